@@ -0,0 +1,438 @@
+// *****************************************************************************
+// *****************************************************************************
+// Copyright 2013-2014, Cadence Design Systems
+// 
+// This  file  is  part  of  the  Cadence  LEF/DEF  Open   Source
+// Distribution,  Product Version 5.8. 
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+//    implied. See the License for the specific language governing
+//    permissions and limitations under the License.
+// 
+// For updates, support, or to become part of the LEF/DEF Community,
+// check www.openeda.org for details.
+// 
+//  $Author$
+//  $Revision$
+//  $Date$
+//  $State:  $
+// *****************************************************************************
+// *****************************************************************************
+
+// defbench reads a DEF file with one callback configuration and appends
+// the throughput of the read, in total and per section, as one JSON
+// line to a results file, so that the speed of the reader can be
+// tracked over time.
+//
+//   none        only the section start and end callbacks
+//   components  the component callback
+//   nets        the net callback with defrSetAddPathToNet
+//   full        the callbacks of all the objects, like defrw
+//
+// The bytes, tokens and objects of every section are counted by a scan
+// of the file before the timed read; the time of a section is taken
+// between its start and end callbacks, and the peak RSS at its end.
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#ifndef WIN32
+#   include <sys/time.h>
+#   include <sys/resource.h>
+#endif /* not WIN32 */
+#include "defrReader.hpp"
+#include "defwbench.hpp"
+
+struct benchSection {
+  const char*        name;         // keyword starting the section
+  defrCallbackType_e start;
+  defrCallbackType_e end;
+  long long          bytes;
+  long long          tokens;
+  long long          objects;      // statements starting with "-"
+  double             startTime;
+  double             seconds;
+  long               peakRss;      // KB
+  int                found;
+};
+
+// The first entry is everything outside of the sections.
+static benchSection sections[] = {
+  { "HEADER", defrUnspecifiedCbkType, defrUnspecifiedCbkType },
+  { "PROPERTYDEFINITIONS", defrPropDefStartCbkType, defrPropDefEndCbkType },
+  { "VIAS", defrViaStartCbkType, defrViaEndCbkType },
+  { "STYLES", defrStylesStartCbkType, defrStylesEndCbkType },
+  { "NONDEFAULTRULES", defrNonDefaultStartCbkType, defrNonDefaultEndCbkType },
+  { "REGIONS", defrRegionStartCbkType, defrRegionEndCbkType },
+  { "COMPONENTS", defrComponentStartCbkType, defrComponentEndCbkType },
+  { "PINS", defrStartPinsCbkType, defrPinEndCbkType },
+  { "PINPROPERTIES", defrPinPropStartCbkType, defrPinPropEndCbkType },
+  { "BLOCKAGES", defrBlockageStartCbkType, defrBlockageEndCbkType },
+  { "SLOTS", defrSlotStartCbkType, defrSlotEndCbkType },
+  { "FILLS", defrFillStartCbkType, defrFillEndCbkType },
+  { "SPECIALNETS", defrSNetStartCbkType, defrSNetEndCbkType },
+  { "NETS", defrNetStartCbkType, defrNetEndCbkType },
+  { "SCANCHAINS", defrScanchainsStartCbkType, defrScanchainsEndCbkType },
+  { "GROUPS", defrGroupsStartCbkType, defrGroupsEndCbkType },
+  { "IOTIMINGS", defrIOTimingsStartCbkType, defrIOTimingsEndCbkType },
+  { "FLOORPLANCONSTRAINTS", defrFPCStartCbkType, defrFPCEndCbkType },
+  { "TIMINGDISABLES", defrTimingDisablesStartCbkType,
+    defrTimingDisablesEndCbkType },
+  { "PARTITIONS", defrPartitionsStartCbkType, defrPartitionsEndCbkType },
+  { "ASSERTIONS", defrAssertionsStartCbkType, defrAssertionsEndCbkType },
+  { "CONSTRAINTS", defrConstraintsStartCbkType, defrConstraintsEndCbkType }
+};
+#define NUM_SECTIONS ((int) (sizeof(sections) / sizeof(sections[0])))
+
+static long long numCallbacks = 0;
+
+static double now() {
+#ifndef WIN32
+  struct timeval tv;
+  gettimeofday(&tv, 0);
+  return tv.tv_sec + tv.tv_usec * 1e-6;
+#else
+  return (double) clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+static long peakRss() {
+#ifndef WIN32
+  struct rusage ru;
+  getrusage(RUSAGE_SELF, &ru);
+  return ru.ru_maxrss;
+#else
+  return 0;
+#endif
+}
+
+static int findSection(const char* word, int len) {
+  for (int i = 1; i < NUM_SECTIONS; i++)
+    if ((int) strlen(sections[i].name) == len &&
+        strncmp(sections[i].name, word, len) == 0)
+      return i;
+  return -1;
+}
+
+// Counts the bytes, tokens and objects of every section.
+static int scanFile(const char* fileName) {
+  FILE*     f = fopen(fileName, "rb");
+  char      buf[65536];
+  char      words[2][32];        // the first two words of the line
+  int       wordLen[2] = { 0, 0 };
+  int       wordNum = 0, inWord = 0, lineEnd = 0;
+  int       cur = 0;              // current section
+  size_t    n, i;
+
+  if (f == 0) {
+    fprintf(stderr, "ERROR: could not open input file '%s'\n", fileName);
+    return 1;
+  }
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+    for (i = 0; i < n; i++) {
+      char c = buf[i];
+
+      sections[cur].bytes++;
+      if (c == ' ' || c == '\t' || c == '\r' || c == '\n') {
+        if (inWord) {
+          // a complete word
+          if (wordNum == 1 && wordLen[0] == 1 && words[0][0] == '-')
+            sections[cur].objects++;
+          if (wordNum == 1 && cur == 0) {
+            int s = findSection(words[0], wordLen[0]);
+            if (s > 0) {
+              // move the bytes and the token of the keyword
+              sections[0].bytes -= wordLen[0] + 1;
+              sections[0].tokens--;
+              cur = s;
+              sections[cur].bytes += wordLen[0] + 1;
+              sections[cur].tokens++;
+              sections[cur].found = 1;
+            }
+          } else if (wordNum == 2 && cur > 0 && wordLen[0] == 3 &&
+                     strncmp(words[0], "END", 3) == 0 &&
+                     findSection(words[1], wordLen[1]) == cur) {
+            lineEnd = 1;
+          }
+          inWord = 0;
+        }
+        if (c == '\n') {
+          if (lineEnd)
+            cur = 0;
+          lineEnd = 0;
+          wordNum = 0;
+        }
+      } else {
+        if (!inWord) {
+          sections[cur].tokens++;
+          if (wordNum < 2)
+            wordLen[wordNum] = 0;
+          wordNum++;
+          inWord = 1;
+        }
+        if (wordNum <= 2 && wordLen[wordNum - 1] < 31)
+          words[wordNum - 1][wordLen[wordNum - 1]++] = c;
+      }
+    }
+  }
+  fclose(f);
+  return 0;
+}
+
+static int sectionOf(defrCallbackType_e c, int start) {
+  for (int i = 1; i < NUM_SECTIONS; i++)
+    if ((start ? sections[i].start : sections[i].end) == c)
+      return i;
+  return 0;
+}
+
+static void startSection(defrCallbackType_e c) {
+  int s = sectionOf(c, 1);
+  if (s)
+    sections[s].startTime = now();
+}
+
+static int startInt(defrCallbackType_e c, int n, defiUserData ud) {
+  startSection(c);
+  return 0;
+}
+
+static int startVoid(defrCallbackType_e c, void* v, defiUserData ud) {
+  startSection(c);
+  return 0;
+}
+
+static int endVoid(defrCallbackType_e c, void* v, defiUserData ud) {
+  int s = sectionOf(c, 0);
+  if (s) {
+    sections[s].seconds += now() - sections[s].startTime;
+    sections[s].peakRss = peakRss();
+  }
+  return 0;
+}
+
+// The object callbacks only count.
+static int count(defrCallbackType_e c, void* v, defiUserData ud) {
+  numCallbacks++;
+  return 0;
+}
+
+static void setCallbacks(const char* config) {
+  defrSetPropDefStartCbk(startVoid);
+  defrSetPropDefEndCbk(endVoid);
+  defrSetViaStartCbk(startInt);
+  defrSetViaEndCbk(endVoid);
+  defrSetStylesStartCbk(startInt);
+  defrSetStylesEndCbk(endVoid);
+  defrSetNonDefaultStartCbk(startInt);
+  defrSetNonDefaultEndCbk(endVoid);
+  defrSetRegionStartCbk(startInt);
+  defrSetRegionEndCbk(endVoid);
+  defrSetComponentStartCbk(startInt);
+  defrSetComponentEndCbk(endVoid);
+  defrSetStartPinsCbk(startInt);
+  defrSetPinEndCbk(endVoid);
+  defrSetPinPropStartCbk(startInt);
+  defrSetPinPropEndCbk(endVoid);
+  defrSetBlockageStartCbk(startInt);
+  defrSetBlockageEndCbk(endVoid);
+  defrSetSlotStartCbk(startInt);
+  defrSetSlotEndCbk(endVoid);
+  defrSetFillStartCbk(startInt);
+  defrSetFillEndCbk(endVoid);
+  defrSetSNetStartCbk(startInt);
+  defrSetSNetEndCbk(endVoid);
+  defrSetNetStartCbk(startInt);
+  defrSetNetEndCbk(endVoid);
+  defrSetScanchainsStartCbk(startInt);
+  defrSetScanchainsEndCbk(endVoid);
+  defrSetGroupsStartCbk(startInt);
+  defrSetGroupsEndCbk(endVoid);
+  defrSetIOTimingsStartCbk(startInt);
+  defrSetIOTimingsEndCbk(endVoid);
+  defrSetFPCStartCbk(startInt);
+  defrSetFPCEndCbk(endVoid);
+  defrSetTimingDisablesStartCbk(startInt);
+  defrSetTimingDisablesEndCbk(endVoid);
+  defrSetPartitionsStartCbk(startInt);
+  defrSetPartitionsEndCbk(endVoid);
+  defrSetAssertionsStartCbk(startInt);
+  defrSetAssertionsEndCbk(endVoid);
+  defrSetConstraintsStartCbk(startInt);
+  defrSetConstraintsEndCbk(endVoid);
+
+  if (strcmp(config, "components") == 0 || strcmp(config, "full") == 0)
+    defrSetComponentCbk((defrComponentCbkFnType)count);
+  if (strcmp(config, "nets") == 0 || strcmp(config, "full") == 0) {
+    defrSetNetCbk((defrNetCbkFnType)count);
+    defrSetAddPathToNet();
+  }
+  if (strcmp(config, "full") == 0) {
+    defrSetSNetCbk((defrNetCbkFnType)count);
+    defrSetPinCbk((defrPinCbkFnType)count);
+    defrSetViaCbk((defrViaCbkFnType)count);
+    defrSetRowCbk((defrRowCbkFnType)count);
+    defrSetTrackCbk((defrTrackCbkFnType)count);
+    defrSetGcellGridCbk((defrGcellGridCbkFnType)count);
+    defrSetPropCbk((defrPropCbkFnType)count);
+    defrSetRegionCbk((defrRegionCbkFnType)count);
+    defrSetGroupCbk((defrGroupCbkFnType)count);
+    defrSetScanchainCbk((defrScanchainCbkFnType)count);
+    defrSetIOTimingCbk((defrIOTimingCbkFnType)count);
+    defrSetFPCCbk((defrFPCCbkFnType)count);
+    defrSetTimingDisableCbk((defrTimingDisableCbkFnType)count);
+    defrSetPartitionCbk((defrPartitionCbkFnType)count);
+    defrSetBlockageCbk((defrBlockageCbkFnType)count);
+    defrSetSlotCbk((defrSlotCbkFnType)count);
+    defrSetFillCbk((defrFillCbkFnType)count);
+    defrSetNonDefaultCbk((defrNonDefaultCbkFnType)count);
+    defrSetStylesCbk((defrStylesCbkFnType)count);
+    defrSetPinPropCbk((defrPinPropCbkFnType)count);
+    defrSetDieAreaCbk((defrBoxCbkFnType)count);
+    defrSetAssertionCbk((defrAssertionCbkFnType)count);
+    defrSetConstraintCbk((defrAssertionCbkFnType)count);
+  }
+}
+
+static double rate(double amount, double seconds) {
+  return seconds > 0 ? amount / seconds : 0;
+}
+
+static void writeRates(FILE* out, long long bytes, long long tokens,
+                       long long objects, double seconds, long rss) {
+  fprintf(out, "\"bytes\": %lld, \"tokens\": %lld, \"objects\": %lld, "
+          "\"seconds\": %.6f, \"MBps\": %.3f, \"tokensPerSec\": %.0f, "
+          "\"objectsPerSec\": %.0f, \"peakRssKB\": %ld",
+          bytes, tokens, objects, seconds, rate(bytes / 1e6, seconds),
+          rate((double) tokens, seconds), rate((double) objects, seconds),
+          rss);
+}
+
+// -profile: the reader's own counters of every section, and with -alloc
+// the memory held by type.
+static void profileCB(const defiProfile* p, defiUserData) {
+  p->print(stderr);
+  if (defrGetAllocStats())
+    defrGetAllocStats()->print(stderr);
+}
+
+int main(int argc, char** argv) {
+  const char* config = "full";
+  const char* inFile = 0;
+  const char* outFile = 0;
+  FILE*       f;
+  FILE*       out = stdout;
+  long long   bytes = 0, tokens = 0, objects = 0;
+  double      start, seconds, inSections = 0;
+  char        stamp[32];
+  time_t      t = time(0);
+  const char* traceFile = 0;
+  int         profile = 0;
+  int         alloc = 0;
+  int         i, res;
+
+  if (argc > 1 && strcmp(argv[1], "-write") == 0)
+    return defwBenchMain(argc - 1, argv + 1);
+
+  for (i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-config") == 0 && i + 1 < argc)
+      config = argv[++i];
+    else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+      outFile = argv[++i];
+    else if (strcmp(argv[i], "-profile") == 0)
+      profile = 1;
+    else if (strcmp(argv[i], "-alloc") == 0)
+      alloc = 1;
+    else if (strcmp(argv[i], "-trace") == 0 && i + 1 < argc)
+      traceFile = argv[++i];
+    else if (argv[i][0] != '-' && !inFile)
+      inFile = argv[i];
+    else {
+      fprintf(stderr, "Usage: defbench [-config none|components|nets|full] "
+              "[-o results.json] [-profile [-alloc]] [-trace trace.json] "
+              "defFile\n");
+      return 2;
+    }
+  }
+  if (!inFile || (strcmp(config, "none") && strcmp(config, "components") &&
+                  strcmp(config, "nets") && strcmp(config, "full"))) {
+    fprintf(stderr, "Usage: defbench [-config none|components|nets|full] "
+            "[-o results.json] [-profile [-alloc]] [-trace trace.json] "
+            "defFile\n");
+    return 2;
+  }
+
+  if (scanFile(inFile))
+    return 2;
+
+  defrInit();
+  setCallbacks(config);
+  if (profile)
+    defrSetProfileCallback(profileCB);
+  if (alloc)
+    defrSetAllocAccounting();
+  if (traceFile && defiTraceOpen(traceFile)) {
+    fprintf(stderr, "ERROR: could not open trace file '%s'\n", traceFile);
+    return 2;
+  }
+  if ((f = fopen(inFile, "r")) == 0) {
+    fprintf(stderr, "ERROR: could not open input file '%s'\n", inFile);
+    return 2;
+  }
+  start = now();
+  res = defrRead(f, inFile, 0, 1);
+  seconds = now() - start;
+  fclose(f);
+  defrClear();
+  if (traceFile)
+    defiTraceClose();
+  if (res) {
+    fprintf(stderr, "ERROR: reading '%s' failed\n", inFile);
+    return 1;
+  }
+
+  for (i = 0; i < NUM_SECTIONS; i++) {
+    bytes += sections[i].bytes;
+    tokens += sections[i].tokens;
+    objects += sections[i].objects;
+    if (i)
+      inSections += sections[i].seconds;
+  }
+  sections[0].seconds = seconds - inSections;
+  sections[0].peakRss = peakRss();
+  sections[0].found = 1;
+
+  if (outFile && (out = fopen(outFile, "a")) == 0) {
+    fprintf(stderr, "ERROR: could not open output file '%s'\n", outFile);
+    return 2;
+  }
+  strftime(stamp, sizeof(stamp), "%Y-%m-%dT%H:%M:%SZ", gmtime(&t));
+  fprintf(out, "{\"date\": \"%s\", \"input\": \"%s\", \"config\": \"%s\", "
+          "\"callbacks\": %lld, ", stamp, inFile, config, numCallbacks);
+  writeRates(out, bytes, tokens, objects, seconds, peakRss());
+  fprintf(out, ", \"sections\": [");
+  for (i = 0; i < NUM_SECTIONS; i++) {
+    benchSection& s = sections[i];
+    if (!s.found)
+      continue;
+    fprintf(out, "%s{\"name\": \"%s\", ", i ? ", " : "", s.name);
+    writeRates(out, s.bytes, s.tokens, s.objects, s.seconds, s.peakRss);
+    fprintf(out, "}");
+  }
+  fprintf(out, "]}\n");
+  if (out != stdout)
+    fclose(out);
+
+  fprintf(stderr, "%s %s: %.1f MB in %.3f s, %.1f MB/s\n", inFile, config,
+          bytes / 1e6, seconds, rate(bytes / 1e6, seconds));
+  return 0;
+}
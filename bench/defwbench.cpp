@@ -0,0 +1,473 @@
+// *****************************************************************************
+// *****************************************************************************
+// Copyright 2013-2014, Cadence Design Systems
+// 
+// This  file  is  part  of  the  Cadence  LEF/DEF  Open   Source
+// Distribution,  Product Version 5.8. 
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+//    implied. See the License for the specific language governing
+//    permissions and limitations under the License.
+// 
+// For updates, support, or to become part of the LEF/DEF Community,
+// check www.openeda.org for details.
+// 
+//  $Author$
+//  $Revision$
+//  $Date$
+//  $State:  $
+// *****************************************************************************
+// *****************************************************************************
+
+// The writer benchmark writes the same generated design through every
+// output sink and appends, for each sink, the time and MB/s of the
+// COMPONENTS, SPECIALNETS and NETS sections and of the whole file as one
+// JSON line to the results file.  The design is made in memory before
+// the timing starts, so only the defw calls and the sink are measured.
+//
+//   null      formatting only, the output is counted and dropped
+//   memory    defwSetMemorySink
+//   file      stdio FILE*
+//   buffered  FILE* with a 1 MB defwSetOutputBufferSize buffer
+//   fd        defwSetFdSink with a 1 MB buffer
+//   fdwritev  defwSetFdSink using writev with a 1 MB buffer
+//   gzip      defwGZipOpen
+//   gzipN     defwGZipOpenParallel with -threads threads
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#ifndef WIN32
+#   include <unistd.h>
+#   include <sys/time.h>
+#endif /* not WIN32 */
+#include "defwWriter.hpp"
+#include "defiTrace.hpp"
+#include "defzlib.hpp"
+#include "defwbench.hpp"
+
+#define ROW_HEIGHT 2000
+#define SLOT_WIDTH 800
+
+enum {
+  SEC_HEADER = 0,
+  SEC_COMPONENTS,
+  SEC_SPECIALNETS,
+  SEC_NETS,
+  SEC_END,
+  NUM_SEC
+};
+
+static const char* secNames[NUM_SEC] = {
+  "HEADER", "COMPONENTS", "SPECIALNETS", "NETS", "END"
+};
+
+// The generated design.
+struct wbenchDesign {
+  int     numInsts;
+  int     perRow;
+  char*   names;         // numInsts names of 16 bytes
+  int*    x;
+  int*    y;
+  int*    driver;        // per net, numInsts nets
+  int*    sink1;
+  int*    sink2;
+  int     numRects;      // special net rects per net
+};
+
+static long long countBytes = 0;
+
+static size_t countWrite(FILE* f, const char* data, size_t len) {
+  countBytes += len;
+  return len;
+}
+
+static double now() {
+#ifndef WIN32
+  struct timeval tv;
+  gettimeofday(&tv, 0);
+  return tv.tv_sec + tv.tv_usec * 1e-6;
+#else
+  return (double) clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+static unsigned long long next(unsigned long long* state) {
+  unsigned long long h = (*state += 0x9e3779b97f4a7c15ULL);
+  h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+  return h ^ (h >> 31);
+}
+
+static void makeDesign(wbenchDesign* d, int numInsts) {
+  unsigned long long state = 1;
+  int                i;
+
+  d->numInsts = numInsts;
+  d->perRow = 1;
+  while ((long long) d->perRow * d->perRow * SLOT_WIDTH <
+         (long long) numInsts * ROW_HEIGHT)
+    d->perRow++;
+  d->names = (char*) malloc(16 * (size_t) numInsts);
+  d->x = (int*) malloc(sizeof(int) * numInsts);
+  d->y = (int*) malloc(sizeof(int) * numInsts);
+  d->driver = (int*) malloc(sizeof(int) * numInsts);
+  d->sink1 = (int*) malloc(sizeof(int) * numInsts);
+  d->sink2 = (int*) malloc(sizeof(int) * numInsts);
+  for (i = 0; i < numInsts; i++) {
+    sprintf(d->names + 16 * (size_t) i, "u%d", i);
+    d->x[i] = (i % d->perRow) * SLOT_WIDTH;
+    d->y[i] = (i / d->perRow) * ROW_HEIGHT;
+    d->driver[i] = (int) (next(&state) % numInsts);
+    d->sink1[i] = (int) ((d->driver[i] + 1 + next(&state) % (2 * d->perRow))
+                         % numInsts);
+    d->sink2[i] = (int) (next(&state) % numInsts);
+  }
+  d->numRects = numInsts / 20 + 1;
+}
+
+static const char* instName(const wbenchDesign* d, int i) {
+  return d->names + 16 * (size_t) i;
+}
+
+#define CHECK_STATUS(status) \
+  if (status) {              \
+     defwPrintError(status); \
+     return(status);         \
+  }
+
+static int writeComponents(const wbenchDesign* d) {
+  int i, status;
+
+  status = defwStartComponents(d->numInsts);
+  CHECK_STATUS(status);
+  for (i = 0; i < d->numInsts; i++) {
+    status = defwComponent(instName(d, i), i % 3 ? "NAND2_X1" : "INV_X1",
+                           0, NULL, NULL, NULL, NULL, NULL, 0, NULL, NULL,
+                           NULL, NULL, "PLACED", d->x[i], d->y[i],
+                           (d->y[i] / ROW_HEIGHT) % 2 ? 6 : 0, 0, NULL,
+                           0, 0, 0, 0);
+    CHECK_STATUS(status);
+  }
+  return defwEndComponents();
+}
+
+// Power grid of rects: a followpin rect per row and a stripe rect every
+// 25 slots, over and over up to numRects rects per net.
+static int writeSpecialNets(const wbenchDesign* d) {
+  const char* nets[2] = { "VDD", "VSS" };
+  int         width = d->perRow * SLOT_WIDTH;
+  int         rows = (d->numInsts + d->perRow - 1) / d->perRow;
+  int         n, i, status;
+
+  status = defwStartSpecialNets(2);
+  CHECK_STATUS(status);
+  for (n = 0; n < 2; n++) {
+    status = defwSpecialNet(nets[n]);
+    CHECK_STATUS(status);
+    status = defwSpecialNetConnection("*", nets[n], 0);
+    CHECK_STATUS(status);
+    for (i = 0; i < d->numRects; i++) {
+      if (i % 2) {
+        int x = ((i / 2) * 25 * SLOT_WIDTH + n * 12 * SLOT_WIDTH) % width;
+        status = defwSpecialNetRect("M4", x - 500, 0, x + 500,
+                                    rows * ROW_HEIGHT);
+      } else {
+        int y = ((i / 2) * 2 + n) % (rows + 1) * ROW_HEIGHT;
+        status = defwSpecialNetRect("M1", 0, y - 120, width, y + 120);
+      }
+      CHECK_STATUS(status);
+    }
+    status = defwSpecialNetEndOneNet();
+    CHECK_STATUS(status);
+  }
+  return defwEndSpecialNets();
+}
+
+// Three pin nets routed with an L from the driver to each sink.
+static int writeNets(const wbenchDesign* d) {
+  char   name[32];
+  double px[3], py[3];
+  int    i, k, status;
+
+  status = defwStartNets(d->numInsts);
+  CHECK_STATUS(status);
+  for (i = 0; i < d->numInsts; i++) {
+    int pins[3] = { d->driver[i], d->sink1[i], d->sink2[i] };
+
+    sprintf(name, "n%d", i);
+    status = defwNet(name);
+    CHECK_STATUS(status);
+    status = defwNetConnection(instName(d, pins[0]), "Z", 0);
+    CHECK_STATUS(status);
+    status = defwNetConnection(instName(d, pins[1]), "A1", 0);
+    CHECK_STATUS(status);
+    status = defwNetConnection(instName(d, pins[2]), "A2", 0);
+    CHECK_STATUS(status);
+    for (k = 1; k < 3; k++) {
+      status = defwNetPathStart(k == 1 ? "ROUTED" : "NEW");
+      CHECK_STATUS(status);
+      status = defwNetPathLayer("M2", 0, NULL);
+      CHECK_STATUS(status);
+      px[0] = d->x[pins[0]] + 100;
+      py[0] = d->y[pins[0]] + 1000;
+      px[1] = d->x[pins[k]] + 300;
+      py[1] = py[0];
+      px[2] = px[1];
+      py[2] = d->y[pins[k]] + 1000;
+      status = defwNetPathPoint(3, px, py);
+      CHECK_STATUS(status);
+      status = defwNetPathVia("VIA12");
+      CHECK_STATUS(status);
+    }
+    status = defwNetPathEnd();
+    CHECK_STATUS(status);
+    status = defwNetEndOneNet();
+    CHECK_STATUS(status);
+  }
+  return defwEndNets();
+}
+
+struct wbenchResult {
+  double    seconds[NUM_SEC];
+  long long bytes[NUM_SEC];      // DEF bytes, from the null sink
+  long long outputBytes;
+};
+
+// Writes the design through one sink.
+static int writeDesign(const wbenchDesign* d, const char* sink,
+                       const char* tmpFile, int numThreads,
+                       wbenchResult* r) {
+  defwContext* ctx = defwNewContext();
+  defwContext* prev = defwSetContext(ctx);
+  FILE*        f = 0;
+  defwGZFile   gz = 0;
+  int          fd = -1;
+  double       t;
+  int          status = 0;
+  struct stat  st;
+
+  memset(r->seconds, 0, sizeof(r->seconds));
+  r->outputBytes = 0;
+  t = now();
+
+  if (strcmp(sink, "null") == 0) {
+    countBytes = 0;
+    defwSetWriteFunction(countWrite);
+  } else if (strcmp(sink, "memory") == 0) {
+    defwSetMemorySink();
+  } else if (strcmp(sink, "file") == 0 || strcmp(sink, "buffered") == 0) {
+    f = fopen(tmpFile, "w");
+    if (f && strcmp(sink, "buffered") == 0)
+      defwSetOutputBufferSize(1 << 20);
+#ifndef WIN32
+  } else if (strcmp(sink, "fd") == 0 || strcmp(sink, "fdwritev") == 0) {
+    fd = open(tmpFile, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd >= 0) {
+      defwSetFdSink(fd, strcmp(sink, "fdwritev") == 0);
+      defwSetOutputBufferSize(1 << 20);
+    }
+#endif
+  } else if (strcmp(sink, "gzip") == 0) {
+    gz = defwGZipOpen(tmpFile, "wb");
+  } else if (strcmp(sink, "gzipN") == 0) {
+    gz = defwGZipOpenParallel(tmpFile, -1, numThreads, 1 << 20);
+  } else {
+    fprintf(stderr, "ERROR: unknown sink '%s'\n", sink);
+    status = 1;
+  }
+  if (!status && !f && fd < 0 && !gz && strcmp(sink, "null") &&
+      strcmp(sink, "memory")) {
+    fprintf(stderr, "ERROR: could not open '%s'\n", tmpFile);
+    status = 1;
+  }
+
+  if (!status)
+    status = defwInit(gz ? (FILE*) gz : f, 5, 8, NULL, "/", "[]",
+                      "wbench", NULL, NULL, NULL, 1000);
+  if (!status) {
+    status = defwStartVias(1);
+    if (!status) status = defwViaName("VIA12");
+    if (!status) status = defwViaRect("M1", -100, -70, 100, 70);
+    if (!status) status = defwViaRect("V1", -50, -50, 50, 50);
+    if (!status) status = defwViaRect("M2", -70, -100, 70, 100);
+    if (!status) status = defwOneViaEnd();
+    if (!status) status = defwEndVias();
+  }
+  r->seconds[SEC_HEADER] = now() - t;
+  r->bytes[SEC_HEADER] = countBytes;
+
+  if (!status) {
+    t = now();
+    status = writeComponents(d);
+    r->seconds[SEC_COMPONENTS] = now() - t;
+    r->bytes[SEC_COMPONENTS] = countBytes;
+  }
+  if (!status) {
+    t = now();
+    status = writeSpecialNets(d);
+    r->seconds[SEC_SPECIALNETS] = now() - t;
+    r->bytes[SEC_SPECIALNETS] = countBytes;
+  }
+  if (!status) {
+    t = now();
+    status = writeNets(d);
+    r->seconds[SEC_NETS] = now() - t;
+    r->bytes[SEC_NETS] = countBytes;
+  }
+
+  // the end includes flushing and closing the sink
+  t = now();
+  if (!status)
+    status = defwEnd();
+  if (strcmp(sink, "memory") == 0) {
+    size_t size;
+    defwMemorySinkData(&size);
+    r->outputBytes = size;
+  }
+  if (gz)
+    defwGZipClose(gz);
+  defwSetContext(prev);
+  defwDeleteContext(ctx);
+  if (f)
+    fclose(f);
+#ifndef WIN32
+  if (fd >= 0)
+    close(fd);
+#endif
+  r->seconds[SEC_END] = now() - t;
+  r->bytes[SEC_END] = countBytes;
+  if (strcmp(sink, "null") == 0)
+    r->outputBytes = countBytes;
+  else if ((f || fd >= 0 || gz) && stat(tmpFile, &st) == 0)
+    r->outputBytes = st.st_size;
+  remove(tmpFile);
+  return status;
+}
+
+static double rate(double amount, double seconds) {
+  return seconds > 0 ? amount / seconds : 0;
+}
+
+int defwBenchMain(int argc, char** argv) {
+  const char*  sinks = "null,memory,file,buffered,fd,fdwritev,gzip,gzipN";
+  const char*  outFile = 0;
+  const char*  tmpFile = "wbench.tmp";
+  const char*  traceFile = 0;
+  int          numInsts = 200000;
+  int          numThreads = 4;
+  long long    secBytes[NUM_SEC];
+  long long    defBytes;
+  wbenchDesign d;
+  wbenchResult r;
+  FILE*        out = stdout;
+  char         stamp[32];
+  char         sink[32];
+  time_t       now0 = time(0);
+  const char*  p;
+  int          i;
+
+  for (i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-insts") == 0 && i + 1 < argc)
+      numInsts = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-sinks") == 0 && i + 1 < argc)
+      sinks = argv[++i];
+    else if (strcmp(argv[i], "-threads") == 0 && i + 1 < argc)
+      numThreads = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-tmp") == 0 && i + 1 < argc)
+      tmpFile = argv[++i];
+    else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+      outFile = argv[++i];
+    else if (strcmp(argv[i], "-trace") == 0 && i + 1 < argc)
+      traceFile = argv[++i];
+    else {
+      fprintf(stderr, "Usage: defbench -write [-insts n] [-sinks a,b,...] "
+              "[-threads n] [-tmp file] [-o results.json] "
+              "[-trace trace.json]\n");
+      return 2;
+    }
+  }
+  if (numInsts < 2) {
+    fprintf(stderr, "ERROR: need -insts >= 2\n");
+    return 2;
+  }
+
+  makeDesign(&d, numInsts);
+
+  // the bytes per section, with the null sink
+  if (writeDesign(&d, "null", tmpFile, numThreads, &r))
+    return 1;
+  for (i = 0; i < NUM_SEC; i++)
+    secBytes[i] = r.bytes[i] - (i ? r.bytes[i - 1] : 0);
+  defBytes = r.outputBytes;
+
+  if (outFile && (out = fopen(outFile, "a")) == 0) {
+    fprintf(stderr, "ERROR: could not open output file '%s'\n", outFile);
+    return 2;
+  }
+  strftime(stamp, sizeof(stamp), "%Y-%m-%dT%H:%M:%SZ", gmtime(&now0));
+  if (traceFile && defiTraceOpen(traceFile)) {
+    fprintf(stderr, "ERROR: could not open trace file '%s'\n", traceFile);
+    return 2;
+  }
+
+  for (p = sinks; *p; ) {
+    size_t len = strcspn(p, ",");
+    double total = 0;
+
+    if (len >= sizeof(sink))
+      len = sizeof(sink) - 1;
+    strncpy(sink, p, len);
+    sink[len] = 0;
+    p += len;
+    if (*p == ',')
+      p++;
+    if (!len)
+      continue;
+
+    if (writeDesign(&d, sink, tmpFile, numThreads, &r)) {
+      fprintf(stderr, "ERROR: writing with sink '%s' failed\n", sink);
+      continue;
+    }
+    for (i = 0; i < NUM_SEC; i++)
+      total += r.seconds[i];
+
+    fprintf(out, "{\"date\": \"%s\", \"benchmark\": \"write\", "
+            "\"insts\": %d, \"sink\": \"%s\", \"bytes\": %lld, "
+            "\"outputBytes\": %lld, \"seconds\": %.6f, \"MBps\": %.3f, "
+            "\"sections\": [", stamp, numInsts, sink, defBytes,
+            r.outputBytes, total, rate(defBytes / 1e6, total));
+    for (i = 0; i < NUM_SEC; i++)
+      fprintf(out, "%s{\"name\": \"%s\", \"bytes\": %lld, "
+              "\"seconds\": %.6f, \"MBps\": %.3f}", i ? ", " : "",
+              secNames[i], secBytes[i], r.seconds[i],
+              rate(secBytes[i] / 1e6, r.seconds[i]));
+    fprintf(out, "]}\n");
+    fflush(out);
+    fprintf(stderr, "write %s: %.1f MB in %.3f s, %.1f MB/s\n", sink,
+            defBytes / 1e6, total, rate(defBytes / 1e6, total));
+  }
+  if (out != stdout)
+    fclose(out);
+  if (traceFile)
+    defiTraceClose();
+
+  free(d.names);
+  free(d.x);
+  free(d.y);
+  free(d.driver);
+  free(d.sink1);
+  free(d.sink2);
+  return 0;
+}
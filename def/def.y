@@ -86,11 +86,23 @@ extern void pathIsDone(int shield, int reset, int netOsnet, int *needCbk);
 // If the function was set then call it.
 // If the function returns non zero then there was an error
 // so call the error routine and exit.
+// When profiling, the time spent in the callback is recorded; when
+// tracing, a span is recorded for a sample of the callbacks.
 //
 #define CALLBACK(func, typ, data) \
     if (!defData->errors) {\
       if (func) { \
-        if ((defData->defRetVal = (*func)(typ, data, defSettings->UserData)) == PARSE_OK) { \
+        if (defSettings->ProfileFunction || defiTraceOn) { \
+          int    traced = defiTraceOn && defiTraceSampleCallback(); \
+          double profStart = defiProfile::clock(); \
+          defData->defRetVal = (*func)(typ, data, defSettings->UserData); \
+          if (defSettings->ProfileFunction) \
+            defData->Profile.addCallbackTime(defiProfile::clock() - profStart); \
+          if (traced) \
+            defiTraceSpan("read", "callback", profStart, "type", typ); \
+        } else \
+          defData->defRetVal = (*func)(typ, data, defSettings->UserData); \
+        if (defData->defRetVal == PARSE_OK) { \
         } else if (defData->defRetVal == STOP_PARSE) { \
           return defData->defRetVal; \
         } else { \
@@ -190,7 +202,7 @@ int defValidNum(int values) {
         case 10000:
         case 20000:
              if (defData->VersionNum < 5.6) {
-                if (defCallbacks->UnitsCbk) {
+                if (defCallbacks->UnitsCbk || defData->validating) {
                   if (defData->unitsWarnings++ < defSettings->UnitsWarnings) {
                     outMsg = (char*)defMalloc(1000);
                     sprintf (outMsg,
@@ -206,7 +218,7 @@ int defValidNum(int values) {
                 return 1;
              }
     }
-    if (defCallbacks->UnitsCbk) {
+    if (defCallbacks->UnitsCbk || defData->validating) {
       if (defData->unitsWarnings++ < defSettings->UnitsWarnings) {
         outMsg = (char*)defMalloc(10000);
         sprintf (outMsg,
@@ -225,6 +237,10 @@ int defValidNum(int values) {
 #define UNPLACED 4
 %}
 
+// Reentrant parser: the token value is passed to yylex, so no parser
+// state is shared between threads reading at the same time.
+%define api.pure
+
 %union {
         double dval ;
         int    integer ;
@@ -234,6 +250,10 @@ int defValidNum(int values) {
         LefDefParser::defTOKEN *tk;
 }
 
+%{
+extern int yylex(YYSTYPE *pYylval);
+%}
+
 %token <string>  QSTRING
 %token <string>  T_STRING SITE_PATTERN
 %token <dval>    NUMBER
@@ -352,7 +372,7 @@ case_sens_stmt: // empty
                      defData->names_case_sensitive); 
           defData->hasNameCase = 1;
         } else
-          if (defCallbacks->CaseSensitiveCbk) // write error only if cbk is set 
+          if (defCallbacks->CaseSensitiveCbk || defData->validating) // write error only if cbk is set or validating
              if (defData->caseSensitiveWarnings++ < defSettings->CaseSensitiveWarnings)
                defWarning(7011, "The NAMESCASESENSITIVE statement is obsolete in version 5.6 and later.\nThe DEF parser will ignore this statement.");
       }
@@ -365,7 +385,7 @@ case_sens_stmt: // empty
                      defData->names_case_sensitive);
           defData->hasNameCase = 1;
         } else {
-          if (defCallbacks->CaseSensitiveCbk) { // write error only if cbk is set 
+          if (defCallbacks->CaseSensitiveCbk || defData->validating) { // write error only if cbk is set or validating
             if (defData->caseSensitiveWarnings++ < defSettings->CaseSensitiveWarnings) {
               defError(6504, "Def parser version 5.7 and later does not support NAMESCASESENSITIVE OFF.\nEither remove this optional construct or set it to ON.");
               CHKERR();
@@ -679,7 +699,7 @@ start_def_cap: K_DEFAULTCAP NUMBER
              if (defCallbacks->DefaultCapCbk)
                 CALLBACK(defCallbacks->DefaultCapCbk, defrDefaultCapCbkType, ROUND($2));
           } else {
-             if (defCallbacks->DefaultCapCbk) // write error only if cbk is set 
+             if (defCallbacks->DefaultCapCbk || defData->validating) // write error only if cbk is set or validating
                 if (defData->defaultCapWarnings++ < defSettings->DefaultCapWarnings)
                    defWarning(7017, "The DEFAULTCAP statement is obsolete in version 5.4 and later.\nThe DEF parser will ignore this statement.");
           }
@@ -722,6 +742,8 @@ pin: '-' {defData->dumb_mode = 1; defData->no_num = 1; } T_STRING '+' K_NET
             if (defCallbacks->PinCbk || defCallbacks->PinExtCbk) {
               defData->Pin.Setup($3, $7);
             }
+            if (defSettings->BuildNameIndex)
+              defData->NameIndex.add(defiNamePin, $3);
             defData->hasPort = 0;
           }
         pin_options ';'
@@ -754,7 +776,7 @@ pin_option: '+' K_SPECIAL
         | '+' K_NETEXPR QSTRING
           {
             if (defData->VersionNum < 5.6) {
-              if (defCallbacks->PinCbk || defCallbacks->PinExtCbk) {
+              if (defCallbacks->PinCbk || defCallbacks->PinExtCbk || defData->validating) {
                 if ((defData->pinWarnings++ < defSettings->PinWarnings) &&
                     (defData->pinWarnings++ < defSettings->PinExtWarnings)) {
                   defData->defMsg = (char*)defMalloc(1000);
@@ -775,7 +797,7 @@ pin_option: '+' K_SPECIAL
         | '+' K_SUPPLYSENSITIVITY { defData->dumb_mode = 1; } T_STRING
           {
             if (defData->VersionNum < 5.6) {
-              if (defCallbacks->PinCbk || defCallbacks->PinExtCbk) {
+              if (defCallbacks->PinCbk || defCallbacks->PinExtCbk || defData->validating) {
                 if ((defData->pinWarnings++ < defSettings->PinWarnings) &&
                     (defData->pinWarnings++ < defSettings->PinExtWarnings)) {
                   defData->defMsg = (char*)defMalloc(1000);
@@ -795,7 +817,7 @@ pin_option: '+' K_SPECIAL
         | '+' K_GROUNDSENSITIVITY { defData->dumb_mode = 1; } T_STRING
           {
             if (defData->VersionNum < 5.6) {
-              if (defCallbacks->PinCbk || defCallbacks->PinExtCbk) {
+              if (defCallbacks->PinCbk || defCallbacks->PinExtCbk || defData->validating) {
                 if ((defData->pinWarnings++ < defSettings->PinWarnings) &&
                     (defData->pinWarnings++ < defSettings->PinExtWarnings)) {
                   defData->defMsg = (char*)defMalloc(1000);
@@ -819,7 +841,7 @@ pin_option: '+' K_SPECIAL
         | '+' K_PORT          // 5.7 
           {
             if (defData->VersionNum < 5.7) {
-               if (defCallbacks->PinCbk || defCallbacks->PinExtCbk) {
+               if (defCallbacks->PinCbk || defCallbacks->PinExtCbk || defData->validating) {
                  if ((defData->pinWarnings++ < defSettings->PinWarnings) &&
                      (defData->pinWarnings++ < defSettings->PinExtWarnings)) {
                    defData->defMsg = (char*)defMalloc(10000);
@@ -859,7 +881,7 @@ pin_option: '+' K_SPECIAL
         | '+' K_POLYGON { defData->dumb_mode = 1; } T_STRING
           {
             if (defData->VersionNum < 5.6) {
-              if (defCallbacks->PinCbk || defCallbacks->PinExtCbk) {
+              if (defCallbacks->PinCbk || defCallbacks->PinExtCbk || defData->validating) {
                 if ((defData->pinWarnings++ < defSettings->PinWarnings) &&
                     (defData->pinWarnings++ < defSettings->PinExtWarnings)) {
                   defData->defMsg = (char*)defMalloc(1000);
@@ -895,7 +917,7 @@ pin_option: '+' K_SPECIAL
         | '+' K_VIA { defData->dumb_mode = 1; } T_STRING pin_via_mask_opt '(' NUMBER NUMBER ')'   // 5.7
           {
             if (defData->VersionNum < 5.7) {
-              if (defCallbacks->PinCbk || defCallbacks->PinExtCbk) {
+              if (defCallbacks->PinCbk || defCallbacks->PinExtCbk || defData->validating) {
                 if ((defData->pinWarnings++ < defSettings->PinWarnings) &&
                     (defData->pinWarnings++ < defSettings->PinExtWarnings)) {
                   defData->defMsg = (char*)defMalloc(1000);
@@ -932,7 +954,7 @@ pin_option: '+' K_SPECIAL
         | '+' K_ANTENNAPINPARTIALMETALAREA NUMBER pin_layer_opt
           {
             if (defData->VersionNum <= 5.3) {
-              if (defCallbacks->PinCbk || defCallbacks->PinExtCbk) {
+              if (defCallbacks->PinCbk || defCallbacks->PinExtCbk || defData->validating) {
                 if ((defData->pinWarnings++ < defSettings->PinWarnings) &&
                     (defData->pinWarnings++ < defSettings->PinExtWarnings)) {
                   defData->defMsg = (char*)defMalloc(1000);
@@ -950,7 +972,7 @@ pin_option: '+' K_SPECIAL
         | '+' K_ANTENNAPINPARTIALMETALSIDEAREA NUMBER pin_layer_opt
           {
             if (defData->VersionNum <= 5.3) {
-              if (defCallbacks->PinCbk || defCallbacks->PinExtCbk) {
+              if (defCallbacks->PinCbk || defCallbacks->PinExtCbk || defData->validating) {
                 if ((defData->pinWarnings++ < defSettings->PinWarnings) &&
                     (defData->pinWarnings++ < defSettings->PinExtWarnings)) {
                   defData->defMsg = (char*)defMalloc(1000);
@@ -968,7 +990,7 @@ pin_option: '+' K_SPECIAL
         | '+' K_ANTENNAPINGATEAREA NUMBER pin_layer_opt
           {
             if (defData->VersionNum <= 5.3) {
-              if (defCallbacks->PinCbk || defCallbacks->PinExtCbk) {
+              if (defCallbacks->PinCbk || defCallbacks->PinExtCbk || defData->validating) {
                 if ((defData->pinWarnings++ < defSettings->PinWarnings) &&
                     (defData->pinWarnings++ < defSettings->PinExtWarnings)) {
                   defData->defMsg = (char*)defMalloc(1000);
@@ -986,7 +1008,7 @@ pin_option: '+' K_SPECIAL
         | '+' K_ANTENNAPINDIFFAREA NUMBER pin_layer_opt
           {
             if (defData->VersionNum <= 5.3) {
-              if (defCallbacks->PinCbk || defCallbacks->PinExtCbk) {
+              if (defCallbacks->PinCbk || defCallbacks->PinExtCbk || defData->validating) {
                 if ((defData->pinWarnings++ < defSettings->PinWarnings) &&
                     (defData->pinWarnings++ < defSettings->PinExtWarnings)) {
                   defData->defMsg = (char*)defMalloc(1000);
@@ -1004,7 +1026,7 @@ pin_option: '+' K_SPECIAL
         | '+' K_ANTENNAPINMAXAREACAR NUMBER K_LAYER {defData->dumb_mode=1;} T_STRING
           {
             if (defData->VersionNum <= 5.3) {
-              if (defCallbacks->PinCbk || defCallbacks->PinExtCbk) {
+              if (defCallbacks->PinCbk || defCallbacks->PinExtCbk || defData->validating) {
                 if ((defData->pinWarnings++ < defSettings->PinWarnings) &&
                     (defData->pinWarnings++ < defSettings->PinExtWarnings)) {
                   defData->defMsg = (char*)defMalloc(1000);
@@ -1023,7 +1045,7 @@ pin_option: '+' K_SPECIAL
            T_STRING
           {
             if (defData->VersionNum <= 5.3) {
-              if (defCallbacks->PinCbk || defCallbacks->PinExtCbk) {
+              if (defCallbacks->PinCbk || defCallbacks->PinExtCbk || defData->validating) {
                 if ((defData->pinWarnings++ < defSettings->PinWarnings) &&
                     (defData->pinWarnings++ < defSettings->PinExtWarnings)) {
                   defData->defMsg = (char*)defMalloc(1000);
@@ -1041,7 +1063,7 @@ pin_option: '+' K_SPECIAL
         | '+' K_ANTENNAPINPARTIALCUTAREA NUMBER pin_layer_opt
           {
             if (defData->VersionNum <= 5.3) {
-              if (defCallbacks->PinCbk || defCallbacks->PinExtCbk) {
+              if (defCallbacks->PinCbk || defCallbacks->PinExtCbk || defData->validating) {
                 if ((defData->pinWarnings++ < defSettings->PinWarnings) &&
                     (defData->pinWarnings++ < defSettings->PinExtWarnings)) {
                   defData->defMsg = (char*)defMalloc(1000);
@@ -1059,7 +1081,7 @@ pin_option: '+' K_SPECIAL
         | '+' K_ANTENNAPINMAXCUTCAR NUMBER K_LAYER {defData->dumb_mode=1;} T_STRING
           {
             if (defData->VersionNum <= 5.3) {
-              if (defCallbacks->PinCbk || defCallbacks->PinExtCbk) {
+              if (defCallbacks->PinCbk || defCallbacks->PinExtCbk || defData->validating) {
                 if ((defData->pinWarnings++ < defSettings->PinWarnings) &&
                     (defData->pinWarnings++ < defSettings->PinExtWarnings)) {
                   defData->defMsg = (char*)defMalloc(1000);
@@ -1077,7 +1099,7 @@ pin_option: '+' K_SPECIAL
         | '+' K_ANTENNAMODEL pin_oxide
           {  // 5.5 syntax 
             if (defData->VersionNum < 5.5) {
-              if (defCallbacks->PinCbk || defCallbacks->PinExtCbk) {
+              if (defCallbacks->PinCbk || defCallbacks->PinExtCbk || defData->validating) {
                 if ((defData->pinWarnings++ < defSettings->PinWarnings) &&
                     (defData->pinWarnings++ < defSettings->PinExtWarnings)) {
                   defData->defMsg = (char*)defMalloc(1000);
@@ -1132,7 +1154,7 @@ pin_layer_spacing_opt: // empty
         | K_SPACING NUMBER
           {
             if (defData->VersionNum < 5.6) {
-              if (defCallbacks->PinCbk || defCallbacks->PinExtCbk) {
+              if (defCallbacks->PinCbk || defCallbacks->PinExtCbk || defData->validating) {
                 if ((defData->pinWarnings++ < defSettings->PinWarnings) &&
                     (defData->pinWarnings++ < defSettings->PinExtWarnings)) {
                   defData->defMsg = (char*)defMalloc(1000);
@@ -1155,7 +1177,7 @@ pin_layer_spacing_opt: // empty
         | K_DESIGNRULEWIDTH NUMBER
           {
             if (defData->VersionNum < 5.6) {
-              if (defCallbacks->PinCbk || defCallbacks->PinExtCbk) {
+              if (defCallbacks->PinCbk || defCallbacks->PinExtCbk || defData->validating) {
                 if ((defData->pinWarnings++ < defSettings->PinWarnings) &&
                     (defData->pinWarnings++ < defSettings->PinExtWarnings)) {
                   defData->defMsg = (char*)defMalloc(1000);
@@ -1180,7 +1202,7 @@ pin_poly_spacing_opt: // empty
         | K_SPACING NUMBER
           {
             if (defData->VersionNum < 5.6) {
-              if (defCallbacks->PinCbk || defCallbacks->PinExtCbk) {
+              if (defCallbacks->PinCbk || defCallbacks->PinExtCbk || defData->validating) {
                 if ((defData->pinWarnings++ < defSettings->PinWarnings) &&
                     (defData->pinWarnings++ < defSettings->PinExtWarnings)) {
                   defData->defMsg = (char*)defMalloc(1000);
@@ -1203,7 +1225,7 @@ pin_poly_spacing_opt: // empty
         | K_DESIGNRULEWIDTH NUMBER
           {
             if (defData->VersionNum < 5.6) {
-              if (defCallbacks->PinCbk || defCallbacks->PinExtCbk) {
+              if (defCallbacks->PinCbk || defCallbacks->PinExtCbk || defData->validating) {
                 if ((defData->pinWarnings++ < defSettings->PinWarnings) &&
                     (defData->pinWarnings++ < defSettings->PinExtWarnings)) {
                   defData->defMsg = (char*)defMalloc(1000);
@@ -1277,10 +1299,9 @@ end_pins: K_END K_PINS
 row_rule: K_ROW {defData->dumb_mode = 2; defData->no_num = 2; } T_STRING T_STRING NUMBER NUMBER
       orient
         {
-          if (defCallbacks->RowCbk) {
-            defData->rowName = $3;
+          defData->rowName = $3;
+          if (defCallbacks->RowCbk)
             defData->Row.setup($3, $4, $5, $6, $7);
-          }
         }
       row_do_option
       row_options ';'
@@ -1292,7 +1313,7 @@ row_rule: K_ROW {defData->dumb_mode = 2; defData->no_num = 2; } T_STRING T_STRIN
 row_do_option: // empty 
         {
           if (defData->VersionNum < 5.6) {
-            if (defCallbacks->RowCbk) {
+            if (defCallbacks->RowCbk || defData->validating) {
               if (defData->rowWarnings++ < defSettings->RowWarnings) {
                 defError(6523, "Invalid ROW statement defined in the DEF file. The DO statement which is required in the ROW statement is not defined.\nUpdate your DEF file with a DO statement.");
                 CHKERR();
@@ -1313,7 +1334,7 @@ row_do_option: // empty
               // do nothing 
             } else 
               if (defData->VersionNum < 5.6) {
-                if (defCallbacks->RowCbk) {
+                if (defCallbacks->RowCbk || defData->validating) {
                   if (defData->rowWarnings++ < defSettings->RowWarnings) {
                     defData->defMsg = (char*)defMalloc(1000);
                     sprintf(defData->defMsg,
@@ -1326,7 +1347,7 @@ row_do_option: // empty
           }
           // pcr 459218 - Error if at least numX or numY does not equal 1 
           if (($2 != 1) && ($4 != 1)) {
-            if (defCallbacks->RowCbk) {
+            if (defCallbacks->RowCbk || defData->validating) {
               if (defData->rowWarnings++ < defSettings->RowWarnings) {
                 defError(6524, "Invalid syntax specified. The valid syntax is either \"DO 1 BY num or DO num BY 1\". Specify the valid syntax and try again.");
                 CHKERR();
@@ -1401,7 +1422,7 @@ tracks_rule: track_start NUMBER
         K_DO NUMBER K_STEP NUMBER track_opts ';' 
         {
           if (($5 <= 0) && (defData->VersionNum >= 5.4)) {
-            if (defCallbacks->TrackCbk)
+            if (defCallbacks->TrackCbk || defData->validating)
               if (defData->trackWarnings++ < defSettings->TrackWarnings) {
                 defData->defMsg = (char*)defMalloc(1000);
                 sprintf (defData->defMsg,
@@ -1411,7 +1432,7 @@ tracks_rule: track_start NUMBER
               }
           }
           if ($7 < 0) {
-            if (defCallbacks->TrackCbk)
+            if (defCallbacks->TrackCbk || defData->validating)
               if (defData->trackWarnings++ < defSettings->TrackWarnings) {
                 defData->defMsg = (char*)defMalloc(1000);
                 sprintf (defData->defMsg,
@@ -1472,7 +1493,7 @@ gcellgrid: K_GCELLGRID track_type NUMBER
      K_DO NUMBER K_STEP NUMBER ';'
         {
           if ($5 <= 0) {
-            if (defCallbacks->GcellGridCbk)
+            if (defCallbacks->GcellGridCbk || defData->validating)
               if (defData->gcellGridWarnings++ < defSettings->GcellGridWarnings) {
                 defData->defMsg = (char*)defMalloc(1000);
                 sprintf (defData->defMsg,
@@ -1482,7 +1503,7 @@ gcellgrid: K_GCELLGRID track_type NUMBER
               }
           }
           if ($7 < 0) {
-            if (defCallbacks->GcellGridCbk)
+            if (defCallbacks->GcellGridCbk || defData->validating)
               if (defData->gcellGridWarnings++ < defSettings->GcellGridWarnings) {
                 defData->defMsg = (char*)defMalloc(1000);
                 sprintf (defData->defMsg,
@@ -1545,7 +1566,7 @@ layer_stmt: '+' K_RECT {defData->dumb_mode = 1;defData->no_num = 1; } T_STRING m
         | '+' K_POLYGON { defData->dumb_mode = 1; } T_STRING mask
             {
               if (defData->VersionNum < 5.6) {
-                if (defCallbacks->ViaCbk) {
+                if (defCallbacks->ViaCbk || defData->validating) {
                   if (defData->viaWarnings++ < defSettings->ViaWarnings) {
                     defData->defMsg = (char*)defMalloc(1000);
                     sprintf (defData->defMsg,
@@ -1575,7 +1596,7 @@ layer_stmt: '+' K_RECT {defData->dumb_mode = 1;defData->no_num = 1; } T_STRING m
                 if (defCallbacks->ViaCbk)
                   defData->Via.addPattern($4);
               } else
-                if (defCallbacks->ViaCbk)
+                if (defCallbacks->ViaCbk || defData->validating)
                   if (defData->viaWarnings++ < defSettings->ViaWarnings)
                     defWarning(7019, "The PATTERNNAME statement is obsolete in version 5.6 and later.\nThe DEF parser will ignore this statement."); 
             }
@@ -1587,7 +1608,7 @@ layer_stmt: '+' K_RECT {defData->dumb_mode = 1;defData->no_num = 1; } T_STRING m
             {
                defData->viaRule = 1;
                if (defData->VersionNum < 5.6) {
-                if (defCallbacks->ViaCbk) {
+                if (defCallbacks->ViaCbk || defData->validating) {
                   if (defData->viaWarnings++ < defSettings->ViaWarnings) {
                     defData->defMsg = (char*)defMalloc(1000);
                     sprintf (defData->defMsg,
@@ -1614,7 +1635,7 @@ layer_stmt: '+' K_RECT {defData->dumb_mode = 1;defData->no_num = 1; } T_STRING m
 layer_viarule_opts: '+' K_ROWCOL NUMBER NUMBER
             {
               if (!defData->viaRule) {
-                if (defCallbacks->ViaCbk) {
+                if (defCallbacks->ViaCbk || defData->validating) {
                   if (defData->viaWarnings++ < defSettings->ViaWarnings) {
                     defError (6559, "The ROWCOL statement is missing from the VIARULE statement. Ensure that it exists in the VIARULE statement.");
                     CHKERR();
@@ -1626,7 +1647,7 @@ layer_viarule_opts: '+' K_ROWCOL NUMBER NUMBER
         | '+' K_ORIGIN NUMBER NUMBER
             {
               if (!defData->viaRule) {
-                if (defCallbacks->ViaCbk) {
+                if (defCallbacks->ViaCbk || defData->validating) {
                   if (defData->viaWarnings++ < defSettings->ViaWarnings) {
                     defError (6560, "The ORIGIN statement is missing from the VIARULE statement. Ensure that it exists in the VIARULE statement.");
                     CHKERR();
@@ -1638,7 +1659,7 @@ layer_viarule_opts: '+' K_ROWCOL NUMBER NUMBER
         | '+' K_OFFSET NUMBER NUMBER NUMBER NUMBER
             {
               if (!defData->viaRule) {
-                if (defCallbacks->ViaCbk) {
+                if (defCallbacks->ViaCbk || defData->validating) {
                   if (defData->viaWarnings++ < defSettings->ViaWarnings) {
                     defError (6561, "The OFFSET statement is missing from the VIARULE statement. Ensure that it exists in the VIARULE statement.");
                     CHKERR();
@@ -1650,7 +1671,7 @@ layer_viarule_opts: '+' K_ROWCOL NUMBER NUMBER
         | '+' K_PATTERN {defData->dumb_mode = 1;defData->no_num = 1; } T_STRING 
             {
               if (!defData->viaRule) {
-                if (defCallbacks->ViaCbk) {
+                if (defCallbacks->ViaCbk || defData->validating) {
                   if (defData->viaWarnings++ < defSettings->ViaWarnings) {
                     defError (6562, "The PATTERN statement is missing from the VIARULE statement. Ensure that it exists in the VIARULE statement.");
                     CHKERR();
@@ -1750,7 +1771,7 @@ region_option : '+' K_PROPERTY {defData->dumb_mode = DEF_MAX_INT; defData->parsi
       | '+' K_TYPE region_type      // 5.4.1 
          {
            if (defData->regTypeDef) {
-              if (defCallbacks->RegionCbk) {
+              if (defCallbacks->RegionCbk || defData->validating) {
                 if (defData->regionWarnings++ < defSettings->RegionWarnings) {
                   defError(6563, "The TYPE statement already exists. It has been defined in the REGION statement.");
                   CHKERR();
@@ -1864,6 +1885,8 @@ comp_id_and_name: '-' {defData->dumb_mode = DEF_MAX_INT; defData->no_num = DEF_M
          {
             if (defCallbacks->ComponentCbk)
               defData->Component.IdAndName($3, $4);
+            if (defSettings->BuildNameIndex)
+              defData->NameIndex.add(defiNameComponent, $3);
          }
 
 comp_net_list: // empty 
@@ -1964,7 +1987,7 @@ comp_pnt_list: pt pt
 comp_halo: '+' K_HALO                    // 5.7 
         {
           if (defData->VersionNum < 5.6) {
-             if (defCallbacks->ComponentCbk) {
+             if (defCallbacks->ComponentCbk || defData->validating) {
                if (defData->componentWarnings++ < defSettings->ComponentWarnings) {
                  defData->defMsg = (char*)defMalloc(1000);
                  sprintf (defData->defMsg,
@@ -1987,7 +2010,7 @@ halo_soft: // 5.7
     | K_SOFT
       {
         if (defData->VersionNum < 5.7) {
-           if (defCallbacks->ComponentCbk) {
+           if (defCallbacks->ComponentCbk || defData->validating) {
              if (defData->componentWarnings++ < defSettings->ComponentWarnings) {
                 defData->defMsg = (char*)defMalloc(10000);
                 sprintf (defData->defMsg,
@@ -2007,7 +2030,7 @@ halo_soft: // 5.7
 comp_routehalo: '+' K_ROUTEHALO NUMBER { defData->dumb_mode = 2; defData->no_num = 2; } T_STRING T_STRING
       {
         if (defData->VersionNum < 5.7) {
-           if (defCallbacks->ComponentCbk) {
+           if (defCallbacks->ComponentCbk || defData->validating) {
              if (defData->componentWarnings++ < defSettings->ComponentWarnings) {
                 defData->defMsg = (char*)defMalloc(10000);
                 sprintf (defData->defMsg,
@@ -2074,7 +2097,7 @@ comp_foreign: '+' K_FOREIGN { defData->dumb_mode = 1; defData->no_num = 1; } T_S
               defData->Component.setForeignLocation($5.x, $5.y, $6);
             }
          } else
-            if (defCallbacks->ComponentCbk)
+            if (defCallbacks->ComponentCbk || defData->validating)
               if (defData->componentWarnings++ < defSettings->ComponentWarnings)
                 defWarning(7021, "The FOREIGN statement is obsolete in version 5.6 and later.\nThe DEF parser will ignore this statement.");
          }
@@ -2137,7 +2160,7 @@ weight: '+' K_WEIGHT NUMBER
 
 end_comps: K_END K_COMPS
         { 
-          if (defCallbacks->ComponentCbk)
+          if (defCallbacks->ComponentEndCbk)
             CALLBACK(defCallbacks->ComponentEndCbk, defrComponentEndCbkType, 0);
         }
 
@@ -2178,6 +2201,9 @@ net_name: T_STRING
           // this is shared by both net and special net 
           if ((defCallbacks->NetCbk && (defData->netOsnet==1)) || (defCallbacks->SNetCbk && (defData->netOsnet==2)))
             defData->Net.setName($1);
+          if (defSettings->BuildNameIndex)
+            defData->indexNetId = defData->NameIndex.add(
+                defData->netOsnet == 2 ? defiNameSNet : defiNameNet, $1);
           if (defCallbacks->NetNameCbk)
             CALLBACK(defCallbacks->NetNameCbk, defrNetNameCbkType, $1);
         } net_connections
@@ -2201,6 +2227,15 @@ net_connection: '(' T_STRING {defData->dumb_mode = DEF_MAX_INT; defData->no_num
           // need to check on both flags 
           if ((defCallbacks->NetCbk && (defData->netOsnet==1)) || (defCallbacks->SNetCbk && (defData->netOsnet==2)))
             defData->Net.addPin($2, $4, $5);
+          if (defSettings->BuildConnIndex && (defData->netOsnet==1)) {
+            int compId = defData->NameIndex.table(defiNameComponent)->findName($2);
+            if (compId < 0)
+              defData->ConnIndex.addUnresolved();
+            else
+              defData->ConnIndex.addConnection(compId,
+                  defData->NameIndex.add(defiNameCompPin, $4),
+                  defData->indexNetId);
+          }
           // 1/14/2000 - pcr 289156 
           // reset defData->dumb_mode & defData->no_num to 3 , just in case 
           // the next statement is another net_connection 
@@ -2265,7 +2300,7 @@ net_option: '+' net_type
         | '+' K_FIXEDBUMP
         {
           if (defData->VersionNum < 5.5) {
-            if (defCallbacks->NetCbk) {
+            if (defCallbacks->NetCbk || defData->validating) {
               if (defData->netWarnings++ < defSettings->NetWarnings) {
                  defData->defMsg = (char*)defMalloc(1000);
                  sprintf (defData->defMsg,
@@ -2282,7 +2317,7 @@ net_option: '+' net_type
         | '+' K_FREQUENCY { defData->real_num = 1; } NUMBER
         {
           if (defData->VersionNum < 5.5) {
-            if (defCallbacks->NetCbk) {
+            if (defCallbacks->NetCbk || defData->validating) {
               if (defData->netWarnings++ < defSettings->NetWarnings) {
                  defData->defMsg = (char*)defMalloc(1000);
                  sprintf (defData->defMsg,
@@ -2518,7 +2553,8 @@ new_path: K_NEW { defData->dumb_mode = 1; } path
 path:  T_STRING
       {
         if ((strcmp($1, "TAPER") == 0) || (strcmp($1, "TAPERRULE") == 0)) {
-          if (defData->NeedPathData && defCallbacks->NetCbk) {
+          if ((defData->NeedPathData && defCallbacks->NetCbk) ||
+              defData->validating) {
             if (defData->netWarnings++ < defSettings->NetWarnings) {
               defError(6531, "The layerName which is required in path is missing. Include the layerName in the path and then try again.");
               CHKERR();
@@ -2552,7 +2588,7 @@ virtual_statement :
     K_VIRTUAL virtual_pt
     {
       if (defData->VersionNum < 5.8) {
-              if (defCallbacks->SNetCbk) {
+              if (defCallbacks->SNetCbk || defData->validating) {
                 if (defData->sNetWarnings++ < defSettings->SNetWarnings) {
                   defData->defMsg = (char*)defMalloc(1000);
                   sprintf (defData->defMsg,
@@ -2569,7 +2605,7 @@ rect_statement :
     K_RECT rect_pts
     {
       if (defData->VersionNum < 5.8) {
-              if (defCallbacks->SNetCbk) {
+              if (defCallbacks->SNetCbk || defData->validating) {
                 if (defData->sNetWarnings++ < defSettings->SNetWarnings) {
                   defData->defMsg = (char*)defMalloc(1000);
                   sprintf (defData->defMsg,
@@ -2636,8 +2672,8 @@ path_item:
       {
         if (validateMaskInput((int)$2, defData->sNetWarnings, defSettings->SNetWarnings)) {      
             if (($5 == 0) || ($7 == 0)) {
-              if (defData->NeedPathData &&
-                  defCallbacks->SNetCbk) {
+              if ((defData->NeedPathData && defCallbacks->SNetCbk) ||
+                  defData->validating) {
                 if (defData->netWarnings++ < defSettings->NetWarnings) {
                   defError(6533, "Either the numX or numY in the VIA DO statement has the value. The value specified is 0.\nUpdate your DEF file with the correct value and then try again.\n");
                   CHKERR();
@@ -2648,7 +2684,8 @@ path_item:
                 defData->PathObj.addViaMask($2);
                 defData->PathObj.addVia($3);
                 defData->PathObj.addViaData((int)$5, (int)$7, (int)$9, (int)$10);
-            }  else if (defData->NeedPathData && (defCallbacks->NetCbk && (defData->netOsnet==1))) {
+            }  else if (((defData->NeedPathData && defCallbacks->NetCbk) ||
+                         defData->validating) && (defData->netOsnet==1)) {
               if (defData->netWarnings++ < defSettings->NetWarnings) {
                 defError(6567, "The VIA DO statement is defined in the NET statement and is invalid.\nRemove this statement from your DEF file and try again.");
                 CHKERR();
@@ -2659,8 +2696,8 @@ path_item:
     | T_STRING K_DO NUMBER K_BY NUMBER K_STEP NUMBER NUMBER
       {
         if (defData->VersionNum < 5.5) {
-          if (defData->NeedPathData && 
-              defCallbacks->SNetCbk) {
+          if ((defData->NeedPathData && defCallbacks->SNetCbk) ||
+              defData->validating) {
             if (defData->netWarnings++ < defSettings->NetWarnings) {
               defData->defMsg = (char*)defMalloc(1000);
               sprintf (defData->defMsg,
@@ -2672,8 +2709,8 @@ path_item:
           }
         }
         if (($3 == 0) || ($5 == 0)) {
-          if (defData->NeedPathData &&
-              defCallbacks->SNetCbk) {
+          if ((defData->NeedPathData && defCallbacks->SNetCbk) ||
+              defData->validating) {
             if (defData->netWarnings++ < defSettings->NetWarnings) {
               defError(6533, "Either the numX or numY in the VIA DO statement has the value. The value specified is 0.\nUpdate your DEF file with the correct value and then try again.\n");
               CHKERR();
@@ -2683,7 +2720,8 @@ path_item:
         if (defData->NeedPathData && (defCallbacks->SNetCbk && (defData->netOsnet==2))) {
             defData->PathObj.addVia($1);
             defData->PathObj.addViaData((int)$3, (int)$5, (int)$7, (int)$8);
-        }  else if (defData->NeedPathData && (defCallbacks->NetCbk && (defData->netOsnet==1))) {
+        }  else if (((defData->NeedPathData && defCallbacks->NetCbk) ||
+                     defData->validating) && (defData->netOsnet==1)) {
           if (defData->netWarnings++ < defSettings->NetWarnings) {
             defError(6567, "The VIA DO statement is defined in the NET statement and is invalid.\nRemove this statement from your DEF file and try again.");
             CHKERR();
@@ -2693,8 +2731,8 @@ path_item:
     | T_STRING orient K_DO NUMBER K_BY NUMBER K_STEP NUMBER NUMBER
       {
         if (defData->VersionNum < 5.5) {
-          if (defData->NeedPathData &&
-              defCallbacks->SNetCbk) {
+          if ((defData->NeedPathData && defCallbacks->SNetCbk) ||
+              defData->validating) {
             if (defData->netWarnings++ < defSettings->NetWarnings) {
               defData->defMsg = (char*)defMalloc(1000);
               sprintf (defData->defMsg,
@@ -2705,8 +2743,8 @@ path_item:
           }
         }
         if (($4 == 0) || ($6 == 0)) {
-          if (defData->NeedPathData &&
-              defCallbacks->SNetCbk) {
+          if ((defData->NeedPathData && defCallbacks->SNetCbk) ||
+              defData->validating) {
             if (defData->netWarnings++ < defSettings->NetWarnings) {
               defError(6533, "Either the numX or numY in the VIA DO statement has the value. The value specified is 0.\nUpdate your DEF file with the correct value and then try again.\n");
               CHKERR();
@@ -2717,7 +2755,8 @@ path_item:
             defData->PathObj.addVia($1);
             defData->PathObj.addViaRotation($2);
             defData->PathObj.addViaData((int)$4, (int)$6, (int)$8, (int)$9);
-        } else if (defData->NeedPathData && (defCallbacks->NetCbk && (defData->netOsnet==1))) {
+        } else if (((defData->NeedPathData && defCallbacks->NetCbk) ||
+                    defData->validating) && (defData->netOsnet==1)) {
           if (defData->netWarnings++ < defSettings->NetWarnings) {
             defError(6567, "The VIA DO statement is defined in the NET statement and is invalid.\nRemove this statement from your DEF file and try again.");
             CHKERR();
@@ -2728,8 +2767,8 @@ path_item:
       {
         if (validateMaskInput((int)$2, defData->sNetWarnings, defSettings->SNetWarnings)) {
             if (($6 == 0) || ($8 == 0)) {
-              if (defData->NeedPathData &&
-                  defCallbacks->SNetCbk) {
+              if ((defData->NeedPathData && defCallbacks->SNetCbk) ||
+                  defData->validating) {
                 if (defData->netWarnings++ < defSettings->NetWarnings) {
                   defError(6533, "Either the numX or numY in the VIA DO statement has the value. The value specified is 0.\nUpdate your DEF file with the correct value and then try again.\n");
                   CHKERR();
@@ -2741,7 +2780,8 @@ path_item:
                 defData->PathObj.addVia($3);
                 defData->PathObj.addViaRotation($4);;
                 defData->PathObj.addViaData((int)$6, (int)$8, (int)$10, (int)$11);
-            } else if (defData->NeedPathData && (defCallbacks->NetCbk && (defData->netOsnet==1))) {
+            } else if (((defData->NeedPathData && defCallbacks->NetCbk) ||
+                        defData->validating) && (defData->netOsnet==1)) {
               if (defData->netWarnings++ < defSettings->NetWarnings) {
                 defError(6567, "The VIA DO statement is defined in the NET statement and is invalid.\nRemove this statement from your DEF file and try again.");
                 CHKERR();
@@ -2895,8 +2935,8 @@ opt_taper: K_TAPER
 opt_style: K_STYLE NUMBER
       { 
         if (defData->VersionNum < 5.6) {
-           if (defData->NeedPathData && (defCallbacks->NetCbk ||
-               defCallbacks->SNetCbk)) {
+           if ((defData->NeedPathData && (defCallbacks->NetCbk ||
+               defCallbacks->SNetCbk)) || defData->validating) {
              if (defData->netWarnings++ < defSettings->NetWarnings) {
                defData->defMsg = (char*)defMalloc(1000);
                sprintf (defData->defMsg,
@@ -2923,8 +2963,8 @@ opt_shape_style:
           defData->PathObj.addShape($3); }
     | '+' K_STYLE NUMBER
       { if (defData->VersionNum < 5.6) {
-          if (defData->NeedPathData && ((defCallbacks->NetCbk && (defData->netOsnet==1)) ||
-            (defCallbacks->SNetCbk && (defData->netOsnet==2)))) {
+          if ((defData->NeedPathData && ((defCallbacks->NetCbk && (defData->netOsnet==1)) ||
+            (defCallbacks->SNetCbk && (defData->netOsnet==2)))) || defData->validating) {
             if (defData->netWarnings++ < defSettings->NetWarnings) {
               defData->defMsg = (char*)defMalloc(1000);
               sprintf (defData->defMsg,
@@ -3009,7 +3049,7 @@ snet_other_option: '+' net_type
              if (defData->VersionNum >= 5.8) {
                 defData->specialWire_routeStatus = $2;
              } else {
-                 if (defCallbacks->SNetCbk) {   // PCR 902306 
+                 if (defCallbacks->SNetCbk || defData->validating) {   // PCR 902306 
                    defData->defMsg = (char*)defMalloc(1024);
                    sprintf(defData->defMsg, "The SPECIAL NET statement, with type %s, does not have any net statement defined.\nThe DEF parser will ignore this statemnet.", $2);
                    defWarning(7023, defData->defMsg);
@@ -3059,7 +3099,7 @@ snet_other_option: '+' net_type
         | '+' K_POLYGON { defData->dumb_mode = 1; } T_STRING
           {
             if (defData->VersionNum < 5.6) {
-              if (defCallbacks->SNetCbk) {
+              if (defCallbacks->SNetCbk || defData->validating) {
                 if (defData->sNetWarnings++ < defSettings->SNetWarnings) {
                   defData->defMsg = (char*)defMalloc(1000);
                   sprintf (defData->defMsg,
@@ -3100,7 +3140,7 @@ snet_other_option: '+' net_type
         | '+' K_RECT { defData->dumb_mode = 1; } T_STRING pt pt
           {
             if (defData->VersionNum < 5.6) {
-              if (defCallbacks->SNetCbk) {
+              if (defCallbacks->SNetCbk || defData->validating) {
                 if (defData->sNetWarnings++ < defSettings->SNetWarnings) {
                   defData->defMsg = (char*)defMalloc(1000);
                   sprintf (defData->defMsg,
@@ -3133,7 +3173,7 @@ snet_other_option: '+' net_type
         | '+' K_VIA { defData->dumb_mode = 1; } T_STRING orient_pt
         {
           if (defData->VersionNum < 5.8) {
-              if (defCallbacks->SNetCbk) {
+              if (defCallbacks->SNetCbk || defData->validating) {
                 if (defData->sNetWarnings++ < defSettings->SNetWarnings) {
                   defData->defMsg = (char*)defMalloc(1000);
                   sprintf (defData->defMsg,
@@ -3216,7 +3256,7 @@ orient_pt: // empty
         
 shield_layer: // PCR 902306 
             {
-                if (defCallbacks->SNetCbk) {
+                if (defCallbacks->SNetCbk || defData->validating) {
                     if (defData->VersionNum < 5.8) { 
                         defData->defMsg = (char*)defMalloc(1024);
                         sprintf(defData->defMsg, "The SPECIAL NET SHIELD statement doesn't have routing points definition.\nWill be ignored.");
@@ -3298,7 +3338,7 @@ snet_voltage: '+' K_VOLTAGE  { defData->dumb_mode = 1; defData->no_num = 1; } T_
               if (numIsInt($4)) {
                  if (defCallbacks->SNetCbk) defData->Net.setVoltage(atoi($4));
               } else {
-                 if (defCallbacks->SNetCbk) {
+                 if (defCallbacks->SNetCbk || defData->validating) {
                    if (defData->sNetWarnings++ < defSettings->SNetWarnings) {
                      defData->defMsg = (char*)defMalloc(1000);
                      sprintf (defData->defMsg,
@@ -3604,7 +3644,7 @@ assertions_start: K_ASSERTIONS NUMBER ';'
           CALLBACK(defCallbacks->AssertionsStartCbk, defrAssertionsStartCbkType,
                    ROUND($2));
         } else {
-          if (defCallbacks->AssertionCbk)
+          if (defCallbacks->AssertionCbk || defData->validating)
             if (defData->assertionWarnings++ < defSettings->AssertionWarnings)
               defWarning(7031, "The ASSERTIONS statement is obsolete in version 5.4 and later.\nThe DEF parser will ignore this statement.");
         }
@@ -3618,7 +3658,7 @@ constraints_start: K_CONSTRAINTS NUMBER ';'
           CALLBACK(defCallbacks->ConstraintsStartCbk, defrConstraintsStartCbkType,
                    ROUND($2));
         } else {
-          if (defCallbacks->ConstraintCbk)
+          if (defCallbacks->ConstraintCbk || defData->validating)
             if (defData->constraintWarnings++ < defSettings->ConstraintWarnings)
               defWarning(7032, "The CONSTRAINTS statement is obsolete in version 5.4 and later.\nThe DEF parser will ignore this statement.");
         }
@@ -3722,7 +3762,7 @@ constraints_end: K_END K_CONSTRAINTS
       { if ((defData->VersionNum < 5.4) && defCallbacks->ConstraintsEndCbk) {
           CALLBACK(defCallbacks->ConstraintsEndCbk, defrConstraintsEndCbkType, 0);
         } else {
-          if (defCallbacks->ConstraintsEndCbk) {
+          if (defCallbacks->ConstraintsEndCbk || defData->validating) {
             if (defData->constraintWarnings++ < defSettings->ConstraintWarnings)
               defWarning(7032, "The CONSTRAINTS statement is obsolete in version 5.4 and later.\nThe DEF parser will ignore this statement.");
           }
@@ -3733,7 +3773,7 @@ assertions_end: K_END K_ASSERTIONS
       { if ((defData->VersionNum < 5.4) && defCallbacks->AssertionsEndCbk) {
           CALLBACK(defCallbacks->AssertionsEndCbk, defrAssertionsEndCbkType, 0);
         } else {
-          if (defCallbacks->AssertionsEndCbk) {
+          if (defCallbacks->AssertionsEndCbk || defData->validating) {
             if (defData->assertionWarnings++ < defSettings->AssertionWarnings)
               defWarning(7031, "The ASSERTIONS statement is obsolete in version 5.4 and later.\nThe DEF parser will ignore this statement.");
           }
@@ -3801,7 +3841,7 @@ scan_member: '+' K_START {defData->dumb_mode = 2; defData->no_num = 2;} T_STRING
       partition_maxbits
       {
         if (defData->VersionNum < 5.5) {
-          if (defCallbacks->ScanchainCbk) {
+          if (defCallbacks->ScanchainCbk || defData->validating) {
             if (defData->scanchainWarnings++ < defSettings->ScanchainWarnings) {
               defData->defMsg = (char*)defMalloc(1000);
               sprintf (defData->defMsg,
@@ -4028,7 +4068,7 @@ iotiming_start: K_IOTIMINGS NUMBER ';'
         if (defData->VersionNum < 5.4 && defCallbacks->IOTimingsStartCbk) {
           CALLBACK(defCallbacks->IOTimingsStartCbk, defrIOTimingsStartCbkType, ROUND($2));
         } else {
-          if (defCallbacks->IOTimingsStartCbk)
+          if (defCallbacks->IOTimingsStartCbk || defData->validating)
             if (defData->iOTimingWarnings++ < defSettings->IOTimingWarnings)
               defWarning(7035, "The IOTIMINGS statement is obsolete in version 5.4 and later.\nThe DEF parser will ignore this statement.");
         }
@@ -4567,7 +4607,7 @@ layer_blockage_rules: // empty
 layer_blockage_rule: '+' K_SPACING NUMBER
       {
         if (defData->VersionNum < 5.6) {
-          if (defCallbacks->BlockageCbk) {
+          if (defCallbacks->BlockageCbk || defData->validating) {
             if (defData->blockageWarnings++ < defSettings->BlockageWarnings) {
               defData->defMsg = (char*)defMalloc(1000);
               sprintf (defData->defMsg,
@@ -4578,7 +4618,7 @@ layer_blockage_rule: '+' K_SPACING NUMBER
             }
           }
         } else if (defData->hasBlkLayerSpac) {
-          if (defCallbacks->BlockageCbk) {
+          if (defCallbacks->BlockageCbk || defData->validating) {
             if (defData->blockageWarnings++ < defSettings->BlockageWarnings) {
               defError(6541, "The SPACING statement is defined in the LAYER statement,\nbut there is already either a SPACING statement or DESIGNRULEWIDTH  statement has defined in the LAYER statement.\nUpdate your DEF file to have either SPACING statement or a DESIGNRULEWIDTH statement.");
               CHKERR();
@@ -4593,14 +4633,14 @@ layer_blockage_rule: '+' K_SPACING NUMBER
       | '+' K_DESIGNRULEWIDTH NUMBER
       {
         if (defData->VersionNum < 5.6) {
-          if (defCallbacks->BlockageCbk) {
+          if (defCallbacks->BlockageCbk || defData->validating) {
             if (defData->blockageWarnings++ < defSettings->BlockageWarnings) {
               defError(6541, "The SPACING statement is defined in the LAYER statement,\nbut there is already either a SPACING statement or DESIGNRULEWIDTH  statement has defined in the LAYER statement.\nUpdate your DEF file to have either SPACING statement or a DESIGNRULEWIDTH statement.");
               CHKERR();
             }
           }
         } else if (defData->hasBlkLayerSpac) {
-          if (defCallbacks->BlockageCbk) {
+          if (defCallbacks->BlockageCbk || defData->validating) {
             if (defData->blockageWarnings++ < defSettings->BlockageWarnings) {
               defError(6541, "The SPACING statement is defined in the LAYER statement,\nbut there is already either a SPACING statement or DESIGNRULEWIDTH  statement has defined in the LAYER statement.\nUpdate your DEF file to have either SPACING statement or a DESIGNRULEWIDTH statement.");
               CHKERR();
@@ -4628,7 +4668,7 @@ comp_blockage_rule:
       '+' K_COMPONENT { defData->dumb_mode = 1; defData->no_num = 1; } T_STRING
       {
         if (defData->hasBlkLayerComp) {
-          if (defCallbacks->BlockageCbk) {
+          if (defCallbacks->BlockageCbk || defData->validating) {
             if (defData->blockageWarnings++ < defSettings->BlockageWarnings) {
               defError(6542, "The defined BLOCKAGES COMPONENT statement has either COMPONENT, SLOTS, FILLS, PUSHDOWN or EXCEPTPGNET defined.\nOnly one of these statements is allowed per LAYER. Updated the DEF file to define a valid BLOCKAGES COMPONENT statement per layer.");
               CHKERR();
@@ -4647,7 +4687,7 @@ comp_blockage_rule:
       | '+' K_SLOTS
       {
         if (defData->hasBlkLayerComp || defData->hasBlkLayerTypeComp) {
-          if (defCallbacks->BlockageCbk) {
+          if (defCallbacks->BlockageCbk || defData->validating) {
             if (defData->blockageWarnings++ < defSettings->BlockageWarnings) {
               defError(6542, "The defined BLOCKAGES COMPONENT statement has either COMPONENT, SLOTS, FILLS, PUSHDOWN or EXCEPTPGNET defined.\nOnly one of these statements is allowed per LAYER. Updated the DEF file to define a valid BLOCKAGES COMPONENT statement per layer.");
               CHKERR();
@@ -4668,7 +4708,7 @@ comp_blockage_rule:
       | '+' K_FILLS
       {
         if (defData->hasBlkLayerComp || defData->hasBlkLayerTypeComp) {
-          if (defCallbacks->BlockageCbk) {
+          if (defCallbacks->BlockageCbk || defData->validating) {
             if (defData->blockageWarnings++ < defSettings->BlockageWarnings) {
               defError(6542, "The defined BLOCKAGES COMPONENT statement has either COMPONENT, SLOTS, FILLS, PUSHDOWN or EXCEPTPGNET defined.\nOnly one of these statements is allowed per LAYER. Updated the DEF file to define a valid BLOCKAGES COMPONENT statement per layer.");
               CHKERR();
@@ -4689,7 +4729,7 @@ comp_blockage_rule:
       | '+' K_PUSHDOWN
       {
         if (defData->hasBlkLayerComp) {
-          if (defCallbacks->BlockageCbk) {
+          if (defCallbacks->BlockageCbk || defData->validating) {
             if (defData->blockageWarnings++ < defSettings->BlockageWarnings) {
               defError(6542, "The defined BLOCKAGES COMPONENT statement has either COMPONENT, SLOTS, FILLS, PUSHDOWN or EXCEPTPGNET defined.\nOnly one of these statements is allowed per LAYER. Updated the DEF file to define a valid BLOCKAGES COMPONENT statement per layer.");
               CHKERR();
@@ -4707,7 +4747,7 @@ comp_blockage_rule:
       | '+' K_EXCEPTPGNET              // 5.7 
       {
         if (defData->VersionNum < 5.7) {
-           if (defCallbacks->BlockageCbk) {
+           if (defCallbacks->BlockageCbk || defData->validating) {
              if (defData->blockageWarnings++ < defSettings->BlockageWarnings) {
                defData->defMsg = (char*)defMalloc(10000);
                sprintf (defData->defMsg,
@@ -4719,7 +4759,7 @@ comp_blockage_rule:
            }
         } else {
            if (defData->hasBlkLayerComp) {
-             if (defCallbacks->BlockageCbk) {
+             if (defCallbacks->BlockageCbk || defData->validating) {
                if (defData->blockageWarnings++ < defSettings->BlockageWarnings) {
                  defError(6542, "The defined BLOCKAGES COMPONENT statement has either COMPONENT, SLOTS, FILLS, PUSHDOWN or EXCEPTPGNET defined.\nOnly one of these statements is allowed per LAYER. Updated the DEF file to define a valid BLOCKAGES COMPONENT statement per layer.");
                  CHKERR();
@@ -4745,7 +4785,7 @@ placement_comp_rule: // empty
       '+' K_COMPONENT { defData->dumb_mode = 1; defData->no_num = 1; } T_STRING
       {
         if (defData->hasBlkPlaceComp) {
-          if (defCallbacks->BlockageCbk) {
+          if (defCallbacks->BlockageCbk || defData->validating) {
             if (defData->blockageWarnings++ < defSettings->BlockageWarnings) {
               defError(6543, "The defined BLOCKAGES PLACEMENT statement has either COMPONENT, PUSHDOWN, SOFT or PARTIAL defined.\nOnly one of these statements is allowed per LAYER. Updated the DEF file to define a valid BLOCKAGES PLACEMENT statement.");
               CHKERR();
@@ -4763,7 +4803,7 @@ placement_comp_rule: // empty
       | '+' K_PUSHDOWN
       {
         if (defData->hasBlkPlaceComp) {
-          if (defCallbacks->BlockageCbk) {
+          if (defCallbacks->BlockageCbk || defData->validating) {
             if (defData->blockageWarnings++ < defSettings->BlockageWarnings) {
               defError(6543, "The defined BLOCKAGES PLACEMENT statement has either COMPONENT, PUSHDOWN, SOFT or PARTIAL defined.\nOnly one of these statements is allowed per LAYER. Updated the DEF file to define a valid BLOCKAGES PLACEMENT statement.");
               CHKERR();
@@ -4781,7 +4821,7 @@ placement_comp_rule: // empty
       | '+' K_SOFT                   // 5.7
       {
         if (defData->VersionNum < 5.7) {
-           if (defCallbacks->BlockageCbk) {
+           if (defCallbacks->BlockageCbk || defData->validating) {
              if (defData->blockageWarnings++ < defSettings->BlockageWarnings) {
                defData->defMsg = (char*)defMalloc(10000);
                sprintf (defData->defMsg,
@@ -4793,7 +4833,7 @@ placement_comp_rule: // empty
            }
         } else {
            if (defData->hasBlkPlaceComp || defData->hasBlkPlaceTypeComp) {
-             if (defCallbacks->BlockageCbk) {
+             if (defCallbacks->BlockageCbk || defData->validating) {
                if (defData->blockageWarnings++ < defSettings->BlockageWarnings) {
                  defError(6543, "The defined BLOCKAGES PLACEMENT statement has either COMPONENT, PUSHDOWN, SOFT or PARTIAL defined.\nOnly one of these statements is allowed per LAYER. Updated the DEF file to define a valid BLOCKAGES PLACEMENT statement.");
                  CHKERR();
@@ -4815,7 +4855,7 @@ placement_comp_rule: // empty
       | '+' K_PARTIAL NUMBER         // 5.7
       {
         if (defData->VersionNum < 5.7) {
-           if (defCallbacks->BlockageCbk) {
+           if (defCallbacks->BlockageCbk || defData->validating) {
              if (defData->blockageWarnings++ < defSettings->BlockageWarnings) {
                 defData->defMsg = (char*)defMalloc(10000);
                 sprintf (defData->defMsg,
@@ -4827,7 +4867,7 @@ placement_comp_rule: // empty
            }
         } else {
            if (defData->hasBlkPlaceComp || defData->hasBlkPlaceTypeComp) {
-             if (defCallbacks->BlockageCbk) {
+             if (defCallbacks->BlockageCbk || defData->validating) {
                if (defData->blockageWarnings++ < defSettings->BlockageWarnings) {
                  defError(6543, "The defined BLOCKAGES PLACEMENT statement has either COMPONENT, PUSHDOWN, SOFT or PARTIAL defined.\nOnly one of these statements is allowed per LAYER. Updated the DEF file to define a valid BLOCKAGES PLACEMENT statement.");
                  CHKERR();
@@ -4871,7 +4911,7 @@ rectPoly_blockage: K_RECT pt pt
               if (defCallbacks->BlockageCbk)
                 defData->Blockage.addPolygon(&defData->Geometries);
             } else {
-              if (defCallbacks->BlockageCbk) {
+              if (defCallbacks->BlockageCbk || defData->validating) {
                 if (defData->blockageWarnings++ < defSettings->BlockageWarnings) {
                   defError(6544, "A POLYGON statement is defined in the BLOCKAGE statement,\nbut it is not defined in the BLOCKAGE LAYER statement.\nUpdate your DEF file to either remove the POLYGON statement from the BLOCKAGE statement or\ndefine the POLYGON statement in a BLOCKAGE LAYER statement.");
                   CHKERR();
@@ -5015,7 +5055,7 @@ fill_layer_opc:
       '+' K_OPC
       {
         if (defData->VersionNum < 5.7) {
-           if (defCallbacks->FillCbk) {
+           if (defCallbacks->FillCbk || defData->validating) {
              if (defData->fillWarnings++ < defSettings->FillWarnings) {
                defData->defMsg = (char*)defMalloc(10000);
                sprintf (defData->defMsg,
@@ -5053,7 +5093,7 @@ fill_via_opc:
       '+' K_OPC
       {
         if (defData->VersionNum < 5.7) {
-           if (defCallbacks->FillCbk) {
+           if (defCallbacks->FillCbk || defData->validating) {
              if (defData->fillWarnings++ < defSettings->FillWarnings) {
                defData->defMsg = (char*)defMalloc(10000);
                sprintf (defData->defMsg,
@@ -5096,7 +5136,7 @@ nondefaultrule_section: nondefault_start nondefault_def nondefault_defs
 nondefault_start: K_NONDEFAULTRULES NUMBER ';'
       { 
         if (defData->VersionNum < 5.6) {
-          if (defCallbacks->NonDefaultStartCbk) {
+          if (defCallbacks->NonDefaultStartCbk || defData->validating) {
             if (defData->nonDefaultWarnings++ < defSettings->NonDefaultWarnings) {
               defData->defMsg = (char*)defMalloc(1000);
               sprintf (defData->defMsg,
@@ -5237,7 +5277,7 @@ styles_section: styles_start styles_rules styles_end ;
 styles_start: K_STYLES NUMBER ';'
       {
         if (defData->VersionNum < 5.6) {
-          if (defCallbacks->StylesStartCbk) {
+          if (defCallbacks->StylesStartCbk || defData->validating) {
             if (defData->stylesWarnings++ < defSettings->StylesWarnings) {
               defData->defMsg = (char*)defMalloc(1000);
               sprintf (defData->defMsg,
@@ -98,10 +98,7 @@ int defGetDefine(const string &name, string &result)
 #define yyparse	defyyparse
 #define yylex	defyylex
 #define yyerror	defyyerror
-#define yylval	defyylval
-#define yychar	defyychar
 #define yydebug	defyydebug
-#define yynerrs	defyynerrs
 
 // lex.cpph starts here
 
@@ -142,7 +139,12 @@ extern char* defkywd(int num);
 
 
 void reload_buffer() {
-   int nb = 0;
+   int    nb = 0;
+   double traceStart = defiTraceOn ? defiProfile::clock() : 0;
+
+   /* keep track of the input offset of buffer[0] */
+   if (defData->next)
+      defData->bufferOffset += defData->last - defData->buffer + 1;
 
    if (defData->first_buffer) {
       defData->first_buffer = 0;
@@ -172,7 +174,11 @@ void reload_buffer() {
    } else {
       defData->next = defData->buffer;
       defData->last = defData->buffer + nb - 1;
+      if (defSettings->ProgressFunction)
+         defProgress(0);
    }
+   if (defiTraceOn)
+      defiTraceSpan("read", "reload", traceStart, "bytes", nb);
 }   
 
 int GETC() {
@@ -190,6 +196,32 @@ int GETC() {
     }
 }
 
+/* Input offset of the next character GETC() returns. */
+static long long defInputOffset() {
+    if (!defData->next)
+       return defData->bufferOffset;
+    return defData->bufferOffset + (defData->next - defData->buffer);
+}
+
+/* Calls the progress function if its interval has passed, or if force.
+** Checked once per buffer, so the clock is read every IN_BUF_SIZE bytes.
+*/
+void defProgress(int force) {
+    double    now = defiProfile::clock();
+    long long bytes;
+
+    if (!force && now - defData->progressLast < defSettings->ProgressInterval)
+       return;
+    defData->progressLast = now;
+    if (defSettings->InputPositionFunction)
+       bytes = (*defSettings->InputPositionFunction)(defSettings->File);
+    else
+       bytes = defInputOffset();
+    (*defSettings->ProgressFunction)(bytes, defData->inputSize,
+                                     now - defData->progressStart,
+                                     defSettings->UserData);
+}
+
 void UNGETC(char ch) {
     if (defData->next <= defData->buffer) {
         defError(6111, "UNGETC: buffer access violation.");
@@ -274,6 +306,11 @@ int DefGetTokenFromStack(char *s) {
 inline static void 
 print_lines(long long lines) 
 {
+    if (!defSettings->LineNumberFunction &&
+        !defSettings->LongLineNumberFunction) {
+        return;
+    }
+
     if (lines % defSettings->defiDeltaNumberLines) {
         return;
     }
@@ -288,7 +325,7 @@ print_lines(long long lines)
 inline const char * 
 lines2str(long long lines) 
 {
-    static char buffer[30];
+    static DEFR_THREAD_LOCAL char buffer[30];
 
 #ifdef _WIN32
     sprintf(buffer, "%I64d", lines);
@@ -329,19 +366,36 @@ DefGetToken(char **buffer, int *bufferSize)
     defData->defInvalidChar = 0;
 
     if (defData->input_level >= 0){  /* if we are expanding an alias */
-       if( DefGetTokenFromStack(s) ) /* try to get a token from it */
+       if( DefGetTokenFromStack(s) ) { /* try to get a token from it */
+          defData->tokenOffset = -1;
           return TRUE;               /* if we get one, return it */
+       }
     }                                /* but if not, continue */
 
     /* skip blanks and count lines */
+    long long lineStart = -1;
     while ((ch = GETC()) != EOF) {
        if (ch == '\n') {
           print_lines(++defData->nlines);
+          if (defSettings->BuildSourceMap) {
+             lineStart = defInputOffset();
+             defData->SourceMap.extendEnd(lineStart);
+          }
        }
        if (ch != ' ' && ch != '\t' && (defData->nl_token || ch != '\n'))
           break;
     }
 
+    if (defSettings->BuildSourceMap) {
+       defData->SourceMap.cancelExtend();
+       defData->tokenOffset = defInputOffset() - 1;
+       defData->tokenLineStart = (lineStart >= 0) ? lineStart
+                                                  : defData->tokenOffset;
+    } else if (defSettings->ProfileFunction || defiTraceOn ||
+               defSettings->SampleLimits) {
+       defData->tokenOffset = defInputOffset() - 1;
+    }
+
     if (ch == EOF) return FALSE;
 
 
@@ -527,14 +581,27 @@ StoreAlias()
         so_far += line;
     }
 
-    defData->def_alias_set[aname] = so_far;
+    defSetAlias(aname, so_far.c_str());
 
     free(aname);
     free(line);
     free(uc_line);
 }
 
-int amper_lookup(char *token);    /* forward reference to this routine */
+/* Sets an &alias, accounting its entry if allocation accounting is on. */
+void defSetAlias(const char *name, const char *value) {
+    defAliasMap::iterator it = defData->def_alias_set.find(name);
+    size_t oldSize = 0;
+
+    if (it != defData->def_alias_set.end())
+        oldSize = it->first.size() + it->second.size();
+    defData->def_alias_set[name] = value;
+    if (defSettings->AllocStats)
+        defSettings->AllocStats->aliasSet(oldSize,
+                                          strlen(name) + strlen(value));
+}
+
+int amper_lookup(YYSTYPE *pYylval, char *token);    /* forward reference to this routine */
 
 /* The main routine called by the YACC parser to get the next token.
  *    Returns 0 if no more tokens are available.
@@ -551,22 +618,182 @@ int amper_lookup(char *token);    /* forward reference to this routine */
  * Newlines are in general silently ignored.  If the global defData->nl_token is
  * true, however, they are returned as the token K_NL.
  */
-extern int sublex();
+extern int sublex(YYSTYPE *pYylval);
+
+
+/* Section started by a keyword, for the source map. */
+static defiSection_e defSourceMapSection(int v) {
+   switch (v) {
+      case K_PROPERTYDEFINITIONS: return defiSectionPropertyDefinitions;
+      case K_DEFAULTCAP:          return defiSectionDefaultCap;
+      case K_VIAS:                return defiSectionVias;
+      case K_STYLES:              return defiSectionStyles;
+      case K_NONDEFAULTRULES:     return defiSectionNonDefaultRules;
+      case K_REGIONS:             return defiSectionRegions;
+      case K_COMPS:               return defiSectionComponents;
+      case K_PINS:                return defiSectionPins;
+      case K_PINPROPERTIES:       return defiSectionPinProperties;
+      case K_BLOCKAGES:           return defiSectionBlockages;
+      case K_SLOTS:               return defiSectionSlots;
+      case K_FILLS:               return defiSectionFills;
+      case K_SNETS:               return defiSectionSpecialNets;
+      case K_NETS:                return defiSectionNets;
+      case K_SCANCHAINS:          return defiSectionScanChains;
+      case K_GROUPS:              return defiSectionGroups;
+      case K_IOTIMINGS:           return defiSectionIOTimings;
+      case K_FPC:                 return defiSectionFPC;
+      case K_TIMINGDISABLES:      return defiSectionTimingDisables;
+      case K_PARTITIONS:          return defiSectionPartitions;
+      case K_ASSERTIONS:          return defiSectionAssertions;
+      case K_CONSTRAINTS:         return defiSectionConstraints;
+   }
+   return defiSectionUnknown;
+}
+
+/* Reports the profile of the open section. */
+static void defProfileReport(int isEnd) {
+   defData->Profile.update(isEnd, defData->tokenOffset, defData->ntokens);
+   (*defSettings->ProfileFunction)(&defData->Profile, defSettings->UserData);
+}
+
+/* Records section and statement ranges, for the source map, the
+** profile, the trace and the sample limits.  A section starts with its keyword at the beginning of a
+** statement and ends with END <keyword>; inside a section a statement
+** starts with - and ends with ;.
+*/
+static void defSectionToken(int v) {
+   defiSourceMap* map = defSettings->BuildSourceMap ? &defData->SourceMap
+                                                    : 0;
+   int            profile = defSettings->ProfileFunction != 0;
+   long long      start = defData->tokenOffset;
+   int            atStart = defData->mapStatementStart;
+   int            afterEnd = defData->mapAfterEnd;
+   const char*    tk = defData->deftoken;
+   int            line = (int)defData->nlines;
+
+   defData->mapStatementStart = 0;
+   defData->mapAfterEnd = 0;
+   if (start < 0)   /* from an alias */
+      return;
+
+   if (afterEnd) {
+      defiSection_e section = defSourceMapSection(v);
+      if (section != defiSectionUnknown && section == defData->sectionOpen) {
+         if (map)
+            map->endSection(start + strlen(tk), line);
+         if (profile) {
+            defData->tokenOffset = start + strlen(tk);
+            defProfileReport(1);
+            defData->tokenOffset = start;
+         }
+         if (defiTraceOn)
+            defiTraceSpan("read", defiSourceMap::sectionName(section),
+                          defData->traceSectionStart);
+         defData->sectionOpen = defiSectionUnknown;
+      }
+      defData->mapStatementStart = 1;
+   } else if (tk[0] == ';' && tk[1] == '\0') {
+      if (map && map->inStatement())
+         map->endStatement(start + 1, line);
+      defData->mapStatementStart = 1;
+   } else if (tk[0] == '-' && tk[1] == '\0') {
+      if (atStart && defData->sectionOpen != defiSectionUnknown) {
+         int limit = defSettings->SampleLimit[defData->sectionOpen];
+         if (limit && defData->sectionObjects >= limit) {
+            defData->sampleSkip = 1;
+            return;
+         }
+         defData->sectionObjects++;
+         if (map)
+            map->beginStatement(defData->tokenLineStart, line);
+         if (profile) {
+            defData->Profile.addObject();
+            if (defSettings->ProfileInterval &&
+                defData->Profile.objects() % defSettings->ProfileInterval == 0)
+               defProfileReport(0);
+         }
+      }
+   } else if (v == K_END) {
+      defData->mapAfterEnd = atStart;
+   } else if (v == K_HISTORY || v == K_BEGINEXT) {
+      defData->mapStatementStart = 1;  /* the lexer read the statement */
+   } else if (atStart && defData->sectionOpen == defiSectionUnknown) {
+      defiSection_e section = defSourceMapSection(v);
+      if (section != defiSectionUnknown) {
+         if (map)
+            map->beginSection(section, defData->tokenLineStart, line);
+         if (profile)
+            defData->Profile.beginSection(section, start, defData->ntokens);
+         if (defiTraceOn)
+            defData->traceSectionStart = defiProfile::clock();
+         defData->sectionOpen = section;
+         defData->sectionObjects = 0;
+      }
+   }
+}
 
+/* Skips the rest of the open section once its sample limit is reached,
+** from the - of the first object over the limit up to the END of the
+** section.  Only raw tokens are read, so the objects are not checked.
+** Returns K_END, or 0 at the end of the input.
+*/
+static int defSkipSection() {
+   int atStart = 0;
+
+   defData->sampleSkip = 0;
+   while (DefGetToken(&defData->deftoken, &defData->deftokenLength)) {
+      const char* tk = defData->deftoken;
+
+      if (tk[0] == defSettings->CommentChar) {
+         int c;
+         while ((c = GETC()) != EOF && c != '\n')
+            ;
+         if (c == EOF)
+            return 0;
+         print_lines(++defData->nlines);
+         continue;
+      }
+      if (atStart && (tk[0] == 'E' || tk[0] == 'e')) {
+         defData->uc_token = (char*)realloc(defData->uc_token,
+                                            defData->deftokenLength);
+         uc_array(defData->deftoken, defData->uc_token);
+         if (strcmp(defData->uc_token, "END") == 0) {
+            defData->mapStatementStart = 1;
+            defSectionToken(K_END);
+            return K_END;
+         }
+      }
+      atStart = tk[0] == ';' && tk[1] == '\0';
+   }
+   return 0;
+}
 
-int yylex() {
-   int v = sublex();
+int yylex(YYSTYPE *pYylval) {
+   int v;
+   if (defSettings->ProfileFunction) {
+      double start = defiProfile::clock();
+      v = sublex(pYylval);
+      defData->Profile.addLexTime(defiProfile::clock() - start);
+   } else {
+      v = sublex(pYylval);
+   }
+   if ((defSettings->BuildSourceMap || defSettings->ProfileFunction ||
+        defiTraceOn || defSettings->SampleLimits) && v > 0) {
+      defSectionToken(v);
+      if (defData->sampleSkip)
+         v = defSkipSection();
+   }
    if (defData->defPrintTokens) {
       if (v == 0) {
          printf("yylex NIL\n");
       } else if (v < 256) {
          printf("yylex char %c\n", v);
       } else if (v == QSTRING) {
-         printf("yylex quoted string '%s'\n", yylval.string);
+         printf("yylex quoted string '%s'\n", pYylval->string);
       } else if (v == T_STRING) {
-         printf("yylex string '%s'\n", yylval.string);
+         printf("yylex string '%s'\n", pYylval->string);
       } else if (v == NUMBER) {
-         printf("yylex number %f\n", yylval.dval);
+         printf("yylex number %f\n", pYylval->dval);
       } else {
          printf("yylex keyword %s\n", defkywd(v));
       }
@@ -580,7 +807,7 @@ int yylex() {
    return v;
 }
 
-int sublex()
+int sublex(YYSTYPE *pYylval)
 {
    char fc;
    double numVal;
@@ -657,7 +884,7 @@ int sublex()
    }
 
    if(fc == '\"') {
-      yylval.string = ringCopy(&(defData->deftoken[1]));
+      pYylval->string = ringCopy(&(defData->deftoken[1]));
 
       return QSTRING;
    }
@@ -682,11 +909,11 @@ int sublex()
       /* strtod defData->first to handle double number inside PROPERTY.  Only        */
       /* property has real number (large number) */
       if (!defData->parsing_property && !defData->real_num) {
-         yylval.dval = strtol(defData->deftoken, &ch, 10); /* try string to long defData->first */
+         pYylval->dval = strtol(defData->deftoken, &ch, 10); /* try string to long defData->first */
          if (defData->no_num < 0 && *ch == '\0') { /* did we use the whole string? */
             return NUMBER;
          } else {  /* failed strtol, try double */
-            numVal = yylval.dval = strtod(defData->deftoken, &ch);
+            numVal = pYylval->dval = strtod(defData->deftoken, &ch);
             if (defData->no_num < 0 && *ch == '\0') {  /* did we use the whole string? */
                /* check if the integer has exceed the limit */
                if ((numVal >= defData->lVal) && (numVal <= defData->rVal))
@@ -701,15 +928,16 @@ int sublex()
                   defiError(1, 0, str);
                   defFree(str);
                   defData->errors++;
+                  defData->totalErrors++;
                   return NUMBER;
                }
              } else {
-               yylval.string = ringCopy(defData->deftoken);  /* NO, it's a string */
+               pYylval->string = ringCopy(defData->deftoken);  /* NO, it's a string */
                return T_STRING;
             }
          }
       } else {  /* handling PROPERTY, do strtod defData->first instead of strtol */
-         numVal = yylval.dval = strtod(defData->deftoken, &ch);
+         numVal = pYylval->dval = strtod(defData->deftoken, &ch);
          if (defData->no_num < 0 && *ch == '\0') { /* did we use the whole string? */
             /* check if the integer has exceed the limit */
             if (defData->real_num)    /* this is for PROPERTYDEF with REAL */
@@ -726,14 +954,15 @@ int sublex()
                defiError(1, 0, str);
                defFree(str);
                defData->errors++;
+               defData->totalErrors++;
                return NUMBER;
             }
          } else {  /* failed integer conversion, try floating point */
-            yylval.dval = strtol(defData->deftoken, &ch, 10);
+            pYylval->dval = strtol(defData->deftoken, &ch, 10);
             if (defData->no_num < 0 && *ch == '\0')  /* did we use the whole string? */
                return NUMBER;
             else {
-               yylval.string = ringCopy(defData->deftoken);  /* NO, it's a string */
+               pYylval->string = ringCopy(defData->deftoken);  /* NO, it's a string */
                return T_STRING;
             }
          }
@@ -830,7 +1059,7 @@ int sublex()
                 return K_FE;
          }
       }
-      yylval.string = ringCopy(defData->deftoken);
+      pYylval->string = ringCopy(defData->deftoken);
       return T_STRING;
    }
 
@@ -846,10 +1075,8 @@ int sublex()
 
       if (defGetKeyword(defData->uc_token, &result)) {
          if (K_HISTORY == result) {  /* history - get up to ';' */
-            int n;
             int c;
             int prev;
-            n = 0;
             prev = ' ';
             while (1) {
                c = GETC();
@@ -869,12 +1096,10 @@ int sublex()
             }
             defData->History_text.push_back('\0');
          } else if (K_BEGINEXT == result) { /* extension, get up to end */
-            int nn;
             int cc;
             int foundTag = 0;
             int notEmpTag = 0;
             int begQuote = 0;
-            nn = 0;
             /* First make sure there is a name after BEGINEXT within quote */
             /* BEGINEXT "name" */
             while (1) {
@@ -953,8 +1178,8 @@ int sublex()
          return result;        /* YES, return its value */
       } else {  /* we don't have a keyword.  */
          if (fc == '&')
-         return amper_lookup(defData->deftoken);
-         yylval.string = ringCopy(defData->deftoken);  /* NO, it's a string */
+         return amper_lookup(pYylval, defData->deftoken);
+         pYylval->string = ringCopy(defData->deftoken);  /* NO, it's a string */
          return T_STRING;
       }
    } else {  /* it should be a punctuation character */
@@ -977,7 +1202,7 @@ int sublex()
 
 /* We have found a defData->deftoken beginning with '&'.  If it has been previously
    defined, substitute the definition.  Otherwise return it. */
-int amper_lookup(char *tkn)
+int amper_lookup(YYSTYPE *pYylval, char *tkn)
 {
    string   defValue;
 
@@ -989,13 +1214,13 @@ int amper_lookup(char *tkn)
       if (defGetKeyword(defValue.c_str(), &value))
          return value;
       if (defValue.c_str()[0] == '"')
-         yylval.string = ringCopy(defValue.c_str()+1);
+         pYylval->string = ringCopy(defValue.c_str()+1);
       else
-         yylval.string = ringCopy(defValue.c_str());
+         pYylval->string = ringCopy(defValue.c_str());
       return (defValue.c_str()[0] == '\"' ? QSTRING : T_STRING);
    }
    /* if none of the above, just return the defData->deftoken. */
-   yylval.string = ringCopy(tkn);
+   pYylval->string = ringCopy(tkn);
    return T_STRING;
 }
 
@@ -1056,6 +1281,7 @@ void defError(int msgNum, const char *s) {
    defiError(1, msgNum, str);
    defFree(str);
    defData->errors++;
+   defData->totalErrors++;
 }
 
 /* yydeferror is called by bison.simple */
@@ -1160,7 +1386,17 @@ void defWarning(int msgNum, const char *s) {
 }
 
 void * defMalloc(size_t def_size) {
+   return defMallocType(def_size, defiAllocParser);
+}
+
+void * defRealloc(void *name, size_t def_size) {
+   return defReallocType(name, def_size, defiAllocParser);
+}
+
+void * defMallocType(size_t def_size, int type) {
    void * mallocVar;
+   if (defSettings->ProfileFunction && defData)
+      defData->Profile.addMalloc();
    if (defSettings->MallocFunction)
       mallocVar =  (*defSettings->MallocFunction)(def_size);
    else
@@ -1171,18 +1407,30 @@ void * defMalloc(size_t def_size) {
         defSettings->FileName, lines2str(defData->nlines));
       exit (1);
    }
+   if (defSettings->AllocStats)
+      defSettings->AllocStats->allocated(mallocVar, def_size, type);
    return mallocVar;
 }
 
-void * defRealloc(void *name, size_t def_size) {
+void * defReallocType(void *name, size_t def_size, int type) {
+   void * reallocVar;
+   if (defSettings->ProfileFunction && defData)
+      defData->Profile.addRealloc();
    if (defSettings->ReallocFunction)
-      return (*defSettings->ReallocFunction)(name, def_size);
+      reallocVar = (*defSettings->ReallocFunction)(name, def_size);
    else
-      return (void*)realloc(name, def_size);
+      reallocVar = (void*)realloc(name, def_size);
+   if (defSettings->AllocStats && (reallocVar || !def_size))
+      defSettings->AllocStats->resized(name, reallocVar, def_size, type);
+   return reallocVar;
 }
 
 
 void defFree(void *name) {
+   if (defSettings->ProfileFunction && defData)
+      defData->Profile.addFree();
+   if (defSettings->AllocStats && name)
+      defSettings->AllocStats->freed(name);
    if (defSettings->FreeFunction)
       (*defSettings->FreeFunction)(name);
    else
@@ -0,0 +1,309 @@
+// *****************************************************************************
+// *****************************************************************************
+// Copyright 2013-2014, Cadence Design Systems
+// 
+// This  file  is  part  of  the  Cadence  LEF/DEF  Open   Source
+// Distribution,  Product Version 5.8. 
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+//    implied. See the License for the specific language governing
+//    permissions and limitations under the License.
+// 
+// For updates, support, or to become part of the LEF/DEF Community,
+// check www.openeda.org for details.
+// 
+//  $Author$
+//  $Revision$
+//  $Date$
+//  $State:  $
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdlib.h>
+#include <string.h>
+#include "defiAlloc.hpp"
+
+BEGIN_LEFDEF_PARSER_NAMESPACE
+
+struct defiAllocBlock {
+  const void* ptr;        // null for an empty slot
+  size_t      size;
+  int         type;
+};
+
+// The live blocks by address, in an open addressing hash table with
+// linear probing, kept at most half full.  The slots are malloc()ed, not
+// defMalloc()ed, so they are not accounted themselves.
+class defiAllocBlocks {
+public:
+  defiAllocBlocks() : slots_(0), size_(0), used_(0) {}
+  ~defiAllocBlocks() { free(slots_); }
+
+  void clear();
+
+  defiAllocBlock* find(const void* p) const;
+
+  // The slot of p, a new one with a zero size if p is not there.
+  defiAllocBlock* insert(const void* p);
+  void            erase(defiAllocBlock* b);
+
+private:
+  size_t home(const void* p) const;
+  void   grow();
+
+  defiAllocBlock* slots_;
+  size_t          size_;          // a power of 2
+  size_t          used_;
+};
+
+
+void defiAllocBlocks::clear() {
+  free(slots_);
+  slots_ = 0;
+  size_ = 0;
+  used_ = 0;
+}
+
+
+size_t defiAllocBlocks::home(const void* p) const {
+  unsigned long long h = (unsigned long long) (size_t) p;
+
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  return (size_t) h & (size_ - 1);
+}
+
+
+defiAllocBlock* defiAllocBlocks::find(const void* p) const {
+  size_t i;
+
+  if (!size_)
+    return 0;
+  for (i = home(p); slots_[i].ptr; i = (i + 1) & (size_ - 1))
+    if (slots_[i].ptr == p)
+      return &slots_[i];
+  return 0;
+}
+
+
+defiAllocBlock* defiAllocBlocks::insert(const void* p) {
+  size_t i;
+
+  if ((used_ + 1) * 2 > size_)
+    grow();
+  for (i = home(p); slots_[i].ptr; i = (i + 1) & (size_ - 1))
+    if (slots_[i].ptr == p)
+      return &slots_[i];
+  slots_[i].ptr = p;
+  slots_[i].size = 0;
+  slots_[i].type = 0;
+  used_++;
+  return &slots_[i];
+}
+
+
+// Moves the blocks after b back into the hole, so that no probe
+// sequence is broken and no deleted marks are needed.
+void defiAllocBlocks::erase(defiAllocBlock* b) {
+  size_t mask = size_ - 1;
+  size_t i = b - slots_;
+  size_t j = i;
+  size_t k;
+
+  for (;;) {
+    j = (j + 1) & mask;
+    if (!slots_[j].ptr)
+      break;
+    k = home(slots_[j].ptr);
+    if ((j > i && (k <= i || k > j)) || (j < i && k <= i && k > j)) {
+      slots_[i] = slots_[j];
+      i = j;
+    }
+  }
+  slots_[i].ptr = 0;
+  used_--;
+}
+
+
+void defiAllocBlocks::grow() {
+  defiAllocBlock* old = slots_;
+  size_t          oldSize = size_;
+  size_t          i, j;
+
+  size_ = size_ ? size_ * 2 : 1024;
+  slots_ = (defiAllocBlock*) calloc(size_, sizeof(defiAllocBlock));
+  for (i = 0; i < oldSize; i++) {
+    if (!old[i].ptr)
+      continue;
+    for (j = home(old[i].ptr); slots_[j].ptr; j = (j + 1) & (size_ - 1))
+      ;
+    slots_[j] = old[i];
+  }
+  free(old);
+}
+
+static const char* defiAllocTypeNames[defiNumAllocTypes + 1] = {
+  "parser",
+  "alias",
+  "assertion",
+  "blockage",
+  "component",
+  "fill",
+  "fpc",
+  "group",
+  "iotiming",
+  "misc",
+  "net",
+  "nondefault",
+  "partition",
+  "path",
+  "pin",
+  "pinprop",
+  "prop",
+  "region",
+  "rowtrack",
+  "scanchain",
+  "site",
+  "slot",
+  "timingdisable",
+  "via",
+  "total"
+};
+
+/*********************************************************
+* class defiAllocStats
+**********************************************************/
+defiAllocStats::defiAllocStats()
+: blocks_(new defiAllocBlocks) {
+  clear();
+}
+
+
+defiAllocStats::~defiAllocStats() {
+  delete blocks_;
+}
+
+
+void defiAllocStats::clear() {
+  blocks_->clear();
+  memset(current_, 0, sizeof(current_));
+  memset(peak_, 0, sizeof(peak_));
+  memset(count_, 0, sizeof(count_));
+  memset(allocs_, 0, sizeof(allocs_));
+  memset(total_, 0, sizeof(total_));
+}
+
+
+void defiAllocStats::add(int type, long long size, int blocks) {
+  int t[2] = { type, defiNumAllocTypes };
+  int i;
+
+  for (i = 0; i < 2; i++) {
+    current_[t[i]] += size;
+    count_[t[i]] += blocks;
+    if (current_[t[i]] > peak_[t[i]])
+      peak_[t[i]] = current_[t[i]];
+    if (size > 0) {
+      allocs_[t[i]]++;
+      total_[t[i]] += size;
+    }
+  }
+}
+
+
+void defiAllocStats::allocated(const void* p, size_t size, int type) {
+  defiAllocBlock* b = blocks_->insert(p);
+
+  if (b->size)    // a block freed behind our back
+    add(b->type, -(long long) b->size, -1);
+  b->size = size;
+  b->type = type;
+  add(type, size, 1);
+}
+
+
+void defiAllocStats::freed(const void* p) {
+  defiAllocBlock* b = blocks_->find(p);
+
+  if (!b)
+    return;
+  add(b->type, -(long long) b->size, -1);
+  blocks_->erase(b);
+}
+
+
+void defiAllocStats::resized(const void* old, const void* p, size_t size,
+                             int type) {
+  if (old)
+    freed(old);
+  if (p)
+    allocated(p, size, type);
+}
+
+
+// Alias entries are std::map nodes; they are counted by the size of
+// their strings.
+void defiAllocStats::aliasSet(size_t oldSize, size_t newSize) {
+  if (oldSize)
+    add(defiAllocAlias, -(long long) oldSize, -1);
+  if (newSize)
+    add(defiAllocAlias, newSize, 1);
+}
+
+
+long long defiAllocStats::current(int type) const {
+  return current_[type];
+}
+
+
+long long defiAllocStats::peak(int type) const {
+  return peak_[type];
+}
+
+
+long long defiAllocStats::count(int type) const {
+  return count_[type];
+}
+
+
+long long defiAllocStats::allocs(int type) const {
+  return allocs_[type];
+}
+
+
+long long defiAllocStats::total(int type) const {
+  return total_[type];
+}
+
+
+const char* defiAllocStats::typeName(int type) {
+  if (type < 0 || type > defiNumAllocTypes)
+    return "";
+  return defiAllocTypeNames[type];
+}
+
+
+void defiAllocStats::print(FILE* f) const {
+  int i;
+
+  fprintf(f, "%-14s %12s %12s %10s %12s %14s\n", "type", "current",
+          "peak", "blocks", "allocs", "total");
+  for (i = 0; i <= defiNumAllocTypes; i++) {
+    if (!allocs_[i] && i != defiNumAllocTypes)
+      continue;
+    fprintf(f, "%-14s %12lld %12lld %10lld %12lld %14lld\n",
+            defiAllocTypeNames[i], current_[i], peak_[i], count_[i],
+            allocs_[i], total_[i]);
+  }
+}
+
+END_LEFDEF_PARSER_NAMESPACE
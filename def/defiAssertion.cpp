@@ -29,6 +29,7 @@
 
 #include <string.h>
 #include <stdlib.h>
+#define DEF_ALLOC_TYPE defiAllocAssertion
 #include "lex.h"
 #include "defiAssertion.hpp"
 #include "defiDebug.hpp"
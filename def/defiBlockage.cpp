@@ -30,6 +30,7 @@
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
+#define DEF_ALLOC_TYPE defiAllocBlockage
 #include "lex.h"
 #include "defiBlockage.hpp"
 #include "defiDebug.hpp"
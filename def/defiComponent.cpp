@@ -31,6 +31,7 @@
 #include <string.h>
 #include "defiComponent.hpp"
 #include "defiDebug.hpp"
+#define DEF_ALLOC_TYPE defiAllocComponent
 #include "lex.h"
 #include "defiUtil.hpp"
 
@@ -29,6 +29,7 @@
 
 #include <string.h>
 #include <stdlib.h>
+#define DEF_ALLOC_TYPE defiAllocFPC
 #include "lex.h"
 #include "defiFPC.hpp"
 #include "defiDebug.hpp"
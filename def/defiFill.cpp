@@ -30,6 +30,7 @@
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
+#define DEF_ALLOC_TYPE defiAllocFill
 #include "lex.h"
 #include "defiFill.hpp"
 #include "defiDebug.hpp"
@@ -29,6 +29,7 @@
 
 #include <string.h>
 #include <stdlib.h>
+#define DEF_ALLOC_TYPE defiAllocGroup
 #include "lex.h"
 #include "defiGroup.hpp"
 #include "defiDebug.hpp"
@@ -29,6 +29,7 @@
 
 #include <string.h>
 #include <stdlib.h>
+#define DEF_ALLOC_TYPE defiAllocIOTiming
 #include "lex.h"
 #include "defiIOTiming.hpp"
 #include "defiDebug.hpp"
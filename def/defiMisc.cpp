@@ -30,6 +30,7 @@
 #include <string.h>
 #include <stdlib.h>
 #include <stdio.h>
+#define DEF_ALLOC_TYPE defiAllocMisc
 #include "lex.h"
 #include "defiDebug.hpp"
 #include "defiMisc.hpp"
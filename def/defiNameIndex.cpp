@@ -0,0 +1,466 @@
+// *****************************************************************************
+// *****************************************************************************
+// Copyright 2013-2014, Cadence Design Systems
+// 
+// This  file  is  part  of  the  Cadence  LEF/DEF  Open   Source
+// Distribution,  Product Version 5.8. 
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+//    implied. See the License for the specific language governing
+//    permissions and limitations under the License.
+// 
+// For updates, support, or to become part of the LEF/DEF Community,
+// check www.openeda.org for details.
+// 
+//  $Author$
+//  $Revision$
+//  $Date$
+//  $State:  $
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "defiNameIndex.hpp"
+
+BEGIN_LEFDEF_PARSER_NAMESPACE
+
+// FNV-1a, of the upper cased name if upper is set.
+static unsigned int defiHashName(const char* name, int upper) {
+  unsigned int h = 2166136261u;
+
+  for (; *name; name++) {
+    h ^= upper ? (unsigned char) toupper((unsigned char) *name)
+               : (unsigned char) *name;
+    h *= 16777619u;
+  }
+  return h;
+}
+
+// Compares an upper cased name of the table with a name in any case.
+static int defiNameEqualUpper(const char* upperName, const char* name) {
+  for (; *name; upperName++, name++)
+    if (*upperName != toupper((unsigned char) *name))
+      return 0;
+  return *upperName == '\0';
+}
+
+/*********************************************************
+* class defiNameTable
+**********************************************************/
+defiNameTable::defiNameTable() {
+  Init();
+}
+
+
+defiNameTable::~defiNameTable() {
+  Destroy();
+}
+
+
+void defiNameTable::Init() {
+  arena_ = 0;
+  arenaUsed_ = 0;
+  arenaSize_ = 0;
+  offsets_ = 0;
+  hashes_ = 0;
+  numNames_ = 0;
+  namesAllocated_ = 0;
+  slots_ = 0;
+  numSlots_ = 0;
+}
+
+
+void defiNameTable::Destroy() {
+  if (arena_) free(arena_);
+  if (offsets_) free(offsets_);
+  if (hashes_) free(hashes_);
+  if (slots_) free(slots_);
+  Init();
+}
+
+
+void defiNameTable::clear() {
+  arenaUsed_ = 0;
+  numNames_ = 0;
+  if (slots_) memset(slots_, 0, numSlots_ * sizeof(int));
+}
+
+
+int defiNameTable::slotOf(const char* name, unsigned int hash,
+                          int upper) const {
+  int mask = numSlots_ - 1;
+  int i = (int) (hash & mask);
+
+  // Linear probing; the table is never more than half full.
+  while (slots_[i]) {
+    int id = slots_[i] - 1;
+    if (hashes_[id] == hash &&
+        (upper ? defiNameEqualUpper(arena_ + offsets_[id], name)
+               : strcmp(arena_ + offsets_[id], name) == 0))
+      return i;
+    i = (i + 1) & mask;
+  }
+  return i;
+}
+
+
+void defiNameTable::rehash(int newSlots) {
+  int i;
+  int mask = newSlots - 1;
+
+  if (slots_) free(slots_);
+  slots_ = (int*) malloc(newSlots * sizeof(int));
+  memset(slots_, 0, newSlots * sizeof(int));
+  numSlots_ = newSlots;
+
+  for (i = 0; i < numNames_; i++) {
+    int s = (int) (hashes_[i] & mask);
+    while (slots_[s])
+      s = (s + 1) & mask;
+    slots_[s] = i + 1;
+  }
+}
+
+
+int defiNameTable::addName(const char* name) {
+  unsigned int hash = defiHashName(name, 0);
+  long long len;
+  int slot;
+
+  if (numSlots_ == 0)
+    rehash(64);
+
+  slot = slotOf(name, hash, 0);
+  if (slots_[slot])
+    return slots_[slot] - 1;
+
+  len = (long long) strlen(name) + 1;
+  if (arenaUsed_ + len > arenaSize_) {
+    while (arenaUsed_ + len > arenaSize_)
+      arenaSize_ = arenaSize_ ? arenaSize_ * 2 : 4096;
+    arena_ = (char*) realloc(arena_, arenaSize_);
+  }
+  if (numNames_ == namesAllocated_) {
+    namesAllocated_ = namesAllocated_ ? namesAllocated_ * 2 : 64;
+    offsets_ = (long long*) realloc(offsets_,
+                                    namesAllocated_ * sizeof(long long));
+    hashes_ = (unsigned int*) realloc(hashes_,
+                                      namesAllocated_ * sizeof(unsigned int));
+  }
+
+  memcpy(arena_ + arenaUsed_, name, len);
+  offsets_[numNames_] = arenaUsed_;
+  hashes_[numNames_] = hash;
+  arenaUsed_ += len;
+  slots_[slot] = ++numNames_;
+
+  if (numNames_ * 2 > numSlots_)
+    rehash(numSlots_ * 2);
+
+  return numNames_ - 1;
+}
+
+
+int defiNameTable::findName(const char* name, int upper) const {
+  int slot;
+
+  if (numNames_ == 0)
+    return -1;
+  slot = slotOf(name, defiHashName(name, upper), upper);
+  return slots_[slot] - 1;
+}
+
+
+int defiNameTable::numNames() const {
+  return numNames_;
+}
+
+
+const char* defiNameTable::name(int id) const {
+  if (id < 0 || id >= numNames_)
+    return 0;
+  return arena_ + offsets_[id];
+}
+
+
+long long defiNameTable::memoryUsed() const {
+  return arenaSize_ +
+         (long long) namesAllocated_ * (sizeof(long long) + sizeof(int)) +
+         (long long) numSlots_ * sizeof(int);
+}
+
+
+/*********************************************************
+* class defiNameIndex
+**********************************************************/
+defiNameIndex::defiNameIndex() {
+  Init();
+}
+
+
+defiNameIndex::~defiNameIndex() {
+  Destroy();
+}
+
+
+void defiNameIndex::Init() {
+  caseSensitive_ = 1;
+}
+
+
+void defiNameIndex::Destroy() {
+  int i;
+
+  for (i = 0; i < defiNameNumKinds; i++)
+    tables_[i].Destroy();
+  Init();
+}
+
+
+void defiNameIndex::clear() {
+  int i;
+
+  for (i = 0; i < defiNameNumKinds; i++)
+    tables_[i].clear();
+  caseSensitive_ = 1;
+}
+
+
+void defiNameIndex::setCaseSensitive(int caseSensitive) {
+  caseSensitive_ = caseSensitive;
+}
+
+
+int defiNameIndex::caseSensitive() const {
+  return caseSensitive_;
+}
+
+
+int defiNameIndex::add(defiNameKind_e kind, const char* name) {
+  return tables_[kind].addName(name);
+}
+
+
+int defiNameIndex::find(defiNameKind_e kind, const char* name) const {
+  return tables_[kind].findName(name, !caseSensitive_);
+}
+
+
+int defiNameIndex::numNames(defiNameKind_e kind) const {
+  return tables_[kind].numNames();
+}
+
+
+const char* defiNameIndex::name(defiNameKind_e kind, int id) const {
+  return tables_[kind].name(id);
+}
+
+
+const defiNameTable* defiNameIndex::table(defiNameKind_e kind) const {
+  return &tables_[kind];
+}
+
+
+long long defiNameIndex::memoryUsed() const {
+  long long size = 0;
+  int i;
+
+  for (i = 0; i < defiNameNumKinds; i++)
+    size += tables_[i].memoryUsed();
+  return size;
+}
+
+
+void defiNameIndex::print(FILE* f) const {
+  fprintf(f, "Name index: %d components, %d pins, %d nets, %d special nets,"
+          " %d component pins, %lld bytes\n",
+          numNames(defiNameComponent), numNames(defiNamePin),
+          numNames(defiNameNet), numNames(defiNameSNet),
+          numNames(defiNameCompPin), memoryUsed());
+}
+
+
+/*********************************************************
+* class defiConnIndex
+**********************************************************/
+defiConnIndex::defiConnIndex() {
+  Init();
+}
+
+
+defiConnIndex::~defiConnIndex() {
+  Destroy();
+}
+
+
+void defiConnIndex::Init() {
+  rawComp_ = 0;
+  rawPin_ = 0;
+  rawNet_ = 0;
+  numConns_ = 0;
+  connsAllocated_ = 0;
+  numUnresolved_ = 0;
+  offsets_ = 0;
+  pins_ = 0;
+  nets_ = 0;
+  numComps_ = 0;
+  finished_ = 0;
+}
+
+
+void defiConnIndex::Destroy() {
+  if (rawComp_) free(rawComp_);
+  if (rawPin_) free(rawPin_);
+  if (rawNet_) free(rawNet_);
+  if (offsets_) free(offsets_);
+  if (pins_) free(pins_);
+  if (nets_) free(nets_);
+  Init();
+}
+
+
+void defiConnIndex::clear() {
+  numConns_ = 0;
+  numUnresolved_ = 0;
+  numComps_ = 0;
+  finished_ = 0;
+}
+
+
+void defiConnIndex::addConnection(int compId, int pinId, int netId) {
+  if (numConns_ == connsAllocated_) {
+    connsAllocated_ = connsAllocated_ ? connsAllocated_ * 2 : 256;
+    rawComp_ = (int*) realloc(rawComp_, connsAllocated_ * sizeof(int));
+    rawPin_ = (int*) realloc(rawPin_, connsAllocated_ * sizeof(int));
+    rawNet_ = (int*) realloc(rawNet_, connsAllocated_ * sizeof(int));
+  }
+  rawComp_[numConns_] = compId;
+  rawPin_[numConns_] = pinId;
+  rawNet_[numConns_] = netId;
+  numConns_++;
+  finished_ = 0;
+}
+
+
+void defiConnIndex::addUnresolved() {
+  numUnresolved_++;
+}
+
+
+void defiConnIndex::finish(int numComponents) {
+  int i;
+
+  if (finished_ && numComponents == numComps_)
+    return;
+
+  if (offsets_) free(offsets_);
+  if (pins_) free(pins_);
+  if (nets_) free(nets_);
+
+  numComps_ = numComponents;
+  offsets_ = (int*) malloc((numComps_ + 1) * sizeof(int));
+  pins_ = (int*) malloc((numConns_ ? numConns_ : 1) * sizeof(int));
+  nets_ = (int*) malloc((numConns_ ? numConns_ : 1) * sizeof(int));
+  memset(offsets_, 0, (numComps_ + 1) * sizeof(int));
+
+  // Counting sort by component; stable, so each component keeps its
+  // connections in NETS order.
+  for (i = 0; i < numConns_; i++)
+    offsets_[rawComp_[i] + 1]++;
+  for (i = 0; i < numComps_; i++)
+    offsets_[i + 1] += offsets_[i];
+  for (i = 0; i < numConns_; i++) {
+    int pos = offsets_[rawComp_[i]]++;
+    pins_[pos] = rawPin_[i];
+    nets_[pos] = rawNet_[i];
+  }
+  for (i = numComps_; i > 0; i--)
+    offsets_[i] = offsets_[i - 1];
+  offsets_[0] = 0;
+
+  finished_ = 1;
+}
+
+
+int defiConnIndex::numComponents() const {
+  return numComps_;
+}
+
+
+int defiConnIndex::numConnections() const {
+  return numConns_;
+}
+
+
+int defiConnIndex::numConnections(int compId) const {
+  if (compId < 0 || compId >= numComps_)
+    return 0;
+  return offsets_[compId + 1] - offsets_[compId];
+}
+
+
+int defiConnIndex::begin(int compId) const {
+  return offsets_[compId];
+}
+
+
+int defiConnIndex::pinId(int conn) const {
+  return pins_[conn];
+}
+
+
+int defiConnIndex::netId(int conn) const {
+  return nets_[conn];
+}
+
+
+int defiConnIndex::numUnresolved() const {
+  return numUnresolved_;
+}
+
+
+int defiConnIndex::findNet(int compId, int pinId) const {
+  int i;
+
+  if (compId < 0 || compId >= numComps_)
+    return -1;
+  for (i = offsets_[compId]; i < offsets_[compId + 1]; i++)
+    if (pins_[i] == pinId)
+      return nets_[i];
+  return -1;
+}
+
+
+const int* defiConnIndex::offsets() const {
+  return offsets_;
+}
+
+
+const int* defiConnIndex::pinIds() const {
+  return pins_;
+}
+
+
+const int* defiConnIndex::netIds() const {
+  return nets_;
+}
+
+
+long long defiConnIndex::memoryUsed() const {
+  return (long long) connsAllocated_ * 3 * sizeof(int) +
+         (finished_ ? ((long long) numComps_ + 1 + 2 * numConns_)
+                      * sizeof(int) : 0);
+}
+
+
+END_LEFDEF_PARSER_NAMESPACE
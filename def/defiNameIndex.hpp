@@ -0,0 +1,184 @@
+// *****************************************************************************
+// *****************************************************************************
+// Copyright 2013-2014, Cadence Design Systems
+// 
+// This  file  is  part  of  the  Cadence  LEF/DEF  Open   Source
+// Distribution,  Product Version 5.8. 
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+//    implied. See the License for the specific language governing
+//    permissions and limitations under the License.
+// 
+// For updates, support, or to become part of the LEF/DEF Community,
+// check www.openeda.org for details.
+// 
+//  $Author$
+//  $Revision$
+//  $Date$
+//  $State:  $
+// *****************************************************************************
+// *****************************************************************************
+
+#ifndef defiNameIndex_h
+#define defiNameIndex_h
+
+#include <stdio.h>
+#include "defiKRDefs.hpp"
+
+BEGIN_LEFDEF_PARSER_NAMESPACE
+
+// Kinds of names kept in the name index.
+typedef enum {
+  defiNameComponent = 0,
+  defiNamePin,
+  defiNameNet,
+  defiNameSNet,
+  defiNameCompPin,     // pin names used in NETS connections
+  defiNameNumKinds
+} defiNameKind_e;
+
+// Open addressing hash table mapping names to dense ids 0..numNames()-1,
+// in the order the names were first added.  The strings are stored back
+// to back in a single character arena.
+class defiNameTable {
+public:
+  defiNameTable();
+  ~defiNameTable();
+
+  void Init();
+  void Destroy();
+  void clear();
+
+  // Returns the id of the name, adding it if it is not in the table.
+  int addName(const char* name);
+
+  // Returns the id of the name, or -1 if it is not in the table.  With
+  // upper set the name is looked up upper cased, without a copy.
+  int findName(const char* name, int upper = 0) const;
+
+  int         numNames() const;
+  const char* name(int id) const;
+
+  // Bytes allocated by the table.
+  long long   memoryUsed() const;
+
+protected:
+  void rehash(int newSlots);
+  int  slotOf(const char* name, unsigned int hash, int upper) const;
+
+  char*         arena_;       // NUL terminated names
+  long long     arenaUsed_;
+  long long     arenaSize_;
+  long long*    offsets_;     // arena offset of each id
+  unsigned int* hashes_;      // hash value of each id
+  int           numNames_;
+  int           namesAllocated_;
+  int*          slots_;       // id + 1, 0 for an empty slot
+  int           numSlots_;    // always a power of 2
+};
+
+// Name index built during defrRead() for COMPONENTS, PINS, NETS and
+// SPECIALNETS when defrSetBuildNameIndex() is enabled.  Retrieve it
+// with defrGetNameIndex() after defrRead().
+class defiNameIndex {
+public:
+  defiNameIndex();
+  ~defiNameIndex();
+
+  void Init();
+  void Destroy();
+  void clear();
+
+  void setCaseSensitive(int caseSensitive);
+  int  caseSensitive() const;
+
+  int  add(defiNameKind_e kind, const char* name);
+
+  // Returns the dense id of the name, or -1 if not found.  If the
+  // file was not case sensitive the names were upper cased by the
+  // parser and the name looked up is upper cased too.  It writes
+  // nothing, so several threads can look names up at the same time.
+  int  find(defiNameKind_e kind, const char* name) const;
+
+  int         numNames(defiNameKind_e kind) const;
+  const char* name(defiNameKind_e kind, int id) const;
+  const defiNameTable* table(defiNameKind_e kind) const;
+
+  long long   memoryUsed() const;
+
+  void print(FILE* f) const;
+
+protected:
+  defiNameTable tables_[defiNameNumKinds];
+  int           caseSensitive_;
+};
+
+// Reverse connectivity of NETS built during defrRead() when
+// defrSetBuildConnIndex() is enabled: for each component (by its
+// defiNameComponent id) the list of (pin name id, net id) it connects
+// to, where pin names are defiNameCompPin ids and nets defiNameNet ids.
+// The lists are kept in CSR form: the connections of component c are
+// [begin(c), begin(c + 1)).  Connections to PIN, to '*' and to
+// components not declared in COMPONENTS are not indexed; the latter are
+// counted by numUnresolved().
+class defiConnIndex {
+public:
+  defiConnIndex();
+  ~defiConnIndex();
+
+  void Init();
+  void Destroy();
+  void clear();
+
+  void addConnection(int compId, int pinId, int netId);
+  void addUnresolved();
+
+  // Build the CSR arrays for numComponents components.
+  void finish(int numComponents);
+
+  int numComponents() const;
+  int numConnections() const;
+  int numConnections(int compId) const;
+  int begin(int compId) const;
+  int pinId(int conn) const;
+  int netId(int conn) const;
+  int numUnresolved() const;
+
+  // Returns the net id connected to the pin of the component, or -1.
+  int findNet(int compId, int pinId) const;
+
+  // Raw CSR arrays; offsets() has numComponents() + 1 entries.
+  const int* offsets() const;
+  const int* pinIds() const;
+  const int* netIds() const;
+
+  long long memoryUsed() const;
+
+protected:
+  int* rawComp_;        // connections in NETS order
+  int* rawPin_;
+  int* rawNet_;
+  int  numConns_;
+  int  connsAllocated_;
+  int  numUnresolved_;
+
+  int* offsets_;        // CSR, valid if finished_
+  int* pins_;
+  int* nets_;
+  int  numComps_;
+  int  finished_;
+};
+
+END_LEFDEF_PARSER_NAMESPACE
+
+USE_LEFDEF_PARSER_NAMESPACE
+
+#endif
@@ -32,6 +32,7 @@
 #include "defiNet.hpp"
 #include "defiPath.hpp"
 #include "defiDebug.hpp"
+#define DEF_ALLOC_TYPE defiAllocNet
 #include "lex.h"
 #include "defiUtil.hpp"
 
@@ -29,6 +29,7 @@
 
 #include <stdlib.h>
 #include <string.h>
+#define DEF_ALLOC_TYPE defiAllocNonDefault
 #include "lex.h"
 #include "defiNonDefault.hpp"
 #include "defiDebug.hpp"
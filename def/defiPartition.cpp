@@ -29,6 +29,7 @@
 
 #include <string.h>
 #include <stdlib.h>
+#define DEF_ALLOC_TYPE defiAllocPartition
 #include "lex.h"
 #include "defiPartition.hpp"
 #include "defiDebug.hpp"
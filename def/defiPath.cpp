@@ -31,6 +31,7 @@
 #include <string.h>
 #include "defiPath.hpp"
 #include "defiDebug.hpp"
+#define DEF_ALLOC_TYPE defiAllocPath
 #include "lex.h"
 #include "defiUtil.hpp"
 
@@ -32,6 +32,7 @@
 #include "defiPinCap.hpp"
 #include "defiComponent.hpp"
 #include "defiDebug.hpp"
+#define DEF_ALLOC_TYPE defiAllocPin
 #include "lex.h"
 #include "defiUtil.hpp"
 
@@ -29,6 +29,7 @@
 
 #include <string.h>
 #include <stdlib.h>
+#define DEF_ALLOC_TYPE defiAllocPinProp
 #include "lex.h"
 #include "defiDebug.hpp"
 #include "defiPinProp.hpp"
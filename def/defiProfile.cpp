@@ -0,0 +1,204 @@
+// *****************************************************************************
+// *****************************************************************************
+// Copyright 2013-2014, Cadence Design Systems
+// 
+// This  file  is  part  of  the  Cadence  LEF/DEF  Open   Source
+// Distribution,  Product Version 5.8. 
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+//    implied. See the License for the specific language governing
+//    permissions and limitations under the License.
+// 
+// For updates, support, or to become part of the LEF/DEF Community,
+// check www.openeda.org for details.
+// 
+//  $Author$
+//  $Revision$
+//  $Date$
+//  $State:  $
+// *****************************************************************************
+// *****************************************************************************
+
+#include <time.h>
+#ifndef WIN32
+#   include <sys/time.h>
+#endif
+#include "defiProfile.hpp"
+
+BEGIN_LEFDEF_PARSER_NAMESPACE
+
+/*********************************************************
+* class defiProfile
+**********************************************************/
+defiProfile::defiProfile() {
+  Init();
+}
+
+
+void defiProfile::Init() {
+  clear();
+}
+
+
+void defiProfile::clear() {
+  section_ = defiSectionUnknown;
+  isEnd_ = 0;
+  startOffset_ = 0;
+  startTokens_ = 0;
+  startTime_ = 0;
+  bytes_ = 0;
+  tokens_ = 0;
+  objects_ = 0;
+  seconds_ = 0;
+  lexSeconds_ = 0;
+  callbackSeconds_ = 0;
+  mallocCalls_ = 0;
+  reallocCalls_ = 0;
+  freeCalls_ = 0;
+}
+
+
+double defiProfile::clock() {
+#ifndef WIN32
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+#else
+  return (double) ::clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+
+void defiProfile::beginSection(defiSection_e section, long long offset,
+                               long long tokens) {
+  clear();
+  section_ = section;
+  startOffset_ = offset;
+  startTokens_ = tokens;
+  startTime_ = clock();
+}
+
+
+void defiProfile::update(int isEnd, long long offset,
+                         long long tokens) {
+  isEnd_ = isEnd;
+  bytes_ = offset - startOffset_;
+  tokens_ = tokens - startTokens_;
+  seconds_ = clock() - startTime_;
+}
+
+
+void defiProfile::addObject() {
+  objects_++;
+}
+
+
+void defiProfile::addLexTime(double seconds) {
+  lexSeconds_ += seconds;
+}
+
+
+void defiProfile::addCallbackTime(double seconds) {
+  callbackSeconds_ += seconds;
+}
+
+
+void defiProfile::addMalloc() {
+  mallocCalls_++;
+}
+
+
+void defiProfile::addRealloc() {
+  reallocCalls_++;
+}
+
+
+void defiProfile::addFree() {
+  freeCalls_++;
+}
+
+
+defiSection_e defiProfile::section() const {
+  return (defiSection_e) section_;
+}
+
+
+const char* defiProfile::sectionName() const {
+  return defiSourceMap::sectionName((defiSection_e) section_);
+}
+
+
+int defiProfile::isEnd() const {
+  return isEnd_;
+}
+
+
+long long defiProfile::bytes() const {
+  return bytes_;
+}
+
+
+long long defiProfile::tokens() const {
+  return tokens_;
+}
+
+
+long long defiProfile::objects() const {
+  return objects_;
+}
+
+
+double defiProfile::seconds() const {
+  return seconds_;
+}
+
+
+double defiProfile::lexSeconds() const {
+  return lexSeconds_;
+}
+
+
+double defiProfile::callbackSeconds() const {
+  return callbackSeconds_;
+}
+
+
+double defiProfile::grammarSeconds() const {
+  double s = seconds_ - lexSeconds_ - callbackSeconds_;
+  return s > 0 ? s : 0;
+}
+
+
+long long defiProfile::mallocCalls() const {
+  return mallocCalls_;
+}
+
+
+long long defiProfile::reallocCalls() const {
+  return reallocCalls_;
+}
+
+
+long long defiProfile::freeCalls() const {
+  return freeCalls_;
+}
+
+
+void defiProfile::print(FILE* f) const {
+  fprintf(f, "%s%s: %lld bytes, %lld tokens, %lld objects, %.3f s "
+          "(lexer %.3f, grammar %.3f, callbacks %.3f), "
+          "%lld malloc, %lld realloc, %lld free\n",
+          sectionName(), isEnd_ ? "" : " (partial)", bytes_, tokens_,
+          objects_, seconds_, lexSeconds_, grammarSeconds(),
+          callbackSeconds_, mallocCalls_, reallocCalls_, freeCalls_);
+}
+
+END_LEFDEF_PARSER_NAMESPACE
@@ -0,0 +1,102 @@
+// *****************************************************************************
+// *****************************************************************************
+// Copyright 2013-2014, Cadence Design Systems
+// 
+// This  file  is  part  of  the  Cadence  LEF/DEF  Open   Source
+// Distribution,  Product Version 5.8. 
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+//    implied. See the License for the specific language governing
+//    permissions and limitations under the License.
+// 
+// For updates, support, or to become part of the LEF/DEF Community,
+// check www.openeda.org for details.
+// 
+//  $Author$
+//  $Revision$
+//  $Date$
+//  $State:  $
+// *****************************************************************************
+// *****************************************************************************
+
+#ifndef defiProfile_h
+#define defiProfile_h
+
+#include <stdio.h>
+#include "defiKRDefs.hpp"
+#include "defiSourceMap.hpp"
+
+BEGIN_LEFDEF_PARSER_NAMESPACE
+
+// Counters of one section of the input, passed to the function set with
+// defrSetProfileCallback() at the end of the section and, if an object
+// interval is set, after every interval objects of the section.  The
+// counters cover the section from its keyword up to the report.  The
+// time is split in the time spent in the lexer, in the user callbacks
+// and in the rest, which is the grammar and its actions.
+class defiProfile {
+public:
+  defiProfile();
+
+  void Init();
+  void clear();
+
+  defiSection_e section() const;
+  const char*   sectionName() const;
+  int           isEnd() const;          // 0 for an interval report
+
+  long long     bytes() const;          // input bytes consumed
+  long long     tokens() const;         // tokens lexed
+  long long     objects() const;        // "- ... ;" statements started
+  double        seconds() const;
+  double        lexSeconds() const;
+  double        callbackSeconds() const;
+  double        grammarSeconds() const;
+  long long     mallocCalls() const;    // defMalloc calls
+  long long     reallocCalls() const;   // defRealloc calls
+  long long     freeCalls() const;      // defFree calls
+
+  void print(FILE* f) const;
+
+  // Used by the parser.
+  static double clock();
+  void beginSection(defiSection_e section, long long offset,
+                    long long tokens);
+  void update(int isEnd, long long offset, long long tokens);
+  void addObject();
+  void addLexTime(double seconds);
+  void addCallbackTime(double seconds);
+  void addMalloc();
+  void addRealloc();
+  void addFree();
+
+protected:
+  int       section_;
+  int       isEnd_;
+  long long startOffset_;
+  long long startTokens_;
+  double    startTime_;
+  long long bytes_;
+  long long tokens_;
+  long long objects_;
+  double    seconds_;
+  double    lexSeconds_;
+  double    callbackSeconds_;
+  long long mallocCalls_;
+  long long reallocCalls_;
+  long long freeCalls_;
+};
+
+END_LEFDEF_PARSER_NAMESPACE
+
+USE_LEFDEF_PARSER_NAMESPACE
+
+#endif
@@ -29,6 +29,7 @@
 
 #include <stdlib.h>
 #include <string.h>
+#define DEF_ALLOC_TYPE defiAllocProp
 #include "lex.h"
 #include "defiProp.hpp"
 #include "defiDebug.hpp"
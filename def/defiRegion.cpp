@@ -29,6 +29,7 @@
 
 #include <string.h>
 #include <stdlib.h>
+#define DEF_ALLOC_TYPE defiAllocRegion
 #include "lex.h"
 #include "defiRegion.hpp"
 #include "defiDebug.hpp"
@@ -31,6 +31,7 @@
 #include <stdlib.h>
 #include "defiRowTrack.hpp"
 #include "defiDebug.hpp"
+#define DEF_ALLOC_TYPE defiAllocRowTrack
 #include "lex.h"
 #include "defiUtil.hpp"
 
@@ -30,6 +30,7 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#define DEF_ALLOC_TYPE defiAllocScanchain
 #include "lex.h"
 #include "defiScanchain.hpp"
 #include "defiDebug.hpp"
@@ -31,6 +31,7 @@
 #include <stdlib.h>
 #include "defiSite.hpp"
 #include "defiDebug.hpp"
+#define DEF_ALLOC_TYPE defiAllocSite
 #include "lex.h"
 #include "defiUtil.hpp"
 
@@ -30,6 +30,7 @@
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
+#define DEF_ALLOC_TYPE defiAllocSlot
 #include "lex.h"
 #include "defiSlot.hpp"
 #include "defiDebug.hpp"
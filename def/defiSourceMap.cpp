@@ -0,0 +1,275 @@
+// *****************************************************************************
+// *****************************************************************************
+// Copyright 2013-2014, Cadence Design Systems
+// 
+// This  file  is  part  of  the  Cadence  LEF/DEF  Open   Source
+// Distribution,  Product Version 5.8. 
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+//    implied. See the License for the specific language governing
+//    permissions and limitations under the License.
+// 
+// For updates, support, or to become part of the LEF/DEF Community,
+// check www.openeda.org for details.
+// 
+//  $Author$
+//  $Revision$
+//  $Date$
+//  $State:  $
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdlib.h>
+#include <string.h>
+#include "defiSourceMap.hpp"
+
+BEGIN_LEFDEF_PARSER_NAMESPACE
+
+static const char* defiSectionNames[defiNumSections] = {
+  "",
+  "PROPERTYDEFINITIONS",
+  "DEFAULTCAP",
+  "VIAS",
+  "STYLES",
+  "NONDEFAULTRULES",
+  "REGIONS",
+  "COMPONENTS",
+  "PINS",
+  "PINPROPERTIES",
+  "BLOCKAGES",
+  "SLOTS",
+  "FILLS",
+  "SPECIALNETS",
+  "NETS",
+  "SCANCHAINS",
+  "GROUPS",
+  "IOTIMINGS",
+  "FLOORPLANCONSTRAINTS",
+  "TIMINGDISABLES",
+  "PARTITIONS",
+  "ASSERTIONS",
+  "CONSTRAINTS"
+};
+
+/*********************************************************
+* class defiSourceMap
+**********************************************************/
+defiSourceMap::defiSourceMap() {
+  Init();
+}
+
+
+defiSourceMap::~defiSourceMap() {
+  Destroy();
+}
+
+
+void defiSourceMap::Init() {
+  sections_ = 0;
+  numSections_ = 0;
+  sectionsAllocated_ = 0;
+  statements_ = 0;
+  numStatements_ = 0;
+  statementsAllocated_ = 0;
+  sectionOpen_ = defiSectionUnknown;
+  statementOpen_ = 0;
+  extend_ = 0;
+}
+
+
+void defiSourceMap::Destroy() {
+  if (sections_)
+    free((char*)sections_);
+  if (statements_)
+    free((char*)statements_);
+  Init();
+}
+
+
+void defiSourceMap::clear() {
+  numSections_ = 0;
+  numStatements_ = 0;
+  sectionOpen_ = defiSectionUnknown;
+  statementOpen_ = 0;
+  extend_ = 0;
+}
+
+
+defiSourceRange* defiSourceMap::addRange(defiSourceRange** ranges, int* num,
+                                         int* allocated) {
+  if (*num == *allocated) {
+    *allocated = *allocated ? *allocated * 2 : 64;
+    *ranges = (defiSourceRange*)realloc((char*)*ranges,
+                                        sizeof(defiSourceRange) * *allocated);
+  }
+  return *ranges + (*num)++;
+}
+
+
+void defiSourceMap::setExtend(defiSourceRange* range) {
+  extend_ = range;
+}
+
+
+void defiSourceMap::beginSection(defiSection_e section, long long start,
+                                 int line) {
+  defiSourceRange* r;
+
+  cancelExtend();
+  r = addRange(&sections_, &numSections_, &sectionsAllocated_);
+  r->start = start;
+  r->end = start;
+  r->line = line;
+  r->numLines = 0;
+  r->section = section;
+  sectionOpen_ = section;
+  statementOpen_ = 0;
+}
+
+
+void defiSourceMap::endSection(long long end, int line) {
+  defiSourceRange* r;
+
+  cancelExtend();
+  if (sectionOpen_ == defiSectionUnknown)
+    return;
+  r = sections_ + numSections_ - 1;
+  r->end = end;
+  r->numLines = line - r->line;
+  sectionOpen_ = defiSectionUnknown;
+  statementOpen_ = 0;
+  setExtend(r);
+}
+
+
+void defiSourceMap::beginStatement(long long start, int line) {
+  defiSourceRange* r;
+
+  cancelExtend();
+  if (sectionOpen_ == defiSectionUnknown)
+    return;
+  r = addRange(&statements_, &numStatements_, &statementsAllocated_);
+  r->start = start;
+  r->end = start;
+  r->line = line;
+  r->numLines = 0;
+  r->section = numSections_ - 1;
+  statementOpen_ = 1;
+}
+
+
+void defiSourceMap::endStatement(long long end, int line) {
+  defiSourceRange* r;
+
+  cancelExtend();
+  if (!statementOpen_)
+    return;
+  r = statements_ + numStatements_ - 1;
+  r->end = end;
+  r->numLines = line - r->line;
+  statementOpen_ = 0;
+  setExtend(r);
+}
+
+
+void defiSourceMap::extendEnd(long long end) {
+  if (!extend_)
+    return;
+  extend_->end = end;
+  extend_->numLines++;
+  extend_ = 0;
+}
+
+
+void defiSourceMap::cancelExtend() {
+  extend_ = 0;
+}
+
+
+int defiSourceMap::inStatement() const {
+  return statementOpen_;
+}
+
+
+int defiSourceMap::sectionOpen() const {
+  return sectionOpen_;
+}
+
+
+int defiSourceMap::numSections() const {
+  return numSections_;
+}
+
+
+const defiSourceRange* defiSourceMap::section(int index) const {
+  if (index < 0 || index >= numSections_)
+    return 0;
+  return sections_ + index;
+}
+
+
+int defiSourceMap::findSection(defiSection_e section) const {
+  int i;
+
+  for (i = 0; i < numSections_; i++)
+    if (sections_[i].section == section)
+      return i;
+  return -1;
+}
+
+
+int defiSourceMap::numStatements() const {
+  return numStatements_;
+}
+
+
+const defiSourceRange* defiSourceMap::statement(int index) const {
+  if (index < 0 || index >= numStatements_)
+    return 0;
+  return statements_ + index;
+}
+
+
+int defiSourceMap::firstStatement(int index) const {
+  int lo = 0;
+  int hi = numStatements_;
+
+  // Statements are in file order, so their section indexes are sorted.
+  while (lo < hi) {
+    int mid = lo + (hi - lo) / 2;
+    if (statements_[mid].section < index)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return lo;
+}
+
+
+const char* defiSourceMap::sectionName(defiSection_e section) {
+  if (section < 0 || section >= defiNumSections)
+    return "";
+  return defiSectionNames[section];
+}
+
+
+void defiSourceMap::print(FILE* f) const {
+  int i;
+
+  for (i = 0; i < numSections_; i++) {
+    const defiSourceRange* r = sections_ + i;
+    fprintf(f, "%s %lld %lld line %d lines %d statements %d\n",
+            sectionName((defiSection_e)r->section), r->start, r->end,
+            r->line, r->numLines, firstStatement(i + 1) - firstStatement(i));
+  }
+}
+
+END_LEFDEF_PARSER_NAMESPACE
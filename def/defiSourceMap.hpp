@@ -0,0 +1,139 @@
+// *****************************************************************************
+// *****************************************************************************
+// Copyright 2013-2014, Cadence Design Systems
+// 
+// This  file  is  part  of  the  Cadence  LEF/DEF  Open   Source
+// Distribution,  Product Version 5.8. 
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+//    implied. See the License for the specific language governing
+//    permissions and limitations under the License.
+// 
+// For updates, support, or to become part of the LEF/DEF Community,
+// check www.openeda.org for details.
+// 
+//  $Author$
+//  $Revision$
+//  $Date$
+//  $State:  $
+// *****************************************************************************
+// *****************************************************************************
+
+#ifndef defiSourceMap_h
+#define defiSourceMap_h
+
+#include <stdio.h>
+#include "defiKRDefs.hpp"
+
+BEGIN_LEFDEF_PARSER_NAMESPACE
+
+// Sections of a DEF file that end with END <section>.
+typedef enum {
+  defiSectionUnknown = 0,
+  defiSectionPropertyDefinitions,
+  defiSectionDefaultCap,
+  defiSectionVias,
+  defiSectionStyles,
+  defiSectionNonDefaultRules,
+  defiSectionRegions,
+  defiSectionComponents,
+  defiSectionPins,
+  defiSectionPinProperties,
+  defiSectionBlockages,
+  defiSectionSlots,
+  defiSectionFills,
+  defiSectionSpecialNets,
+  defiSectionNets,
+  defiSectionScanChains,
+  defiSectionGroups,
+  defiSectionIOTimings,
+  defiSectionFPC,
+  defiSectionTimingDisables,
+  defiSectionPartitions,
+  defiSectionAssertions,
+  defiSectionConstraints,
+  defiNumSections
+} defiSection_e;
+
+// A byte range [start, end) of the input.  line is the line the range
+// starts on and numLines the number of newlines inside it.
+struct defiSourceRange {
+  long long start;
+  long long end;
+  int       line;
+  int       numLines;
+  int       section;      // defiSection_e of a section, or the index of
+                          // the section a statement belongs to
+};
+
+// Byte ranges of the sections, and of the "- ... ;" statements inside
+// them, built during defrRead() when defrSetBuildSourceMap() is on.
+// A range starts at the beginning of its first line if only blanks
+// precede it there, and ends after the newline that follows it if only
+// blanks follow it.  Copying all the ranges of a file in order with
+// the text between them reproduces the file.  The offsets are offsets
+// in the data returned by the read function, so they are file offsets
+// only when reading an uncompressed file.
+class defiSourceMap {
+public:
+  defiSourceMap();
+  ~defiSourceMap();
+
+  void Init();
+  void Destroy();
+  void clear();
+
+  // Used by the parser.
+  void beginSection(defiSection_e section, long long start, int line);
+  void endSection(long long end, int line);
+  void beginStatement(long long start, int line);
+  void endStatement(long long end, int line);
+  void extendEnd(long long end);  // moves the end of the last range ended
+  void cancelExtend();            // keeps it
+  int  inStatement() const;
+  int  sectionOpen() const;       // defiSection_e of the open section
+
+  int                    numSections() const;
+  const defiSourceRange* section(int index) const;
+  // Index of the first section of the given kind, or -1.
+  int                    findSection(defiSection_e section) const;
+
+  int                    numStatements() const;
+  const defiSourceRange* statement(int index) const;
+  // The statements of section index are [firstStatement(index),
+  // firstStatement(index + 1)).
+  int                    firstStatement(int index) const;
+
+  static const char*     sectionName(defiSection_e section);
+
+  void print(FILE* f) const;
+
+protected:
+  defiSourceRange* addRange(defiSourceRange** ranges, int* num,
+                            int* allocated);
+  void             setExtend(defiSourceRange* range);
+
+  defiSourceRange* sections_;
+  int              numSections_;
+  int              sectionsAllocated_;
+  defiSourceRange* statements_;
+  int              numStatements_;
+  int              statementsAllocated_;
+  int              sectionOpen_;
+  int              statementOpen_;
+  defiSourceRange* extend_;           // range to end at the next newline
+};
+
+END_LEFDEF_PARSER_NAMESPACE
+
+USE_LEFDEF_PARSER_NAMESPACE
+
+#endif
@@ -0,0 +1,613 @@
+// *****************************************************************************
+// *****************************************************************************
+// Copyright 2013-2014, Cadence Design Systems
+// 
+// This  file  is  part  of  the  Cadence  LEF/DEF  Open   Source
+// Distribution,  Product Version 5.8. 
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+//    implied. See the License for the specific language governing
+//    permissions and limitations under the License.
+// 
+// For updates, support, or to become part of the LEF/DEF Community,
+// check www.openeda.org for details.
+// 
+//  $Author$
+//  $Revision$
+//  $Date$
+//  $State:  $
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "defiStats.hpp"
+
+BEGIN_LEFDEF_PARSER_NAMESPACE
+
+#define DEFI_STATS_BUF_SIZE (1 << 20)
+
+// The via or layer names with their counts, interned in an open
+// addressing hash table, and sorted by name by index().
+class defiStatsNames {
+public:
+  struct Entry {
+    std::string  name;
+    unsigned int hash;
+    long long    count;
+  };
+
+  defiStatsNames() : table(64, -1) {}
+
+  void clear() {
+    entries.clear();
+    sorted.clear();
+    table.assign(64, -1);
+  }
+
+  void add(const char* name, int len) {
+    unsigned int hash = 2166136261u;      // FNV-1a
+    size_t       mask = table.size() - 1;
+    size_t       i;
+    int          e;
+
+    for (i = 0; i < (size_t) len; i++)
+      hash = (hash ^ (unsigned char) name[i]) * 16777619u;
+    for (i = hash & mask; (e = table[i]) != -1; i = (i + 1) & mask) {
+      if (entries[e].hash == hash && entries[e].name.size() == (size_t) len &&
+          !memcmp(entries[e].name.data(), name, len)) {
+        entries[e].count++;
+        return;
+      }
+    }
+    table[i] = (int) entries.size();
+    entries.push_back(Entry());
+    entries.back().name.assign(name, len);
+    entries.back().hash = hash;
+    entries.back().count = 1;
+    if (entries.size() * 2 > table.size())
+      grow();
+  }
+
+  void index() {
+    size_t i;
+
+    sorted.clear();
+    for (i = 0; i < entries.size(); i++)
+      sorted.push_back(&entries[i]);
+    std::sort(sorted.begin(), sorted.end(), less);
+  }
+
+  std::vector<Entry>        entries;
+  std::vector<const Entry*> sorted;
+
+private:
+  static bool less(const Entry* a, const Entry* b) {
+    return a->name < b->name;
+  }
+
+  void grow() {
+    size_t mask = table.size() * 2 - 1;
+    size_t e, i;
+
+    table.assign(mask + 1, -1);
+    for (e = 0; e < entries.size(); e++) {
+      for (i = entries[e].hash & mask; table[i] != -1; i = (i + 1) & mask)
+        ;
+      table[i] = (int) e;
+    }
+  }
+
+  std::vector<int>          table;
+};
+
+// The input of defiStats::scan(), read in large blocks.  The tokens are
+// not copied: the token being read is moved to the front of the buffer
+// before the next block is read, so it is always whole in buf.
+struct defiStatsInput {
+  FILE*     f;
+  size_t    (*readFunction)(FILE*, char*, size_t);
+  char*     buf;
+  size_t    size;
+  char*     cur;
+  char*     end;
+  long long bytes;
+  long long lines;
+};
+
+#define defiStatsSpace(c) ((c) == ' ' || ((c) >= '\t' && (c) <= '\r'))
+
+#define defiStatsIs(t, n, word) \
+  ((n) == (int) sizeof(word) - 1 && !memcmp((t), (word), (n)))
+
+// Moves the characters from in->cur to the front of the buffer and reads
+// the next block after them.  Returns 0 at the end of the input.
+static int defiStatsFill(defiStatsInput* in) {
+  size_t      keep = in->end - in->cur;
+  size_t      len;
+  const char* p;
+
+  if (keep == in->size) {         // a token as long as the buffer
+    in->size *= 2;
+    in->buf = (char*) realloc(in->buf, in->size);
+  } else {
+    memmove(in->buf, in->cur, keep);
+  }
+  in->cur = in->buf;
+  in->end = in->buf + keep;
+  if (in->readFunction)
+    len = (*in->readFunction)(in->f, in->end, in->size - keep);
+  else
+    len = fread(in->end, 1, in->size - keep, in->f);
+  if (len == 0 || len == (size_t) -1)
+    return 0;
+  for (p = in->end; (p = (const char*) memchr(p, '\n', in->end + len - p));
+       p++)
+    in->lines++;
+  in->bytes += len;
+  in->end += len;
+  return 1;
+}
+
+// Sets *token to the next token, in the buffer until the next call, and
+// returns its length, or 0 at the end of the input.  Comments are
+// skipped and a quoted string is one token.
+static int defiStatsNext(defiStatsInput* in, const char** token) {
+  const char* p = in->cur;
+  const char* q;
+  int         comment = 0;
+  int         len;
+
+  for (;;) {
+    if (comment && (q = (const char*) memchr(p, '\n', in->end - p)) != 0) {
+      p = q + 1;
+      comment = 0;
+    }
+    if (!comment)
+      while (p < in->end && defiStatsSpace(*p))
+        p++;
+    if (p < in->end && !comment) {
+      if (*p != '#')
+        break;
+      comment = 1;
+      continue;
+    }
+    in->cur = in->end;
+    if (!defiStatsFill(in))
+      return 0;
+    p = in->cur;
+  }
+
+  for (;;) {
+    q = p;
+    if (*q == '"') {
+      for (q++; q < in->end && *q != '"'; q++)
+        if (*q == '\\' && ++q == in->end)
+          break;
+      if (q < in->end) {
+        q++;
+        break;
+      }
+    } else {
+      while (q < in->end && !defiStatsSpace(*q))
+        q++;
+      if (q < in->end)
+        break;
+    }
+    // the token goes on in the next block
+    in->cur = (char*) p;
+    if (!defiStatsFill(in)) {
+      *token = in->cur;
+      len = (int) (in->end - in->cur);
+      in->cur = in->end;
+      return len;
+    }
+    p = in->cur;
+  }
+  *token = p;
+  in->cur = (char*) q;
+  return (int) (q - p);
+}
+
+// Skips the tokens up to and including the next token stop, as the
+// points of a path, counting them in *tokens.  A ';' is not skipped, so
+// the statement still ends where it should.
+static void defiStatsSkip(defiStatsInput* in, char stop, long long* tokens) {
+  const char* t;
+  int         n;
+
+  while ((n = defiStatsNext(in, &t)) != 0) {
+    if (n == 1 && *t == ';') {
+      in->cur = (char*) t;
+      return;
+    }
+    (*tokens)++;
+    if (n == 1 && *t == stop)
+      return;
+  }
+}
+
+static int defiStatsNumber(const char* t, int n) {
+  int i = 0;
+
+  if (i < n && (t[i] == '-' || t[i] == '+'))
+    i++;
+  if (i < n && t[i] == '.')
+    i++;
+  return i < n && t[i] >= '0' && t[i] <= '9';
+}
+
+static long long defiStatsValue(const char* t, int n) {
+  long long value = 0;
+  int       i = 0;
+
+  if (i < n && t[i] == '+')
+    i++;
+  for (; i < n && t[i] >= '0' && t[i] <= '9'; i++)
+    value = value * 10 + t[i] - '0';
+  return value;
+}
+
+static int defiStatsIsOneOf(const char* t, int n, const char* const* words) {
+  for (; *words; words++)
+    if (**words == *t && !strncmp(t, *words, n) && !(*words)[n])
+      return 1;
+  return 0;
+}
+
+static const char* const defiStatsRouteWords[] = {
+  "ROUTED", "FIXED", "COVER", "NOSHIELD", 0
+};
+
+// Words of a wiring path that are not via names.
+static const char* const defiStatsPathWords[] = {
+  "TAPER", "DO", "BY", "STEP", "RECT", "VIRTUAL",
+  "N", "S", "E", "W", "FN", "FS", "FE", "FW", 0
+};
+
+// Words of a wiring path followed by a value.
+static const char* const defiStatsPathValueWords[] = {
+  "MASK", "STYLE", "TAPERRULE", 0
+};
+
+static defiSection_e defiStatsSection(const char* t, int n) {
+  const char* name;
+  int         i;
+
+  for (i = defiSectionUnknown + 1; i < defiNumSections; i++) {
+    name = defiSourceMap::sectionName((defiSection_e) i);
+    if (!strncmp(t, name, n) && !name[n])
+      return (defiSection_e) i;
+  }
+  return defiSectionUnknown;
+}
+
+/*********************************************************
+* class defiStats
+**********************************************************/
+defiStats::defiStats()
+: vias_(new defiStatsNames),
+  layers_(new defiStatsNames) {
+  clear();
+}
+
+
+defiStats::~defiStats() {
+  delete vias_;
+  delete layers_;
+}
+
+
+void defiStats::clear() {
+  bytes_ = 0;
+  lines_ = 0;
+  tokens_ = 0;
+  memset(objects_, 0, sizeof(objects_));
+  memset(declared_, 0, sizeof(declared_));
+  memset(numSections_, 0, sizeof(numSections_));
+  routedNets_ = 0;
+  unroutedNets_ = 0;
+  routedSNets_ = 0;
+  unroutedSNets_ = 0;
+  vias_->clear();
+  layers_->clear();
+}
+
+
+long long defiStats::bytes() const {
+  return bytes_;
+}
+
+
+long long defiStats::lines() const {
+  return lines_;
+}
+
+
+long long defiStats::tokens() const {
+  return tokens_;
+}
+
+
+long long defiStats::objects(defiSection_e section) const {
+  if (section < 0 || section >= defiNumSections)
+    return 0;
+  return objects_[section];
+}
+
+
+long long defiStats::declared(defiSection_e section) const {
+  if (section < 0 || section >= defiNumSections)
+    return 0;
+  return declared_[section];
+}
+
+
+int defiStats::numSections(defiSection_e section) const {
+  if (section < 0 || section >= defiNumSections)
+    return 0;
+  return numSections_[section];
+}
+
+
+long long defiStats::routedNets() const {
+  return routedNets_;
+}
+
+
+long long defiStats::unroutedNets() const {
+  return unroutedNets_;
+}
+
+
+long long defiStats::routedSpecialNets() const {
+  return routedSNets_;
+}
+
+
+long long defiStats::unroutedSpecialNets() const {
+  return unroutedSNets_;
+}
+
+
+int defiStats::numVias() const {
+  return (int) vias_->sorted.size();
+}
+
+
+const char* defiStats::via(int index) const {
+  if (index < 0 || index >= numVias())
+    return 0;
+  return vias_->sorted[index]->name.c_str();
+}
+
+
+long long defiStats::viaCount(int index) const {
+  if (index < 0 || index >= numVias())
+    return 0;
+  return vias_->sorted[index]->count;
+}
+
+
+int defiStats::numLayers() const {
+  return (int) layers_->sorted.size();
+}
+
+
+const char* defiStats::layer(int index) const {
+  if (index < 0 || index >= numLayers())
+    return 0;
+  return layers_->sorted[index]->name.c_str();
+}
+
+
+long long defiStats::layerWires(int index) const {
+  if (index < 0 || index >= numLayers())
+    return 0;
+  return layers_->sorted[index]->count;
+}
+
+
+int defiStats::scan(FILE* f, size_t (*readFunction)(FILE*, char*, size_t)) {
+  defiStatsInput in;
+  const char*    t;
+  int            n;
+  defiSection_e  section = defiSectionUnknown;
+  int            start = 1;       // next token starts a statement
+  int            header = 0;      // in "<SECTION> count ;"
+  int            object = 0;      // in a statement of a section
+  int            skipExtension = 0;
+  int            skip = 0;        // tokens to skip
+  int            end = 0;         // the token after END
+  int            plus = 0;        // the token after +
+  int            path = 0;        // in a wiring path
+  int            layer = 0;       // the next token is a layer
+  int            shield = 0;      // "+ SHIELD net" is followed by a layer
+  int            viaNext = 0;     // "+ VIA via" of SPECIALNETS
+  int            routed = 0;
+
+  in.f = f;
+  in.readFunction = readFunction;
+  in.size = DEFI_STATS_BUF_SIZE;
+  in.buf = (char*) malloc(in.size);
+  in.cur = in.buf;
+  in.end = in.buf;
+  in.bytes = 0;
+  in.lines = 0;
+
+  // Only the first tokens of a statement, the tokens after "+" and the
+  // tokens of a wiring path are looked at; the other statements and the
+  // points "( x y )" are skipped by defiStatsSkip().
+  while ((n = defiStatsNext(&in, &t)) != 0) {
+    int wiring = section == defiSectionNets ||
+                 section == defiSectionSpecialNets;
+
+    tokens_++;
+    if (skipExtension) {
+      if (defiStatsIs(t, n, "ENDEXT")) {
+        skipExtension = 0;
+        start = 1;
+      }
+      continue;
+    }
+    if (end) {
+      end = 0;
+      start = 1;
+      section = defiSectionUnknown;
+      continue;
+    }
+    if (n == 1 && *t == ';') {
+      if (object && wiring) {
+        if (section == defiSectionNets)
+          routed ? routedNets_++ : unroutedNets_++;
+        else
+          routed ? routedSNets_++ : unroutedSNets_++;
+      }
+      start = 1;
+      header = object = skip = 0;
+      plus = path = layer = shield = viaNext = routed = 0;
+      continue;
+    }
+
+    if (start) {
+      start = 0;
+      if (defiStatsIs(t, n, "END")) {
+        end = 1;
+      } else if (section == defiSectionUnknown) {
+        if (defiStatsIs(t, n, "BEGINEXT")) {
+          skipExtension = 1;
+        } else if ((section = defiStatsSection(t, n)) != defiSectionUnknown) {
+          numSections_[section]++;
+          header = 1;
+        } else {
+          defiStatsSkip(&in, ';', &tokens_);      // HISTORY, DESIGN, ...
+        }
+      } else {
+        objects_[section]++;
+        object = 1;
+        if (!wiring)
+          defiStatsSkip(&in, ';', &tokens_);
+        else if (n == 1 && *t == '-')
+          skip = 1;
+      }
+      continue;
+    }
+
+    if (header) {
+      if (defiStatsNumber(t, n))
+        declared_[section] += defiStatsValue(t, n);
+      header = 0;
+      continue;
+    }
+    if (skip) {
+      if (--skip == 0 && shield) {
+        shield = 0;
+        layer = 1;
+      }
+      continue;
+    }
+    if (!wiring || *t == '"')
+      continue;
+    if (n == 1 && *t == '(') {
+      defiStatsSkip(&in, ')', &tokens_);
+      continue;
+    }
+    if (n == 1 && *t == ')')
+      continue;
+    if (viaNext) {
+      viaNext = 0;
+      vias_->add(t, n);
+      continue;
+    }
+    if (n == 1 && *t == '+') {
+      plus = 1;
+      layer = 0;                      // not "+ FIXED + SHAPE ..."
+      continue;
+    }
+    if (layer) {
+      layer = 0;
+      path = 1;
+      layers_->add(t, n);
+      continue;
+    }
+    if (plus) {
+      plus = 0;
+      if (defiStatsIsOneOf(t, n, defiStatsRouteWords)) {
+        routed = layer = 1;
+      } else if (defiStatsIs(t, n, "SHIELD")) {
+        routed = shield = skip = 1;
+      } else if (path && (defiStatsIs(t, n, "SHAPE") ||
+                          defiStatsIs(t, n, "STYLE") ||
+                          defiStatsIs(t, n, "MASK"))) {
+        skip = 1;
+      } else {
+        path = 0;
+        viaNext = section == defiSectionSpecialNets &&
+                  defiStatsIs(t, n, "VIA");
+      }
+      continue;
+    }
+    if (!path) {
+      if (defiStatsIsOneOf(t, n, defiStatsRouteWords))   // after SUBNET
+        routed = layer = 1;
+      continue;
+    }
+    if (defiStatsNumber(t, n) || (n == 1 && *t == '*') ||
+        defiStatsIsOneOf(t, n, defiStatsPathWords))
+      continue;
+    if (defiStatsIs(t, n, "NEW"))
+      layer = 1;
+    else if (defiStatsIsOneOf(t, n, defiStatsPathValueWords))
+      skip = 1;
+    else if (!defiStatsIsOneOf(t, n, defiStatsRouteWords))
+      vias_->add(t, n);
+    else
+      routed = layer = 1;
+  }
+
+  bytes_ += in.bytes;
+  lines_ += in.lines;
+  vias_->index();
+  layers_->index();
+  free(in.buf);
+  return section != defiSectionUnknown || skipExtension;
+}
+
+
+void defiStats::print(FILE* f, int printVias) const {
+  int i;
+
+  fprintf(f, "bytes %lld lines %lld tokens %lld\n", bytes_, lines_, tokens_);
+  for (i = defiSectionUnknown + 1; i < defiNumSections; i++) {
+    if (!numSections_[i])
+      continue;
+    fprintf(f, "%-20s %12lld", defiSourceMap::sectionName((defiSection_e) i),
+            objects_[i]);
+    if (declared_[i] && declared_[i] != objects_[i])
+      fprintf(f, " (declared %lld)", declared_[i]);
+    fprintf(f, "\n");
+  }
+  if (numSections_[defiSectionNets])
+    fprintf(f, "nets routed %lld unrouted %lld\n", routedNets_,
+            unroutedNets_);
+  if (numSections_[defiSectionSpecialNets])
+    fprintf(f, "specialnets routed %lld unrouted %lld\n", routedSNets_,
+            unroutedSNets_);
+  for (i = 0; i < numLayers(); i++)
+    fprintf(f, "layer %-16s wires %lld\n", layer(i), layerWires(i));
+  for (i = 0; printVias && i < numVias(); i++)
+    fprintf(f, "via %-18s %lld\n", via(i), viaCount(i));
+}
+
+END_LEFDEF_PARSER_NAMESPACE
@@ -0,0 +1,108 @@
+// *****************************************************************************
+// *****************************************************************************
+// Copyright 2013-2014, Cadence Design Systems
+// 
+// This  file  is  part  of  the  Cadence  LEF/DEF  Open   Source
+// Distribution,  Product Version 5.8. 
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+//    implied. See the License for the specific language governing
+//    permissions and limitations under the License.
+// 
+// For updates, support, or to become part of the LEF/DEF Community,
+// check www.openeda.org for details.
+// 
+//  $Author$
+//  $Revision$
+//  $Date$
+//  $State:  $
+// *****************************************************************************
+// *****************************************************************************
+
+#ifndef defiStats_h
+#define defiStats_h
+
+#include <stdio.h>
+#include <stddef.h>
+#include "defiKRDefs.hpp"
+#include "defiSourceMap.hpp"
+
+BEGIN_LEFDEF_PARSER_NAMESPACE
+
+class defiStatsNames;
+
+// Statistics of a DEF file computed by defrScanStats() without parsing
+// it: a tokenizer follows the sections and the "- ... ;" statements and
+// looks at the routing of NETS and SPECIALNETS, with no defi objects and
+// no callbacks.  Keywords are recognized in upper case only, and the
+// file is not checked, so the numbers of a bad file are not reliable.
+class defiStats {
+public:
+  defiStats();
+  ~defiStats();
+
+  void clear();
+
+  long long bytes() const;
+  long long lines() const;
+  long long tokens() const;
+
+  // Number of "- ... ;" statements found in the sections of the kind,
+  // and the sum of the numbers after their keywords.
+  long long objects(defiSection_e section) const;
+  long long declared(defiSection_e section) const;
+  int       numSections(defiSection_e section) const;
+
+  // Nets with and without ROUTED, FIXED, COVER or NOSHIELD wiring.
+  long long routedNets() const;
+  long long unroutedNets() const;
+  long long routedSpecialNets() const;
+  long long unroutedSpecialNets() const;
+
+  // Vias used in the wiring of NETS and SPECIALNETS, and the number of
+  // wires, a layer starting a wiring path, per layer; sorted by name.
+  int         numVias() const;
+  const char* via(int index) const;
+  long long   viaCount(int index) const;
+  int         numLayers() const;
+  const char* layer(int index) const;
+  long long   layerWires(int index) const;
+
+  void print(FILE* f, int printVias = 1) const;
+
+  // Used by defrScanStats(), with fread() if readFunction is null.
+  // Returns 0, or 1 if a section was still open at the end of the file.
+  int scan(FILE* f, size_t (*readFunction)(FILE*, char*, size_t));
+
+protected:
+  long long       bytes_;
+  long long       lines_;
+  long long       tokens_;
+  long long       objects_[defiNumSections];
+  long long       declared_[defiNumSections];
+  int             numSections_[defiNumSections];
+  long long       routedNets_;
+  long long       unroutedNets_;
+  long long       routedSNets_;
+  long long       unroutedSNets_;
+  defiStatsNames* vias_;
+  defiStatsNames* layers_;
+
+private:
+  defiStats(const defiStats&);
+  defiStats& operator=(const defiStats&);
+};
+
+END_LEFDEF_PARSER_NAMESPACE
+
+USE_LEFDEF_PARSER_NAMESPACE
+
+#endif
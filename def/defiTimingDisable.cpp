@@ -29,6 +29,7 @@
 
 #include <string.h>
 #include <stdlib.h>
+#define DEF_ALLOC_TYPE defiAllocTimingDisable
 #include "lex.h"
 #include "defiTimingDisable.hpp"
 #include "defiDebug.hpp"
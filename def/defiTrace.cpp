@@ -0,0 +1,121 @@
+// *****************************************************************************
+// *****************************************************************************
+// Copyright 2013-2014, Cadence Design Systems
+// 
+// This  file  is  part  of  the  Cadence  LEF/DEF  Open   Source
+// Distribution,  Product Version 5.8. 
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+//    implied. See the License for the specific language governing
+//    permissions and limitations under the License.
+// 
+// For updates, support, or to become part of the LEF/DEF Community,
+// check www.openeda.org for details.
+// 
+//  $Author$
+//  $Revision$
+//  $Date$
+//  $State:  $
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdio.h>
+#ifndef WIN32
+#   include <pthread.h>
+#endif
+#include "defrReader.hpp"
+#include "defiProfile.hpp"
+#include "defiTrace.hpp"
+
+BEGIN_LEFDEF_PARSER_NAMESPACE
+
+int defiTraceOn = 0;
+
+static FILE*  traceFile = 0;
+static double traceOrigin = 0;
+static int    traceEvents = 0;
+static int    traceThreads = 0;
+static int    traceSample = 1;
+#ifndef WIN32
+static pthread_mutex_t traceLock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+static DEFR_THREAD_LOCAL int traceTid = 0;
+static DEFR_THREAD_LOCAL int traceCallbacks = 0;
+
+static void lock() {
+#ifndef WIN32
+  pthread_mutex_lock(&traceLock);
+#endif
+}
+
+static void unlock() {
+#ifndef WIN32
+  pthread_mutex_unlock(&traceLock);
+#endif
+}
+
+int defiTraceOpen(const char* fileName, int callbackSample) {
+  FILE* f = fopen(fileName, "w");
+
+  if (!f)
+    return 1;
+  lock();
+  if (traceFile)
+    fclose(traceFile);
+  traceFile = f;
+  traceOrigin = defiProfile::clock();
+  traceEvents = 0;
+  traceSample = callbackSample > 0 ? callbackSample : 1;
+  fprintf(traceFile, "{\"traceEvents\": [\n");
+  defiTraceOn = 1;
+  unlock();
+  return 0;
+}
+
+int defiTraceClose() {
+  int res = 0;
+
+  lock();
+  defiTraceOn = 0;
+  if (traceFile) {
+    fprintf(traceFile, "\n], \"displayTimeUnit\": \"ms\"}\n");
+    res = fclose(traceFile);
+    traceFile = 0;
+  }
+  unlock();
+  return res;
+}
+
+void defiTraceSpan(const char* cat, const char* name, double start,
+                   const char* argName, long long arg) {
+  double end = defiProfile::clock();
+
+  lock();
+  if (traceFile) {
+    if (!traceTid)
+      traceTid = ++traceThreads;
+    fprintf(traceFile, "%s{\"name\": \"%s\", \"cat\": \"%s\", \"ph\": \"X\", "
+            "\"ts\": %.3f, \"dur\": %.3f, \"pid\": 1, \"tid\": %d",
+            traceEvents++ ? ",\n" : "", name, cat,
+            (start - traceOrigin) * 1e6, (end - start) * 1e6, traceTid);
+    if (argName)
+      fprintf(traceFile, ", \"args\": {\"%s\": %lld}", argName, arg);
+    fprintf(traceFile, "}");
+  }
+  unlock();
+}
+
+int defiTraceSampleCallback() {
+  return ++traceCallbacks % traceSample == 0;
+}
+
+END_LEFDEF_PARSER_NAMESPACE
@@ -0,0 +1,58 @@
+// *****************************************************************************
+// *****************************************************************************
+// Copyright 2013-2014, Cadence Design Systems
+// 
+// This  file  is  part  of  the  Cadence  LEF/DEF  Open   Source
+// Distribution,  Product Version 5.8. 
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+//    implied. See the License for the specific language governing
+//    permissions and limitations under the License.
+// 
+// For updates, support, or to become part of the LEF/DEF Community,
+// check www.openeda.org for details.
+// 
+//  $Author$
+//  $Revision$
+//  $Date$
+//  $State:  $
+// *****************************************************************************
+// *****************************************************************************
+
+#ifndef defiTrace_h
+#define defiTrace_h
+
+#include "defiKRDefs.hpp"
+
+BEGIN_LEFDEF_PARSER_NAMESPACE
+
+// Timeline of reads and writes in the Chrome trace format, which loads
+// in chrome://tracing and ui.perfetto.dev.  Between defiTraceOpen() and
+// defiTraceClose() every thread records spans into the file: the DEF
+// sections read and written, input buffer reloads, output buffer
+// flushes, gzip blocks, and one in callbackSample reader callbacks.
+// Returns 0 if the file could be opened.
+extern int  defiTraceOpen(const char* fileName, int callbackSample = 100);
+extern int  defiTraceClose();
+
+// Used by the reader, the writer and defzlib.  start is a
+// defiProfile::clock() time; the span ends now.  argName, if set, is
+// recorded with arg as the argument of the span.
+extern int  defiTraceOn;
+extern void defiTraceSpan(const char* cat, const char* name, double start,
+                          const char* argName = 0, long long arg = 0);
+extern int  defiTraceSampleCallback();
+
+END_LEFDEF_PARSER_NAMESPACE
+
+USE_LEFDEF_PARSER_NAMESPACE
+
+#endif
@@ -70,6 +70,12 @@
 #include "defiFill.hpp"
 #include "defiNonDefault.hpp"
 #include "defiPropType.hpp"
+#include "defiNameIndex.hpp"
+#include "defiSourceMap.hpp"
+#include "defiStats.hpp"
+#include "defiAlloc.hpp"
+#include "defiProfile.hpp"
+#include "defiTrace.hpp"
 
 BEGIN_LEFDEF_PARSER_NAMESPACE
 
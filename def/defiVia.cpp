@@ -29,6 +29,7 @@
 
 #include <string.h>
 #include <stdlib.h>
+#define DEF_ALLOC_TYPE defiAllocVia
 #include "lex.h"
 #include "defiVia.hpp"
 #include "defiDebug.hpp"
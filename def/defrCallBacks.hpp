@@ -152,7 +152,7 @@ public:
 
 };
 
-extern defrCallbacks *defCallbacks;
+extern DEFR_THREAD_LOCAL defrCallbacks *defCallbacks;
 
 END_LEFDEF_PARSER_NAMESPACE
 
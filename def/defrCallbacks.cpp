@@ -31,7 +31,7 @@
 
 BEGIN_LEFDEF_PARSER_NAMESPACE
 
-defrCallbacks *defCallbacks = NULL;
+DEFR_THREAD_LOCAL defrCallbacks *defCallbacks = NULL;
 
 defrCallbacks::defrCallbacks()
 : DesignCbk(NULL),
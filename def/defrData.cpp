@@ -42,7 +42,7 @@ BEGIN_LEFDEF_PARSER_NAMESPACE
 extern void *defMalloc(size_t def_size);
 extern void defFree(void *name);
 
-defrData *defData = NULL;
+DEFR_THREAD_LOCAL defrData *defData = NULL;
 
 defrData::defrData()
 : Subnet(0),
@@ -132,8 +132,10 @@ defrData::defrData()
   specialWire_mask(0),
   step_is_keyword(0),
   stylesWarnings(0),
+  totalErrors(0),
   trackWarnings(0),
   unitsWarnings(0),
+  validating(0),
   versionWarnings(0),
   viaRule(0),
   viaWarnings(0),
@@ -179,9 +181,22 @@ defrData::defrData()
   Styles(),
   doneDesign(0),
   NeedPathData(0),
-  deftoken((char*)defMalloc(TOKEN_SIZE)),
-  uc_token((char*)defMalloc(TOKEN_SIZE)),
-  pv_deftoken((char*)defMalloc(TOKEN_SIZE))
+  indexNetId(-1),
+  bufferOffset(0),
+  tokenOffset(-1),
+  tokenLineStart(-1),
+  mapStatementStart(1),
+  mapAfterEnd(0),
+  sectionOpen(defiSectionUnknown),
+  sectionObjects(0),
+  sampleSkip(0),
+  inputSize(-1),
+  progressStart(0),
+  progressLast(0),
+  traceSectionStart(0),
+  deftoken((char*)malloc(TOKEN_SIZE)),    // realloc'd and freed by the
+  uc_token((char*)malloc(TOKEN_SIZE)),    // lexer with the C library
+  pv_deftoken((char*)malloc(TOKEN_SIZE))
 {
     magic[0] = '\0';
     deftoken[0] = '\0';
@@ -242,12 +257,20 @@ defrData::defrData()
       for (i = 0; i < RING_SIZE; i++) {
           defFree(ring[i]);
       }
+
+      if (defSettings && defSettings->AllocStats) {
+          defAliasMap::iterator it;
+          for (it = def_alias_set.begin(); it != def_alias_set.end(); it++)
+              defSettings->AllocStats->aliasSet(it->first.size() +
+                                                it->second.size(), 0);
+      }
   }
 
 void
 defrData::reset()
 {
     delete defData;
+    defData = NULL;   // defMalloc() looks at it while constructing
     defData = new defrData();
 }
 
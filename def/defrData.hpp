@@ -133,7 +133,6 @@ public:
     int  no_num; 
     int  nonDefaultWarnings; 
     int  nondef_is_keyword; 
-    int  ntokens; 
     int  orient_is_keyword; 
     int  parsing_property; 
     int  pinExtWarnings; 
@@ -152,14 +151,17 @@ public:
     int  specialWire_mask; 
     int  step_is_keyword; 
     int  stylesWarnings; 
+    int  totalErrors; // errors reported, unlike errors not reset
     int  trackWarnings; 
     int  unitsWarnings; 
+    int  validating; // defrValidate(): checks given without callbacks
     int  versionWarnings; 
     int  viaRule; // keep track the viarule has called first
     int  viaWarnings; 
     int  virtual_is_keyword; 
     int  deftokenLength;
     long long nlines;
+    long long ntokens;
 
     std::vector<char>  History_text; 
     defAliasMap        def_alias_set; 
@@ -208,6 +210,29 @@ public:
     // Flags to control what happens
     int NeedPathData;
 
+    defiNameIndex NameIndex;   // filled if defrSetBuildNameIndex() is on
+    defiConnIndex ConnIndex;   // filled if defrSetBuildConnIndex() is on
+    int           indexNetId;  // name index id of the current net
+
+    defiSourceMap SourceMap;   // filled if defrSetBuildSourceMap() is on
+    long long     bufferOffset;   // input offset of buffer[0]
+    long long     tokenOffset;    // input offset of the last token, -1
+                                  // if it came from an alias
+    long long     tokenLineStart; // start of its line if only blanks
+                                  // precede it there, else tokenOffset
+    int           mapStatementStart; // next token starts a statement
+    int           mapAfterEnd;       // last token was END
+    int           sectionOpen;       // defiSection_e of the open section
+    int           sectionObjects;    // objects read in the open section
+    int           sampleSkip;        // skip the rest of the open section
+
+    long long     inputSize;         // for the progress function, or -1
+    double        progressStart;     // clock when defrRead() started
+    double        progressLast;      // clock of the last report
+    double        traceSectionStart; // clock when the open section started
+
+    defiProfile   Profile;    // filled if defrSetProfileCallback() is set
+
     defiSubnet* Subnet;
     int msgLimit[DEF_MSGS];
     char buffer[IN_BUF_SIZE];
@@ -216,7 +241,7 @@ public:
     std::string stack[20];  /* the stack itself */
 };
 
-extern defrData *defData;
+extern DEFR_THREAD_LOCAL defrData *defData;
 
 END_LEFDEF_PARSER_NAMESPACE
 
@@ -38,6 +38,7 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <sys/stat.h>
 #include "lex.h"
 #include "defiUtil.hpp"
 #include "defrCallBacks.hpp"
@@ -49,7 +50,7 @@
 
 BEGIN_LEFDEF_PARSER_NAMESPACE
 
-static const char *init_call_func = NULL;
+static DEFR_THREAD_LOCAL const char *init_call_func = NULL;
 
 
 void
@@ -1182,15 +1183,27 @@ defrFName()
 
 
 int
-defrRead(FILE           *f,
-         const char     *fName,
-         defiUserData   uData,
-         int            case_sensitive)
+defrScanStats(FILE *f, defiStats *stats)
+{
+    DEF_INIT;
+    return stats->scan(f, defSettings->ReadFunction);
+}
+
+
+// Shared by defrRead() and defrValidate(); validating is set after the
+// reset so the parser gives the callback-gated checks without callbacks.
+static int
+defrReadFile(FILE           *f,
+             const char     *fName,
+             defiUserData   uData,
+             int            case_sensitive,
+             int            validating)
 {
 
     int status;
 
     defrData::reset();
+    defData->validating = validating;
 
     // Propagate Settings parameter to Data.
     if (defSettings->reader_case_sensitive_set) {
@@ -1213,11 +1226,69 @@ defrRead(FILE           *f,
         defData->PathObj.Init();
     }
 
+    if (defSettings->ProgressFunction) {
+        defData->inputSize = defSettings->InputSize;
+        if (defData->inputSize < 0 && !defSettings->ReadFunction) {
+            struct stat st;
+            if (fstat(fileno(f), &st) == 0 && (st.st_mode & S_IFMT) == S_IFREG)
+                defData->inputSize = st.st_size;
+        }
+        defData->progressStart = defData->progressLast = defiProfile::clock();
+    }
+
     status = defyyparse();
 
+    if (defSettings->ProgressFunction)
+        defProgress(1);
+
     return status;
 }
 
+
+int
+defrValidate(FILE           *f,
+             const char     *fName,
+             int            case_sensitive,
+             int            *numErrors,
+             int            *numWarnings)
+{
+    DEF_INIT;
+    defrCallbacks   *callbacks = defCallbacks;
+    int             buildNameIndex = defSettings->BuildNameIndex;
+    int             buildConnIndex = defSettings->BuildConnIndex;
+    int             buildSourceMap = defSettings->BuildSourceMap;
+    int             status;
+
+    defCallbacks = new defrCallbacks();
+    defSettings->BuildNameIndex = 0;
+    defSettings->BuildConnIndex = 0;
+    defSettings->BuildSourceMap = 0;
+
+    status = defrReadFile(f, fName, defSettings->UserData, case_sensitive, 1);
+
+    delete defCallbacks;
+    defCallbacks = callbacks;
+    defSettings->BuildNameIndex = buildNameIndex;
+    defSettings->BuildConnIndex = buildConnIndex;
+    defSettings->BuildSourceMap = buildSourceMap;
+
+    if (numErrors)
+        *numErrors = defData->totalErrors;
+    if (numWarnings)
+        *numWarnings = defData->def_warnings;
+    return status;
+}
+
+
+int
+defrRead(FILE           *f,
+         const char     *fName,
+         defiUserData   uData,
+         int            case_sensitive)
+{
+    return defrReadFile(f, fName, uData, case_sensitive, 0);
+}
+
 void
 defrSetUserData(defiUserData d)
 {
@@ -1475,6 +1546,99 @@ defrSetPathCbk(defrPathCbkFnType f)
     defCallbacks->PathCbk = f;
 }
 
+void
+defrSetBuildNameIndex(int build)
+{
+    DEF_INIT;
+    defSettings->BuildNameIndex = build;
+}
+
+const defiNameIndex*
+defrGetNameIndex()
+{
+    DEF_INIT;
+    if (!defData)
+        return NULL;
+    defData->NameIndex.setCaseSensitive(defData->names_case_sensitive);
+    return &defData->NameIndex;
+}
+
+void
+defrSetBuildConnIndex(int build)
+{
+    DEF_INIT;
+    defSettings->BuildConnIndex = build;
+    if (build)
+        defSettings->BuildNameIndex = 1;
+}
+
+const defiConnIndex*
+defrGetConnIndex()
+{
+    DEF_INIT;
+    if (!defData)
+        return NULL;
+    defData->ConnIndex.finish(defData->NameIndex.numNames(defiNameComponent));
+    return &defData->ConnIndex;
+}
+
+void
+defrSetBuildSourceMap(int build)
+{
+    DEF_INIT;
+    defSettings->BuildSourceMap = build;
+}
+
+const defiSourceMap*
+defrGetSourceMap()
+{
+    DEF_INIT;
+    if (!defData)
+        return NULL;
+    return &defData->SourceMap;
+}
+
+void
+defrSetAllocAccounting(int account)
+{
+    DEF_INIT;
+    delete defSettings->AllocStats;
+    defSettings->AllocStats = account ? new defiAllocStats() : NULL;
+}
+
+const defiAllocStats*
+defrGetAllocStats()
+{
+    DEF_INIT;
+    return defSettings->AllocStats;
+}
+
+void
+defrSetProfileCallback(defrProfileCbkFnType func, int objectInterval)
+{
+    DEF_INIT;
+    defSettings->ProfileFunction = func;
+    defSettings->ProfileInterval = objectInterval > 0 ? objectInterval : 0;
+}
+
+void
+defrSetSampleLimit(defiSection_e section, int n)
+{
+    DEF_INIT;
+    int i;
+
+    if (section < 0 || section >= defiNumSections)
+        return;
+    for (i = defiSectionUnknown + 1; i < defiNumSections; i++)
+        if (section == defiSectionUnknown || section == i)
+            defSettings->SampleLimit[i] = n > 0 ? n : 0;
+
+    defSettings->SampleLimits = 0;
+    for (i = 0; i < defiNumSections; i++)
+        if (defSettings->SampleLimit[i])
+            defSettings->SampleLimits = 1;
+}
+
 void
 defrSetAddPathToNet()
 {
@@ -2397,7 +2561,7 @@ defrAddAlias(const char *key,
         marked = 1;                 // make sure only 1 digit
     sprintf(v1, "%d%s", marked, value);
 
-    defData->def_alias_set[k1] = v1;
+    defSetAlias(k1, v1);
 }
 
 void
@@ -2429,6 +2593,35 @@ defrUnsetReadFunction()
     defSettings->ReadFunction = 0;
 }
 
+void
+defrSetProgressFunction(DEFI_PROGRESS_FUNCTION f, double interval)
+{
+    DEF_INIT;
+    defSettings->ProgressFunction = f;
+    defSettings->ProgressInterval = interval;
+}
+
+void
+defrSetInputSize(long long total)
+{
+    DEF_INIT;
+    defSettings->InputSize = total;
+}
+
+void
+defrSetInputPositionFunction(DEFI_INPUT_POSITION_FUNCTION f)
+{
+    DEF_INIT;
+    defSettings->InputPositionFunction = f;
+}
+
+void
+defrUnsetInputPositionFunction()
+{
+    DEF_INIT;
+    defSettings->InputPositionFunction = 0;
+}
+
 void
 defrDisablePropStrProcess()
 {
@@ -39,6 +39,17 @@
 #define DEF_MSGS 4013
 #define CBMAX 150    // Number of callbacks.
 
+// Thread local storage class for the reader state.
+// __thread is preferred to thread_local where both exist: an extern
+// thread_local is reached through a wrapper call on every use.
+#if defined(_MSC_VER)
+#define DEFR_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__) || __cplusplus < 201103L
+#define DEFR_THREAD_LOCAL __thread
+#else
+#define DEFR_THREAD_LOCAL thread_local
+#endif
+
 BEGIN_LEFDEF_PARSER_NAMESPACE
 
 // An enum describing all of the types of reader callbacks.
@@ -305,6 +316,11 @@ typedef int (*defrStylesCbkFnType) (defrCallbackType_e, defiStyles *, defiUserDa
  
 
 // The reader initialization.  Must be called before defrRead().
+// The reader settings, callbacks and parse data are kept per thread:
+// every thread that reads a DEF file calls defrInit() or
+// defrInitSession(), sets its own callbacks and calls defrRead()
+// independently of the other threads.  defrClear() releases the state
+// of the calling thread only.
 extern int defrInit ();
 extern int defrInitSession (int startSession = 1);
 
@@ -324,6 +340,53 @@ extern void defrSetAllowComponentNets ();
 extern int defrGetAllowComponentNets ();
 extern void defrSetCaseSensitivity (int caseSense);
 
+// Build a name index of COMPONENTS, PINS, NETS and SPECIALNETS while
+// reading.  The names are indexed whether or not the callbacks for
+// those sections are set.  defrGetNameIndex() returns the index of the
+// last defrRead(); it stays valid until the next defrRead() or
+// defrClear(), and is NULL before the first defrRead() or after
+// defrClear().
+extern void defrSetBuildNameIndex (int build = 1);
+extern const defiNameIndex* defrGetNameIndex ();
+
+// Build the reverse connectivity of NETS, from component to the
+// (pin, net) pairs it connects to.  Turns on the name index, which
+// provides the component, pin and net ids.  defrGetConnIndex() has
+// the same lifetime as defrGetNameIndex(), and is NULL when it is.
+extern void defrSetBuildConnIndex (int build = 1);
+extern const defiConnIndex* defrGetConnIndex ();
+
+// Record the byte ranges of the sections and of the statements inside
+// them while reading, so that a writer can copy unchanged parts of the
+// input verbatim with defwCopyRange().  defrGetSourceMap() has the same
+// lifetime as defrGetNameIndex(), and is NULL when it is.
+extern void defrSetBuildSourceMap (int build = 1);
+extern const defiSourceMap* defrGetSourceMap ();
+
+// Account the memory allocated by the reader by type, see defiAlloc.hpp.
+// Turning accounting off drops the counters.  defrGetAllocStats()
+// returns NULL while accounting is off; printing it from the profile
+// callback dumps the counters at the end of every section.
+extern void defrSetAllocAccounting (int account = 1);
+extern const defiAllocStats* defrGetAllocStats ();
+
+// Report the counters of every section of the input to func: at the end
+// of the section, and if objectInterval is not 0 also after every
+// objectInterval objects of it.  See defiProfile.hpp.  Timing the lexer
+// and the callbacks costs two clock reads per token and callback, so
+// only set it when profiling.  A NULL func turns profiling off.
+typedef void (*defrProfileCbkFnType) (const defiProfile*, defiUserData);
+extern void defrSetProfileCallback (defrProfileCbkFnType func,
+                                    int objectInterval = 0);
+
+// Read only the first n objects, the "- ... ;" statements, of sections
+// of the kind and skip the rest of such a section up to its END, to
+// preview a large file.  The start callback of the section still gets
+// the declared count and its end callback is still called.  The skipped
+// objects are not checked.  defiSectionUnknown sets the limit of every
+// section, and an n of 0 removes the limit.
+extern void defrSetSampleLimit (defiSection_e section, int n);
+
 // Functions to keep track of callbacks that the user did not
 // supply.  Normally all parts of the DEF file that the user
 // does not supply a callback for will be ignored.  These
@@ -346,6 +409,26 @@ extern int defrRead (FILE *file,
                     defiUserData userData,
                     int case_sensitive);
 
+// Count the sections, objects, routed nets and wiring of a DEF file
+// into stats without parsing it or calling any callback, see
+// defiStats.hpp.  Reads the file through the read function set by
+// defrSetReadFunction(), so defGZipOpen() files can be scanned too.
+// Returns 0 if no section was left open.
+extern int defrScanStats (FILE *file, defiStats *stats);
+
+// Parse a DEF file only for its errors and warnings: defrRead() with no
+// callbacks, so none of the defi objects are filled, and without the
+// name index, connectivity index and source map.  The message limits,
+// the log functions and the progress function still apply, and the
+// checks that defrRead() only makes for a section with a callback are
+// made for every section.  Returns the defrRead() status, and the numbers of
+// errors and warnings reported in numErrors and numWarnings.
+extern int defrValidate (FILE *file,
+                         const char *fileName,
+                         int case_sensitive,
+                         int *numErrors = 0,
+                         int *numWarnings = 0);
+
 // Set/get the client-provided user data.  defi doesn't look at
 // this data at all, it simply passes the opaque defiUserData pointer
 // back to the application with each callback.  The client can
@@ -630,6 +713,25 @@ typedef size_t (*DEFI_READ_FUNCTION)  (FILE*, char*, size_t);
 extern void defrSetReadFunction(DEFI_READ_FUNCTION);
 extern void defrUnsetReadFunction ();
 
+// Routine to report the progress of defrRead() by bytes.  The function is
+// called with the bytes of the input consumed, the total size of the
+// input, or -1 if it is not known, and the seconds since defrRead()
+// started: at most every interval seconds while reading, and once when
+// defrRead() returns.  elapsed * (total - bytes) / bytes estimates the
+// time left.  The total size is taken from the file when it is a plain
+// file read without a read function; otherwise set it with
+// defrSetInputSize().  When the bytes returned by the read function are
+// not bytes of the file, as for a compressed file, set a position
+// function returning the position in the file.  defGZipOpen() sets both.
+typedef void (*DEFI_PROGRESS_FUNCTION) (long long bytes, long long total,
+                                        double elapsed, defiUserData);
+extern void defrSetProgressFunction(DEFI_PROGRESS_FUNCTION,
+                                    double interval = 1.0);
+extern void defrSetInputSize(long long total);
+typedef long long (*DEFI_INPUT_POSITION_FUNCTION) (FILE*);
+extern void defrSetInputPositionFunction(DEFI_INPUT_POSITION_FUNCTION);
+extern void defrUnsetInputPositionFunction ();
+
 // Routine to set the defrWarning.log to open as append instead for write 
 // New in 5.7 
 extern void defrSetOpenLogFileAppend ();
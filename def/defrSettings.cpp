@@ -33,7 +33,7 @@ using namespace std;
 
 BEGIN_LEFDEF_PARSER_NAMESPACE
 
-defrSettings *defSettings = NULL;
+DEFR_THREAD_LOCAL defrSettings *defSettings = NULL;
 
 defrSettings::defrSettings()
 : defiDeltaNumberLines(10000),
@@ -66,6 +66,9 @@ defrSettings::defrSettings()
   totalDefMsgLimit(0),
   AddPathToNet(0),
   AllowComponentNets(0),
+  BuildNameIndex(0),
+  BuildConnIndex(0),
+  BuildSourceMap(0),
   CommentChar('#'),
   DisPropStrProcess(0),
   File(0),
@@ -81,6 +84,14 @@ defrSettings::defrSettings()
   FreeFunction(NULL),
   LineNumberFunction(NULL),
   LongLineNumberFunction(NULL),
+  ProgressFunction(NULL),
+  ProgressInterval(1.0),
+  InputSize(-1),
+  InputPositionFunction(NULL),
+  AllocStats(NULL),
+  ProfileFunction(NULL),
+  ProfileInterval(0),
+  SampleLimits(0),
   CompProp(),
   CompPinProp(),
   DesignProp(),
@@ -94,10 +105,20 @@ defrSettings::defrSettings()
     memset(Debug, 0, DEF_DEBUG_IDS * sizeof(int));
     memset(MsgLimit, 0, DEF_MSGS * sizeof(int));
     memset(UnusedCallbacks, 0, CBMAX * sizeof(int));
+    memset(SampleLimit, 0, defiNumSections * sizeof(int));
 
     init_symbol_table();
 }
 
+defrSettings::~defrSettings()
+{
+    defiAllocStats *allocStats = AllocStats;
+
+    // The property types are destroyed after this and defFree() them.
+    AllocStats = NULL;
+    delete allocStats;
+}
+
 void
 defrSettings::reset()
 {
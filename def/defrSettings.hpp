@@ -52,6 +52,7 @@ typedef std::map<const char*, int, defCompareCStrings>  defKeywordMap;
 class defrSettings {
 public:
     defrSettings();
+    ~defrSettings();
 
     static void reset();
     void init_symbol_table();
@@ -95,6 +96,9 @@ public:
     int  totalDefMsgLimit; // to save the user set total msg limit to output
     int AddPathToNet;
     int AllowComponentNets;
+    int BuildNameIndex;
+    int BuildConnIndex;
+    int BuildSourceMap;
     char CommentChar;
     int DisPropStrProcess; 
     FILE* File;
@@ -112,6 +116,15 @@ public:
     DEFI_FREE_FUNCTION FreeFunction;
     DEFI_LINE_NUMBER_FUNCTION LineNumberFunction;
     DEFI_LONG_LINE_NUMBER_FUNCTION LongLineNumberFunction;
+    DEFI_PROGRESS_FUNCTION ProgressFunction;
+    double ProgressInterval;
+    long long InputSize;    // -1 if not set
+    DEFI_INPUT_POSITION_FUNCTION InputPositionFunction;
+    defiAllocStats* AllocStats;    // NULL if accounting is off
+    defrProfileCbkFnType ProfileFunction;
+    int ProfileInterval;    // objects between interval reports, 0 if none
+    int SampleLimit[defiNumSections];   // objects read per section, 0 = all
+    int SampleLimits;       // any SampleLimit set
 
     int Debug[DEF_DEBUG_IDS]; /* can set from command line for debugging */
     int UnusedCallbacks[CBMAX];
@@ -131,7 +144,7 @@ public:
     defiPropType SNetProp;
 };
 
-extern defrSettings *defSettings;
+extern DEFR_THREAD_LOCAL defrSettings *defSettings;
 
 END_LEFDEF_PARSER_NAMESPACE
 
@@ -0,0 +1,108 @@
+// *****************************************************************************
+// *****************************************************************************
+// Copyright 2013-2014, Cadence Design Systems
+// 
+// This  file  is  part  of  the  Cadence  LEF/DEF  Open   Source
+// Distribution,  Product Version 5.8. 
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+//    implied. See the License for the specific language governing
+//    permissions and limitations under the License.
+// 
+// For updates, support, or to become part of the LEF/DEF Community,
+// check www.openeda.org for details.
+// 
+//  $Author$
+//  $Revision$
+//  $Date$
+//  $State:  $
+// *****************************************************************************
+// *****************************************************************************
+
+#ifndef defwContext_h
+#define defwContext_h
+
+#include <stdio.h>
+
+#include "defwWriter.hpp"
+
+// Thread local storage class for the current writer context.
+// __thread is preferred to thread_local where both exist: an extern
+// thread_local is reached through a wrapper call on every use.
+// defwCtx holds a plain pointer and needs no dynamic initialisation,
+// so __thread is enough.  Keep in step with DEFR_THREAD_LOCAL in
+// defrReader.hpp: a tool such as defdiff that reads on several threads
+// uses both.
+#if defined(_MSC_VER)
+#define DEFW_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__) || __cplusplus < 201103L
+#define DEFW_THREAD_LOCAL __thread
+#else
+#define DEFW_THREAD_LOCAL thread_local
+#endif
+
+BEGIN_LEFDEF_PARSER_NAMESPACE
+
+// All the state of one DEF writer.  The defw* routines work on the
+// context current in the calling thread, see defwSetContext().
+class defwContext {
+public:
+    defwContext();
+    ~defwContext();
+
+    FILE*  defwFile;            // File to write to.
+    int    defwLines;           // number of lines written
+    int    defwState;           // Current state of writer
+    int    defwFunc;            // Current function of writer
+    int    defwDidNets;         // required section
+    int    defwDidComponents;   // required section
+    int    defwDidInit;         // required section
+    int    defwCounter;         // number of nets, components in section
+    int    defwLineItemCounter; // number of items on current line
+    int    defwFPC;             // Current number of items in constraints/operand/sum
+    int    defwHasInit;         // for defwInit has called
+    int    defwHasInitCbk;      // for defwInitCbk has called
+    int    defwSpNetShield;     // for special net shieldNetName
+    double defVersionNum;       // default to 5.7
+    int    defwObsoleteNum;     // keep track the obsolete syntax for error
+    int    defwViaHasVal;       // keep track only ViaRule|Pattern
+    int    defwBlockageHasSD;   // keep track only Spacing|Designrulewidth
+    int    defwBlockageHasSF;   // keep track only SLOTS|FILLS
+    int    defwBlockageHasSP;   // keep track only SOFT|PARTIAL
+    int    defwPinEnded;        // the PINS line or last pin has its ;
+    int    printPointsNum;      // points written in the current path
+    double printPointsX;        // last point written, for "*"
+    double printPointsY;
+
+    // Output sink
+    DEFW_WRITE_FUNCTION defwWriteFunction;
+    FILE*  defwSinkFile;        // FILE* handed to the write function
+    char   defwNoFile;          // defwFile if that FILE* is NULL
+    char*  defwOutBuf;          // user space buffer
+    size_t defwOutBufSize;
+    size_t defwOutBufUsed;
+    char*  defwMemData;         // memory sink
+    size_t defwMemSize;
+    size_t defwMemAlloc;
+    int    defwFd;              // file descriptor sink
+    int    defwFdWritev;
+    double defwSectionStart;    // clock when the section started, if traced
+
+private:
+    defwContext(const defwContext&);
+    defwContext& operator=(const defwContext&);
+};
+
+extern DEFW_THREAD_LOCAL defwContext *defwCtx;
+
+END_LEFDEF_PARSER_NAMESPACE
+
+#endif
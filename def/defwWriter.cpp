@@ -41,10 +41,21 @@
 //                         (!name || !*name)
 
 #include "defwWriter.hpp"
+#include "defwContext.hpp"
 #include <string.h>
 #include <stdlib.h>
 #include <time.h>
+#include <errno.h>
+#ifndef WIN32
+#include <unistd.h>
+#include <sys/uio.h>
+#else
+#include <io.h>
+#endif
 #include "defiUtil.hpp"
+#include "defiProfile.hpp"
+#include "defiTrace.hpp"
+#include "defiSourceMap.hpp"
 
 BEGIN_LEFDEF_PARSER_NAMESPACE
 
@@ -160,27 +171,580 @@ BEGIN_LEFDEF_PARSER_NAMESPACE
 
 
 // *****************************************************************************
-//        Global Variables
+//        Writer context
 // *****************************************************************************
-FILE *defwFile = 0;   // File to write to.
-int defwLines = 0;    // number of lines written
-int defwState = DEFW_UNINIT;  // Current state of writer
-int defwFunc = DEFW_UNINIT;   // Current function of writer
-int defwDidNets = 0;  // required section
-int defwDidComponents = 0;  // required section
-int defwDidInit = 0;  // required section
-int defwCounter = 0;  // number of nets, components in section
-int defwLineItemCounter = 0; // number of items on current line
-int defwFPC = 0;  // Current number of items in constraints/operand/sum
-int defwHasInit = 0;    // for defwInit has called
-int defwHasInitCbk = 0; // for defwInitCbk has called
-int defwSpNetShield = 0; // for special net shieldNetName
-static double defVersionNum = 5.7;  // default to 5.7
-static int defwObsoleteNum = -1; // keep track the obsolete syntax for error
-static int defwViaHasVal = 0;    // keep track only ViaRule|Pattern
-static int defwBlockageHasSD = 0;// keep track only Spacing|Designrulewidth
-static int defwBlockageHasSF = 0;// keep track only SLOTS|FILLS
-static int defwBlockageHasSP = 0;// keep track only SOFT|PARTIAL
+defwContext::defwContext()
+: defwFile(0),
+  defwLines(0),
+  defwState(DEFW_UNINIT),
+  defwFunc(DEFW_UNINIT),
+  defwDidNets(0),
+  defwDidComponents(0),
+  defwDidInit(0),
+  defwCounter(0),
+  defwLineItemCounter(0),
+  defwFPC(0),
+  defwHasInit(0),
+  defwHasInitCbk(0),
+  defwSpNetShield(0),
+  defVersionNum(5.7),
+  defwObsoleteNum(-1),
+  defwViaHasVal(0),
+  defwBlockageHasSD(0),
+  defwBlockageHasSF(0),
+  defwBlockageHasSP(0),
+  defwPinEnded(0),
+  printPointsNum(0),
+  printPointsX(0),
+  printPointsY(0),
+  defwWriteFunction(0),
+  defwSinkFile(0),
+  defwNoFile(0),
+  defwOutBuf(0),
+  defwOutBufSize(0),
+  defwOutBufUsed(0),
+  defwMemData(0),
+  defwMemSize(0),
+  defwMemAlloc(0),
+  defwFd(-1),
+  defwFdWritev(0),
+  defwSectionStart(0)
+{
+}
+
+defwContext::~defwContext()
+{
+    if (defwOutBuf)
+        free(defwOutBuf);
+    if (defwMemData)
+        free(defwMemData);
+}
+
+// The context used by threads that never call defwSetContext.
+static defwContext defwDefaultContext;
+DEFW_THREAD_LOCAL defwContext *defwCtx = &defwDefaultContext;
+
+defwContext*
+defwNewContext()
+{
+    return new defwContext;
+}
+
+void
+defwDeleteContext(defwContext *context)
+{
+    if (!context || context == &defwDefaultContext)
+        return;
+    if (defwCtx == context)
+        defwCtx = &defwDefaultContext;
+    delete context;
+}
+
+defwContext*
+defwSetContext(defwContext *context)
+{
+    defwContext *prev = defwCtx;
+
+    defwCtx = context ? context : &defwDefaultContext;
+    return prev;
+}
+
+defwContext*
+defwGetContext()
+{
+    return defwCtx;
+}
+
+
+// *****************************************************************************
+//        Output sink
+//
+// By default everything is written with stdio to defwFile.  A write
+// function set with defwSetWriteFunction() replaces stdio, and an
+// optional user space buffer collects the output in large blocks.
+// *****************************************************************************
+
+// Called by defwInit, defwInitCbk and defwWrite.
+void
+defwSetOutputFile(FILE *f)
+{
+    defwCtx->defwSinkFile = f;
+    // With a write function a NULL FILE* is fine; the writer only
+    // needs a non NULL defwFile to know it has been initialized.
+    if (!f && defwCtx->defwWriteFunction)
+        defwCtx->defwFile = (FILE*) &defwCtx->defwNoFile;
+    else
+        defwCtx->defwFile = f;
+}
+
+static void
+defwSinkWrite(const char *data, size_t len)
+{
+    if (defwCtx->defwWriteFunction)
+        defwCtx->defwWriteFunction(defwCtx->defwSinkFile, data, len);
+    else
+        fwrite(data, 1, len, defwCtx->defwFile);
+}
+
+static void
+defwFlushOutputBuffer()
+{
+    if (defwCtx->defwOutBufUsed) {
+        double traceStart = defiTraceOn ? defiProfile::clock() : 0;
+
+        defwSinkWrite(defwCtx->defwOutBuf, defwCtx->defwOutBufUsed);
+        if (defiTraceOn)
+            defiTraceSpan("write", "flush", traceStart, "bytes",
+                          defwCtx->defwOutBufUsed);
+        defwCtx->defwOutBufUsed = 0;
+    }
+}
+
+// Spans of the sections written, for defiTraceOpen().
+static void
+defwTraceSectionStart()
+{
+    if (defiTraceOn)
+        defwCtx->defwSectionStart = defiProfile::clock();
+}
+
+static void
+defwTraceSectionEnd(const char *name)
+{
+    if (defiTraceOn)
+        defiTraceSpan("write", name, defwCtx->defwSectionStart);
+}
+
+#ifndef WIN32
+// Writes the buffer and data with one writev() call if possible.
+static void
+defwFdWritevData(const char *data, size_t len)
+{
+    struct iovec iov[2];
+    int          n = 0;
+    ssize_t      done;
+
+    if (defwCtx->defwOutBufUsed) {
+        iov[n].iov_base = defwCtx->defwOutBuf;
+        iov[n++].iov_len = defwCtx->defwOutBufUsed;
+    }
+    iov[n].iov_base = (void*) data;
+    iov[n++].iov_len = len;
+
+    done = writev(defwCtx->defwFd, iov, n);
+    if (done < 0)
+        done = 0;
+
+    // Finish a short write with plain writes.
+    if ((size_t) done < defwCtx->defwOutBufUsed) {
+        defwSinkWrite(defwCtx->defwOutBuf + done, defwCtx->defwOutBufUsed - done);
+        done = 0;
+    } else {
+        done -= defwCtx->defwOutBufUsed;
+    }
+    defwCtx->defwOutBufUsed = 0;
+    if ((size_t) done < len)
+        defwSinkWrite(data + done, len - done);
+}
+#endif
+
+static void
+defwPutData(const char *data, size_t len)
+{
+    if (!defwCtx->defwOutBufSize) {
+        defwSinkWrite(data, len);
+        return;
+    }
+    if (defwCtx->defwOutBufUsed + len <= defwCtx->defwOutBufSize) {
+        memcpy(defwCtx->defwOutBuf + defwCtx->defwOutBufUsed, data, len);
+        defwCtx->defwOutBufUsed += len;
+        return;
+    }
+#ifndef WIN32
+    if (defwCtx->defwFd >= 0 && defwCtx->defwFdWritev) {
+        defwFdWritevData(data, len);
+        return;
+    }
+#endif
+    defwFlushOutputBuffer();
+    if (len >= defwCtx->defwOutBufSize) {
+        defwSinkWrite(data, len);
+    } else {
+        memcpy(defwCtx->defwOutBuf, data, len);
+        defwCtx->defwOutBufUsed = len;
+    }
+}
+
+static void
+defwPrintf(const char *format, ...)
+{
+    va_list args;
+    char    line[1024];
+    char   *buf = line;
+    int     len;
+
+    va_start(args, format);
+    if (!defwCtx->defwWriteFunction && !defwCtx->defwOutBufSize) {
+        vfprintf(defwCtx->defwFile, format, args);
+        va_end(args);
+        return;
+    }
+
+    // Format straight into the output buffer when it fits.
+    if (defwCtx->defwOutBufSize && defwCtx->defwOutBufSize - defwCtx->defwOutBufUsed > sizeof(line)) {
+        size_t room = defwCtx->defwOutBufSize - defwCtx->defwOutBufUsed;
+        len = vsnprintf(defwCtx->defwOutBuf + defwCtx->defwOutBufUsed, room, format, args);
+        va_end(args);
+        if (len >= 0 && (size_t) len < room) {
+            defwCtx->defwOutBufUsed += len;
+            return;
+        }
+        va_start(args, format);
+    }
+
+    len = vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+    if (len < 0)
+        return;
+    if ((size_t) len >= sizeof(line)) {
+        buf = (char*) malloc(len + 1);
+        va_start(args, format);
+        vsnprintf(buf, len + 1, format, args);
+        va_end(args);
+    }
+    defwPutData(buf, len);
+    if (buf != line)
+        free(buf);
+}
+
+void
+defwSetWriteFunction(DEFW_WRITE_FUNCTION f)
+{
+    defwCtx->defwWriteFunction = f;
+    defwCtx->defwFd = -1;
+}
+
+void
+defwUnsetWriteFunction()
+{
+    defwFlushOutputBuffer();
+    defwCtx->defwWriteFunction = 0;
+    defwCtx->defwFd = -1;
+}
+
+int
+defwSetOutputBufferSize(size_t size)
+{
+    defwFlushOutputBuffer();
+    if (defwCtx->defwOutBuf)
+        free(defwCtx->defwOutBuf);
+    defwCtx->defwOutBuf = 0;
+    defwCtx->defwOutBufSize = 0;
+    if (size) {
+        defwCtx->defwOutBuf = (char*) malloc(size);
+        if (!defwCtx->defwOutBuf)
+            return DEFW_BAD_DATA;
+        defwCtx->defwOutBufSize = size;
+    }
+    return DEFW_OK;
+}
+
+int
+defwFlush()
+{
+    if (!defwCtx->defwFile)
+        return DEFW_UNINITIALIZED;
+    defwFlushOutputBuffer();
+    if (!defwCtx->defwWriteFunction)
+        fflush(defwCtx->defwFile);
+    return DEFW_OK;
+}
+
+static size_t
+defwMemoryWrite(FILE*, const char *data, size_t len)
+{
+    if (defwCtx->defwMemSize + len + 1 > defwCtx->defwMemAlloc) {
+        size_t size = defwCtx->defwMemAlloc ? defwCtx->defwMemAlloc : 65536;
+        char  *mem;
+
+        while (defwCtx->defwMemSize + len + 1 > size)
+            size *= 2;
+        mem = (char*) realloc(defwCtx->defwMemData, size);
+        if (!mem)
+            return 0;
+        defwCtx->defwMemData = mem;
+        defwCtx->defwMemAlloc = size;
+    }
+    memcpy(defwCtx->defwMemData + defwCtx->defwMemSize, data, len);
+    defwCtx->defwMemSize += len;
+    defwCtx->defwMemData[defwCtx->defwMemSize] = '\0';
+    return len;
+}
+
+void
+defwSetMemorySink()
+{
+    defwSetWriteFunction(defwMemoryWrite);
+    defwCtx->defwMemSize = 0;
+}
+
+const char*
+defwMemorySinkData(size_t *size)
+{
+    defwFlushOutputBuffer();
+    if (size)
+        *size = defwCtx->defwMemSize;
+    return defwCtx->defwMemData ? defwCtx->defwMemData : "";
+}
+
+void
+defwMemorySinkClear()
+{
+    if (defwCtx->defwMemData)
+        free(defwCtx->defwMemData);
+    defwCtx->defwMemData = 0;
+    defwCtx->defwMemSize = 0;
+    defwCtx->defwMemAlloc = 0;
+}
+
+#ifndef WIN32
+static size_t
+defwFdWrite(FILE*, const char *data, size_t len)
+{
+    size_t done = 0;
+
+    while (done < len) {
+        ssize_t n = write(defwCtx->defwFd, data + done, len - done);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+        done += n;
+    }
+    return done;
+}
+
+void
+defwSetFdSink(int fd, int useWritev)
+{
+    defwSetWriteFunction(defwFdWrite);
+    defwCtx->defwFd = fd;
+    defwCtx->defwFdWritev = useWritev;
+}
+#endif
+
+// Copies length bytes at offset of the file open on fd to the sink.
+// Uses copy_file_range() when writing to a file descriptor sink on
+// Linux, otherwise reads the data in blocks.
+static int
+defwCopyData(int fd, long long offset, long long length)
+{
+    char buf[65536];
+
+#if defined(__linux__) && defined(__GLIBC__) && \
+    (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 27))
+    if (defwCtx->defwFd >= 0 && !defwCtx->defwOutBufUsed) {
+        loff_t off = offset;
+
+        while (length > 0) {
+            ssize_t n = copy_file_range(fd, &off, defwCtx->defwFd, 0,
+                                        (size_t) length, 0);
+            if (n <= 0)
+                break;      // not supported here, finish with reads
+            length -= n;
+        }
+        offset = off;
+    }
+#endif
+    while (length > 0) {
+        size_t  want = length < (long long) sizeof(buf) ?
+                       (size_t) length : sizeof(buf);
+        ssize_t n;
+#ifndef WIN32
+        n = pread(fd, buf, want, (off_t) offset);
+        if (n < 0 && errno == EINTR)
+            continue;
+#else
+        if (_lseeki64(fd, offset, SEEK_SET) < 0)
+            return DEFW_BAD_DATA;
+        n = _read(fd, buf, (unsigned int) want);
+#endif
+        if (n <= 0)
+            return DEFW_BAD_DATA;
+        defwPutData(buf, n);
+        offset += n;
+        length -= n;
+    }
+    return DEFW_OK;
+}
+
+// Returns the state of the writer after the given section, a
+// defiSection_e, or 0 if the writer has no state for that section.
+static int
+defwSectionEndState(int section)
+{
+    switch (section) {
+    case defiSectionPropertyDefinitions: return DEFW_PROP_END;
+    case defiSectionDefaultCap:          return DEFW_DEFAULTCAP_END;
+    case defiSectionVias:                return DEFW_VIA_END;
+    case defiSectionStyles:              return DEFW_STYLES_END;
+    case defiSectionNonDefaultRules:     return DEFW_NDR_END;
+    case defiSectionRegions:             return DEFW_REGION_END;
+    case defiSectionComponents:          return DEFW_COMPONENT_END;
+    case defiSectionPins:                return DEFW_PIN_END;
+    case defiSectionPinProperties:       return DEFW_PINPROP_END;
+    case defiSectionBlockages:           return DEFW_BLOCKAGE_END;
+    case defiSectionSlots:               return DEFW_SLOT_END;
+    case defiSectionFills:               return DEFW_FILL_END;
+    case defiSectionSpecialNets:         return DEFW_SNET_END;
+    case defiSectionNets:                return DEFW_NET_END;
+    case defiSectionScanChains:          return DEFW_SCANCHAIN_END;
+    case defiSectionGroups:              return DEFW_GROUP_END;
+    case defiSectionIOTimings:           return DEFW_IOTIMING_END;
+    case defiSectionFPC:
+    case defiSectionConstraints:         return DEFW_FPC_END;
+    }
+    return 0;
+}
+
+int
+defwCopyRange(int       fd,
+              long long offset,
+              long long length,
+              int       numLines,
+              int       numStatements,
+              int       section)
+{
+    int status;
+    int endState;
+
+    if (!defwCtx->defwFile)
+        return DEFW_UNINITIALIZED;
+    if (fd < 0 || offset < 0 || length < 0 ||
+        section < defiSectionUnknown || section >= defiNumSections)
+        return DEFW_BAD_DATA;
+
+    // End a statement the writer has left open.
+    if (defwCtx->defwState == DEFW_ROW) {
+        defwPrintf(";\n\n");
+        defwCtx->defwState = DEFW_TRACKS;
+    } else if (defwCtx->defwState == DEFW_COMPONENT) {
+        defwPrintf(";\n");
+        defwCtx->defwState = DEFW_COMPONENT_START;
+    } else if ((defwCtx->defwState == DEFW_PIN_START ||
+                defwCtx->defwState == DEFW_PIN ||
+                defwCtx->defwState == DEFW_PIN_PORT) &&
+               !defwCtx->defwPinEnded) {
+        // The ; of the PINS line or of a pin is written by what follows.
+        defwPrintf(" ;\n");
+        defwCtx->defwPinEnded = 1;
+        defwCtx->defwState = DEFW_PIN_START;
+    }
+
+    defwFlushOutputBuffer();
+    if (!defwCtx->defwWriteFunction)
+        fflush(defwCtx->defwFile);
+    defwCtx->defwLines += numLines;
+    defwCtx->defwCounter -= numStatements;
+    status = defwCopyData(fd, offset, length);
+    if (status != DEFW_OK)
+        return status;
+
+    // A copied section is written as far as the order of the sections
+    // is concerned.
+    endState = defwSectionEndState(section);
+    if (endState)
+        defwCtx->defwState = endState;
+    if (section == defiSectionComponents)
+        defwCtx->defwDidComponents = 1;
+    else if (section == defiSectionNets)
+        defwCtx->defwDidNets = 1;
+    return DEFW_OK;
+}
+
+
+// *****************************************************************************
+//        Section chunks
+//
+// A chunk is a context that formats part of the COMPONENTS, NETS or
+// SPECIALNETS section into its own memory sink, typically in a worker
+// thread.  defwAppendChunk adds it to the current context as if its
+// statements had been written there.
+// *****************************************************************************
+
+// Returns the START state of the section the state belongs to, or 0
+// if a chunk can not start or end in that state.
+static int
+defwChunkSection(int state)
+{
+    switch (state) {
+    case DEFW_COMPONENT_START:
+    case DEFW_COMPONENT:
+        return DEFW_COMPONENT_START;
+    case DEFW_NET_START:
+    case DEFW_NET_ENDNET:
+        return DEFW_NET_START;
+    case DEFW_SNET_START:
+    case DEFW_SNET_ENDNET:
+        return DEFW_SNET_START;
+    }
+    return 0;
+}
+
+defwContext*
+defwNewChunk()
+{
+    defwContext *chunk;
+    int          section = defwChunkSection(defwCtx->defwState);
+
+    if (!defwCtx->defwFile || !section)
+        return 0;
+
+    chunk = new defwContext;
+    chunk->defwFile = (FILE*) &chunk->defwNoFile;
+    chunk->defwState = section;
+    chunk->defwFunc = defwCtx->defwFunc;
+    chunk->defwDidNets = defwCtx->defwDidNets;
+    chunk->defwDidComponents = defwCtx->defwDidComponents;
+    chunk->defwDidInit = defwCtx->defwDidInit;
+    chunk->defwHasInit = defwCtx->defwHasInit;
+    chunk->defwHasInitCbk = defwCtx->defwHasInitCbk;
+    chunk->defVersionNum = defwCtx->defVersionNum;
+    chunk->defwWriteFunction = defwMemoryWrite;
+    return chunk;
+}
+
+int
+defwAppendChunk(defwContext *chunk)
+{
+    int section;
+
+    if (!defwCtx->defwFile)
+        return DEFW_UNINITIALIZED;
+    if (!chunk || chunk == defwCtx)
+        return DEFW_BAD_DATA;
+    section = defwChunkSection(defwCtx->defwState);
+    if (!section || defwChunkSection(chunk->defwState) != section)
+        return DEFW_BAD_ORDER;
+
+    if (chunk->defwState != section) {
+        // A component is ended by the next one.
+        if (defwCtx->defwState == DEFW_COMPONENT)
+            defwPrintf(";\n");
+        defwPutData(chunk->defwMemData, chunk->defwMemSize);
+        defwCtx->defwState = chunk->defwState;
+    }
+    defwCtx->defwLines += chunk->defwLines;
+    defwCtx->defwCounter += chunk->defwCounter;
+
+    // The chunk can be reused for the next part of the section.
+    chunk->defwState = section;
+    chunk->defwLines = 0;
+    chunk->defwCounter = 0;
+    chunk->defwMemSize = 0;
+    return DEFW_OK;
+}
 
 char defwStateStr[MAXSYN] [80] = {
     "UNINITIALIZE",         //  0
@@ -290,33 +854,134 @@ char defwStateStr[MAXSYN] [80] = {
 };
 
 
-static int printPointsNum = 0;
-static void printPoints(FILE *file, double x, double y, 
-                        const char* prefix, const char* suffix)
+// Fast number formatting.  Coordinates are nearly always integral, so
+// integral doubles are converted with a plain integer to ASCII routine;
+// everything else still goes through "%.11g".  The output is the same
+// as printf with "%d" or "%.11g".
+
+// Writes the decimal digits of v at buf and returns the end (not NUL
+// terminated).
+static char* defwFormatInt(char *buf, long long v)
+{
+    char                tmp[24];
+    char               *t = tmp;
+    unsigned long long  u = v < 0 ? 0ULL - (unsigned long long) v
+                                  : (unsigned long long) v;
+
+    if (v < 0)
+        *buf++ = '-';
+    do {
+        *t++ = (char) ('0' + u % 10);
+        u /= 10;
+    } while (u);
+    while (t != tmp)
+        *buf++ = *--t;
+    return buf;
+}
+
+// Same as sprintf(buf, "%.11g", d), returns the end of the string.
+static char* defwFormatDouble(char *buf, double d)
+{
+    // "%.11g" switches to exponent notation from 1e11 on.
+    if (d > -1e11 && d < 1e11 && d == (double) (long long) d) {
+        if (d == 0 && 1 / d < 0) {   // -0
+            *buf++ = '-';
+            *buf++ = '0';
+            return buf;
+        }
+        return defwFormatInt(buf, (long long) d);
+    }
+    return buf + sprintf(buf, "%.11g", d);
+}
+
+// Writes "( x y )", "( x y ext )" style point lists.
+static void defwPrintPoint(const char *prefix, double x, double y,
+                           const double *ext, const char *suffix)
+{
+    char  buf[128];
+    char *p = buf;
+
+    while (*prefix)
+        *p++ = *prefix++;
+    *p++ = '(';
+    *p++ = ' ';
+    p = defwFormatDouble(p, x);
+    *p++ = ' ';
+    p = defwFormatDouble(p, y);
+    *p++ = ' ';
+    if (ext) {
+        p = defwFormatDouble(p, *ext);
+        *p++ = ' ';
+    }
+    while (*suffix)
+        *p++ = *suffix++;
+    defwPutData(buf, p - buf);
+}
+
+
+static void printPoints(double x, double y, const char* prefix,
+                        const char* suffix)
 {
-    static double x_old = 0;
-    static double y_old = 0;
+    char   buf[128];
+    char  *p = buf;
 
-    fprintf(file, "%s", prefix);
+    while (*prefix)
+        *p++ = *prefix++;
 
-    if (printPointsNum++ == 0) {
-        fprintf(file, "( %.11g %.11g )", x, y);
-    } else if (x_old == x) {
-        if (y_old == y) {
-            fprintf(file, "( * * )");
+    if (defwCtx->printPointsNum++ == 0) {
+        *p++ = '('; *p++ = ' ';
+        p = defwFormatDouble(p, x);
+        *p++ = ' ';
+        p = defwFormatDouble(p, y);
+        *p++ = ' '; *p++ = ')';
+    } else if (defwCtx->printPointsX == x) {
+        if (defwCtx->printPointsY == y) {
+            memcpy(p, "( * * )", 7);
+            p += 7;
         } else {
-            fprintf(file, "( * %.11g )", y);
+            memcpy(p, "( * ", 4);
+            p += 4;
+            p = defwFormatDouble(p, y);
+            *p++ = ' '; *p++ = ')';
         }
-    } else if (y_old == y) {
-        fprintf(file, "( %.11g * )", x);
+    } else if (defwCtx->printPointsY == y) {
+        *p++ = '('; *p++ = ' ';
+        p = defwFormatDouble(p, x);
+        memcpy(p, " * )", 4);
+        p += 4;
     } else {
-        fprintf(file, "( %.11g %.11g )", x, y);
+        *p++ = '('; *p++ = ' ';
+        p = defwFormatDouble(p, x);
+        *p++ = ' ';
+        p = defwFormatDouble(p, y);
+        *p++ = ' '; *p++ = ')';
     }
 
-    fprintf(file, "%s", suffix);
+    while (*suffix)
+        *p++ = *suffix++;
+    defwPutData(buf, p - buf);
+
+    defwCtx->printPointsX = x;
+    defwCtx->printPointsY = y;
+}
+
+// Writes "\n      + <status> ( x y ) <orient> " of a component.
+static void defwPrintPlacement(const char *status, int x, int y,
+                               const char *orient)
+{
+    char  buf[64];
+    char *p = buf;
 
-    x_old = x;
-    y_old = y;
+    defwPutData("\n      + ", 9);
+    defwPutData(status, strlen(status));
+    *p++ = ' '; *p++ = '('; *p++ = ' ';
+    p = defwFormatInt(p, x);
+    *p++ = ' ';
+    p = defwFormatInt(p, y);
+    *p++ = ' '; *p++ = ')'; *p++ = ' ';
+    defwPutData(buf, p - buf);
+    defwPutData(orient, strlen(orient));
+    defwPutData(" ", 1);
 }
 
 
@@ -324,9 +989,9 @@ static void printPoints(FILE *file, double x, double y,
 int
 defwNewLine()
 {
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_BAD_ORDER;
-    fprintf(defwFile, "\n");
+    defwPrintf("\n");
     return DEFW_OK;
 }
 
@@ -350,59 +1015,59 @@ defwInit(FILE       *f,
 {
 
     //if (defwFile) return DEFW_BAD_ORDER;
-    defwFile = f;
-    if (defwHasInitCbk == 1) {  // defwInitCbk has already called, issue an error
+    defwSetOutputFile(f);
+    if (defwCtx->defwHasInitCbk == 1) {  // defwInitCbk has already called, issue an error
         fprintf(stderr,
                 "ERROR (DEFWRIT-9000): The DEF writer has detected that the function defwInitCbk has already been called and you are trying to call defwInit.\nOnly defwInitCbk or defwInit can be called but not both.\nUpdate your program and then try again.\n");
         fprintf(stderr, "Writer Exit.\n");
         exit(DEFW_BAD_ORDER);
     }
 
-    defwState = DEFW_UNINIT;  // Current state of writer
-    defwFunc = DEFW_UNINIT;   // Current function of writer
-    defwDidNets = 0;  // required section
-    defwDidComponents = 0;  // required section
-    defwDidInit = 0;  // required section
+    defwCtx->defwState = DEFW_UNINIT;  // Current state of writer
+    defwCtx->defwFunc = DEFW_UNINIT;   // Current function of writer
+    defwCtx->defwDidNets = 0;  // required section
+    defwCtx->defwDidComponents = 0;  // required section
+    defwCtx->defwDidInit = 0;  // required section
 
     if (vers1) {  // optional in 5.6 on
-        fprintf(defwFile, "VERSION %d.%d ;\n", vers1, vers2);
-        defwLines++;
+        defwPrintf("VERSION %d.%d ;\n", vers1, vers2);
+        defwCtx->defwLines++;
     }
 
     if ((vers1 == 5) && (vers2 < 6)) {  // For version before 5.6
         if (caseSensitive == 0 || *caseSensitive == 0)
             return DEFW_BAD_DATA;
-        fprintf(defwFile, "NAMESCASESENSITIVE %s ;\n", caseSensitive);
+        defwPrintf("NAMESCASESENSITIVE %s ;\n", caseSensitive);
     }
 
     if (dividerChar) {  // optional in 5.6 on
-        fprintf(defwFile, "DIVIDERCHAR \"%s\" ;\n", dividerChar);
-        defwLines++;
+        defwPrintf("DIVIDERCHAR \"%s\" ;\n", dividerChar);
+        defwCtx->defwLines++;
     }
 
     if (busBitChars) {  // optional in 5.6 on
-        fprintf(defwFile, "BUSBITCHARS \"%s\" ;\n", busBitChars);
-        defwLines++;
+        defwPrintf("BUSBITCHARS \"%s\" ;\n", busBitChars);
+        defwCtx->defwLines++;
     }
 
     if (designName == 0 || *designName == 0)
         return DEFW_BAD_DATA;
-    fprintf(defwFile, "DESIGN %s ;\n", designName);
-    defwLines++;
+    defwPrintf("DESIGN %s ;\n", designName);
+    defwCtx->defwLines++;
 
     if (technology) {
-        fprintf(defwFile, "TECHNOLOGY %s ;\n", technology);
-        defwLines++;
+        defwPrintf("TECHNOLOGY %s ;\n", technology);
+        defwCtx->defwLines++;
     }
 
     if (array) {
-        fprintf(defwFile, "ARRAY %s ;\n", array);
-        defwLines++;
+        defwPrintf("ARRAY %s ;\n", array);
+        defwCtx->defwLines++;
     }
 
     if (floorplan) {
-        fprintf(defwFile, "FLOORPLAN %s ;\n", floorplan);
-        defwLines++;
+        defwPrintf("FLOORPLAN %s ;\n", floorplan);
+        defwCtx->defwLines++;
     }
 
     if (units != -1.0) {
@@ -417,17 +1082,17 @@ defwInit(FILE       *f,
         case 10000:
         case 16000:
         case 20000:
-            fprintf(defwFile, "UNITS DISTANCE MICRONS %d ;\n", ROUND(units));
-            defwLines++;
+            defwPrintf("UNITS DISTANCE MICRONS %d ;\n", ROUND(units));
+            defwCtx->defwLines++;
             break;
         default:
             return DEFW_BAD_DATA;
         }
     }
 
-    defwDidInit = 1;
-    defwState = DEFW_DESIGN;
-    defwHasInit = 1;
+    defwCtx->defwDidInit = 1;
+    defwCtx->defwState = DEFW_DESIGN;
+    defwCtx->defwHasInit = 1;
     return DEFW_OK;
 }
 
@@ -438,23 +1103,23 @@ int
 defwInitCbk(FILE *f)
 {
 
-    defwFile = f;
-    if (defwHasInit == 1) {  // defwInit has already called, issue an error
+    defwSetOutputFile(f);
+    if (defwCtx->defwHasInit == 1) {  // defwInit has already called, issue an error
         fprintf(stderr,
                 "ERROR (DEFWRIT-9001): The DEF writer has detected that the function defwInit has already been called and you are trying to call defwInitCbk.\nOnly defwInitCbk or defwInit can be called but not both.\nUpdate your program and then try again.\n");
         fprintf(stderr, "Writer Exit.\n");
         exit(DEFW_BAD_ORDER);
     }
 
-    defwState = DEFW_UNINIT;  // Current state of writer
-    defwFunc = DEFW_UNINIT;   // Current function of writer
-    defwDidNets = 0;  // required section
-    defwDidComponents = 0;  // required section
-    defwDidInit = 0;  // required section
+    defwCtx->defwState = DEFW_UNINIT;  // Current state of writer
+    defwCtx->defwFunc = DEFW_UNINIT;   // Current function of writer
+    defwCtx->defwDidNets = 0;  // required section
+    defwCtx->defwDidComponents = 0;  // required section
+    defwCtx->defwDidInit = 0;  // required section
 
-    defwDidInit = 1;
-    defwState = DEFW_INIT;
-    defwHasInitCbk = 1;
+    defwCtx->defwDidInit = 1;
+    defwCtx->defwState = DEFW_INIT;
+    defwCtx->defwHasInitCbk = 1;
     return DEFW_OK;
 }
 
@@ -462,171 +1127,171 @@ int
 defwVersion(int vers1,
             int vers2)
 {
-    defwFunc = DEFW_VERSION;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_VERSION;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (!defwDidInit)
+    if (!defwCtx->defwDidInit)
         return DEFW_BAD_ORDER;
-    if (defwState != DEFW_INIT)  // version follows init 
+    if (defwCtx->defwState != DEFW_INIT)  // version follows init 
         return DEFW_BAD_ORDER;
-    fprintf(defwFile, "VERSION %d.%d ;\n", vers1, vers2);
+    defwPrintf("VERSION %d.%d ;\n", vers1, vers2);
     if (vers2 >= 10)
-        defVersionNum = vers1 + (vers2 / 100.0);
+        defwCtx->defVersionNum = vers1 + (vers2 / 100.0);
     else
-        defVersionNum = vers1 + (vers2 / 10.0);
-    defwLines++;
+        defwCtx->defVersionNum = vers1 + (vers2 / 10.0);
+    defwCtx->defwLines++;
 
-    defwState = DEFW_VERSION;
+    defwCtx->defwState = DEFW_VERSION;
     return DEFW_OK;
 }
 
 int
 defwCaseSensitive(const char *caseSensitive)
 {
-    defwObsoleteNum = DEFW_CASESENSITIVE;
-    defwFunc = DEFW_CASESENSITIVE;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwObsoleteNum = DEFW_CASESENSITIVE;
+    defwCtx->defwFunc = DEFW_CASESENSITIVE;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (!defwDidInit)
+    if (!defwCtx->defwDidInit)
         return DEFW_BAD_ORDER;
-    if (defVersionNum >= 5.6)
+    if (defwCtx->defVersionNum >= 5.6)
         return DEFW_OBSOLETE;
     // Check for repeated casesensitive
-    if (defwState == DEFW_CASESENSITIVE)
+    if (defwCtx->defwState == DEFW_CASESENSITIVE)
         return DEFW_BAD_ORDER;
     if (strcmp(caseSensitive, "ON") && strcmp(caseSensitive, "OFF"))
         return DEFW_BAD_DATA;     // has to be either ON or OFF
-    fprintf(defwFile, "NAMESCASESENSITIVE %s ;\n", caseSensitive);
-    defwLines++;
+    defwPrintf("NAMESCASESENSITIVE %s ;\n", caseSensitive);
+    defwCtx->defwLines++;
 
-    defwState = DEFW_CASESENSITIVE;
+    defwCtx->defwState = DEFW_CASESENSITIVE;
     return DEFW_OK;
 }
 
 int
 defwBusBitChars(const char *busBitChars)
 {
-    defwFunc = DEFW_BUSBIT;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_BUSBIT;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (!defwDidInit)
+    if (!defwCtx->defwDidInit)
         return DEFW_BAD_ORDER;
     // Check for repeated casesensitive
-    if (defwState == DEFW_BUSBIT)
+    if (defwCtx->defwState == DEFW_BUSBIT)
         return DEFW_BAD_ORDER;
     if (busBitChars && busBitChars != 0 && *busBitChars != 0) {
-        fprintf(defwFile, "BUSBITCHARS \"%s\" ;\n", busBitChars);
-        defwLines++;
+        defwPrintf("BUSBITCHARS \"%s\" ;\n", busBitChars);
+        defwCtx->defwLines++;
     }
 
-    defwState = DEFW_BUSBIT;
+    defwCtx->defwState = DEFW_BUSBIT;
     return DEFW_OK;
 }
 
 int
 defwDividerChar(const char *dividerChar)
 {
-    defwFunc = DEFW_DIVIDER;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_DIVIDER;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (!defwDidInit)
+    if (!defwCtx->defwDidInit)
         return DEFW_BAD_ORDER;
     // Check for repeated busbit
-    if (defwState == DEFW_DIVIDER)
+    if (defwCtx->defwState == DEFW_DIVIDER)
         return DEFW_BAD_ORDER;
     if (dividerChar && dividerChar != 0 && *dividerChar != 0) {
-        fprintf(defwFile, "DIVIDERCHAR \"%s\" ;\n", dividerChar);
-        defwLines++;
+        defwPrintf("DIVIDERCHAR \"%s\" ;\n", dividerChar);
+        defwCtx->defwLines++;
     }
 
-    defwState = DEFW_DIVIDER;
+    defwCtx->defwState = DEFW_DIVIDER;
     return DEFW_OK;
 }
 
 int
 defwDesignName(const char *name)
 {
-    defwFunc = DEFW_DESIGN;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_DESIGN;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (!defwDidInit)
+    if (!defwCtx->defwDidInit)
         return DEFW_BAD_ORDER;
     // Check for repeated design
-    if (defwState == DEFW_DESIGN)
+    if (defwCtx->defwState == DEFW_DESIGN)
         return DEFW_BAD_ORDER;
     if (name && name != 0 && *name != 0) {
-        fprintf(defwFile, "DESIGN %s ;\n", name);
-        defwLines++;
+        defwPrintf("DESIGN %s ;\n", name);
+        defwCtx->defwLines++;
     }
 
-    defwState = DEFW_DESIGN;
+    defwCtx->defwState = DEFW_DESIGN;
     return DEFW_OK;
 }
 
 int
 defwTechnology(const char *technology)
 {
-    defwFunc = DEFW_TECHNOLOGY;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_TECHNOLOGY;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (!defwDidInit)
+    if (!defwCtx->defwDidInit)
         return DEFW_BAD_ORDER;
     if (technology && technology != 0 && *technology != 0) {
-        fprintf(defwFile, "TECHNOLOGY %s ;\n", technology);
-        defwLines++;
+        defwPrintf("TECHNOLOGY %s ;\n", technology);
+        defwCtx->defwLines++;
     }
 
-    defwState = DEFW_TECHNOLOGY;
+    defwCtx->defwState = DEFW_TECHNOLOGY;
     return DEFW_OK;
 }
 
 int
 defwArray(const char *array)
 {
-    defwFunc = DEFW_ARRAY;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_ARRAY;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (!defwDidInit)
+    if (!defwCtx->defwDidInit)
         return DEFW_BAD_ORDER;
-    if (defwState == DEFW_ARRAY)
+    if (defwCtx->defwState == DEFW_ARRAY)
         return DEFW_BAD_ORDER;     // check for repeated array
     if (array && array != 0 && *array != 0) {
-        fprintf(defwFile, "ARRAY %s ;\n", array);
-        defwLines++;
+        defwPrintf("ARRAY %s ;\n", array);
+        defwCtx->defwLines++;
     }
 
-    defwState = DEFW_ARRAY;
+    defwCtx->defwState = DEFW_ARRAY;
     return DEFW_OK;
 }
 
 int
 defwFloorplan(const char *floorplan)
 {
-    defwFunc = DEFW_FLOORPLAN;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_FLOORPLAN;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (!defwDidInit)
+    if (!defwCtx->defwDidInit)
         return DEFW_BAD_ORDER;
-    if (defwState == DEFW_FLOORPLAN)
+    if (defwCtx->defwState == DEFW_FLOORPLAN)
         return DEFW_BAD_ORDER;     // Check for repeated floorplan
     if (floorplan && floorplan != 0 && *floorplan != 0) {
-        fprintf(defwFile, "FLOORPLAN %s ;\n", floorplan);
-        defwLines++;
+        defwPrintf("FLOORPLAN %s ;\n", floorplan);
+        defwCtx->defwLines++;
     }
 
-    defwState = DEFW_FLOORPLAN;
+    defwCtx->defwState = DEFW_FLOORPLAN;
     return DEFW_OK;
 }
 
 int
 defwUnits(int units)
 {
-    defwFunc = DEFW_UNITS;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_UNITS;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (!defwDidInit)
+    if (!defwCtx->defwDidInit)
         return DEFW_BAD_ORDER;
-    if (defwState == DEFW_UNITS)
+    if (defwCtx->defwState == DEFW_UNITS)
         return DEFW_BAD_ORDER;     // Check for repeated units
     if (units != 0) {
         switch (units) {
@@ -636,15 +1301,15 @@ defwUnits(int units)
         case 2000:
         case 10000:
         case 20000:
-            fprintf(defwFile, "UNITS DISTANCE MICRONS %d ;\n", units);
-            defwLines++;
+            defwPrintf("UNITS DISTANCE MICRONS %d ;\n", units);
+            defwCtx->defwLines++;
             break;
         default:
             return DEFW_BAD_DATA;
         }
     }
 
-    defwState = DEFW_UNITS;
+    defwCtx->defwState = DEFW_UNITS;
     return DEFW_OK;
 }
 
@@ -652,39 +1317,40 @@ int
 defwHistory(const char *string)
 {
     char *c;
-    defwFunc = DEFW_HISTORY;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_HISTORY;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (!defwDidInit)
+    if (!defwCtx->defwDidInit)
         return DEFW_BAD_ORDER;
     if (string == 0 || *string == 0)
         return DEFW_BAD_DATA;
 
     for (c = (char*) string; *c; c++)
         if (*c == '\n')
-            defwLines++;
+            defwCtx->defwLines++;
 
-    fprintf(defwFile, "HISTORY %s ;\n", string);
-    defwLines++;
+    defwPrintf("HISTORY %s ;\n", string);
+    defwCtx->defwLines++;
 
-    defwState = DEFW_HISTORY;
+    defwCtx->defwState = DEFW_HISTORY;
     return DEFW_OK;
 }
 
 int
 defwStartPropDef()
 {
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (!defwDidInit)
+    if (!defwCtx->defwDidInit)
         return DEFW_BAD_ORDER;
-    if ((defwState >= DEFW_PROP_START) && (defwState <= DEFW_PROP_END))
+    if ((defwCtx->defwState >= DEFW_PROP_START) && (defwCtx->defwState <= DEFW_PROP_END))
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, "PROPERTYDEFINITIONS\n");
-    defwLines++;
+    defwPrintf("PROPERTYDEFINITIONS\n");
+    defwCtx->defwLines++;
 
-    defwState = DEFW_PROP_START;
+    defwCtx->defwState = DEFW_PROP_START;
+    defwTraceSectionStart();
     return DEFW_OK;
 }
 
@@ -710,10 +1376,10 @@ defwIntPropDef(const char   *objType,
                )
 {
 
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PROP_START &&
-        defwState != DEFW_PROP)
+    if (defwCtx->defwState != DEFW_PROP_START &&
+        defwCtx->defwState != DEFW_PROP)
         return DEFW_BAD_ORDER;
     if ((!objType || !*objType) || (!propName || !*propName)) // require
         return DEFW_BAD_DATA;
@@ -721,17 +1387,17 @@ defwIntPropDef(const char   *objType,
     if (!defwIsPropObjType(objType))
         return DEFW_BAD_DATA;
 
-    fprintf(defwFile, "   %s %s INTEGER ", objType, propName);
+    defwPrintf("   %s %s INTEGER ", objType, propName);
     if (leftRange || rightRange)
-        fprintf(defwFile, "RANGE %.11g %.11g ", leftRange, rightRange);
+        defwPrintf("RANGE %.11g %.11g ", leftRange, rightRange);
 
     if (propValue)
-        fprintf(defwFile, "%d ", propValue);
+        defwPrintf("%d ", propValue);
 
-    fprintf(defwFile, ";\n");
+    defwPrintf(";\n");
 
-    defwLines++;
-    defwState = DEFW_PROP;
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_PROP;
     return DEFW_OK;
 }
 
@@ -745,10 +1411,10 @@ defwRealPropDef(const char  *objType,
                 )
 {
 
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PROP_START &&
-        defwState != DEFW_PROP)
+    if (defwCtx->defwState != DEFW_PROP_START &&
+        defwCtx->defwState != DEFW_PROP)
         return DEFW_BAD_ORDER;
     if ((!objType || !*objType) || (!propName || !*propName)) // require
         return DEFW_BAD_DATA;
@@ -756,17 +1422,17 @@ defwRealPropDef(const char  *objType,
     if (!defwIsPropObjType(objType))
         return DEFW_BAD_DATA;
 
-    fprintf(defwFile, "   %s %s REAL ", objType, propName);
+    defwPrintf("   %s %s REAL ", objType, propName);
     if (leftRange || rightRange)
-        fprintf(defwFile, "RANGE %.11g %.11g ", leftRange, rightRange);
+        defwPrintf("RANGE %.11g %.11g ", leftRange, rightRange);
 
     if (propValue)
-        fprintf(defwFile, "%.11g ", propValue);
+        defwPrintf("%.11g ", propValue);
 
-    fprintf(defwFile, ";\n");
+    defwPrintf(";\n");
 
-    defwLines++;
-    defwState = DEFW_PROP;
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_PROP;
     return DEFW_OK;
 }
 
@@ -780,10 +1446,10 @@ defwStringPropDef(const char    *objType,
                   )
 {
 
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PROP_START &&
-        defwState != DEFW_PROP)
+    if (defwCtx->defwState != DEFW_PROP_START &&
+        defwCtx->defwState != DEFW_PROP)
         return DEFW_BAD_ORDER;
     if ((!objType || !*objType) || (!propName || !*propName))
         return DEFW_BAD_DATA;
@@ -791,17 +1457,17 @@ defwStringPropDef(const char    *objType,
     if (!defwIsPropObjType(objType))
         return DEFW_BAD_DATA;
 
-    fprintf(defwFile, "   %s %s STRING ", objType, propName);
+    defwPrintf("   %s %s STRING ", objType, propName);
     if (leftRange || rightRange)
-        fprintf(defwFile, "RANGE %.11g %.11g ", leftRange, rightRange);
+        defwPrintf("RANGE %.11g %.11g ", leftRange, rightRange);
 
     if (propValue)
-        fprintf(defwFile, "\"%s\" ", propValue);  // string, set quotes
+        defwPrintf("\"%s\" ", propValue);  // string, set quotes
 
-    fprintf(defwFile, ";\n");
+    defwPrintf(";\n");
 
-    defwLines++;
-    defwState = DEFW_PROP;
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_PROP;
     return DEFW_OK;
 }
 
@@ -809,29 +1475,30 @@ defwStringPropDef(const char    *objType,
 int
 defwEndPropDef()
 {
-    defwFunc = DEFW_PROP_END;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_PROP_END;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PROP_START &&
-        defwState != DEFW_PROP)
+    if (defwCtx->defwState != DEFW_PROP_START &&
+        defwCtx->defwState != DEFW_PROP)
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, "END PROPERTYDEFINITIONS\n\n");
-    defwLines++;
+    defwPrintf("END PROPERTYDEFINITIONS\n\n");
+    defwCtx->defwLines++;
 
-    defwState = DEFW_PROP_END;
+    defwCtx->defwState = DEFW_PROP_END;
+    defwTraceSectionEnd("PROPERTYDEFINITIONS");
     return DEFW_OK;
 }
 
 int
 defwIsPropState()
 {
-    if ((defwState != DEFW_ROW) && (defwState != DEFW_REGION) &&
-        (defwState != DEFW_COMPONENT) && (defwState != DEFW_PIN) &&
-        (defwState != DEFW_SNET) && (defwState != DEFW_NET) &&
-        (defwState != DEFW_GROUP) && (defwState != DEFW_PINPROP) &&
-        (defwState != DEFW_SNET_OPTIONS) && (defwState != DEFW_NET_OPTIONS) &&
-        (defwState != DEFW_NDR) && (defwState != DEFW_BEGINEXT))
+    if ((defwCtx->defwState != DEFW_ROW) && (defwCtx->defwState != DEFW_REGION) &&
+        (defwCtx->defwState != DEFW_COMPONENT) && (defwCtx->defwState != DEFW_PIN) &&
+        (defwCtx->defwState != DEFW_SNET) && (defwCtx->defwState != DEFW_NET) &&
+        (defwCtx->defwState != DEFW_GROUP) && (defwCtx->defwState != DEFW_PINPROP) &&
+        (defwCtx->defwState != DEFW_SNET_OPTIONS) && (defwCtx->defwState != DEFW_NET_OPTIONS) &&
+        (defwCtx->defwState != DEFW_NDR) && (defwCtx->defwState != DEFW_BEGINEXT))
         return 0;
     return 1;
 }
@@ -845,8 +1512,8 @@ defwStringProperty(const char   *propName,
 
     // new line for the defwRow of the previous line
     // do not end with newline, may have more than on properties
-    fprintf(defwFile, "\n      + PROPERTY %s \"%s\" ", propName, propValue);
-    defwLines++;
+    defwPrintf("\n      + PROPERTY %s \"%s\" ", propName, propValue);
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -860,8 +1527,8 @@ defwRealProperty(const char *propName,
 
     // new line for the defwRow of the previous line
     // do not end with newline, may have more than on properties
-    fprintf(defwFile, "\n      + PROPERTY %s %.11g ", propName, propValue);
-    defwLines++;
+    defwPrintf("\n      + PROPERTY %s %.11g ", propName, propValue);
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -875,8 +1542,8 @@ defwIntProperty(const char  *propName,
 
     // new line for the defwRow of the previous line
     // do not end with newline, may have more than on properties
-    fprintf(defwFile, "\n      + PROPERTY %s %d ", propName, propValue);
-    defwLines++;
+    defwPrintf("\n      + PROPERTY %s %d ", propName, propValue);
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -887,20 +1554,20 @@ defwDieArea(int xl,
             int xh,
             int yh)
 {
-    defwFunc = DEFW_DIE_AREA;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_DIE_AREA;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (!defwDidInit)
+    if (!defwCtx->defwDidInit)
         return DEFW_BAD_ORDER;
-    if (defwState == DEFW_DIE_AREA)
+    if (defwCtx->defwState == DEFW_DIE_AREA)
         return DEFW_BAD_ORDER;
     if (xl > xh || yl > yh)
         return DEFW_BAD_DATA;
 
-    fprintf(defwFile, "DIEAREA ( %d %d ) ( %d %d ) ;\n", xl, yl, xh, yh);
-    defwLines++;
+    defwPrintf("DIEAREA ( %d %d ) ( %d %d ) ;\n", xl, yl, xh, yh);
+    defwCtx->defwLines++;
 
-    defwState = DEFW_DIE_AREA;
+    defwCtx->defwState = DEFW_DIE_AREA;
     return DEFW_OK;
 }
 
@@ -912,34 +1579,34 @@ defwDieAreaList(int num_points,
 {
     int i;
 
-    defwFunc = DEFW_DIE_AREA;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_DIE_AREA;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (!defwDidInit)
+    if (!defwCtx->defwDidInit)
         return DEFW_BAD_ORDER;
-    if (defwState == DEFW_DIE_AREA)
+    if (defwCtx->defwState == DEFW_DIE_AREA)
         return DEFW_BAD_ORDER;
-    if (defVersionNum < 5.6)
+    if (defwCtx->defVersionNum < 5.6)
         return DEFW_WRONG_VERSION;
     if (num_points < 4)
         return DEFW_BAD_DATA;
 
-    fprintf(defwFile, "DIEAREA ");
+    defwPrintf("DIEAREA ");
     for (i = 0; i < num_points; i++) {
         if (i == 0)
-            fprintf(defwFile, "( %d %d ) ", *xl++, *yl++);
+            defwPrintf("( %d %d ) ", *xl++, *yl++);
         else {
             if ((i % 5) == 0) {
-                fprintf(defwFile, "\n        ( %d %d ) ", *xl++, *yl++);
-                defwLines++;
+                defwPrintf("\n        ( %d %d ) ", *xl++, *yl++);
+                defwCtx->defwLines++;
             } else
-                fprintf(defwFile, "( %d %d ) ", *xl++, *yl++);
+                defwPrintf("( %d %d ) ", *xl++, *yl++);
         }
     }
-    fprintf(defwFile, ";\n");
-    defwLines++;
+    defwPrintf(";\n");
+    defwCtx->defwLines++;
 
-    defwState = DEFW_DIE_AREA;
+    defwCtx->defwState = DEFW_DIE_AREA;
     return DEFW_OK;
 }
 
@@ -987,14 +1654,14 @@ defwRow(const char  *rowName,
         int         do_x,
         int         do_y)
 {
-    defwFunc = DEFW_ROW;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_ROW;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (!defwDidInit)
+    if (!defwCtx->defwDidInit)
         return DEFW_BAD_ORDER;
 
-    if (defwState == DEFW_ROW)
-        fprintf(defwFile, ";\n");// add the ; and newline for the previous row.
+    if (defwCtx->defwState == DEFW_ROW)
+        defwPrintf(";\n");// add the ; and newline for the previous row.
 
     // required
     if ((rowName == 0) || (*rowName == 0) || (rowType == 0) || (*rowType == 0))
@@ -1002,16 +1669,16 @@ defwRow(const char  *rowName,
 
     // do not have ; because the row may have properties
     // do not end with newline, if there is no property, ; need to be concat.
-    fprintf(defwFile, "ROW %s %s %d %d %s ", rowName, rowType, x_orig, y_orig,
+    defwPrintf("ROW %s %s %d %d %s ", rowName, rowType, x_orig, y_orig,
             defwOrient(orient));
     if ((do_count != 0) || (do_increment != 0)) {
-        fprintf(defwFile, "DO %d BY %d ", do_count, do_increment);
+        defwPrintf("DO %d BY %d ", do_count, do_increment);
         if ((do_x != 0) || (do_y != 0))
-            fprintf(defwFile, "STEP %d %d ", do_x, do_y);
+            defwPrintf("STEP %d %d ", do_x, do_y);
     }
-    defwLines++;
+    defwCtx->defwLines++;
 
-    defwState = DEFW_ROW;
+    defwCtx->defwState = DEFW_ROW;
     return DEFW_OK;
 }
 
@@ -1027,30 +1694,30 @@ defwRowStr(const char   *rowName,
            int          do_x,
            int          do_y)
 {
-    defwFunc = DEFW_ROW;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_ROW;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (!defwDidInit)
+    if (!defwCtx->defwDidInit)
         return DEFW_BAD_ORDER;
 
-    if (defwState == DEFW_ROW)
-        fprintf(defwFile, ";\n");// add the ; and newline for the previous row.
+    if (defwCtx->defwState == DEFW_ROW)
+        defwPrintf(";\n");// add the ; and newline for the previous row.
 
     if ((!rowName || !*rowName) || (!rowType || !*rowType)) // required
         return DEFW_BAD_DATA;
 
     // do not have ; because the row may have properties
     // do not end with newline, if there is no property, ; need to be concat.
-    fprintf(defwFile, "ROW %s %s %d %d %s ", rowName, rowType, x_orig, y_orig,
+    defwPrintf("ROW %s %s %d %d %s ", rowName, rowType, x_orig, y_orig,
             orient);
     if ((do_count != 0) || (do_increment != 0)) {
-        fprintf(defwFile, "DO %d BY %d ", do_count, do_increment);
+        defwPrintf("DO %d BY %d ", do_count, do_increment);
         if ((do_x != 0) || (do_y != 0))
-            fprintf(defwFile, "STEP %d %d ", do_x, do_y);
+            defwPrintf("STEP %d %d ", do_x, do_y);
     }
-    defwLines++;
+    defwCtx->defwLines++;
 
-    defwState = DEFW_ROW;
+    defwCtx->defwState = DEFW_ROW;
     return DEFW_OK;
 }
 
@@ -1067,14 +1734,14 @@ defwTracks(const char   *master,
 {
     int i;
 
-    defwFunc = DEFW_TRACKS;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_TRACKS;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (!defwDidInit)
+    if (!defwCtx->defwDidInit)
         return DEFW_BAD_ORDER;
 
-    if (defwState == DEFW_ROW)
-        fprintf(defwFile, ";\n\n");  // add the ; and \n for the previous row
+    if (defwCtx->defwState == DEFW_ROW)
+        defwPrintf(";\n\n");  // add the ; and \n for the previous row
 
     if (!master || !*master) // required
         return DEFW_BAD_DATA;
@@ -1083,29 +1750,29 @@ defwTracks(const char   *master,
 
 
     if (mask) {
-        if (defVersionNum < 5.8) {
+        if (defwCtx->defVersionNum < 5.8) {
             return DEFW_WRONG_VERSION;
         }
 
         if (sameMask) {
-            fprintf(defwFile, "TRACKS %s %d DO %d STEP %d MASK %d SAMEMASK LAYER",
+            defwPrintf("TRACKS %s %d DO %d STEP %d MASK %d SAMEMASK LAYER",
                     master, do_start, do_cnt, do_step, mask);
         } else {
-            fprintf(defwFile, "TRACKS %s %d DO %d STEP %d MASK %d LAYER",
+            defwPrintf("TRACKS %s %d DO %d STEP %d MASK %d LAYER",
                     master, do_start, do_cnt, do_step, mask);
         }
     } else {
-        fprintf(defwFile, "TRACKS %s %d DO %d STEP %d LAYER",
+        defwPrintf("TRACKS %s %d DO %d STEP %d LAYER",
                 master, do_start, do_cnt, do_step);
     }
 
     for (i = 0; i < num_layers; i++) {
-        fprintf(defwFile, " %s", layers[i]);
+        defwPrintf(" %s", layers[i]);
     }
-    fprintf(defwFile, " ;\n");
-    defwLines++;
+    defwPrintf(" ;\n");
+    defwCtx->defwLines++;
 
-    defwState = DEFW_TRACKS;
+    defwCtx->defwState = DEFW_TRACKS;
     return DEFW_OK;
 }
 
@@ -1116,25 +1783,25 @@ defwGcellGrid(const char    *master,
               int           do_cnt,
               int           do_step)
 {
-    defwFunc = DEFW_GCELL_GRID;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_GCELL_GRID;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (!defwDidInit)
+    if (!defwCtx->defwDidInit)
         return DEFW_BAD_ORDER;
 
-    if (defwState == DEFW_ROW)
-        fprintf(defwFile, ";\n\n");  // add the ; and \n for the previous row.
+    if (defwCtx->defwState == DEFW_ROW)
+        defwPrintf(";\n\n");  // add the ; and \n for the previous row.
 
     if (!master || !*master) // required
         return DEFW_BAD_DATA;
     if (strcmp(master, "X") && strcmp(master, "Y"))
         return DEFW_BAD_DATA;
 
-    fprintf(defwFile, "GCELLGRID %s %d DO %d STEP %d ;\n", master, do_start,
+    defwPrintf("GCELLGRID %s %d DO %d STEP %d ;\n", master, do_start,
             do_cnt, do_step);
-    defwLines++;
+    defwCtx->defwLines++;
 
-    defwState = DEFW_GCELL_GRID;
+    defwCtx->defwState = DEFW_GCELL_GRID;
     return DEFW_OK;
 }
 
@@ -1142,26 +1809,27 @@ defwGcellGrid(const char    *master,
 int
 defwStartDefaultCap(int count)
 {
-    defwObsoleteNum = DEFW_DEFAULTCAP_START;
-    defwFunc = DEFW_DEFAULTCAP_START;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwObsoleteNum = DEFW_DEFAULTCAP_START;
+    defwCtx->defwFunc = DEFW_DEFAULTCAP_START;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (!defwDidInit)
+    if (!defwCtx->defwDidInit)
         return DEFW_BAD_ORDER;
-    if ((defwState >= DEFW_DEFAULTCAP_START) &&
-        (defwState <= DEFW_DEFAULTCAP_END))
+    if ((defwCtx->defwState >= DEFW_DEFAULTCAP_START) &&
+        (defwCtx->defwState <= DEFW_DEFAULTCAP_END))
         return DEFW_BAD_ORDER;
-    if (defVersionNum >= 5.4)
+    if (defwCtx->defVersionNum >= 5.4)
         return DEFW_OBSOLETE;
 
-    if (defwState == DEFW_ROW)
-        fprintf(defwFile, ";\n\n");  // add the ; and \n for the previous row.
+    if (defwCtx->defwState == DEFW_ROW)
+        defwPrintf(";\n\n");  // add the ; and \n for the previous row.
 
-    fprintf(defwFile, "DEFAULTCAP %d\n", count);
-    defwLines++;
+    defwPrintf("DEFAULTCAP %d\n", count);
+    defwCtx->defwLines++;
 
-    defwCounter = count;
-    defwState = DEFW_DEFAULTCAP_START;
+    defwCtx->defwCounter = count;
+    defwCtx->defwState = DEFW_DEFAULTCAP_START;
+    defwTraceSectionStart();
     return DEFW_OK;
 }
 
@@ -1170,18 +1838,18 @@ int
 defwDefaultCap(int      pins,
                double   cap)
 {
-    defwFunc = DEFW_DEFAULTCAP;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_DEFAULTCAP;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_DEFAULTCAP_START &&
-        defwState != DEFW_DEFAULTCAP)
+    if (defwCtx->defwState != DEFW_DEFAULTCAP_START &&
+        defwCtx->defwState != DEFW_DEFAULTCAP)
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, "   MINPINS %d WIRECAP %f ;\n", pins, cap);
-    defwLines++;
-    defwCounter--;
+    defwPrintf("   MINPINS %d WIRECAP %f ;\n", pins, cap);
+    defwCtx->defwLines++;
+    defwCtx->defwCounter--;
 
-    defwState = DEFW_DEFAULTCAP;
+    defwCtx->defwState = DEFW_DEFAULTCAP;
     return DEFW_OK;
 }
 
@@ -1189,21 +1857,22 @@ defwDefaultCap(int      pins,
 int
 defwEndDefaultCap()
 {
-    defwFunc = DEFW_DEFAULTCAP_END;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_DEFAULTCAP_END;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_DEFAULTCAP_START &&
-        defwState != DEFW_DEFAULTCAP)
+    if (defwCtx->defwState != DEFW_DEFAULTCAP_START &&
+        defwCtx->defwState != DEFW_DEFAULTCAP)
         return DEFW_BAD_ORDER;
-    if (defwCounter > 0)
+    if (defwCtx->defwCounter > 0)
         return DEFW_BAD_DATA;
-    else if (defwCounter < 0)
+    else if (defwCtx->defwCounter < 0)
         return DEFW_TOO_MANY_STMS;
 
-    fprintf(defwFile, "END DEFAULTCAP\n\n");
-    defwLines++;
+    defwPrintf("END DEFAULTCAP\n\n");
+    defwCtx->defwLines++;
 
-    defwState = DEFW_DEFAULTCAP_END;
+    defwCtx->defwState = DEFW_DEFAULTCAP_END;
+    defwTraceSectionEnd("DEFAULTCAP");
     return DEFW_OK;
 }
 
@@ -1218,23 +1887,23 @@ defwCanPlace(const char *master,
              int        xStep,
              int        yStep)
 {
-    defwFunc = DEFW_CANPLACE;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_CANPLACE;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (!defwDidInit)
+    if (!defwCtx->defwDidInit)
         return DEFW_BAD_ORDER;
 
-    if (defwState == DEFW_ROW)
-        fprintf(defwFile, ";\n\n");  // add the ; and \n for the previous row.
+    if (defwCtx->defwState == DEFW_ROW)
+        defwPrintf(";\n\n");  // add the ; and \n for the previous row.
 
     if ((master == 0) || (*master == 0)) // required
         return DEFW_BAD_DATA;
-    fprintf(defwFile, "CANPLACE %s %d %d %s DO %d BY %d STEP %d %d ;\n",
+    defwPrintf("CANPLACE %s %d %d %s DO %d BY %d STEP %d %d ;\n",
             master, xOrig, yOrig, defwOrient(orient),
             doCnt, doInc, xStep, yStep);
-    defwLines++;
+    defwCtx->defwLines++;
 
-    defwState = DEFW_CANPLACE;
+    defwCtx->defwState = DEFW_CANPLACE;
     return DEFW_OK;
 }
 
@@ -1249,23 +1918,23 @@ defwCanPlaceStr(const char  *master,
                 int         xStep,
                 int         yStep)
 {
-    defwFunc = DEFW_CANPLACE;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_CANPLACE;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (!defwDidInit)
+    if (!defwCtx->defwDidInit)
         return DEFW_BAD_ORDER;
 
-    if (defwState == DEFW_ROW)
-        fprintf(defwFile, ";\n\n");  // add the ; and \n for the previous row.
+    if (defwCtx->defwState == DEFW_ROW)
+        defwPrintf(";\n\n");  // add the ; and \n for the previous row.
 
     if (!master || !*master) // required
         return DEFW_BAD_DATA;
-    fprintf(defwFile, "CANPLACE %s %d %d %s DO %d BY %d STEP %d %d ;\n",
+    defwPrintf("CANPLACE %s %d %d %s DO %d BY %d STEP %d %d ;\n",
             master, xOrig, yOrig, orient,
             doCnt, doInc, xStep, yStep);
-    defwLines++;
+    defwCtx->defwLines++;
 
-    defwState = DEFW_CANPLACE;
+    defwCtx->defwState = DEFW_CANPLACE;
     return DEFW_OK;
 }
 
@@ -1280,20 +1949,20 @@ defwCannotOccupy(const char *master,
                  int        xStep,
                  int        yStep)
 {
-    defwFunc = DEFW_CANNOTOCCUPY;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_CANNOTOCCUPY;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (!defwDidInit)
+    if (!defwCtx->defwDidInit)
         return DEFW_BAD_ORDER;
 
     if ((master == 0) || (*master == 0)) // required
         return DEFW_BAD_DATA;
-    fprintf(defwFile, "CANNOTOCCUPY %s %d %d %s DO %d BY %d STEP %d %d ;\n",
+    defwPrintf("CANNOTOCCUPY %s %d %d %s DO %d BY %d STEP %d %d ;\n",
             master, xOrig, yOrig, defwOrient(orient),
             doCnt, doInc, xStep, yStep);
-    defwLines++;
+    defwCtx->defwLines++;
 
-    defwState = DEFW_CANNOTOCCUPY;
+    defwCtx->defwState = DEFW_CANNOTOCCUPY;
     return DEFW_OK;
 }
 
@@ -1308,20 +1977,20 @@ defwCannotOccupyStr(const char  *master,
                     int         xStep,
                     int         yStep)
 {
-    defwFunc = DEFW_CANNOTOCCUPY;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_CANNOTOCCUPY;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (!defwDidInit)
+    if (!defwCtx->defwDidInit)
         return DEFW_BAD_ORDER;
 
     if (!master || !*master) // required
         return DEFW_BAD_DATA;
-    fprintf(defwFile, "CANNOTOCCUPY %s %d %d %s DO %d BY %d STEP %d %d ;\n",
+    defwPrintf("CANNOTOCCUPY %s %d %d %s DO %d BY %d STEP %d %d ;\n",
             master, xOrig, yOrig, orient,
             doCnt, doInc, xStep, yStep);
-    defwLines++;
+    defwCtx->defwLines++;
 
-    defwState = DEFW_CANNOTOCCUPY;
+    defwCtx->defwState = DEFW_CANNOTOCCUPY;
     return DEFW_OK;
 }
 
@@ -1329,22 +1998,23 @@ defwCannotOccupyStr(const char  *master,
 int
 defwStartVias(int count)
 {
-    defwFunc = DEFW_VIA_START;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_VIA_START;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (!defwDidInit)
+    if (!defwCtx->defwDidInit)
         return DEFW_BAD_ORDER;
-    if ((defwState >= DEFW_VIA_START) && (defwState <= DEFW_VIA_END))
+    if ((defwCtx->defwState >= DEFW_VIA_START) && (defwCtx->defwState <= DEFW_VIA_END))
         return DEFW_BAD_ORDER;
 
-    if (defwState == DEFW_ROW)
-        fprintf(defwFile, ";\n\n");  // add the ; and \n for the previous row.
+    if (defwCtx->defwState == DEFW_ROW)
+        defwPrintf(";\n\n");  // add the ; and \n for the previous row.
 
-    fprintf(defwFile, "VIAS %d ;\n", count);
-    defwLines++;
+    defwPrintf("VIAS %d ;\n", count);
+    defwCtx->defwLines++;
 
-    defwCounter = count;
-    defwState = DEFW_VIA_START;
+    defwCtx->defwCounter = count;
+    defwCtx->defwState = DEFW_VIA_START;
+    defwTraceSectionStart();
     return DEFW_OK;
 }
 
@@ -1352,20 +2022,20 @@ defwStartVias(int count)
 int
 defwViaName(const char *name)
 {
-    defwFunc = DEFW_VIA;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_VIA;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_VIA_START &&
-        defwState != DEFW_VIAONE_END)
+    if (defwCtx->defwState != DEFW_VIA_START &&
+        defwCtx->defwState != DEFW_VIAONE_END)
         return DEFW_BAD_ORDER;
-    defwCounter--;
+    defwCtx->defwCounter--;
 
     if (!name || !*name) // required
         return DEFW_BAD_DATA;
-    fprintf(defwFile, "   - %s", name);
+    defwPrintf("   - %s", name);
 
-    defwState = DEFW_VIA;
-    defwViaHasVal = 0;
+    defwCtx->defwState = DEFW_VIA;
+    defwCtx->defwViaHasVal = 0;
     return DEFW_OK;
 }
 
@@ -1373,21 +2043,21 @@ defwViaName(const char *name)
 int
 defwViaPattern(const char *pattern)
 {
-    defwFunc = DEFW_VIA;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_VIA;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_VIA)
+    if (defwCtx->defwState != DEFW_VIA)
         return DEFW_BAD_ORDER;  // after defwViaName
 
-    if (defwViaHasVal)
+    if (defwCtx->defwViaHasVal)
         return DEFW_ALREADY_DEFINED;  // either PatternName or
     // ViaRule has defined
     if (!pattern || !*pattern) // required
         return DEFW_BAD_DATA;
-    fprintf(defwFile, " + PATTERNNAME %s", pattern);
+    defwPrintf(" + PATTERNNAME %s", pattern);
 
-    defwState = DEFW_VIA;
-    defwViaHasVal = 1;
+    defwCtx->defwState = DEFW_VIA;
+    defwCtx->defwViaHasVal = 1;
     return DEFW_OK;
 }
 
@@ -1400,29 +2070,29 @@ defwViaRect(const char  *layerNames,
             int         yh,
             int         mask)
 {
-    defwFunc = DEFW_VIA;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_VIA;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_VIA)
+    if (defwCtx->defwState != DEFW_VIA)
         return DEFW_BAD_ORDER;
 
     if (!layerNames || !*layerNames) // required
         return DEFW_BAD_DATA;
     if (!mask) {
-        fprintf(defwFile, "\n      + RECT %s ( %d %d ) ( %d %d )", layerNames,
+        defwPrintf("\n      + RECT %s ( %d %d ) ( %d %d )", layerNames,
                 xl, yl, xh, yh);
     } else {
-        if (defVersionNum < 5.8) {
+        if (defwCtx->defVersionNum < 5.8) {
             return DEFW_WRONG_VERSION;
         }
 
-        fprintf(defwFile, "\n      + RECT %s + MASK %d ( %d %d ) ( %d %d )",
+        defwPrintf("\n      + RECT %s + MASK %d ( %d %d ) ( %d %d )",
                 layerNames, mask, xl, yl, xh, yh);
     }
-    defwLines++;
+    defwCtx->defwLines++;
 
 
-    defwState = DEFW_VIA;
+    defwCtx->defwState = DEFW_VIA;
     return DEFW_OK;
 }
 
@@ -1435,35 +2105,35 @@ defwViaPolygon(const char   *layerName,
 {
     int i;
 
-    defwFunc = DEFW_VIA;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_VIA;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_VIA)
+    if (defwCtx->defwState != DEFW_VIA)
         return DEFW_BAD_ORDER;
 
-    if (defVersionNum < 5.6)
+    if (defwCtx->defVersionNum < 5.6)
         return DEFW_WRONG_VERSION;
 
     if (!mask) {
-        fprintf(defwFile, "\n      + POLYGON %s ", layerName);
+        defwPrintf("\n      + POLYGON %s ", layerName);
     } else {
-        if (defVersionNum < 5.8) {
+        if (defwCtx->defVersionNum < 5.8) {
             return DEFW_WRONG_VERSION;
         }
 
-        fprintf(defwFile, "\n      + POLYGON %s + MASK %d ", layerName, mask);
+        defwPrintf("\n      + POLYGON %s + MASK %d ", layerName, mask);
     }
 
-    printPointsNum = 0;
+    defwCtx->printPointsNum = 0;
     for (i = 0; i < num_polys; i++) {
         if ((i == 0) || ((i % 5) != 0))
-            printPoints(defwFile, *xl++, *yl++, "", " ");
+            printPoints(*xl++, *yl++, "", " ");
         else {
-            printPoints(defwFile, *xl++, *yl++, "\n                ", " ");
-            defwLines++;
+            printPoints(*xl++, *yl++, "\n                ", " ");
+            defwCtx->defwLines++;
         }
     }
-    defwLines++;
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -1481,28 +2151,28 @@ defwViaViarule(const char   *viaRuleName,
                double       xTopEnc,
                double       yTopEnc)
 {
-    defwFunc = DEFW_VIA;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_VIA;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_VIA)
+    if (defwCtx->defwState != DEFW_VIA)
         return DEFW_BAD_ORDER;
-    if (defwViaHasVal)
+    if (defwCtx->defwViaHasVal)
         return DEFW_ALREADY_DEFINED;  // either PatternName or
     // ViaRule has defined
-    if (defVersionNum < 5.6)
+    if (defwCtx->defVersionNum < 5.6)
         return DEFW_WRONG_VERSION;
 
-    fprintf(defwFile, " + VIARULE %s\n", viaRuleName);
-    fprintf(defwFile, "      + CUTSIZE %.11g %.11g\n", xCutSize, yCutSize);
-    fprintf(defwFile, "      + LAYERS %s %s %s\n", botMetalLayer,
+    defwPrintf(" + VIARULE %s\n", viaRuleName);
+    defwPrintf("      + CUTSIZE %.11g %.11g\n", xCutSize, yCutSize);
+    defwPrintf("      + LAYERS %s %s %s\n", botMetalLayer,
             cutLayer, topMetalLayer);
-    fprintf(defwFile, "      + CUTSPACING %.11g %.11g\n",
+    defwPrintf("      + CUTSPACING %.11g %.11g\n",
             xCutSpacing, yCutSpacing);
-    fprintf(defwFile, "      + ENCLOSURE %.11g %.11g %.11g %.11g",
+    defwPrintf("      + ENCLOSURE %.11g %.11g %.11g %.11g",
             xBotEnc, yBotEnc, xTopEnc, yTopEnc);
-    defwLines += 5;
-    defwState = DEFW_VIAVIARULE;
-    defwViaHasVal = 1;
+    defwCtx->defwLines += 5;
+    defwCtx->defwState = DEFW_VIAVIARULE;
+    defwCtx->defwViaHasVal = 1;
     return DEFW_OK;
 }
 
@@ -1510,13 +2180,13 @@ int
 defwViaViaruleRowCol(int    numCutRows,
                      int    numCutCols)
 {
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_VIAVIARULE)
+    if (defwCtx->defwState != DEFW_VIAVIARULE)
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, "\n      + ROWCOL %d %d", numCutRows, numCutCols);
-    defwLines++;
+    defwPrintf("\n      + ROWCOL %d %d", numCutRows, numCutCols);
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -1524,13 +2194,13 @@ int
 defwViaViaruleOrigin(int    xOffset,
                      int    yOffset)
 {
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_VIAVIARULE)
+    if (defwCtx->defwState != DEFW_VIAVIARULE)
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, "\n      + ORIGIN %d %d", xOffset, yOffset);
-    defwLines++;
+    defwPrintf("\n      + ORIGIN %d %d", xOffset, yOffset);
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -1540,43 +2210,43 @@ defwViaViaruleOffset(int    xBotOffset,
                      int    xTopOffset,
                      int    yTopOffset)
 {
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_VIAVIARULE)
+    if (defwCtx->defwState != DEFW_VIAVIARULE)
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, "\n      + OFFSET %d %d %d %d",
+    defwPrintf("\n      + OFFSET %d %d %d %d",
             xBotOffset, yBotOffset, xTopOffset, yTopOffset);
-    defwLines++;
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
 int
 defwViaViarulePattern(const char *cutPattern)
 {
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_VIAVIARULE)
+    if (defwCtx->defwState != DEFW_VIAVIARULE)
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, "\n      + PATTERN %s", cutPattern);
-    defwLines++;
+    defwPrintf("\n      + PATTERN %s", cutPattern);
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
 int
 defwOneViaEnd()
 {
-    defwFunc = DEFW_VIA;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_VIA;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if ((defwState != DEFW_VIA) && (defwState != DEFW_VIAVIARULE))
+    if ((defwCtx->defwState != DEFW_VIA) && (defwCtx->defwState != DEFW_VIAVIARULE))
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, " ;\n");
-    defwLines++;
+    defwPrintf(" ;\n");
+    defwCtx->defwLines++;
 
-    defwState = DEFW_VIAONE_END;
+    defwCtx->defwState = DEFW_VIAONE_END;
     return DEFW_OK;
 }
 
@@ -1584,21 +2254,22 @@ defwOneViaEnd()
 int
 defwEndVias()
 {
-    defwFunc = DEFW_VIA_END;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_VIA_END;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_VIA_START &&
-        defwState != DEFW_VIAONE_END)
+    if (defwCtx->defwState != DEFW_VIA_START &&
+        defwCtx->defwState != DEFW_VIAONE_END)
         return DEFW_BAD_ORDER;
-    if (defwCounter > 0)
+    if (defwCtx->defwCounter > 0)
         return DEFW_BAD_DATA;
-    else if (defwCounter < 0)
+    else if (defwCtx->defwCounter < 0)
         return DEFW_TOO_MANY_STMS;
 
-    fprintf(defwFile, "END VIAS\n\n");
-    defwLines++;
+    defwPrintf("END VIAS\n\n");
+    defwCtx->defwLines++;
 
-    defwState = DEFW_VIA_END;
+    defwCtx->defwState = DEFW_VIA_END;
+    defwTraceSectionEnd("VIAS");
     return DEFW_OK;
 }
 
@@ -1606,22 +2277,23 @@ defwEndVias()
 int
 defwStartRegions(int count)
 {
-    defwFunc = DEFW_REGION_START;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_REGION_START;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (!defwDidInit)
+    if (!defwCtx->defwDidInit)
         return DEFW_BAD_ORDER;
-    if ((defwState >= DEFW_REGION_START) && (defwState <= DEFW_REGION_END))
+    if ((defwCtx->defwState >= DEFW_REGION_START) && (defwCtx->defwState <= DEFW_REGION_END))
         return DEFW_BAD_ORDER;
 
-    if (defwState == DEFW_ROW)
-        fprintf(defwFile, ";\n\n");  // add the ; and \n for the previous row.
+    if (defwCtx->defwState == DEFW_ROW)
+        defwPrintf(";\n\n");  // add the ; and \n for the previous row.
 
-    fprintf(defwFile, "REGIONS %d ;\n", count);
-    defwLines++;
+    defwPrintf("REGIONS %d ;\n", count);
+    defwCtx->defwLines++;
 
-    defwCounter = count;
-    defwState = DEFW_REGION_START;
+    defwCtx->defwCounter = count;
+    defwCtx->defwState = DEFW_REGION_START;
+    defwTraceSectionStart();
     return DEFW_OK;
 }
 
@@ -1629,21 +2301,21 @@ defwStartRegions(int count)
 int
 defwRegionName(const char *name)
 {
-    defwFunc = DEFW_REGION;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_REGION;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_REGION_START &&
-        defwState != DEFW_REGION)
+    if (defwCtx->defwState != DEFW_REGION_START &&
+        defwCtx->defwState != DEFW_REGION)
         return DEFW_BAD_ORDER;
-    defwCounter--;
+    defwCtx->defwCounter--;
 
-    if (defwState == DEFW_REGION)
-        fprintf(defwFile, ";\n");  // add the ; and \n for the previous row.
+    if (defwCtx->defwState == DEFW_REGION)
+        defwPrintf(";\n");  // add the ; and \n for the previous row.
 
     if (!name || !*name) // required
         return DEFW_BAD_DATA;
-    fprintf(defwFile, "   - %s ", name);
-    defwState = DEFW_REGION;
+    defwPrintf("   - %s ", name);
+    defwCtx->defwState = DEFW_REGION;
     return DEFW_OK;
 }
 
@@ -1654,15 +2326,15 @@ defwRegionPoints(int    xl,
                  int    xh,
                  int    yh)
 {
-    defwFunc = DEFW_REGION;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_REGION;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_REGION)
+    if (defwCtx->defwState != DEFW_REGION)
         return DEFW_BAD_ORDER;  // after RegionName
 
-    fprintf(defwFile, "      ( %d %d ) ( %d %d ) ", xl, yl, xh, yh);
+    defwPrintf("      ( %d %d ) ( %d %d ) ", xl, yl, xh, yh);
 
-    defwState = DEFW_REGION;
+    defwCtx->defwState = DEFW_REGION;
     return DEFW_OK;
 }
 
@@ -1670,10 +2342,10 @@ defwRegionPoints(int    xl,
 int
 defwRegionType(const char *type)
 {
-    defwFunc = DEFW_REGION;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_REGION;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_REGION)
+    if (defwCtx->defwState != DEFW_REGION)
         return DEFW_BAD_ORDER;  // after RegionName
 
     if (!type || !*type) // required
@@ -1681,9 +2353,9 @@ defwRegionType(const char *type)
     if (strcmp(type, "FENCE") && strcmp(type, "GUIDE"))
         return DEFW_BAD_DATA;
 
-    fprintf(defwFile, "         + TYPE %s ", type);
+    defwPrintf("         + TYPE %s ", type);
 
-    defwState = DEFW_REGION;
+    defwCtx->defwState = DEFW_REGION;
     return DEFW_OK;
 }
 
@@ -1691,24 +2363,25 @@ defwRegionType(const char *type)
 int
 defwEndRegions()
 {
-    defwFunc = DEFW_REGION_END;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_REGION_END;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_REGION_START &&
-        defwState != DEFW_REGION)
+    if (defwCtx->defwState != DEFW_REGION_START &&
+        defwCtx->defwState != DEFW_REGION)
         return DEFW_BAD_ORDER;
-    if (defwCounter > 0)
+    if (defwCtx->defwCounter > 0)
         return DEFW_BAD_DATA;
-    else if (defwCounter < 0)
+    else if (defwCtx->defwCounter < 0)
         return DEFW_TOO_MANY_STMS;
 
-    if (defwState == DEFW_REGION)
-        fprintf(defwFile, ";\nEND REGIONS\n\n");  // ; for the previous statement
+    if (defwCtx->defwState == DEFW_REGION)
+        defwPrintf(";\nEND REGIONS\n\n");  // ; for the previous statement
     else
-        fprintf(defwFile, "END REGIONS\n\n");  // ; for the previous statement
-    defwLines++;
+        defwPrintf("END REGIONS\n\n");  // ; for the previous statement
+    defwCtx->defwLines++;
 
-    defwState = DEFW_REGION_END;
+    defwCtx->defwState = DEFW_REGION_END;
+    defwTraceSectionEnd("REGIONS");
     return DEFW_OK;
 }
 
@@ -1717,30 +2390,30 @@ int
 defwComponentMaskShiftLayers(const char **layerNames,
                              int        numLayerName)
 {
-    if (defVersionNum < 5.8) {
+    if (defwCtx->defVersionNum < 5.8) {
         return DEFW_WRONG_VERSION;
     }
 
-    defwFunc = DEFW_COMPONENT_MASKSHIFTLAYERS;
+    defwCtx->defwFunc = DEFW_COMPONENT_MASKSHIFTLAYERS;
 
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
 
-    if (defwState == DEFW_COMPONENT_MASKSHIFTLAYERS)
+    if (defwCtx->defwState == DEFW_COMPONENT_MASKSHIFTLAYERS)
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, "COMPONENTMASKSHIFT ");
+    defwPrintf("COMPONENTMASKSHIFT ");
 
     if (numLayerName) {
         for (int i = 0; i < numLayerName; i++)
-            fprintf(defwFile, "%s ", layerNames[i]);
+            defwPrintf("%s ", layerNames[i]);
     }
 
-    fprintf(defwFile, ";\n\n");
+    defwPrintf(";\n\n");
 
-    defwLines++;
+    defwCtx->defwLines++;
 
-    defwState = DEFW_COMPONENT_MASKSHIFTLAYERS;
+    defwCtx->defwState = DEFW_COMPONENT_MASKSHIFTLAYERS;
     return DEFW_OK;
 }
 
@@ -1748,22 +2421,114 @@ defwComponentMaskShiftLayers(const char **layerNames,
 int
 defwStartComponents(int count)
 {
-    defwFunc = DEFW_COMPONENT_START;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_COMPONENT_START;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (!defwDidInit)
+    if (!defwCtx->defwDidInit)
         return DEFW_BAD_ORDER;
-    if ((defwState >= DEFW_COMPONENT_START) && (defwState <= DEFW_COMPONENT_END))
+    if ((defwCtx->defwState >= DEFW_COMPONENT_START) && (defwCtx->defwState <= DEFW_COMPONENT_END))
         return DEFW_BAD_ORDER;
 
-    if (defwState == DEFW_ROW)
-        fprintf(defwFile, ";\n\n");  // add the ; and \n for the previous row.
+    if (defwCtx->defwState == DEFW_ROW)
+        defwPrintf(";\n\n");  // add the ; and \n for the previous row.
 
-    fprintf(defwFile, "COMPONENTS %d ;\n", count);
-    defwLines++;
+    defwPrintf("COMPONENTS %d ;\n", count);
+    defwCtx->defwLines++;
 
-    defwCounter = count;
-    defwState = DEFW_COMPONENT_START;
+    defwCtx->defwCounter = count;
+    defwCtx->defwState = DEFW_COMPONENT_START;
+    defwTraceSectionStart();
+    return DEFW_OK;
+}
+
+
+// Writes one component; the caller has checked the writer state.
+static int
+defwComponentRecord(const defwComponentRec *c)
+{
+    int i;
+    int uplace = 0;
+
+    defwCtx->defwCounter--;
+
+    // required
+    if ((c->instance == 0) || (*c->instance == 0) ||
+        (c->master == 0) || (*c->master == 0))
+        return DEFW_BAD_DATA;
+
+    if (c->source && strcmp(c->source, "NETLIST") &&
+        strcmp(c->source, "DIST") && strcmp(c->source, "USER") &&
+        strcmp(c->source, "TIMING"))
+        return DEFW_BAD_DATA;
+
+    if (c->status) {
+        if (strcmp(c->status, "UNPLACED") == 0) {
+            uplace = 1;
+        } else if (strcmp(c->status, "COVER") &&
+                   strcmp(c->status, "FIXED") &&
+                   strcmp(c->status, "PLACED"))
+            return DEFW_BAD_DATA;
+    }
+
+    // only either region or xl, yl, xh, yh
+    if (c->region && (c->xl || c->yl || c->xh || c->yh))
+        return DEFW_BAD_DATA;
+
+    if (defwCtx->defwState == DEFW_COMPONENT)
+        defwPutData(";\n", 2);  // newline for the previous component
+
+    defwPutData("   - ", 5);
+    defwPutData(c->instance, strlen(c->instance));
+    defwPutData(" ", 1);
+    defwPutData(c->master, strlen(c->master));
+    defwPutData(" ", 1);
+    for (i = 0; i < c->numNetName; i++) {
+        defwPutData(c->netNames[i], strlen(c->netNames[i]));
+        defwPutData(" ", 1);
+    }
+    defwCtx->defwLines++;
+    // since the rest is optionals, new line is placed before the options
+    if (c->eeq) {
+        defwPrintf("\n      + EEQMASTER %s ", c->eeq);
+        defwCtx->defwLines++;
+    }
+    if (c->genName) {
+        defwPrintf("\n      + GENERATE %s ", c->genName);
+        if (c->genParemeters)
+            defwPrintf(" %s ", c->genParemeters);
+        defwCtx->defwLines++;
+    }
+    if (c->source) {
+        defwPrintf("\n      + SOURCE %s ", c->source);
+        defwCtx->defwLines++;
+    }
+    for (i = 0; i < c->numForeign; i++) {
+        defwPrintf("\n      + FOREIGN %s ( %d %d ) %s ", c->foreigns[i],
+                c->foreignX[i], c->foreignY[i],
+                defwOrient(c->foreignOrients[i]));
+        defwCtx->defwLines++;
+    }
+    if (c->status && (uplace == 0)) {
+        defwPrintPlacement(c->status, c->statusX, c->statusY,
+                           defwOrient(c->statusOrient));
+    } else if (uplace) {
+        defwPrintf("\n      + %s ", c->status);
+    }
+    defwCtx->defwLines++;
+    if (c->weight) {
+        defwPrintf("\n      + WEIGHT %.11g ", c->weight);
+        defwCtx->defwLines++;
+    }
+    if (c->region) {
+        defwPrintf("\n      + REGION %s ", c->region);
+        defwCtx->defwLines++;
+    } else if (c->xl || c->yl || c->xh || c->yh) {
+        defwPrintf("\n      + REGION ( %d %d ) ( %d %d ) ",
+                c->xl, c->yl, c->xh, c->yh);
+        defwCtx->defwLines++;
+    }
+
+    defwCtx->defwState = DEFW_COMPONENT;
     return DEFW_OK;
 }
 
@@ -1793,92 +2558,65 @@ defwComponent(const char    *instance,
               int           xh,
               int           yh)
 {
+    defwComponentRec c;
 
-    int i;
-    int uplace = 0;
-
-    defwFunc = DEFW_COMPONENT;   // Current function of writer
+    defwCtx->defwFunc = DEFW_COMPONENT;   // Current function of writer
 
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_COMPONENT_START &&
-        defwState != DEFW_COMPONENT)
+    if (defwCtx->defwState != DEFW_COMPONENT_START &&
+        defwCtx->defwState != DEFW_COMPONENT)
         return DEFW_BAD_ORDER;
 
-    defwCounter--;
+    c.instance = instance;
+    c.master = master;
+    c.numNetName = numNetName;
+    c.netNames = netNames;
+    c.eeq = eeq;
+    c.genName = genName;
+    c.genParemeters = genParemeters;
+    c.source = source;
+    c.numForeign = numForeign;
+    c.foreigns = foreigns;
+    c.foreignX = foreignX;
+    c.foreignY = foreignY;
+    c.foreignOrients = foreignOrients;
+    c.status = status;
+    c.statusX = statusX;
+    c.statusY = statusY;
+    c.statusOrient = statusOrient;
+    c.weight = weight;
+    c.region = region;
+    c.xl = xl;
+    c.yl = yl;
+    c.xh = xh;
+    c.yh = yh;
+    return defwComponentRecord(&c);
+}
 
-    // required
-    if ((instance == 0) || (*instance == 0) || (master == 0) || (*master == 0))
-        return DEFW_BAD_DATA;
 
-    if (source && strcmp(source, "NETLIST") && strcmp(source, "DIST") &&
-        strcmp(source, "USER") && strcmp(source, "TIMING"))
-        return DEFW_BAD_DATA;
+int
+defwComponentsBulk(const defwComponentRec *recs,
+                   size_t                 n)
+{
+    size_t i;
+    int    status;
 
-    if (status) {
-        if (strcmp(status, "UNPLACED") == 0) {
-            uplace = 1;
-        } else if (strcmp(status, "COVER") && strcmp(status, "FIXED") &&
-                   strcmp(status, "PLACED"))
-            return DEFW_BAD_DATA;
-    }
+    defwCtx->defwFunc = DEFW_COMPONENT;   // Current function of writer
 
-    // only either region or xl, yl, xh, yh
-    if (region && (xl || yl || xh || yh))
+    if (!defwCtx->defwFile)
+        return DEFW_UNINITIALIZED;
+    if (defwCtx->defwState != DEFW_COMPONENT_START &&
+        defwCtx->defwState != DEFW_COMPONENT)
+        return DEFW_BAD_ORDER;
+    if (n && !recs)
         return DEFW_BAD_DATA;
 
-    if (defwState == DEFW_COMPONENT)
-        fprintf(defwFile, ";\n");       // newline for the previous component
-
-    fprintf(defwFile, "   - %s %s ", instance, master);
-    if (numNetName) {
-        for (i = 0; i < numNetName; i++)
-            fprintf(defwFile, "%s ", netNames[i]);
-    }
-    defwLines++;
-    // since the rest is optionals, new line is placed before the options
-    if (eeq) {
-        fprintf(defwFile, "\n      + EEQMASTER %s ", eeq);
-        defwLines++;
+    for (i = 0; i < n; i++) {
+        status = defwComponentRecord(recs + i);
+        if (status != DEFW_OK)
+            return status;
     }
-    if (genName) {
-        fprintf(defwFile, "\n      + GENERATE %s ", genName);
-        if (genParemeters)
-            fprintf(defwFile, " %s ", genParemeters);
-        defwLines++;
-    }
-    if (source) {
-        fprintf(defwFile, "\n      + SOURCE %s ", source);
-        defwLines++;
-    }
-    if (numForeign) {
-        for (i = 0; i < numForeign; i++) {
-            fprintf(defwFile, "\n      + FOREIGN %s ( %d %d ) %s ", foreigns[i],
-                    foreignX[i], foreignY[i], defwOrient(foreignOrients[i]));
-            defwLines++;
-        }
-    }
-    if (status && (uplace == 0)) {
-        fprintf(defwFile, "\n      + %s ( %d %d ) %s ", status, statusX, statusY,
-                defwOrient(statusOrient));
-    } else if (uplace) {
-        fprintf(defwFile, "\n      + %s ", status);
-    }
-    defwLines++;
-    if (weight) {
-        fprintf(defwFile, "\n      + WEIGHT %.11g ", weight);
-        defwLines++;
-    }
-    if (region) {
-        fprintf(defwFile, "\n      + REGION %s ", region);
-        defwLines++;
-    } else if (xl || yl || xh || yh) {
-        fprintf(defwFile, "\n      + REGION ( %d %d ) ( %d %d ) ",
-                xl, yl, xh, yh);
-        defwLines++;
-    }
-
-    defwState = DEFW_COMPONENT;
     return DEFW_OK;
 }
 
@@ -1912,15 +2650,15 @@ defwComponentStr(const char *instance,
     int i;
     int uplace = 0;
 
-    defwFunc = DEFW_COMPONENT;   // Current function of writer
+    defwCtx->defwFunc = DEFW_COMPONENT;   // Current function of writer
 
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_COMPONENT_START &&
-        defwState != DEFW_COMPONENT)
+    if (defwCtx->defwState != DEFW_COMPONENT_START &&
+        defwCtx->defwState != DEFW_COMPONENT)
         return DEFW_BAD_ORDER;
 
-    defwCounter--;
+    defwCtx->defwCounter--;
 
     if ((!instance || !*instance) || (!master || !*master)) // required
         return DEFW_BAD_DATA;
@@ -1941,76 +2679,75 @@ defwComponentStr(const char *instance,
     if (region && (xl || yl || xh || yh))
         return DEFW_BAD_DATA;
 
-    if (defwState == DEFW_COMPONENT)
-        fprintf(defwFile, ";\n");       // newline for the previous component
+    if (defwCtx->defwState == DEFW_COMPONENT)
+        defwPrintf(";\n");       // newline for the previous component
 
-    fprintf(defwFile, "   - %s %s ", instance, master);
+    defwPrintf("   - %s %s ", instance, master);
     if (numNetName) {
         for (i = 0; i < numNetName; i++)
-            fprintf(defwFile, "%s ", netNames[i]);
+            defwPrintf("%s ", netNames[i]);
     }
-    defwLines++;
+    defwCtx->defwLines++;
     // since the rest is optionals, new line is placed before the options
     if (eeq) {
-        fprintf(defwFile, "\n      + EEQMASTER %s ", eeq);
-        defwLines++;
+        defwPrintf("\n      + EEQMASTER %s ", eeq);
+        defwCtx->defwLines++;
     }
     if (genName) {
-        fprintf(defwFile, "\n      + GENERATE %s ", genName);
+        defwPrintf("\n      + GENERATE %s ", genName);
         if (genParemeters)
-            fprintf(defwFile, " %s ", genParemeters);
-        defwLines++;
+            defwPrintf(" %s ", genParemeters);
+        defwCtx->defwLines++;
     }
     if (source) {
-        fprintf(defwFile, "\n      + SOURCE %s ", source);
-        defwLines++;
+        defwPrintf("\n      + SOURCE %s ", source);
+        defwCtx->defwLines++;
     }
     if (numForeign) {
         for (i = 0; i < numForeign; i++) {
-            fprintf(defwFile, "\n      + FOREIGN %s ( %d %d ) %s ", foreigns[i],
+            defwPrintf("\n      + FOREIGN %s ( %d %d ) %s ", foreigns[i],
                     foreignX[i], foreignY[i], foreignOrients[i]);
-            defwLines++;
+            defwCtx->defwLines++;
         }
     }
     if (status && (uplace == 0)) {
-        fprintf(defwFile, "\n      + %s ( %d %d ) %s ", status, statusX, statusY,
-                statusOrient);
+        defwPrintPlacement(status, statusX, statusY, statusOrient);
     } else if (uplace) {
-        fprintf(defwFile, "\n      + %s ", status);
+        defwPrintf("\n      + %s ", status);
     }
-    defwLines++;
+    defwCtx->defwLines++;
     if (weight) {
-        fprintf(defwFile, "\n      + WEIGHT %.11g ", weight);
-        defwLines++;
+        defwPrintf("\n      + WEIGHT %.11g ", weight);
+        defwCtx->defwLines++;
     }
     if (region) {
-        fprintf(defwFile, "\n      + REGION %s ", region);
-        defwLines++;
+        defwPrintf("\n      + REGION %s ", region);
+        defwCtx->defwLines++;
     } else if (xl || yl || xh || yh) {
-        fprintf(defwFile, "\n      + REGION ( %d %d ) ( %d %d ) ",
+        defwPrintf("\n      + REGION ( %d %d ) ( %d %d ) ",
                 xl, yl, xh, yh);
-        defwLines++;
+        defwCtx->defwLines++;
     }
 
-    defwState = DEFW_COMPONENT;
+    defwCtx->defwState = DEFW_COMPONENT;
     return DEFW_OK;
 }
 
 int
 defwComponentMaskShift(int shiftLayerMasks)
 {
-    defwFunc = DEFW_COMPONENT;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_COMPONENT;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defVersionNum < 5.8) {
+    if (defwCtx->defVersionNum < 5.8) {
         return DEFW_WRONG_VERSION;
     }
 
-    if (defwState != DEFW_COMPONENT)
+    if (defwCtx->defwState != DEFW_COMPONENT)
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, "\n      + MASKSHIFT %d ", shiftLayerMasks);
-    defwLines++;
+    defwPrintf("\n      + MASKSHIFT %d ", shiftLayerMasks);
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -2020,16 +2757,16 @@ defwComponentHalo(int   left,
                   int   right,
                   int   top)
 {
-    defwFunc = DEFW_COMPONENT;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_COMPONENT;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defVersionNum < 5.6)
+    if (defwCtx->defVersionNum < 5.6)
         return DEFW_WRONG_VERSION;
-    if (defwState != DEFW_COMPONENT)
+    if (defwCtx->defwState != DEFW_COMPONENT)
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, "\n      + HALO %d %d %d %d ", left, bottom, right, top);
-    defwLines++;
+    defwPrintf("\n      + HALO %d %d %d %d ", left, bottom, right, top);
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -2040,17 +2777,17 @@ defwComponentHaloSoft(int   left,
                       int   right,
                       int   top)
 {
-    defwFunc = DEFW_COMPONENT;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_COMPONENT;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defVersionNum < 5.7)
+    if (defwCtx->defVersionNum < 5.7)
         return DEFW_WRONG_VERSION;
-    if (defwState != DEFW_COMPONENT)
+    if (defwCtx->defwState != DEFW_COMPONENT)
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, "\n      + HALO SOFT %d %d %d %d ", left, bottom,
+    defwPrintf("\n      + HALO SOFT %d %d %d %d ", left, bottom,
             right, top);
-    defwLines++;
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -2060,17 +2797,17 @@ defwComponentRouteHalo(int          haloDist,
                        const char   *minLayer,
                        const char   *maxLayer)
 {
-    defwFunc = DEFW_COMPONENT;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_COMPONENT;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defVersionNum < 5.7)
+    if (defwCtx->defVersionNum < 5.7)
         return DEFW_WRONG_VERSION;
-    if (defwState != DEFW_COMPONENT)
+    if (defwCtx->defwState != DEFW_COMPONENT)
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, "\n      + ROUTEHALO %d %s %s ", haloDist, minLayer,
+    defwPrintf("\n      + ROUTEHALO %d %s %s ", haloDist, minLayer,
             maxLayer);
-    defwLines++;
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -2078,26 +2815,27 @@ defwComponentRouteHalo(int          haloDist,
 int
 defwEndComponents()
 {
-    defwFunc = DEFW_COMPONENT_END;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_COMPONENT_END;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_COMPONENT_START &&
-        defwState != DEFW_COMPONENT)
+    if (defwCtx->defwState != DEFW_COMPONENT_START &&
+        defwCtx->defwState != DEFW_COMPONENT)
         return DEFW_BAD_ORDER;
-    if (defwCounter > 0)
+    if (defwCtx->defwCounter > 0)
         return DEFW_BAD_DATA;
-    else if (defwCounter < 0)
+    else if (defwCtx->defwCounter < 0)
         return DEFW_TOO_MANY_STMS;
 
-    defwDidComponents = 1;
+    defwCtx->defwDidComponents = 1;
 
-    if (defwState == DEFW_COMPONENT)
-        fprintf(defwFile, ";\nEND COMPONENTS\n\n");
+    if (defwCtx->defwState == DEFW_COMPONENT)
+        defwPrintf(";\nEND COMPONENTS\n\n");
     else
-        fprintf(defwFile, "END COMPONENTS\n\n");
-    defwLines++;
+        defwPrintf("END COMPONENTS\n\n");
+    defwCtx->defwLines++;
 
-    defwState = DEFW_COMPONENT_END;
+    defwCtx->defwState = DEFW_COMPONENT_END;
+    defwTraceSectionEnd("COMPONENTS");
     return DEFW_OK;
 }
 
@@ -2105,19 +2843,21 @@ defwEndComponents()
 int
 defwStartPins(int count)
 {
-    defwFunc = DEFW_PIN_START;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_PIN_START;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (!defwDidComponents)
+    if (!defwCtx->defwDidComponents)
         return DEFW_BAD_ORDER;
-    if ((defwState >= DEFW_PIN_START) && (defwState <= DEFW_PIN_END))
+    if ((defwCtx->defwState >= DEFW_PIN_START) && (defwCtx->defwState <= DEFW_PIN_END))
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, "PINS %d", count);
-    defwLines++;
+    defwPrintf("PINS %d", count);
+    defwCtx->defwLines++;
+    defwCtx->defwPinEnded = 0;
 
-    defwCounter = count;
-    defwState = DEFW_PIN_START;
+    defwCtx->defwCounter = count;
+    defwCtx->defwState = DEFW_PIN_START;
+    defwTraceSectionStart();
     return DEFW_OK;
 }
 
@@ -2140,24 +2880,27 @@ defwPin(const char  *name,
         )
 {
 
-    defwFunc = DEFW_PIN;   // Current function of writer
+    defwCtx->defwFunc = DEFW_PIN;   // Current function of writer
 
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PIN_START && defwState != DEFW_PIN)
+    if (defwCtx->defwState != DEFW_PIN_START && defwCtx->defwState != DEFW_PIN)
         return DEFW_BAD_ORDER;
 
-    defwCounter--;
+    defwCtx->defwCounter--;
 
-    fprintf(defwFile, " ;\n   - %s + NET %s", name, net);
+    if (!defwCtx->defwPinEnded)
+        defwPrintf(" ;\n");
+    defwCtx->defwPinEnded = 0;
+    defwPrintf("   - %s + NET %s", name, net);
 
     if (special)
-        fprintf(defwFile, "\n      + SPECIAL");
+        defwPrintf("\n      + SPECIAL");
     if (direction) {
         if (strcmp(direction, "INPUT") && strcmp(direction, "OUTPUT") &&
             strcmp(direction, "INOUT") && strcmp(direction, "FEEDTHRU"))
             return DEFW_BAD_DATA;
-        fprintf(defwFile, "\n      + DIRECTION %s", direction);
+        defwPrintf("\n      + DIRECTION %s", direction);
     }
     if (use) {
         if (strcmp(use, "SIGNAL") && strcmp(use, "POWER") &&
@@ -2165,25 +2908,25 @@ defwPin(const char  *name,
             strcmp(use, "TIEOFF") && strcmp(use, "ANALOG") &&
             strcmp(use, "SCAN") && strcmp(use, "RESET"))
             return DEFW_BAD_DATA;
-        fprintf(defwFile, "\n      + USE %s", use);
+        defwPrintf("\n      + USE %s", use);
     }
     if (status) {
         if (strcmp(status, "FIXED") && strcmp(status, "PLACED") &&
             strcmp(status, "COVER"))
             return DEFW_BAD_DATA;
 
-        fprintf(defwFile, "\n      + %s ( %d %d ) %s", status, xo, yo,
+        defwPrintf("\n      + %s ( %d %d ) %s", status, xo, yo,
                 defwOrient(orient));
     }
     // In 5.6, user should use defPinLayer to write out layer construct 
     if (layer) {
-        fprintf(defwFile, "\n      + LAYER %s ( %d %d ) ( %d %d )",
+        defwPrintf("\n      + LAYER %s ( %d %d ) ( %d %d )",
                 layer, xl, yl, xh, yh);
     }
 
-    defwLines++;
+    defwCtx->defwLines++;
 
-    defwState = DEFW_PIN;
+    defwCtx->defwState = DEFW_PIN;
     return DEFW_OK;
 }
 
@@ -2206,24 +2949,27 @@ defwPinStr(const char   *name,
            )
 {
 
-    defwFunc = DEFW_PIN;   // Current function of writer
+    defwCtx->defwFunc = DEFW_PIN;   // Current function of writer
 
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PIN_START && defwState != DEFW_PIN)
+    if (defwCtx->defwState != DEFW_PIN_START && defwCtx->defwState != DEFW_PIN)
         return DEFW_BAD_ORDER;
 
-    defwCounter--;
+    defwCtx->defwCounter--;
 
-    fprintf(defwFile, " ;\n   - %s + NET %s", name, net);
+    if (!defwCtx->defwPinEnded)
+        defwPrintf(" ;\n");
+    defwCtx->defwPinEnded = 0;
+    defwPrintf("   - %s + NET %s", name, net);
 
     if (special)
-        fprintf(defwFile, "\n      + SPECIAL");
+        defwPrintf("\n      + SPECIAL");
     if (direction) {
         if (strcmp(direction, "INPUT") && strcmp(direction, "OUTPUT") &&
             strcmp(direction, "INOUT") && strcmp(direction, "FEEDTHRU"))
             return DEFW_BAD_DATA;
-        fprintf(defwFile, "\n      + DIRECTION %s", direction);
+        defwPrintf("\n      + DIRECTION %s", direction);
     }
     if (use) {
         if (strcmp(use, "SIGNAL") && strcmp(use, "POWER") &&
@@ -2231,25 +2977,25 @@ defwPinStr(const char   *name,
             strcmp(use, "TIEOFF") && strcmp(use, "ANALOG") &&
             strcmp(use, "SCAN") && strcmp(use, "RESET"))
             return DEFW_BAD_DATA;
-        fprintf(defwFile, "\n      + USE %s", use);
+        defwPrintf("\n      + USE %s", use);
     }
     if (status) {
         if (strcmp(status, "FIXED") && strcmp(status, "PLACED") &&
             strcmp(status, "COVER"))
             return DEFW_BAD_DATA;
 
-        fprintf(defwFile, "\n      + %s ( %d %d ) %s", status, xo, yo,
+        defwPrintf("\n      + %s ( %d %d ) %s", status, xo, yo,
                 orient);
     }
     // In 5.6, user should use defPinLayer to write out layer construct 
     if (layer) {
-        fprintf(defwFile, "\n      + LAYER %s ( %d %d ) ( %d %d )",
+        defwPrintf("\n      + LAYER %s ( %d %d ) ( %d %d )",
                 layer, xl, yl, xh, yh);
     }
 
-    defwLines++;
+    defwCtx->defwLines++;
 
-    defwState = DEFW_PIN;
+    defwCtx->defwState = DEFW_PIN;
     return DEFW_OK;
 }
 
@@ -2263,34 +3009,34 @@ defwPinLayer(const char *layerName,
              int        yh,
              int        mask)
 {
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PIN)
+    if (defwCtx->defwState != DEFW_PIN)
         return DEFW_BAD_ORDER;
-    if (defVersionNum < 5.6)
+    if (defwCtx->defVersionNum < 5.6)
         return DEFW_WRONG_VERSION;
     if (spacing && designRuleWidth)
         return DEFW_BAD_DATA;  // only one, spacing
     // or designRuleWidth can be defined, not both
 
-    fprintf(defwFile, "\n      + LAYER %s ", layerName);
+    defwPrintf("\n      + LAYER %s ", layerName);
 
     if (mask) {
-        if (defVersionNum < 5.8) {
+        if (defwCtx->defVersionNum < 5.8) {
             return DEFW_WRONG_VERSION;
         }
 
-        fprintf(defwFile, "\n        MASK %d", mask);
+        defwPrintf("\n        MASK %d", mask);
     }
 
     if (spacing)
-        fprintf(defwFile, "\n        SPACING %d", spacing);
+        defwPrintf("\n        SPACING %d", spacing);
     else if (designRuleWidth)        // can be both 0
-        fprintf(defwFile, "\n        DESIGNRULEWIDTH  %d", designRuleWidth);
-    fprintf(defwFile, "\n        ( %d %d ) ( %d %d )", xl, yl, xh, yh);
+        defwPrintf("\n        DESIGNRULEWIDTH  %d", designRuleWidth);
+    defwPrintf("\n        ( %d %d ) ( %d %d )", xl, yl, xh, yh);
 
-    defwState = DEFW_PIN;
-    defwLines++;
+    defwCtx->defwState = DEFW_PIN;
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -2305,43 +3051,43 @@ defwPinPolygon(const char   *layerName,
 {
     int i;
 
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PIN)
+    if (defwCtx->defwState != DEFW_PIN)
         return DEFW_BAD_ORDER;
-    if (defVersionNum < 5.6)
+    if (defwCtx->defVersionNum < 5.6)
         return DEFW_WRONG_VERSION;
     if (spacing && designRuleWidth)
         return DEFW_BAD_DATA; // only one, spacing
     // or designRuleWidth can be defined, not both
 
-    fprintf(defwFile, "\n      + POLYGON %s ", layerName);
+    defwPrintf("\n      + POLYGON %s ", layerName);
 
     if (mask) {
-        if (defVersionNum < 5.8) {
+        if (defwCtx->defVersionNum < 5.8) {
             return DEFW_WRONG_VERSION;
         }
 
-        fprintf(defwFile, "\n        MASK %d", mask);
+        defwPrintf("\n        MASK %d", mask);
     }
 
     if (spacing)
-        fprintf(defwFile, "\n        SPACING %d", spacing);
+        defwPrintf("\n        SPACING %d", spacing);
     else if (designRuleWidth)        // can be both 0
-        fprintf(defwFile, "\n        DESIGNRULEWIDTH  %d", designRuleWidth);
+        defwPrintf("\n        DESIGNRULEWIDTH  %d", designRuleWidth);
 
-    printPointsNum = 0;
+    defwCtx->printPointsNum = 0;
 
     for (i = 0; i < num_polys; i++) {
         if ((i == 0) || ((i % 5) == 0)) {
-            printPoints(defwFile, *xl++, *yl++, "\n        ", " ");
-            defwLines++; 
+            printPoints(*xl++, *yl++, "\n        ", " ");
+            defwCtx->defwLines++; 
         } else
-            printPoints(defwFile, *xl++, *yl++, "", " ");
+            printPoints(*xl++, *yl++, "", " ");
     }
    
-    defwState = DEFW_PIN;
-    defwLines++;
+    defwCtx->defwState = DEFW_PIN;
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -2353,25 +3099,25 @@ defwPinVia(const char   *viaName,
            int          mask)
 {
 
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PIN)
+    if (defwCtx->defwState != DEFW_PIN)
         return DEFW_BAD_ORDER;
-    if (defVersionNum < 5.7)
+    if (defwCtx->defVersionNum < 5.7)
         return DEFW_WRONG_VERSION;
 
     if (mask) {
-        if (defVersionNum < 5.8) {
+        if (defwCtx->defVersionNum < 5.8) {
             return DEFW_WRONG_VERSION;
         }
 
-        fprintf(defwFile, "\n      + VIA %s MASK %d ( %d %d ) ", viaName, mask, xl, yl);
+        defwPrintf("\n      + VIA %s MASK %d ( %d %d ) ", viaName, mask, xl, yl);
     } else {
-        fprintf(defwFile, "\n      + VIA %s ( %d %d ) ", viaName, xl, yl);
+        defwPrintf("\n      + VIA %s ( %d %d ) ", viaName, xl, yl);
     }
 
-    defwLines++;
-    defwState = DEFW_PIN;
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_PIN;
     return DEFW_OK;
 }
 
@@ -2381,17 +3127,17 @@ int
 defwPinPort()
 {
 
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PIN)
+    if (defwCtx->defwState != DEFW_PIN)
         return DEFW_BAD_ORDER;
-    if (defVersionNum < 5.7)
+    if (defwCtx->defVersionNum < 5.7)
         return DEFW_WRONG_VERSION;
 
-    fprintf(defwFile, "\n      + PORT");
+    defwPrintf("\n      + PORT");
 
-    defwLines++;
-    defwState = DEFW_PIN_PORT;
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_PIN_PORT;
     return DEFW_OK;
 }
 
@@ -2406,35 +3152,35 @@ defwPinPortLayer(const char *layerName,
                  int        yh,
                  int        mask)
 {
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PIN && defwState != DEFW_PIN_PORT)
+    if (defwCtx->defwState != DEFW_PIN && defwCtx->defwState != DEFW_PIN_PORT)
         return DEFW_BAD_ORDER;
-    if (defVersionNum < 5.7)
+    if (defwCtx->defVersionNum < 5.7)
         return DEFW_WRONG_VERSION;
     if (spacing && designRuleWidth)
         return DEFW_BAD_DATA;  // only one, spacing
     // or designRuleWidth can be defined, not both
 
-    fprintf(defwFile, "\n        + LAYER %s ", layerName);
+    defwPrintf("\n        + LAYER %s ", layerName);
 
     if (mask) {
-        if (defVersionNum < 5.8) {
+        if (defwCtx->defVersionNum < 5.8) {
             return DEFW_WRONG_VERSION;
         }
 
-        fprintf(defwFile, "\n          MASK %d", mask);
+        defwPrintf("\n          MASK %d", mask);
     }
 
     if (spacing)
-        fprintf(defwFile, "\n          SPACING %d", spacing);
+        defwPrintf("\n          SPACING %d", spacing);
     else if (designRuleWidth)        // can be both 0
-        fprintf(defwFile, "\n          DESIGNRULEWIDTH  %d", designRuleWidth);
+        defwPrintf("\n          DESIGNRULEWIDTH  %d", designRuleWidth);
 
-    fprintf(defwFile, "\n        ( %d %d ) ( %d %d )", xl, yl, xh, yh);
+    defwPrintf("\n        ( %d %d ) ( %d %d )", xl, yl, xh, yh);
 
-    defwState = DEFW_PIN;
-    defwLines++;
+    defwCtx->defwState = DEFW_PIN;
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -2450,42 +3196,42 @@ defwPinPortPolygon(const char   *layerName,
 {
     int i;
 
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PIN && defwState != DEFW_PIN_PORT)
+    if (defwCtx->defwState != DEFW_PIN && defwCtx->defwState != DEFW_PIN_PORT)
         return DEFW_BAD_ORDER;
-    if (defVersionNum < 5.7)
+    if (defwCtx->defVersionNum < 5.7)
         return DEFW_WRONG_VERSION;
     if (spacing && designRuleWidth)
         return DEFW_BAD_DATA; // only one, spacing
     // or designRuleWidth can be defined, not both
 
-    fprintf(defwFile, "\n        + POLYGON %s ", layerName);
+    defwPrintf("\n        + POLYGON %s ", layerName);
 
     if (mask) {
-        if (defVersionNum < 5.8) {
+        if (defwCtx->defVersionNum < 5.8) {
             return DEFW_WRONG_VERSION;
         }
 
-        fprintf(defwFile, "\n          MASK %d", mask);
+        defwPrintf("\n          MASK %d", mask);
     }
 
     if (spacing)
-        fprintf(defwFile, "\n          SPACING %d", spacing);
+        defwPrintf("\n          SPACING %d", spacing);
     else if (designRuleWidth)        // can be both 0
-        fprintf(defwFile, "\n          DESIGNRULEWIDTH  %d", designRuleWidth);
+        defwPrintf("\n          DESIGNRULEWIDTH  %d", designRuleWidth);
 
-    printPointsNum = 0;
+    defwCtx->printPointsNum = 0;
     for (i = 0; i < num_polys; i++) {
         if ((i == 0) || ((i % 5) == 0)) {
-            printPoints(defwFile, *xl++, *yl++, "\n          ", " ");
-            defwLines++; 
+            printPoints(*xl++, *yl++, "\n          ", " ");
+            defwCtx->defwLines++; 
         } else
-            printPoints(defwFile, *xl++, *yl++, "", " ");
+            printPoints(*xl++, *yl++, "", " ");
     }
 
-    defwState = DEFW_PIN;
-    defwLines++;
+    defwCtx->defwState = DEFW_PIN;
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -2497,25 +3243,25 @@ defwPinPortVia(const char   *viaName,
                int          mask)
 {
 
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PIN && defwState != DEFW_PIN_PORT)
+    if (defwCtx->defwState != DEFW_PIN && defwCtx->defwState != DEFW_PIN_PORT)
         return DEFW_BAD_ORDER;
-    if (defVersionNum < 5.7)
+    if (defwCtx->defVersionNum < 5.7)
         return DEFW_WRONG_VERSION;
 
     if (mask) {
-        if (defVersionNum < 5.8) {
+        if (defwCtx->defVersionNum < 5.8) {
             return DEFW_WRONG_VERSION;
         }
 
-        fprintf(defwFile, "\n        + VIA %s MASK %d ( %d %d ) ", viaName, mask, xl, yl);
+        defwPrintf("\n        + VIA %s MASK %d ( %d %d ) ", viaName, mask, xl, yl);
     } else {
-        fprintf(defwFile, "\n        + VIA %s ( %d %d ) ", viaName, xl, yl);
+        defwPrintf("\n        + VIA %s ( %d %d ) ", viaName, xl, yl);
     }
 
-    defwLines++;
-    defwState = DEFW_PIN;
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_PIN;
     return DEFW_OK;
 }
 
@@ -2526,36 +3272,36 @@ defwPinPortLocation(const char  *status,
                     int         statusY,
                     const char  *orient)
 {
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PIN && defwState != DEFW_PIN_PORT)
+    if (defwCtx->defwState != DEFW_PIN && defwCtx->defwState != DEFW_PIN_PORT)
         return DEFW_BAD_ORDER;
-    if (defVersionNum < 5.7)
+    if (defwCtx->defVersionNum < 5.7)
         return DEFW_WRONG_VERSION;
 
     if (strcmp(status, "FIXED") && strcmp(status, "PLACED") &&
         strcmp(status, "COVER"))
         return DEFW_BAD_DATA;
-    fprintf(defwFile, "\n        + %s ( %d %d ) %s ", status, statusX, statusY,
+    defwPrintf("\n        + %s ( %d %d ) %s ", status, statusX, statusY,
             orient);
-    defwState = DEFW_PIN;
-    defwLines++;
+    defwCtx->defwState = DEFW_PIN;
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
 int
 defwPinNetExpr(const char *pinExpr)
 {
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PIN)
+    if (defwCtx->defwState != DEFW_PIN)
         return DEFW_BAD_ORDER;
-    if (defVersionNum < 5.6)
+    if (defwCtx->defVersionNum < 5.6)
         return DEFW_WRONG_VERSION;
     if (pinExpr && pinExpr != 0 && *pinExpr != 0)
-        fprintf(defwFile, "\n      + NETEXPR \"%s\"", pinExpr);
+        defwPrintf("\n      + NETEXPR \"%s\"", pinExpr);
 
-    defwLines++;
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -2563,16 +3309,16 @@ defwPinNetExpr(const char *pinExpr)
 int
 defwPinSupplySensitivity(const char *pinName)
 {
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PIN)
+    if (defwCtx->defwState != DEFW_PIN)
         return DEFW_BAD_ORDER;
-    if (defVersionNum < 5.6)
+    if (defwCtx->defVersionNum < 5.6)
         return DEFW_WRONG_VERSION;
     if (pinName && pinName != 0 && *pinName != 0)
-        fprintf(defwFile, "\n      + SUPPLYSENSITIVITY %s", pinName);
+        defwPrintf("\n      + SUPPLYSENSITIVITY %s", pinName);
 
-    defwLines++;
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -2580,16 +3326,16 @@ defwPinSupplySensitivity(const char *pinName)
 int
 defwPinGroundSensitivity(const char *pinName)
 {
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PIN)
+    if (defwCtx->defwState != DEFW_PIN)
         return DEFW_BAD_ORDER;
-    if (defVersionNum < 5.6)
+    if (defwCtx->defVersionNum < 5.6)
         return DEFW_WRONG_VERSION;
     if (pinName && pinName != 0 && *pinName != 0)
-        fprintf(defwFile, "\n      + GROUNDSENSITIVITY %s", pinName);
+        defwPrintf("\n      + GROUNDSENSITIVITY %s", pinName);
 
-    defwLines++;
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -2598,17 +3344,17 @@ int
 defwPinAntennaPinPartialMetalArea(int           value,
                                   const char    *layerName)
 {
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PIN)
+    if (defwCtx->defwState != DEFW_PIN)
         return DEFW_BAD_ORDER;
-    if (defVersionNum < 5.4)
+    if (defwCtx->defVersionNum < 5.4)
         return DEFW_WRONG_VERSION;
 
-    fprintf(defwFile, "\n      + ANTENNAPINPARTIALMETALAREA %d", value);
+    defwPrintf("\n      + ANTENNAPINPARTIALMETALAREA %d", value);
     if (layerName)
-        fprintf(defwFile, " LAYER %s", layerName);
-    defwLines++;
+        defwPrintf(" LAYER %s", layerName);
+    defwCtx->defwLines++;
 
     return DEFW_OK;
 }
@@ -2618,17 +3364,17 @@ int
 defwPinAntennaPinPartialMetalSideArea(int           value,
                                       const char    *layerName)
 {
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PIN)
+    if (defwCtx->defwState != DEFW_PIN)
         return DEFW_BAD_ORDER;
-    if (defVersionNum < 5.4)
+    if (defwCtx->defVersionNum < 5.4)
         return DEFW_WRONG_VERSION;
 
-    fprintf(defwFile, "\n      + ANTENNAPINPARTIALMETALSIDEAREA %d", value);
+    defwPrintf("\n      + ANTENNAPINPARTIALMETALSIDEAREA %d", value);
     if (layerName)
-        fprintf(defwFile, " LAYER %s", layerName);
-    defwLines++;
+        defwPrintf(" LAYER %s", layerName);
+    defwCtx->defwLines++;
 
     return DEFW_OK;
 }
@@ -2638,17 +3384,17 @@ int
 defwPinAntennaPinPartialCutArea(int         value,
                                 const char  *layerName)
 {
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PIN)
+    if (defwCtx->defwState != DEFW_PIN)
         return DEFW_BAD_ORDER;
-    if (defVersionNum < 5.4)
+    if (defwCtx->defVersionNum < 5.4)
         return DEFW_WRONG_VERSION;
 
-    fprintf(defwFile, "\n      + ANTENNAPINPARTIALCUTAREA %d", value);
+    defwPrintf("\n      + ANTENNAPINPARTIALCUTAREA %d", value);
     if (layerName)
-        fprintf(defwFile, " LAYER %s", layerName);
-    defwLines++;
+        defwPrintf(" LAYER %s", layerName);
+    defwCtx->defwLines++;
 
     return DEFW_OK;
 }
@@ -2657,15 +3403,15 @@ defwPinAntennaPinPartialCutArea(int         value,
 int
 defwPinAntennaModel(const char *oxide)
 {
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PIN)
+    if (defwCtx->defwState != DEFW_PIN)
         return DEFW_BAD_ORDER;
-    if (defVersionNum < 5.4)
+    if (defwCtx->defVersionNum < 5.4)
         return DEFW_WRONG_VERSION;
 
-    fprintf(defwFile, "\n      + ANTENNAMODEL %s", oxide);
-    defwLines++;
+    defwPrintf("\n      + ANTENNAMODEL %s", oxide);
+    defwCtx->defwLines++;
 
     return DEFW_OK;
 }
@@ -2675,17 +3421,17 @@ int
 defwPinAntennaPinDiffArea(int           value,
                           const char    *layerName)
 {
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PIN)
+    if (defwCtx->defwState != DEFW_PIN)
         return DEFW_BAD_ORDER;
-    if (defVersionNum < 5.4)
+    if (defwCtx->defVersionNum < 5.4)
         return DEFW_WRONG_VERSION;
 
-    fprintf(defwFile, "\n      + ANTENNAPINDIFFAREA %d", value);
+    defwPrintf("\n      + ANTENNAPINDIFFAREA %d", value);
     if (layerName)
-        fprintf(defwFile, " LAYER %s", layerName);
-    defwLines++;
+        defwPrintf(" LAYER %s", layerName);
+    defwCtx->defwLines++;
 
     return DEFW_OK;
 }
@@ -2695,17 +3441,17 @@ int
 defwPinAntennaPinGateArea(int           value,
                           const char    *layerName)
 {
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PIN)
+    if (defwCtx->defwState != DEFW_PIN)
         return DEFW_BAD_ORDER;
-    if (defVersionNum < 5.4)
+    if (defwCtx->defVersionNum < 5.4)
         return DEFW_WRONG_VERSION;
 
-    fprintf(defwFile, "\n      + ANTENNAPINGATEAREA %d", value);
+    defwPrintf("\n      + ANTENNAPINGATEAREA %d", value);
     if (layerName)
-        fprintf(defwFile, " LAYER %s", layerName);
-    defwLines++;
+        defwPrintf(" LAYER %s", layerName);
+    defwCtx->defwLines++;
 
     return DEFW_OK;
 }
@@ -2715,19 +3461,19 @@ int
 defwPinAntennaPinMaxAreaCar(int         value,
                             const char  *layerName)
 {
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PIN)
+    if (defwCtx->defwState != DEFW_PIN)
         return DEFW_BAD_ORDER;
-    if (defVersionNum < 5.4)
+    if (defwCtx->defVersionNum < 5.4)
         return DEFW_WRONG_VERSION;
 
-    fprintf(defwFile, "\n      + ANTENNAPINMAXAREACAR %d", value);
+    defwPrintf("\n      + ANTENNAPINMAXAREACAR %d", value);
     if (!layerName)
         return DEFW_BAD_DATA;  // layerName is required 
 
-    fprintf(defwFile, " LAYER %s", layerName);
-    defwLines++;
+    defwPrintf(" LAYER %s", layerName);
+    defwCtx->defwLines++;
 
     return DEFW_OK;
 }
@@ -2737,19 +3483,19 @@ int
 defwPinAntennaPinMaxSideAreaCar(int         value,
                                 const char  *layerName)
 {
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PIN)
+    if (defwCtx->defwState != DEFW_PIN)
         return DEFW_BAD_ORDER;
-    if (defVersionNum < 5.4)
+    if (defwCtx->defVersionNum < 5.4)
         return DEFW_WRONG_VERSION;
 
-    fprintf(defwFile, "\n      + ANTENNAPINMAXSIDEAREACAR %d", value);
+    defwPrintf("\n      + ANTENNAPINMAXSIDEAREACAR %d", value);
     if (!layerName)
         return DEFW_BAD_DATA;  // layerName is required 
 
-    fprintf(defwFile, " LAYER %s", layerName);
-    defwLines++;
+    defwPrintf(" LAYER %s", layerName);
+    defwCtx->defwLines++;
 
     return DEFW_OK;
 }
@@ -2759,19 +3505,19 @@ int
 defwPinAntennaPinMaxCutCar(int          value,
                            const char   *layerName)
 {
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PIN)
+    if (defwCtx->defwState != DEFW_PIN)
         return DEFW_BAD_ORDER;
-    if (defVersionNum < 5.4)
+    if (defwCtx->defVersionNum < 5.4)
         return DEFW_WRONG_VERSION;
 
-    fprintf(defwFile, "\n      + ANTENNAPINMAXCUTCAR %d", value);
+    defwPrintf("\n      + ANTENNAPINMAXCUTCAR %d", value);
     if (!layerName)
         return DEFW_BAD_DATA;
 
-    fprintf(defwFile, " LAYER %s", layerName);
-    defwLines++;
+    defwPrintf(" LAYER %s", layerName);
+    defwCtx->defwLines++;
 
     return DEFW_OK;
 }
@@ -2780,20 +3526,24 @@ defwPinAntennaPinMaxCutCar(int          value,
 int
 defwEndPins()
 {
-    defwFunc = DEFW_PIN_END;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_PIN_END;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PIN_START && defwState != DEFW_PIN)
+    if (defwCtx->defwState != DEFW_PIN_START && defwCtx->defwState != DEFW_PIN)
         return DEFW_BAD_ORDER;
-    if (defwCounter > 0)
+    if (defwCtx->defwCounter > 0)
         return DEFW_BAD_DATA;
-    else if (defwCounter < 0)
+    else if (defwCtx->defwCounter < 0)
         return DEFW_TOO_MANY_STMS;
 
-    fprintf(defwFile, " ;\nEND PINS\n\n");
-    defwLines++;
+    if (!defwCtx->defwPinEnded)
+        defwPrintf(" ;\n");
+    defwCtx->defwPinEnded = 0;
+    defwPrintf("END PINS\n\n");
+    defwCtx->defwLines++;
 
-    defwState = DEFW_PIN_END;
+    defwCtx->defwState = DEFW_PIN_END;
+    defwTraceSectionEnd("PINS");
     return DEFW_OK;
 }
 
@@ -2801,17 +3551,18 @@ defwEndPins()
 int
 defwStartPinProperties(int count)
 {
-    defwFunc = DEFW_PINPROP_START;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_PINPROP_START;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if ((defwState >= DEFW_PINPROP_START) && (defwState <= DEFW_PINPROP_END))
+    if ((defwCtx->defwState >= DEFW_PINPROP_START) && (defwCtx->defwState <= DEFW_PINPROP_END))
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, "PINPROPERTIES %d ;\n", count);
-    defwLines++;
+    defwPrintf("PINPROPERTIES %d ;\n", count);
+    defwCtx->defwLines++;
 
-    defwCounter = count;
-    defwState = DEFW_PINPROP_START;
+    defwCtx->defwCounter = count;
+    defwCtx->defwState = DEFW_PINPROP_START;
+    defwTraceSectionStart();
     return DEFW_OK;
 }
 
@@ -2821,25 +3572,25 @@ defwPinProperty(const char  *name,
                 const char  *pinName)
 {
 
-    defwFunc = DEFW_PINPROP;   // Current function of writer
+    defwCtx->defwFunc = DEFW_PINPROP;   // Current function of writer
 
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PINPROP_START &&
-        defwState != DEFW_PINPROP)
+    if (defwCtx->defwState != DEFW_PINPROP_START &&
+        defwCtx->defwState != DEFW_PINPROP)
         return DEFW_BAD_ORDER;
 
-    defwCounter--;
+    defwCtx->defwCounter--;
     if ((!name || !*name) || (!pinName || !*pinName)) // required
         return DEFW_BAD_DATA;
 
-    if (defwState == DEFW_PINPROP)
-        fprintf(defwFile, ";\n");
+    if (defwCtx->defwState == DEFW_PINPROP)
+        defwPrintf(";\n");
 
-    fprintf(defwFile, "   - %s %s ", name, pinName);
-    defwLines++;
+    defwPrintf("   - %s %s ", name, pinName);
+    defwCtx->defwLines++;
 
-    defwState = DEFW_PINPROP;
+    defwCtx->defwState = DEFW_PINPROP;
     return DEFW_OK;
 }
 
@@ -2847,24 +3598,25 @@ defwPinProperty(const char  *name,
 int
 defwEndPinProperties()
 {
-    defwFunc = DEFW_PIN_END;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_PIN_END;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PINPROP_START &&
-        defwState != DEFW_PINPROP)
+    if (defwCtx->defwState != DEFW_PINPROP_START &&
+        defwCtx->defwState != DEFW_PINPROP)
         return DEFW_BAD_ORDER;
-    if (defwCounter > 0)
+    if (defwCtx->defwCounter > 0)
         return DEFW_BAD_DATA;
-    else if (defwCounter < 0)
+    else if (defwCtx->defwCounter < 0)
         return DEFW_TOO_MANY_STMS;
 
-    if (defwState == DEFW_PINPROP_START)
-        fprintf(defwFile, "END PINPROPERTIES\n\n");
+    if (defwCtx->defwState == DEFW_PINPROP_START)
+        defwPrintf("END PINPROPERTIES\n\n");
     else
-        fprintf(defwFile, ";\nEND PINPROPERTIES\n\n");
-    defwLines++;
+        defwPrintf(";\nEND PINPROPERTIES\n\n");
+    defwCtx->defwLines++;
 
-    defwState = DEFW_PINPROP_END;
+    defwCtx->defwState = DEFW_PINPROP_END;
+    defwTraceSectionEnd("PINPROPERTIES");
     return DEFW_OK;
 }
 
@@ -2872,17 +3624,18 @@ defwEndPinProperties()
 int
 defwStartSpecialNets(int count)
 {
-    defwFunc = DEFW_SNET_START;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SNET_START;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if ((defwState >= DEFW_SNET_START) && (defwState <= DEFW_SNET_END))
+    if ((defwCtx->defwState >= DEFW_SNET_START) && (defwCtx->defwState <= DEFW_SNET_END))
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, "SPECIALNETS %d ;\n", count);
-    defwLines++;
+    defwPrintf("SPECIALNETS %d ;\n", count);
+    defwCtx->defwLines++;
 
-    defwCounter = count;
-    defwState = DEFW_SNET_START;
+    defwCtx->defwCounter = count;
+    defwCtx->defwState = DEFW_SNET_START;
+    defwTraceSectionStart();
     return DEFW_OK;
 }
 
@@ -2890,12 +3643,12 @@ defwStartSpecialNets(int count)
 int
 defwSpecialNetOptions()
 {
-    defwFunc = DEFW_SNET;   // Current function of writer
-    if (defwState == DEFW_SNET) {
-        defwState = DEFW_SNET_OPTIONS;
+    defwCtx->defwFunc = DEFW_SNET;   // Current function of writer
+    if (defwCtx->defwState == DEFW_SNET) {
+        defwCtx->defwState = DEFW_SNET_OPTIONS;
         return 1;
     }
-    if (defwState == DEFW_SNET_OPTIONS)
+    if (defwCtx->defwState == DEFW_SNET_OPTIONS)
         return 1;
     return 0;
 }
@@ -2904,17 +3657,17 @@ defwSpecialNetOptions()
 int
 defwSpecialNet(const char *name)
 {
-    defwFunc = DEFW_SNET;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SNET;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_SNET_START &&
-        defwState != DEFW_SNET_ENDNET)
+    if (defwCtx->defwState != DEFW_SNET_START &&
+        defwCtx->defwState != DEFW_SNET_ENDNET)
         return DEFW_BAD_ORDER;
-    defwState = DEFW_SNET;
+    defwCtx->defwState = DEFW_SNET;
 
-    fprintf(defwFile, "   - %s", name);
-    defwLineItemCounter = 0;
-    defwCounter--;
+    defwPrintf("   - %s", name);
+    defwCtx->defwLineItemCounter = 0;
+    defwCtx->defwCounter--;
 
     return DEFW_OK;
 }
@@ -2925,20 +3678,20 @@ defwSpecialNetConnection(const char *inst,
                          const char *pin,
                          int        synthesized)
 {
-    defwFunc = DEFW_SNET;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SNET;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_SNET)
+    if (defwCtx->defwState != DEFW_SNET)
         return DEFW_BAD_ORDER;
 
-    if ((++defwLineItemCounter & 3) == 0) { // since a net can have more than
-        fprintf(defwFile, "\n     ");  // one inst pin connection, don't print
-        defwLines++;             // newline until the line is certain length
+    if ((++defwCtx->defwLineItemCounter & 3) == 0) { // since a net can have more than
+        defwPrintf("\n     ");  // one inst pin connection, don't print
+        defwCtx->defwLines++;             // newline until the line is certain length
     }
-    fprintf(defwFile, " ( %s %s ", inst, pin);
+    defwPrintf(" ( %s %s ", inst, pin);
     if (synthesized)
-        fprintf(defwFile, " + SYNTHESIZED ");
-    fprintf(defwFile, ") ");
+        defwPrintf(" + SYNTHESIZED ");
+    defwPrintf(") ");
     return DEFW_OK;
 }
 
@@ -2946,30 +3699,30 @@ defwSpecialNetConnection(const char *inst,
 int
 defwSpecialNetFixedbump()
 {
-    defwFunc = DEFW_SNET;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SNET;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     if (!defwSpecialNetOptions())
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, "\n      + FIXEDBUMP");
-    defwLines++;
+    defwPrintf("\n      + FIXEDBUMP");
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
 int
 defwSpecialNetVoltage(double d)
 {
-    defwFunc = DEFW_SNET;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SNET;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     if (!defwSpecialNetOptions())
         return DEFW_BAD_ORDER;
 
     int v = (int)(d * 1000);
 
-    fprintf(defwFile, "\n      + VOLTAGE %d", v);
-    defwLines++;
+    defwPrintf("\n      + VOLTAGE %d", v);
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -2980,16 +3733,16 @@ defwSpecialNetSpacing(const char    *layer,
                       double        minwidth,
                       double        maxwidth)
 {
-    defwFunc = DEFW_SNET;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SNET;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     if (!defwSpecialNetOptions())
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, "\n      + SPACING %s %d", layer, spacing);
+    defwPrintf("\n      + SPACING %s %d", layer, spacing);
     if (minwidth || maxwidth)
-        fprintf(defwFile, " RANGE %.11g %.11g", minwidth, maxwidth);
-    defwLines++;
+        defwPrintf(" RANGE %.11g %.11g", minwidth, maxwidth);
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -2998,14 +3751,14 @@ int
 defwSpecialNetWidth(const char  *layer,
                     int         w)
 {
-    defwFunc = DEFW_SNET;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SNET;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     if (!defwSpecialNetOptions())
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, "\n      + WIDTH %s %d", layer, w);
-    defwLines++;
+    defwPrintf("\n      + WIDTH %s %d", layer, w);
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -3013,14 +3766,14 @@ defwSpecialNetWidth(const char  *layer,
 int
 defwSpecialNetSource(const char *name)
 {
-    defwFunc = DEFW_SNET;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SNET;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     if (!defwSpecialNetOptions())
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, "\n      + SOURCE %s", name);
-    defwLines++;
+    defwPrintf("\n      + SOURCE %s", name);
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -3028,14 +3781,14 @@ defwSpecialNetSource(const char *name)
 int
 defwSpecialNetOriginal(const char *name)
 {
-    defwFunc = DEFW_SNET;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SNET;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     if (!defwSpecialNetOptions())
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, "\n      + ORIGINAL %s", name);
-    defwLines++;
+    defwPrintf("\n      + ORIGINAL %s", name);
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -3043,14 +3796,14 @@ defwSpecialNetOriginal(const char *name)
 int
 defwSpecialNetPattern(const char *name)
 {
-    defwFunc = DEFW_SNET;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SNET;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     if (!defwSpecialNetOptions())
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, "\n      + PATTERN %s", name);
-    defwLines++;
+    defwPrintf("\n      + PATTERN %s", name);
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -3058,8 +3811,8 @@ defwSpecialNetPattern(const char *name)
 int
 defwSpecialNetUse(const char *name)
 {
-    defwFunc = DEFW_SNET;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SNET;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     if (!defwSpecialNetOptions())
         return DEFW_BAD_ORDER;
@@ -3070,8 +3823,8 @@ defwSpecialNetUse(const char *name)
         strcmp(name, "SCAN") && strcmp(name, "RESET"))
         return DEFW_BAD_DATA;
 
-    fprintf(defwFile, "\n      + USE %s", name);
-    defwLines++;
+    defwPrintf("\n      + USE %s", name);
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -3079,14 +3832,14 @@ defwSpecialNetUse(const char *name)
 int
 defwSpecialNetWeight(double d)
 {
-    defwFunc = DEFW_SNET;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SNET;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     if (!defwSpecialNetOptions())
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, "\n      + WEIGHT %.11g", d);
-    defwLines++;
+    defwPrintf("\n      + WEIGHT %.11g", d);
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -3094,48 +3847,48 @@ defwSpecialNetWeight(double d)
 int
 defwSpecialNetEstCap(double d)
 {
-    defwFunc = DEFW_SNET;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SNET;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     if (!defwSpecialNetOptions())
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, "\n      + ESTCAP %.11g", d);
-    defwLines++;
+    defwPrintf("\n      + ESTCAP %.11g", d);
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
 int
 defwSpecialNetPathStart(const char *typ)
 {
-    defwFunc = DEFW_PATH;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_PATH;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     if (!defwSpecialNetOptions() &&
-        (defwState != DEFW_SUBNET) && // path in subnet 
-        (defwState != DEFW_PATH))   // NEW in the path, path hasn't end yet 
+        (defwCtx->defwState != DEFW_SUBNET) && // path in subnet 
+        (defwCtx->defwState != DEFW_PATH))   // NEW in the path, path hasn't end yet 
         return DEFW_BAD_ORDER;
 
     if (strcmp(typ, "NEW") && strcmp(typ, "FIXED") && strcmp(typ, "COVER") &&
         strcmp(typ, "ROUTED") && strcmp(typ, "SHIELD"))
         return DEFW_BAD_DATA;
 
-    defwSpNetShield = 0;
+    defwCtx->defwSpNetShield = 0;
 
     // The second time around for a path on this net, we
     // must start it with a new instead of a fixed...
     if (strcmp(typ, "NEW") == 0) {
-        if (defwState != DEFW_PATH)
+        if (defwCtx->defwState != DEFW_PATH)
             return DEFW_BAD_DATA;
-        fprintf(defwFile, " NEW");
+        defwPrintf(" NEW");
     } else if (strcmp(typ, "SHIELD") == 0) {
-        fprintf(defwFile, "\n      + %s", typ);
-        defwSpNetShield = 1;
+        defwPrintf("\n      + %s", typ);
+        defwCtx->defwSpNetShield = 1;
     } else
-        fprintf(defwFile, "\n      + %s", typ);
+        defwPrintf("\n      + %s", typ);
 
-    defwState = DEFW_PATH_START;
-    defwLineItemCounter = 0;
+    defwCtx->defwState = DEFW_PATH_START;
+    defwCtx->defwLineItemCounter = 0;
     return DEFW_OK;
 }
 
@@ -3143,17 +3896,17 @@ defwSpecialNetPathStart(const char *typ)
 int
 defwSpecialNetShieldNetName(const char *name)
 {
-    defwFunc = DEFW_PATH;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_PATH;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PATH_START)
+    if (defwCtx->defwState != DEFW_PATH_START)
         return DEFW_BAD_ORDER;
-    if ((++defwLineItemCounter & 3) == 0) {
-        fprintf(defwFile, "\n     ");
-        defwLines++;
+    if ((++defwCtx->defwLineItemCounter & 3) == 0) {
+        defwPrintf("\n     ");
+        defwCtx->defwLines++;
     }
-    if (defwSpNetShield)
-        fprintf(defwFile, " %s", name);
+    if (defwCtx->defwSpNetShield)
+        defwPrintf(" %s", name);
     else
         return DEFW_BAD_ORDER;
     return DEFW_OK;
@@ -3163,16 +3916,16 @@ defwSpecialNetShieldNetName(const char *name)
 int
 defwSpecialNetPathWidth(int w)
 {
-    defwFunc = DEFW_PATH;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_PATH;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PATH)
+    if (defwCtx->defwState != DEFW_PATH)
         return DEFW_BAD_ORDER;
-    if ((++defwLineItemCounter & 3) == 0) {
-        fprintf(defwFile, "\n     ");
-        defwLines++;
+    if ((++defwCtx->defwLineItemCounter & 3) == 0) {
+        defwPrintf("\n     ");
+        defwCtx->defwLines++;
     }
-    fprintf(defwFile, " %d", w);
+    defwPrintf(" %d", w);
     return DEFW_OK;
 }
 
@@ -3180,17 +3933,17 @@ defwSpecialNetPathWidth(int w)
 int
 defwSpecialNetPathLayer(const char *name)
 {
-    defwFunc = DEFW_PATH;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_PATH;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PATH_START)
+    if (defwCtx->defwState != DEFW_PATH_START)
         return DEFW_BAD_ORDER;
-    if ((++defwLineItemCounter & 3) == 0) {
-        fprintf(defwFile, "\n     ");
-        defwLines++;
+    if ((++defwCtx->defwLineItemCounter & 3) == 0) {
+        defwPrintf("\n     ");
+        defwCtx->defwLines++;
     }
-    fprintf(defwFile, " %s", name);
-    defwState = DEFW_PATH;
+    defwPrintf(" %s", name);
+    defwCtx->defwState = DEFW_PATH;
     return DEFW_OK;
 }
 
@@ -3198,19 +3951,19 @@ defwSpecialNetPathLayer(const char *name)
 int
 defwSpecialNetPathStyle(int styleNum)
 {
-    defwFunc = DEFW_PATH;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_PATH;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PATH)
+    if (defwCtx->defwState != DEFW_PATH)
         return DEFW_BAD_ORDER;
 
-    if ((++defwLineItemCounter & 3) == 0) {
-        fprintf(defwFile, "\n     ");
-        defwLines++;
+    if ((++defwCtx->defwLineItemCounter & 3) == 0) {
+        defwPrintf("\n     ");
+        defwCtx->defwLines++;
     }
-    fprintf(defwFile, "\n      + STYLE %d", styleNum);
-    defwState = DEFW_PATH;
-    defwLineItemCounter = 0;
+    defwPrintf("\n      + STYLE %d", styleNum);
+    defwCtx->defwState = DEFW_PATH;
+    defwCtx->defwLineItemCounter = 0;
     return DEFW_OK;
 }
 
@@ -3218,10 +3971,10 @@ defwSpecialNetPathStyle(int styleNum)
 int
 defwSpecialNetPathShape(const char *typ)
 {
-    defwFunc = DEFW_PATH;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_PATH;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PATH)
+    if (defwCtx->defwState != DEFW_PATH)
         return DEFW_BAD_ORDER;
 
     if (strcmp(typ, "RING") && strcmp(typ, "STRIPE") && strcmp(typ, "FOLLOWPIN") &&
@@ -3232,35 +3985,35 @@ defwSpecialNetPathShape(const char *typ)
         strcmp(typ, "FILLWIREOPC"))      // 5.7
         return DEFW_BAD_DATA;
 
-    if ((++defwLineItemCounter & 3) == 0) {
-        fprintf(defwFile, "\n     ");
-        defwLines++;
+    if ((++defwCtx->defwLineItemCounter & 3) == 0) {
+        defwPrintf("\n     ");
+        defwCtx->defwLines++;
     }
-    fprintf(defwFile, "\n      + SHAPE %s", typ);
+    defwPrintf("\n      + SHAPE %s", typ);
 
-    defwState = DEFW_PATH;
-    defwLineItemCounter = 0;
+    defwCtx->defwState = DEFW_PATH;
+    defwCtx->defwLineItemCounter = 0;
     return DEFW_OK;
 }
 
 int
 defwSpecialNetPathMask(int colorMask)
 {
-    if (defVersionNum < 5.8) {
+    if (defwCtx->defVersionNum < 5.8) {
         return DEFW_WRONG_VERSION;
     }
 
-    defwFunc = DEFW_PATH;   // Current function of writer
+    defwCtx->defwFunc = DEFW_PATH;   // Current function of writer
 
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PATH)
+    if (defwCtx->defwState != DEFW_PATH)
         return DEFW_BAD_ORDER;
-    if ((++defwLineItemCounter & 3) == 0) {
-        fprintf(defwFile, "\n     ");
-        defwLines++;
+    if ((++defwCtx->defwLineItemCounter & 3) == 0) {
+        defwPrintf("\n     ");
+        defwCtx->defwLines++;
     }
-    fprintf(defwFile, " MASK %d", colorMask);
+    defwPrintf(" MASK %d", colorMask);
     return DEFW_OK;
 }
 
@@ -3271,20 +4024,20 @@ defwSpecialNetPathPoint(int     numPts,
 {
     int i;
 
-    defwFunc = DEFW_PATH;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_PATH;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PATH)
+    if (defwCtx->defwState != DEFW_PATH)
         return DEFW_BAD_ORDER;
 
-    printPointsNum = 0;
+    defwCtx->printPointsNum = 0;
     for (i = 0; i < numPts; i++) {
-          if ((++defwLineItemCounter & 3) == 0) {
-              fprintf(defwFile, "\n     ");
-              defwLines++;
+          if ((++defwCtx->defwLineItemCounter & 3) == 0) {
+              defwPrintf("\n     ");
+              defwCtx->defwLines++;
           }
 
-          printPoints(defwFile, pointx[i], pointy[i], " ", "");
+          printPoints(pointx[i], pointy[i], " ", "");
       }
     return DEFW_OK;
 }
@@ -3293,16 +4046,16 @@ defwSpecialNetPathPoint(int     numPts,
 int
 defwSpecialNetPathVia(const char *name)
 {
-    defwFunc = DEFW_PATH;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_PATH;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PATH)
+    if (defwCtx->defwState != DEFW_PATH)
         return DEFW_BAD_ORDER;
-    if ((++defwLineItemCounter & 3) == 0) {
-        fprintf(defwFile, "\n     ");
-        defwLines++;
+    if ((++defwCtx->defwLineItemCounter & 3) == 0) {
+        defwPrintf("\n     ");
+        defwCtx->defwLines++;
     }
-    fprintf(defwFile, " %s", name);
+    defwPrintf(" %s", name);
     return DEFW_OK;
 }
 
@@ -3313,16 +4066,16 @@ defwSpecialNetPathViaData(int   numX,
                           int   stepX,
                           int   stepY)
 {
-    defwFunc = DEFW_PATH;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_PATH;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PATH)
+    if (defwCtx->defwState != DEFW_PATH)
         return DEFW_BAD_ORDER;
-    if ((++defwLineItemCounter & 3) == 0) {
-        fprintf(defwFile, "\n     ");
-        defwLines++;
+    if ((++defwCtx->defwLineItemCounter & 3) == 0) {
+        defwPrintf("\n     ");
+        defwCtx->defwLines++;
     }
-    fprintf(defwFile, " DO %d BY %d STEP %d %d", numX, numY, stepX, stepY);
+    defwPrintf(" DO %d BY %d STEP %d %d", numX, numY, stepX, stepY);
     return DEFW_OK;
 }
 
@@ -3334,20 +4087,18 @@ defwSpecialNetPathPointWithWireExt(int      numPts,
                                    double   *optValue)
 {
     int i;
-    defwFunc = DEFW_PATH;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_PATH;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PATH)
+    if (defwCtx->defwState != DEFW_PATH)
         return DEFW_BAD_ORDER;
     for (i = 0; i < numPts; i++) {
-        if ((++defwLineItemCounter & 3) == 0) {
-            fprintf(defwFile, "\n        ");
-            defwLines++;
+        if ((++defwCtx->defwLineItemCounter & 3) == 0) {
+            defwPrintf("\n        ");
+            defwCtx->defwLines++;
         }
-        fprintf(defwFile, " ( %.11g %.11g ", pointx[i], pointy[i]);
-        if (optValue[i])
-            fprintf(defwFile, "%.11g ", optValue[i]);
-        fprintf(defwFile, ")");
+        defwPrintPoint(" ", pointx[i], pointy[i],
+                       optValue[i] ? &optValue[i] : 0, ")");
     }
     return DEFW_OK;
 }
@@ -3356,12 +4107,12 @@ defwSpecialNetPathPointWithWireExt(int      numPts,
 int
 defwSpecialNetPathEnd()
 {
-    defwFunc = DEFW_SNET_OPTIONS;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SNET_OPTIONS;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PATH)
+    if (defwCtx->defwState != DEFW_PATH)
         return DEFW_BAD_ORDER;
-    defwState = DEFW_SNET_OPTIONS;
+    defwCtx->defwState = DEFW_SNET_OPTIONS;
     return DEFW_OK;
 }
 
@@ -3372,26 +4123,26 @@ defwSpecialNetPolygon(const char* layerName,
                      double* xl, double* yl) {
                               int i;
 
-                              defwFunc = DEFW_SNET_OPTIONS;   // Current function of writer
+                              defwCtx->defwFunc = DEFW_SNET_OPTIONS;   // Current function of writer
                               if (! defwSpecialNetOptions() &&
-                                  (defwState != DEFW_PATH))  // not inside a path
+                                  (defwCtx->defwState != DEFW_PATH))  // not inside a path
                                   return DEFW_BAD_ORDER;
 
-                              if (defVersionNum < 5.6)
+                              if (defwCtx->defVersionNum < 5.6)
                                   return DEFW_WRONG_VERSION;
 
-                              fprintf(defwFile, "\n      + POLYGON %s ", layerName);
+                              defwPrintf("\n      + POLYGON %s ", layerName);
 
-                              printPointsNum = 0;
+                              defwCtx->printPointsNum = 0;
                               for (i = 0; i < num_polys; i++) {
                                   if ((i == 0) || ((i % 5) != 0))
-                                      printPoints(defwFile, *xl++, *yl++, "", " ");
+                                      printPoints(*xl++, *yl++, "", " ");
                                   else {
-                                      printPoints(defwFile,  *xl++, *yl++, "\n                ", " ");
-                                      defwLines++; 
+                                      printPoints( *xl++, *yl++, "\n                ", " ");
+                                      defwCtx->defwLines++; 
                                   }
                               }
-                              defwLines++; 
+                              defwCtx->defwLines++; 
                               return DEFW_OK;
 }
 
@@ -3403,17 +4154,17 @@ defwSpecialNetRect(const char   *layerName,
                    int          xh,
                    int          yh)
 {
-    defwFunc = DEFW_SNET_OPTIONS;   // Current function of writer
+    defwCtx->defwFunc = DEFW_SNET_OPTIONS;   // Current function of writer
     if (!defwSpecialNetOptions() &&
-        (defwState != DEFW_PATH))  // not inside a path
+        (defwCtx->defwState != DEFW_PATH))  // not inside a path
         return DEFW_BAD_ORDER;
 
-    if (defVersionNum < 5.6)
+    if (defwCtx->defVersionNum < 5.6)
         return DEFW_WRONG_VERSION;
 
-    fprintf(defwFile, "\n      + RECT %s ( %d %d ) ( %d %d ) ", layerName,
+    defwPrintf("\n      + RECT %s ( %d %d ) ( %d %d ) ", layerName,
             xl, yl, xh, yh);
-    defwLines++;
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -3421,16 +4172,16 @@ defwSpecialNetRect(const char   *layerName,
 int
 defwSpecialNetVia(const char *layerName)
 {
-    defwFunc = DEFW_SNET_OPTIONS;   // Current function of writer
+    defwCtx->defwFunc = DEFW_SNET_OPTIONS;   // Current function of writer
     if (!defwSpecialNetOptions() &&
-        (defwState != DEFW_PATH))  // not inside a path
+        (defwCtx->defwState != DEFW_PATH))  // not inside a path
         return DEFW_BAD_ORDER;
 
-    if (defVersionNum < 5.8)
+    if (defwCtx->defVersionNum < 5.8)
         return DEFW_WRONG_VERSION;
 
-    fprintf(defwFile, "\n      + VIA %s ", layerName);
-    defwLines++;
+    defwPrintf("\n      + VIA %s ", layerName);
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -3439,17 +4190,17 @@ int
 defwSpecialNetViaWithOrient(const char  *layerName,
                             int         orient)
 {
-    defwFunc = DEFW_SNET_OPTIONS;   // Current function of writer
+    defwCtx->defwFunc = DEFW_SNET_OPTIONS;   // Current function of writer
     if (!defwSpecialNetOptions() &&
-        (defwState != DEFW_PATH))  // not inside a path
+        (defwCtx->defwState != DEFW_PATH))  // not inside a path
         return DEFW_BAD_ORDER;
 
-    if (defVersionNum < 5.8)
+    if (defwCtx->defVersionNum < 5.8)
         return DEFW_WRONG_VERSION;
 
-    fprintf(defwFile, "\n      + VIA %s %s", layerName, defwOrient(orient));
+    defwPrintf("\n      + VIA %s %s", layerName, defwOrient(orient));
 
-    defwLines++;
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -3459,26 +4210,26 @@ defwSpecialNetViaPoints(int     num_points,
                         double  *xl,
                         double  *yl)
 {
-    defwFunc = DEFW_SNET_OPTIONS;   // Current function of writer
+    defwCtx->defwFunc = DEFW_SNET_OPTIONS;   // Current function of writer
     if (!defwSpecialNetOptions() &&
-        (defwState != DEFW_PATH))  // not inside a path
+        (defwCtx->defwState != DEFW_PATH))  // not inside a path
         return DEFW_BAD_ORDER;
 
-    if (defVersionNum < 5.8)
+    if (defwCtx->defVersionNum < 5.8)
         return DEFW_WRONG_VERSION;
 
 
-    printPointsNum = 0;
+    defwCtx->printPointsNum = 0;
     for (int i = 0; i < num_points; i++) {
         if ((i == 0) || ((i % 5) != 0))
-            printPoints(defwFile, *xl++, *yl++, "", " ");
+            printPoints(*xl++, *yl++, "", " ");
         else {
-            printPoints(defwFile, *xl++, *yl++, "\n             ", " ");
-            defwLines++;
+            printPoints(*xl++, *yl++, "\n             ", " ");
+            defwCtx->defwLines++;
         }
     }
 
-    defwLines++;
+    defwCtx->defwLines++;
     return DEFW_OK;
 
 }
@@ -3487,8 +4238,8 @@ defwSpecialNetViaPoints(int     num_points,
 int
 defwSpecialNetShieldStart(const char *name)
 {
-    defwFunc = DEFW_SHIELD;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SHIELD;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     if (!defwSpecialNetOptions())
         return DEFW_BAD_ORDER;
@@ -3496,14 +4247,14 @@ defwSpecialNetShieldStart(const char *name)
     // The second time around for a shield on this net, we
     // must start it with a new instead of the name ...
     if (strcmp(name, "NEW") == 0) {
-        if (defwState != DEFW_SHIELD)
+        if (defwCtx->defwState != DEFW_SHIELD)
             return DEFW_BAD_DATA;
-        fprintf(defwFile, " NEW");
+        defwPrintf(" NEW");
     } else
-        fprintf(defwFile, "\n      + SHIELD %s", name);
+        defwPrintf("\n      + SHIELD %s", name);
 
-    defwState = DEFW_SHIELD;
-    defwLineItemCounter = 0;
+    defwCtx->defwState = DEFW_SHIELD;
+    defwCtx->defwLineItemCounter = 0;
     return DEFW_OK;
 }
 
@@ -3511,16 +4262,16 @@ defwSpecialNetShieldStart(const char *name)
 int
 defwSpecialNetShieldWidth(int w)
 {
-    defwFunc = DEFW_SHIELD;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SHIELD;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_SHIELD)
+    if (defwCtx->defwState != DEFW_SHIELD)
         return DEFW_BAD_ORDER;
-    if ((++defwLineItemCounter & 3) == 0) {
-        fprintf(defwFile, "\n     ");
-        defwLines++;
+    if ((++defwCtx->defwLineItemCounter & 3) == 0) {
+        defwPrintf("\n     ");
+        defwCtx->defwLines++;
     }
-    fprintf(defwFile, " %d", w);
+    defwPrintf(" %d", w);
     return DEFW_OK;
 }
 
@@ -3528,16 +4279,16 @@ defwSpecialNetShieldWidth(int w)
 int
 defwSpecialNetShieldLayer(const char *name)
 {
-    defwFunc = DEFW_SHIELD;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SHIELD;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_SHIELD)
+    if (defwCtx->defwState != DEFW_SHIELD)
         return DEFW_BAD_ORDER;
-    if ((++defwLineItemCounter & 3) == 0) {
-        fprintf(defwFile, "\n     ");
-        defwLines++;
+    if ((++defwCtx->defwLineItemCounter & 3) == 0) {
+        defwPrintf("\n     ");
+        defwCtx->defwLines++;
     }
-    fprintf(defwFile, " %s", name);
+    defwPrintf(" %s", name);
     return DEFW_OK;
 }
 
@@ -3545,10 +4296,10 @@ defwSpecialNetShieldLayer(const char *name)
 int
 defwSpecialNetShieldShape(const char *typ)
 {
-    defwFunc = DEFW_SHIELD;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SHIELD;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_SHIELD)
+    if (defwCtx->defwState != DEFW_SHIELD)
         return DEFW_BAD_ORDER;
 
     if (strcmp(typ, "RING") && strcmp(typ, "STRIPE") && strcmp(typ, "FOLLOWPIN") &&
@@ -3557,14 +4308,14 @@ defwSpecialNetShieldShape(const char *typ)
         strcmp(typ, "BLOCKAGEWIRE") && strcmp(typ, "DRCFILL"))
         return DEFW_BAD_DATA;
 
-    if ((++defwLineItemCounter & 3) == 0) {
-        fprintf(defwFile, "\n     ");
-        defwLines++;
+    if ((++defwCtx->defwLineItemCounter & 3) == 0) {
+        defwPrintf("\n     ");
+        defwCtx->defwLines++;
     }
-    fprintf(defwFile, "\n      + SHAPE %s", typ);
+    defwPrintf("\n      + SHAPE %s", typ);
 
-    defwState = DEFW_SHIELD;
-    defwLineItemCounter = 0;
+    defwCtx->defwState = DEFW_SHIELD;
+    defwCtx->defwLineItemCounter = 0;
     return DEFW_OK;
 }
 
@@ -3576,19 +4327,19 @@ defwSpecialNetShieldPoint(int       numPts,
 {
     int i;
 
-    defwFunc = DEFW_SHIELD;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SHIELD;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_SHIELD)
+    if (defwCtx->defwState != DEFW_SHIELD)
         return DEFW_BAD_ORDER;
 
-    printPointsNum = 0;
+    defwCtx->printPointsNum = 0;
     for (i = 0; i < numPts; i++) {
-        if ((++defwLineItemCounter & 3) == 0) {
-            fprintf(defwFile, "\n     ");
-            defwLines++;
+        if ((++defwCtx->defwLineItemCounter & 3) == 0) {
+            defwPrintf("\n     ");
+            defwCtx->defwLines++;
         }
-     printPoints(defwFile, pointx[i], pointy[i], " ", "");
+     printPoints(pointx[i], pointy[i], " ", "");
     }
     return DEFW_OK;
 }
@@ -3597,16 +4348,16 @@ defwSpecialNetShieldPoint(int       numPts,
 int
 defwSpecialNetShieldVia(const char *name)
 {
-    defwFunc = DEFW_SHIELD;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SHIELD;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_SHIELD)
+    if (defwCtx->defwState != DEFW_SHIELD)
         return DEFW_BAD_ORDER;
-    if ((++defwLineItemCounter & 3) == 0) {
-        fprintf(defwFile, "\n     ");
-        defwLines++;
+    if ((++defwCtx->defwLineItemCounter & 3) == 0) {
+        defwPrintf("\n     ");
+        defwCtx->defwLines++;
     }
-    fprintf(defwFile, " %s", name);
+    defwPrintf(" %s", name);
     return DEFW_OK;
 }
 
@@ -3617,28 +4368,28 @@ defwSpecialNetShieldViaData(int numX,
                             int stepX,
                             int stepY)
 {
-    defwFunc = DEFW_SHIELD;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SHIELD;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_SHIELD)
+    if (defwCtx->defwState != DEFW_SHIELD)
         return DEFW_BAD_ORDER;
-    if ((++defwLineItemCounter & 3) == 0) {
-        fprintf(defwFile, "\n     ");
-        defwLines++;
+    if ((++defwCtx->defwLineItemCounter & 3) == 0) {
+        defwPrintf("\n     ");
+        defwCtx->defwLines++;
     }
-    fprintf(defwFile, " DO %d BY %d STEP %d %d", numX, numY, stepX, stepY);
+    defwPrintf(" DO %d BY %d STEP %d %d", numX, numY, stepX, stepY);
     return DEFW_OK;
 }
 
 int
 defwSpecialNetShieldEnd()
 {
-    defwFunc = DEFW_SNET_OPTIONS;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SNET_OPTIONS;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_SHIELD)
+    if (defwCtx->defwState != DEFW_SHIELD)
         return DEFW_BAD_ORDER;
-    defwState = DEFW_SNET_OPTIONS;
+    defwCtx->defwState = DEFW_SNET_OPTIONS;
     return DEFW_OK;
 }
 
@@ -3646,15 +4397,15 @@ defwSpecialNetShieldEnd()
 int
 defwSpecialNetEndOneNet()
 {
-    defwFunc = DEFW_SNET_ENDNET;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SNET_ENDNET;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     if (!defwSpecialNetOptions())
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, " ;\n");
-    defwLines++;
-    defwState = DEFW_SNET_ENDNET;
+    defwPrintf(" ;\n");
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_SNET_ENDNET;
 
     return DEFW_OK;
 }
@@ -3663,22 +4414,23 @@ defwSpecialNetEndOneNet()
 int
 defwEndSpecialNets()
 {
-    defwFunc = DEFW_SNET_END;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SNET_END;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_SNET_START && defwState != DEFW_SNET_OPTIONS &&
-        defwState != DEFW_SNET_ENDNET &&   // last state is special net
-        defwState != DEFW_SNET)
+    if (defwCtx->defwState != DEFW_SNET_START && defwCtx->defwState != DEFW_SNET_OPTIONS &&
+        defwCtx->defwState != DEFW_SNET_ENDNET &&   // last state is special net
+        defwCtx->defwState != DEFW_SNET)
         return DEFW_BAD_ORDER;
-    if (defwCounter > 0)
+    if (defwCtx->defwCounter > 0)
         return DEFW_BAD_DATA;
-    else if (defwCounter < 0)
+    else if (defwCtx->defwCounter < 0)
         return DEFW_TOO_MANY_STMS;
 
-    fprintf(defwFile, "END SPECIALNETS\n\n");
-    defwLines++;
+    defwPrintf("END SPECIALNETS\n\n");
+    defwCtx->defwLines++;
 
-    defwState = DEFW_SNET_END;
+    defwCtx->defwState = DEFW_SNET_END;
+    defwTraceSectionEnd("SPECIALNETS");
     return DEFW_OK;
 }
 
@@ -3686,17 +4438,18 @@ defwEndSpecialNets()
 int
 defwStartNets(int count)
 {
-    defwFunc = DEFW_NET_START;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_NET_START;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if ((defwState >= DEFW_NET_START) && (defwState <= DEFW_NET_END))
+    if ((defwCtx->defwState >= DEFW_NET_START) && (defwCtx->defwState <= DEFW_NET_END))
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, "NETS %d ;\n", count);
-    defwLines++;
+    defwPrintf("NETS %d ;\n", count);
+    defwCtx->defwLines++;
 
-    defwCounter = count;
-    defwState = DEFW_NET_START;
+    defwCtx->defwCounter = count;
+    defwCtx->defwState = DEFW_NET_START;
+    defwTraceSectionStart();
     return DEFW_OK;
 }
 
@@ -3704,12 +4457,12 @@ defwStartNets(int count)
 int
 defwNetOptions()
 {
-    defwFunc = DEFW_NET;   // Current function of writer
-    if (defwState == DEFW_NET) {
-        defwState = DEFW_NET_OPTIONS;
+    defwCtx->defwFunc = DEFW_NET;   // Current function of writer
+    if (defwCtx->defwState == DEFW_NET) {
+        defwCtx->defwState = DEFW_NET_OPTIONS;
         return 1;
     }
-    if (defwState == DEFW_NET_OPTIONS)
+    if (defwCtx->defwState == DEFW_NET_OPTIONS)
         return 1;
     return 0;
 }
@@ -3718,18 +4471,44 @@ defwNetOptions()
 int
 defwNet(const char *name)
 {
-    defwFunc = DEFW_NET;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_NET;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_NET_START &&
-        defwState != DEFW_NET_ENDNET)
+    if (defwCtx->defwState != DEFW_NET_START &&
+        defwCtx->defwState != DEFW_NET_ENDNET)
         return DEFW_BAD_ORDER;
-    defwState = DEFW_NET;
+    defwCtx->defwState = DEFW_NET;
+
+    defwPrintf("   - %s", name);
+    defwCtx->defwLineItemCounter = 0;
+    defwCtx->defwCounter--;
+
+    return DEFW_OK;
+}
 
-    fprintf(defwFile, "   - %s", name);
-    defwLineItemCounter = 0;
-    defwCounter--;
 
+// Writes one connection of the current net; the caller has checked the
+// writer state.
+static int
+defwNetConnectionRecord(const defwNetConnectionRec *c)
+{
+    // required
+    if ((c->inst == 0) || (*c->inst == 0) ||
+        (c->pin == 0) || (*c->pin == 0))
+        return DEFW_BAD_DATA;
+
+    if ((++defwCtx->defwLineItemCounter & 3) == 0) {  // since there is more than one
+        defwPutData("\n", 1);      // inst & pin connection, don't print newline
+        defwCtx->defwLines++;      // until the line is certain length long
+    }
+    defwPutData(" ( ", 3);
+    defwPutData(c->inst, strlen(c->inst));
+    defwPutData(" ", 1);
+    defwPutData(c->pin, strlen(c->pin));
+    if (c->synthesized)
+        defwPutData(" + SYNTHESIZED ) ", 17);
+    else
+        defwPutData(" ) ", 3);
     return DEFW_OK;
 }
 
@@ -3739,21 +4518,41 @@ defwNetConnection(const char    *inst,
                   const char    *pin,
                   int           synthesized)
 {
-    defwFunc = DEFW_NET;   // Current function of writer
-    if (!defwFile)
+    defwNetConnectionRec c;
+
+    defwCtx->defwFunc = DEFW_NET;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_NET)
+    if (defwCtx->defwState != DEFW_NET)
         return DEFW_BAD_ORDER;
 
-    if ((++defwLineItemCounter & 3) == 0) {  // since there is more than one
-        fprintf(defwFile, "\n"); // inst & pin connection, don't print newline
-        defwLines++;             // until the line is certain length long
+    c.inst = inst;
+    c.pin = pin;
+    c.synthesized = synthesized;
+    return defwNetConnectionRecord(&c);
+}
+
+
+int
+defwNetConnectionsBulk(const defwNetConnectionRec *conns,
+                       size_t                     n)
+{
+    size_t i;
+    int    status;
+
+    defwCtx->defwFunc = DEFW_NET;   // Current function of writer
+    if (!defwCtx->defwFile)
+        return DEFW_UNINITIALIZED;
+    if (defwCtx->defwState != DEFW_NET)
+        return DEFW_BAD_ORDER;
+    if (n && !conns)
+        return DEFW_BAD_DATA;
+
+    for (i = 0; i < n; i++) {
+        status = defwNetConnectionRecord(conns + i);
+        if (status != DEFW_OK)
+            return status;
     }
-    fprintf(defwFile, " ( %s %s", inst, pin);
-    if (synthesized)
-        fprintf(defwFile, " + SYNTHESIZED ) ");
-    else
-        fprintf(defwFile, " ) ");
     return DEFW_OK;
 }
 
@@ -3762,21 +4561,21 @@ int
 defwNetMustjoinConnection(const char    *inst,
                           const char    *pin)
 {
-    defwFunc = DEFW_NET;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_NET;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_NET_ENDNET)
+    if (defwCtx->defwState != DEFW_NET_ENDNET)
         return DEFW_BAD_ORDER;
 
-    if ((++defwLineItemCounter & 3) == 0) {
-        fprintf(defwFile, "\n     ");
-        defwLines++;
+    if ((++defwCtx->defwLineItemCounter & 3) == 0) {
+        defwPrintf("\n     ");
+        defwCtx->defwLines++;
     }
-    fprintf(defwFile, " - MUSTJOIN ( %s %s )", inst, pin);
+    defwPrintf(" - MUSTJOIN ( %s %s )", inst, pin);
 
-  defwState = DEFW_NET;
+  defwCtx->defwState = DEFW_NET;
   
-  defwCounter--;
+  defwCtx->defwCounter--;
 
     return DEFW_OK;
 }
@@ -3785,14 +4584,14 @@ defwNetMustjoinConnection(const char    *inst,
 int
 defwNetFixedbump()
 {
-    defwFunc = DEFW_NET;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_NET;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     if (!defwNetOptions())
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, "\n      + FIXEDBUMP");
-    defwLines++;
+    defwPrintf("\n      + FIXEDBUMP");
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -3800,14 +4599,14 @@ defwNetFixedbump()
 int
 defwNetFrequency(double frequency)
 {
-    defwFunc = DEFW_NET;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_NET;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     if (!defwNetOptions())
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, "\n      + FREQUENCY %.11g", frequency);
-    defwLines++;
+    defwPrintf("\n      + FREQUENCY %.11g", frequency);
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -3815,14 +4614,14 @@ defwNetFrequency(double frequency)
 int
 defwNetSource(const char *name)
 {
-    defwFunc = DEFW_NET;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_NET;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     if (!defwNetOptions())
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, "\n      + SOURCE %s", name);
-    defwLines++;
+    defwPrintf("\n      + SOURCE %s", name);
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -3830,14 +4629,14 @@ defwNetSource(const char *name)
 int
 defwNetXtalk(int xtalk)
 {
-    defwFunc = DEFW_NET;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_NET;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     if (!defwNetOptions())
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, "\n      + XTALK %d", xtalk);
-    defwLines++;
+    defwPrintf("\n      + XTALK %d", xtalk);
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -3854,8 +4653,8 @@ defwNetVpin(const char  *vpinName,
             int         statusY,
             int         orient)
 {
-    defwFunc = DEFW_NET;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_NET;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     if (!defwNetOptions())
         return DEFW_BAD_ORDER;
@@ -3868,17 +4667,17 @@ defwNetVpin(const char  *vpinName,
     if (status && (orient == 1))  // require if status is set
         return DEFW_BAD_DATA;
 
-    fprintf(defwFile, "\n      + VPIN %s", vpinName);
+    defwPrintf("\n      + VPIN %s", vpinName);
     if (layerName)
-        fprintf(defwFile, " LAYER %s", layerName);
-    fprintf(defwFile, " ( %d %d ) ( %d %d )\n", layerXl, layerYl, layerXh,
+        defwPrintf(" LAYER %s", layerName);
+    defwPrintf(" ( %d %d ) ( %d %d )\n", layerXl, layerYl, layerXh,
             layerYh);
-    defwLines++;
+    defwCtx->defwLines++;
 
     if (status)
-        fprintf(defwFile, "         %s ( %d %d ) %s", status, statusX, statusY,
+        defwPrintf("         %s ( %d %d ) %s", status, statusX, statusY,
                 defwOrient(orient));
-    defwLines++;
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -3895,8 +4694,8 @@ defwNetVpinStr(const char   *vpinName,
                int          statusY,
                const char   *orient)
 {
-    defwFunc = DEFW_NET;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_NET;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     if (!defwNetOptions())
         return DEFW_BAD_ORDER;
@@ -3909,17 +4708,17 @@ defwNetVpinStr(const char   *vpinName,
     if (status && orient && *orient == '\0')  // require if status is set
         return DEFW_BAD_DATA;
 
-    fprintf(defwFile, "\n      + VPIN %s", vpinName);
+    defwPrintf("\n      + VPIN %s", vpinName);
     if (layerName)
-        fprintf(defwFile, " LAYER %s", layerName);
-    fprintf(defwFile, " ( %d %d ) ( %d %d )\n", layerXl, layerYl, layerXh,
+        defwPrintf(" LAYER %s", layerName);
+    defwPrintf(" ( %d %d ) ( %d %d )\n", layerXl, layerYl, layerXh,
             layerYh);
-    defwLines++;
+    defwCtx->defwLines++;
 
     if (status)
-        fprintf(defwFile, "         %s ( %d %d ) %s", status, statusX, statusY,
+        defwPrintf("         %s ( %d %d ) %s", status, statusX, statusY,
                 orient);
-    defwLines++;
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -3927,14 +4726,14 @@ defwNetVpinStr(const char   *vpinName,
 int
 defwNetOriginal(const char *name)
 {
-    defwFunc = DEFW_NET;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_NET;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     if (!defwNetOptions())
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, "\n      + ORIGINAL %s", name);
-    defwLines++;
+    defwPrintf("\n      + ORIGINAL %s", name);
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -3942,14 +4741,14 @@ defwNetOriginal(const char *name)
 int
 defwNetPattern(const char *name)
 {
-    defwFunc = DEFW_NET;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_NET;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     if (!defwNetOptions())
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, "\n      + PATTERN %s", name);
-    defwLines++;
+    defwPrintf("\n      + PATTERN %s", name);
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -3957,8 +4756,8 @@ defwNetPattern(const char *name)
 int
 defwNetUse(const char *name)
 {
-    defwFunc = DEFW_NET;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_NET;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     if (!defwNetOptions())
         return DEFW_BAD_ORDER;
@@ -3969,8 +4768,8 @@ defwNetUse(const char *name)
         strcmp(name, "SCAN") && strcmp(name, "RESET"))
         return DEFW_BAD_DATA;
 
-    fprintf(defwFile, "\n      + USE %s", name);
-    defwLines++;
+    defwPrintf("\n      + USE %s", name);
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -3978,18 +4777,18 @@ defwNetUse(const char *name)
 int
 defwNetNondefaultRule(const char *name)
 {
-    defwFunc = DEFW_NET;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_NET;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if ((defwState != DEFW_NET) && (defwState != DEFW_NET_OPTIONS) &&
-        (defwState != DEFW_SUBNET))
+    if ((defwCtx->defwState != DEFW_NET) && (defwCtx->defwState != DEFW_NET_OPTIONS) &&
+        (defwCtx->defwState != DEFW_SUBNET))
         return DEFW_BAD_ORDER;
 
-    if (defwState == DEFW_SUBNET)
-        fprintf(defwFile, "\n         NONDEFAULTRULE %s", name);
+    if (defwCtx->defwState == DEFW_SUBNET)
+        defwPrintf("\n         NONDEFAULTRULE %s", name);
     else
-        fprintf(defwFile, "\n      + NONDEFAULTRULE %s", name);
-    defwLines++;
+        defwPrintf("\n      + NONDEFAULTRULE %s", name);
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -3997,14 +4796,14 @@ defwNetNondefaultRule(const char *name)
 int
 defwNetWeight(double d)
 {
-    defwFunc = DEFW_NET;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_NET;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     if (!defwNetOptions())
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, "\n      + WEIGHT %.11g", d);
-    defwLines++;
+    defwPrintf("\n      + WEIGHT %.11g", d);
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -4012,14 +4811,14 @@ defwNetWeight(double d)
 int
 defwNetEstCap(double d)
 {
-    defwFunc = DEFW_NET;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_NET;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     if (!defwNetOptions())
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, "\n      + ESTCAP %.11g", d);
-    defwLines++;
+    defwPrintf("\n      + ESTCAP %.11g", d);
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -4027,14 +4826,14 @@ defwNetEstCap(double d)
 int
 defwNetShieldnet(const char *name)
 {
-    defwFunc = DEFW_NET;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_NET;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     if (!defwNetOptions())
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, "\n      + SHIELDNET %s", name);
-    defwLines++;
+    defwPrintf("\n      + SHIELDNET %s", name);
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -4042,15 +4841,15 @@ defwNetShieldnet(const char *name)
 int
 defwNetNoshieldStart(const char *name)
 {
-    defwFunc = DEFW_NOSHIELD;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_NOSHIELD;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     if (!defwNetOptions())
         return DEFW_BAD_ORDER;
-    fprintf(defwFile, "\n      + NOSHIELD %s", name);
+    defwPrintf("\n      + NOSHIELD %s", name);
 
-    defwState = DEFW_NOSHIELD;
-    defwLineItemCounter = 0;
+    defwCtx->defwState = DEFW_NOSHIELD;
+    defwCtx->defwLineItemCounter = 0;
     return DEFW_OK;
 }
 
@@ -4062,17 +4861,17 @@ defwNetNoshieldPoint(int        numPts,
 {
     int i;
 
-    defwFunc = DEFW_NOSHIELD;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_NOSHIELD;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_NOSHIELD)
+    if (defwCtx->defwState != DEFW_NOSHIELD)
         return DEFW_BAD_ORDER;
     for (i = 0; i < numPts; i++) {
-        if ((++defwLineItemCounter & 3) == 0) {
-            fprintf(defwFile, "\n     ");
-            defwLines++;
+        if ((++defwCtx->defwLineItemCounter & 3) == 0) {
+            defwPrintf("\n     ");
+            defwCtx->defwLines++;
         }
-        fprintf(defwFile, " ( %s %s )", pointx[i], pointy[i]);
+        defwPrintf(" ( %s %s )", pointx[i], pointy[i]);
     }
     return DEFW_OK;
 }
@@ -4081,16 +4880,16 @@ defwNetNoshieldPoint(int        numPts,
 int
 defwNetNoshieldVia(const char *name)
 {
-    defwFunc = DEFW_NOSHIELD;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_NOSHIELD;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_NOSHIELD)
+    if (defwCtx->defwState != DEFW_NOSHIELD)
         return DEFW_BAD_ORDER;
-    if ((++defwLineItemCounter & 3) == 0) {
-        fprintf(defwFile, "\n     ");
-        defwLines++;
+    if ((++defwCtx->defwLineItemCounter & 3) == 0) {
+        defwPrintf("\n     ");
+        defwCtx->defwLines++;
     }
-    fprintf(defwFile, " %s", name);
+    defwPrintf(" %s", name);
     return DEFW_OK;
 }
 
@@ -4098,12 +4897,12 @@ defwNetNoshieldVia(const char *name)
 int
 defwNetNoshieldEnd()
 {
-    defwFunc = DEFW_NET;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_NET;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_NOSHIELD)
+    if (defwCtx->defwState != DEFW_NOSHIELD)
         return DEFW_BAD_ORDER;
-    defwState = DEFW_NET;
+    defwCtx->defwState = DEFW_NET;
     return DEFW_OK;
 }
 
@@ -4111,18 +4910,18 @@ defwNetNoshieldEnd()
 int
 defwNetSubnetStart(const char *name)
 {
-    defwFunc = DEFW_SUBNET;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SUBNET;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     if (!defwNetOptions())
         return DEFW_BAD_ORDER;
     if (!name || !*name) // required
         return DEFW_BAD_DATA;
 
-    fprintf(defwFile, "\n      + SUBNET %s", name);
-    defwLines++;
-    defwState = DEFW_SUBNET;
-    defwLineItemCounter = 0;
+    defwPrintf("\n      + SUBNET %s", name);
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_SUBNET;
+    defwCtx->defwLineItemCounter = 0;
     return DEFW_OK;
 }
 
@@ -4131,19 +4930,19 @@ int
 defwNetSubnetPin(const char *compName,
                  const char *pinName)
 {
-    defwFunc = DEFW_SUBNET;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SUBNET;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_SUBNET)
+    if (defwCtx->defwState != DEFW_SUBNET)
         return DEFW_BAD_ORDER;
     if ((!compName || !*compName) || (!pinName || !*pinName)) // required
         return DEFW_BAD_DATA;
-    if ((++defwLineItemCounter & 3) == 0) {
-        fprintf(defwFile, "\n        ");
-        defwLines++;
+    if ((++defwCtx->defwLineItemCounter & 3) == 0) {
+        defwPrintf("\n        ");
+        defwCtx->defwLines++;
     }
-    fprintf(defwFile, " ( %s %s )", compName, pinName);
-    defwLines++;
+    defwPrintf(" ( %s %s )", compName, pinName);
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -4151,13 +4950,13 @@ defwNetSubnetPin(const char *compName,
 int
 defwNetSubnetEnd()
 {
-    defwFunc = DEFW_SUBNET;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SUBNET;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if ((defwState != DEFW_SUBNET) &&    // subnet does not have path 
-        (defwState != DEFW_NET_OPTIONS)) // subnet has path and path just ended 
+    if ((defwCtx->defwState != DEFW_SUBNET) &&    // subnet does not have path 
+        (defwCtx->defwState != DEFW_NET_OPTIONS)) // subnet has path and path just ended 
         return DEFW_BAD_ORDER;
-    defwState = DEFW_NET_OPTIONS;
+    defwCtx->defwState = DEFW_NET_OPTIONS;
     return DEFW_OK;
 }
 
@@ -4165,11 +4964,11 @@ defwNetSubnetEnd()
 int
 defwNetPathStart(const char *typ)
 {
-    defwFunc = DEFW_PATH;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_PATH;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (!defwNetOptions() && (defwState != DEFW_SUBNET) && // path in subnet 
-        (defwState != DEFW_PATH))      // NEW in the path, path hasn't end yet 
+    if (!defwNetOptions() && (defwCtx->defwState != DEFW_SUBNET) && // path in subnet 
+        (defwCtx->defwState != DEFW_PATH))      // NEW in the path, path hasn't end yet 
         return DEFW_BAD_ORDER;
 
     if (strcmp(typ, "NEW") && strcmp(typ, "FIXED") && strcmp(typ, "COVER") &&
@@ -4179,18 +4978,18 @@ defwNetPathStart(const char *typ)
     // The second time around for a path on this net, we
     // must start it with a new instead of a fixed...
     if (strcmp(typ, "NEW") == 0) {
-        if (defwState != DEFW_PATH)
+        if (defwCtx->defwState != DEFW_PATH)
             return DEFW_BAD_DATA;
-        fprintf(defwFile, "\n         NEW");
+        defwPrintf("\n         NEW");
     } else {
-        if (defwState == DEFW_SUBNET)
-            fprintf(defwFile, "\n      %s", typ);
+        if (defwCtx->defwState == DEFW_SUBNET)
+            defwPrintf("\n      %s", typ);
         else
-            fprintf(defwFile, "\n      + %s", typ);
+            defwPrintf("\n      + %s", typ);
     }
 
-    defwState = DEFW_PATH_START;
-    defwLineItemCounter = 0;
+    defwCtx->defwState = DEFW_PATH_START;
+    defwCtx->defwLineItemCounter = 0;
     return DEFW_OK;
 }
 
@@ -4198,16 +4997,16 @@ defwNetPathStart(const char *typ)
 int
 defwNetPathWidth(int w)
 {
-    defwFunc = DEFW_PATH;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_PATH;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PATH)
+    if (defwCtx->defwState != DEFW_PATH)
         return DEFW_BAD_ORDER;
-    if ((++defwLineItemCounter & 3) == 0) {
-        fprintf(defwFile, "\n         ");
-        defwLines++;
+    if ((++defwCtx->defwLineItemCounter & 3) == 0) {
+        defwPrintf("\n         ");
+        defwCtx->defwLines++;
     }
-    fprintf(defwFile, " %d", w);
+    defwPrintf(" %d", w);
     return DEFW_OK;
 }
 
@@ -4217,25 +5016,25 @@ defwNetPathLayer(const char *name,
                  int        isTaper,
                  const char *ruleName)
 {
-    defwFunc = DEFW_PATH;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_PATH;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PATH_START)
+    if (defwCtx->defwState != DEFW_PATH_START)
         return DEFW_BAD_ORDER;
 
     // only one, either isTaper or ruleName can be set
     if (isTaper && ruleName)
         return DEFW_BAD_DATA;
-    if ((++defwLineItemCounter & 3) == 0) {
-        fprintf(defwFile, "\n        ");
-        defwLines++;
+    if ((++defwCtx->defwLineItemCounter & 3) == 0) {
+        defwPrintf("\n        ");
+        defwCtx->defwLines++;
     }
-    fprintf(defwFile, " %s", name);
+    defwPrintf(" %s", name);
     if (isTaper)
-        fprintf(defwFile, " TAPER");
+        defwPrintf(" TAPER");
     else if (ruleName)
-        fprintf(defwFile, " TAPERRULE %s", ruleName);
-    defwState = DEFW_PATH;
+        defwPrintf(" TAPERRULE %s", ruleName);
+    defwCtx->defwState = DEFW_PATH;
     return DEFW_OK;
 }
 
@@ -4243,13 +5042,13 @@ defwNetPathLayer(const char *name,
 int
 defwNetPathStyle(int styleNum)
 {
-    defwFunc = DEFW_PATH;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_PATH;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PATH)
+    if (defwCtx->defwState != DEFW_PATH)
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, " STYLE %d", styleNum);
+    defwPrintf(" STYLE %d", styleNum);
     return DEFW_OK;
 }
 
@@ -4260,19 +5059,19 @@ defwNetPathPoint(int    numPts,
                  double *pointy)
 {
     int i;
-    defwFunc = DEFW_PATH;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_PATH;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PATH)
+    if (defwCtx->defwState != DEFW_PATH)
         return DEFW_BAD_ORDER;
 
-    printPointsNum = 0;
+    defwCtx->printPointsNum = 0;
     for (i = 0; i < numPts; i++) {
-        if ((++defwLineItemCounter & 3) == 0) {
-            fprintf(defwFile, "\n        ");
-            defwLines++;
+        if ((++defwCtx->defwLineItemCounter & 3) == 0) {
+            defwPrintf("\n        ");
+            defwCtx->defwLines++;
         }
-        printPoints(defwFile, pointx[i], pointy[i], " ", "");
+        printPoints(pointx[i], pointy[i], " ", "");
     }
     return DEFW_OK;
 }
@@ -4284,17 +5083,17 @@ defwNetPathPointWithExt(int     numPts,
                         double  *optValue)
 {
     int i;
-    defwFunc = DEFW_PATH;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_PATH;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PATH)
+    if (defwCtx->defwState != DEFW_PATH)
         return DEFW_BAD_ORDER;
     for (i = 0; i < numPts; i++) {
-        if ((++defwLineItemCounter & 3) == 0) {
-            fprintf(defwFile, "\n        ");
-            defwLines++;
+        if ((++defwCtx->defwLineItemCounter & 3) == 0) {
+            defwPrintf("\n        ");
+            defwCtx->defwLines++;
         }
-        fprintf(defwFile, " ( %.11g %.11g %.11g )", pointx[i], pointy[i], optValue[i]);
+        defwPrintPoint(" ", pointx[i], pointy[i], &optValue[i], ")");
     }
     return DEFW_OK;
 }
@@ -4302,19 +5101,19 @@ defwNetPathPointWithExt(int     numPts,
 int
 defwNetPathVia(const char *name)
 {
-    defwFunc = DEFW_PATH;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_PATH;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PATH)
+    if (defwCtx->defwState != DEFW_PATH)
         return DEFW_BAD_ORDER;
-    if ((++defwLineItemCounter & 3) == 0) {
-        fprintf(defwFile, "\n        ");
-        defwLines++;
+    if ((++defwCtx->defwLineItemCounter & 3) == 0) {
+        defwPrintf("\n        ");
+        defwCtx->defwLines++;
     }
     if (!name || !*name) // required
         return DEFW_BAD_DATA;
 
-    fprintf(defwFile, " %s", name);
+    defwPrintf(" %s", name);
     return DEFW_OK;
 }
 
@@ -4323,23 +5122,23 @@ int
 defwNetPathViaWithOrient(const char *name,
                          int        orient)
 {
-    defwFunc = DEFW_PATH;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_PATH;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PATH)
+    if (defwCtx->defwState != DEFW_PATH)
         return DEFW_BAD_ORDER;
-    if ((++defwLineItemCounter & 3) == 0) {
-        fprintf(defwFile, "\n        ");
-        defwLines++;
+    if ((++defwCtx->defwLineItemCounter & 3) == 0) {
+        defwPrintf("\n        ");
+        defwCtx->defwLines++;
     }
 
     if (!name || !*name) // required
         return DEFW_BAD_DATA;
 
     if (orient == -1)
-        fprintf(defwFile, " %s", name);
+        defwPrintf(" %s", name);
     else if (orient >= 0 && orient <= 7)
-        fprintf(defwFile, " %s %s", name, defwOrient(orient));
+        defwPrintf(" %s %s", name, defwOrient(orient));
     else
         return DEFW_BAD_DATA;
     return DEFW_OK;
@@ -4350,43 +5149,43 @@ int
 defwNetPathViaWithOrientStr(const char  *name,
                             const char  *orient)
 {
-    defwFunc = DEFW_PATH;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_PATH;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PATH)
+    if (defwCtx->defwState != DEFW_PATH)
         return DEFW_BAD_ORDER;
-    if ((++defwLineItemCounter & 3) == 0) {
-        fprintf(defwFile, "\n        ");
-        defwLines++;
+    if ((++defwCtx->defwLineItemCounter & 3) == 0) {
+        defwPrintf("\n        ");
+        defwCtx->defwLines++;
     }
 
     if (!name || !*name) // required
         return DEFW_BAD_DATA;
 
     if (!orient || !*orient)
-        fprintf(defwFile, " %s", name);
+        defwPrintf(" %s", name);
     else
-        fprintf(defwFile, " %s %s", name, orient);
+        defwPrintf(" %s %s", name, orient);
     return DEFW_OK;
 }
 
 int
 defwNetPathMask(int colorMask)
 {
-    if (defVersionNum < 5.8) {
+    if (defwCtx->defVersionNum < 5.8) {
         return DEFW_WRONG_VERSION;
     }
 
-    defwFunc = DEFW_PATH;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_PATH;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PATH)
+    if (defwCtx->defwState != DEFW_PATH)
         return DEFW_BAD_ORDER;
-    if ((++defwLineItemCounter & 3) == 0) {
-        fprintf(defwFile, "\n     ");
-        defwLines++;
+    if ((++defwCtx->defwLineItemCounter & 3) == 0) {
+        defwPrintf("\n     ");
+        defwCtx->defwLines++;
     }
-    fprintf(defwFile, " MASK %d", colorMask);
+    defwPrintf(" MASK %d", colorMask);
     return DEFW_OK;
 }
 
@@ -4396,21 +5195,21 @@ defwNetPathRect(int deltaX1,
                 int deltaX2,
                 int deltaY2)
 {
-    if (defVersionNum < 5.8)
+    if (defwCtx->defVersionNum < 5.8)
         return DEFW_WRONG_VERSION;
 
-    defwFunc = DEFW_PATH;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_PATH;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PATH)
+    if (defwCtx->defwState != DEFW_PATH)
         return DEFW_BAD_ORDER;
 
-    if ((++defwLineItemCounter & 3) == 0) {
-        fprintf(defwFile, "\n     ");
-        defwLines++;
+    if ((++defwCtx->defwLineItemCounter & 3) == 0) {
+        defwPrintf("\n     ");
+        defwCtx->defwLines++;
     }
 
-    fprintf(defwFile, " RECT ( %d %d %d %d )", deltaX1, deltaY1, deltaX2, deltaY2);
+    defwPrintf(" RECT ( %d %d %d %d )", deltaX1, deltaY1, deltaX2, deltaY2);
 
     return DEFW_OK;
 }
@@ -4419,31 +5218,31 @@ int
 defwNetPathVirtual(int  x,
                    int  y)
 {
-    if (defVersionNum < 5.8)
+    if (defwCtx->defVersionNum < 5.8)
         return DEFW_WRONG_VERSION;
 
-    defwFunc = DEFW_PATH;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_PATH;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PATH)
+    if (defwCtx->defwState != DEFW_PATH)
         return DEFW_BAD_ORDER;
-    if ((++defwLineItemCounter & 3) == 0) {
-        fprintf(defwFile, "\n     ");
-        defwLines++;
+    if ((++defwCtx->defwLineItemCounter & 3) == 0) {
+        defwPrintf("\n     ");
+        defwCtx->defwLines++;
     }
-    fprintf(defwFile, " VIRTUAL ( %d %d )", x, y);
+    defwPrintf(" VIRTUAL ( %d %d )", x, y);
     return DEFW_OK;
 }
 
 int
 defwNetPathEnd()
 {
-    defwFunc = DEFW_PATH;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_PATH;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_PATH)
+    if (defwCtx->defwState != DEFW_PATH)
         return DEFW_BAD_ORDER;
-    defwState = DEFW_NET_OPTIONS;
+    defwCtx->defwState = DEFW_NET_OPTIONS;
     return DEFW_OK;
 }
 
@@ -4451,15 +5250,15 @@ defwNetPathEnd()
 int
 defwNetEndOneNet()
 {
-    defwFunc = DEFW_NET_ENDNET;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_NET_ENDNET;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     if (!defwNetOptions())
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, " ;\n");
-    defwLines++;
-    defwState = DEFW_NET_ENDNET;
+    defwPrintf(" ;\n");
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_NET_ENDNET;
 
     return DEFW_OK;
 }
@@ -4468,23 +5267,24 @@ defwNetEndOneNet()
 int
 defwEndNets()
 {
-    defwFunc = DEFW_NET_END;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_NET_END;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_NET_START && defwState != DEFW_NET_OPTIONS &&
-        defwState != DEFW_NET &&
-        defwState != DEFW_NET_ENDNET) // last state is a net 
+    if (defwCtx->defwState != DEFW_NET_START && defwCtx->defwState != DEFW_NET_OPTIONS &&
+        defwCtx->defwState != DEFW_NET &&
+        defwCtx->defwState != DEFW_NET_ENDNET) // last state is a net 
         return DEFW_BAD_ORDER;
-    if (defwCounter > 0)
+    if (defwCtx->defwCounter > 0)
         return DEFW_BAD_DATA;
-    else if (defwCounter < 0)
+    else if (defwCtx->defwCounter < 0)
         return DEFW_TOO_MANY_STMS;
 
-    fprintf(defwFile, "END NETS\n\n");
-    defwLines++;
+    defwPrintf("END NETS\n\n");
+    defwCtx->defwLines++;
 
-    defwState = DEFW_NET_END;
-    defwDidNets = 1;
+    defwCtx->defwState = DEFW_NET_END;
+    defwCtx->defwDidNets = 1;
+    defwTraceSectionEnd("NETS");
     return DEFW_OK;
 }
 
@@ -4492,23 +5292,24 @@ defwEndNets()
 int
 defwStartIOTimings(int count)
 {
-    defwObsoleteNum = DEFW_IOTIMING_START;
-    defwFunc = DEFW_IOTIMING_START;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwObsoleteNum = DEFW_IOTIMING_START;
+    defwCtx->defwFunc = DEFW_IOTIMING_START;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (!defwDidNets)
+    if (!defwCtx->defwDidNets)
         return DEFW_BAD_ORDER;
-    if ((defwState >= DEFW_IOTIMING_START) &&
-        (defwState >= DEFW_IOTIMING_END))
+    if ((defwCtx->defwState >= DEFW_IOTIMING_START) &&
+        (defwCtx->defwState >= DEFW_IOTIMING_END))
         return DEFW_BAD_ORDER;
-    if (defVersionNum >= 5.4)
+    if (defwCtx->defVersionNum >= 5.4)
         return DEFW_OBSOLETE;
 
-    fprintf(defwFile, "IOTIMINGS %d ;\n", count);
-    defwLines++;
+    defwPrintf("IOTIMINGS %d ;\n", count);
+    defwCtx->defwLines++;
 
-    defwCounter = count;
-    defwState = DEFW_IOTIMING_START;
+    defwCtx->defwCounter = count;
+    defwCtx->defwState = DEFW_IOTIMING_START;
+    defwTraceSectionStart();
     return DEFW_OK;
 }
 
@@ -4517,20 +5318,20 @@ int
 defwIOTiming(const char *instance,
              const char *pin)
 {
-    defwFunc = DEFW_IOTIMING;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_IOTIMING;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_IOTIMING_START &&
-        defwState != DEFW_IOTIMING)
+    if (defwCtx->defwState != DEFW_IOTIMING_START &&
+        defwCtx->defwState != DEFW_IOTIMING)
         return DEFW_BAD_ORDER;
 
-    if (defwState == DEFW_IOTIMING)
-        fprintf(defwFile, " ;\n");   // from previous statement
-    fprintf(defwFile, "   - ( %s %s )\n", instance, pin);
-    defwLines++;
+    if (defwCtx->defwState == DEFW_IOTIMING)
+        defwPrintf(" ;\n");   // from previous statement
+    defwPrintf("   - ( %s %s )\n", instance, pin);
+    defwCtx->defwLines++;
 
-    defwCounter--;
-    defwState = DEFW_IOTIMING;
+    defwCtx->defwCounter--;
+    defwCtx->defwState = DEFW_IOTIMING;
     return DEFW_OK;
 }
 
@@ -4539,19 +5340,19 @@ defwIOTimingVariable(const char *riseFall,
                      int        num1,
                      int        num2)
 {
-    defwFunc = DEFW_IOTIMING;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_IOTIMING;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_IOTIMING)
+    if (defwCtx->defwState != DEFW_IOTIMING)
         return DEFW_BAD_ORDER;
 
     if (strcmp(riseFall, "RISE") &&
         strcmp(riseFall, "FALL"))
         return DEFW_BAD_DATA;
 
-    fprintf(defwFile, "      + %s VARIABLE %d %d\n", riseFall,
+    defwPrintf("      + %s VARIABLE %d %d\n", riseFall,
             num1, num2);
-    defwLines++;
+    defwCtx->defwLines++;
 
     return DEFW_OK;
 }
@@ -4561,19 +5362,19 @@ defwIOTimingSlewrate(const char *riseFall,
                      int        num1,
                      int        num2)
 {
-    defwFunc = DEFW_IOTIMING;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_IOTIMING;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_IOTIMING)
+    if (defwCtx->defwState != DEFW_IOTIMING)
         return DEFW_BAD_ORDER;
 
     if (strcmp(riseFall, "RISE") &&
         strcmp(riseFall, "FALL"))
         return DEFW_BAD_DATA;
 
-    fprintf(defwFile, "      + %s SLEWRATE %d %d\n", riseFall,
+    defwPrintf("      + %s SLEWRATE %d %d\n", riseFall,
             num1, num2);
-    defwLines++;
+    defwCtx->defwLines++;
 
     return DEFW_OK;
 }
@@ -4584,24 +5385,24 @@ defwIOTimingDrivecell(const char    *name,
                       const char    *toPin,
                       int           numDrivers)
 {
-    defwFunc = DEFW_IOTIMING;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_IOTIMING;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_IOTIMING)
+    if (defwCtx->defwState != DEFW_IOTIMING)
         return DEFW_BAD_ORDER;
     if (!name || !*name) // required
         return DEFW_BAD_DATA;
 
-    fprintf(defwFile, "      + DRIVECELL %s ", name);
+    defwPrintf("      + DRIVECELL %s ", name);
     if (fromPin && (!toPin || !*toPin)) // if have fromPin, toPin is required
         return DEFW_BAD_DATA;
     if (fromPin)
-        fprintf(defwFile, "FROMPIN %s ", fromPin);
+        defwPrintf("FROMPIN %s ", fromPin);
     if (toPin)
-        fprintf(defwFile, "TOPIN %s ", toPin);
+        defwPrintf("TOPIN %s ", toPin);
     if (numDrivers)
-        fprintf(defwFile, "PARALLEL %d ", numDrivers);
-    defwLines++;
+        defwPrintf("PARALLEL %d ", numDrivers);
+    defwCtx->defwLines++;
 
     return DEFW_OK;
 }
@@ -4610,14 +5411,14 @@ defwIOTimingDrivecell(const char    *name,
 int
 defwIOTimingCapacitance(double num)
 {
-    defwFunc = DEFW_IOTIMING;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_IOTIMING;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_IOTIMING)
+    if (defwCtx->defwState != DEFW_IOTIMING)
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, "      + CAPACITANCE %.11g", num);
-    defwLines++;
+    defwPrintf("      + CAPACITANCE %.11g", num);
+    defwCtx->defwLines++;
 
     return DEFW_OK;
 }
@@ -4625,22 +5426,23 @@ defwIOTimingCapacitance(double num)
 int
 defwEndIOTimings()
 {
-    defwFunc = DEFW_IOTIMING_END;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_IOTIMING_END;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_IOTIMING_START && defwState != DEFW_IOTIMING)
+    if (defwCtx->defwState != DEFW_IOTIMING_START && defwCtx->defwState != DEFW_IOTIMING)
         return DEFW_BAD_ORDER;
-    if (defwCounter > 0)
+    if (defwCtx->defwCounter > 0)
         return DEFW_BAD_DATA;
-    else if (defwCounter < 0)
+    else if (defwCtx->defwCounter < 0)
         return DEFW_TOO_MANY_STMS;
 
-    if (defwState == DEFW_IOTIMING)
-        fprintf(defwFile, " ;\n");   // from previous statement
-    fprintf(defwFile, "END IOTIMINGS\n\n");
-    defwLines++;
+    if (defwCtx->defwState == DEFW_IOTIMING)
+        defwPrintf(" ;\n");   // from previous statement
+    defwPrintf("END IOTIMINGS\n\n");
+    defwCtx->defwLines++;
 
-    defwState = DEFW_IOTIMING_END;
+    defwCtx->defwState = DEFW_IOTIMING_END;
+    defwTraceSectionEnd("IOTIMINGS");
     return DEFW_OK;
 }
 
@@ -4648,42 +5450,43 @@ defwEndIOTimings()
 int
 defwStartScanchains(int count)
 {
-    defwFunc = DEFW_SCANCHAIN_START;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SCANCHAIN_START;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (!defwDidNets)
+    if (!defwCtx->defwDidNets)
         return DEFW_BAD_ORDER;
-    if ((defwState >= DEFW_SCANCHAIN_START) &&
-        (defwState <= DEFW_SCANCHAIN_END))
+    if ((defwCtx->defwState >= DEFW_SCANCHAIN_START) &&
+        (defwCtx->defwState <= DEFW_SCANCHAIN_END))
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, "SCANCHAINS %d ;\n", count);
-    defwLines++;
+    defwPrintf("SCANCHAINS %d ;\n", count);
+    defwCtx->defwLines++;
 
-    defwState = DEFW_SCANCHAIN_START;
-    defwCounter = count;
+    defwCtx->defwState = DEFW_SCANCHAIN_START;
+    defwCtx->defwCounter = count;
+    defwTraceSectionStart();
     return DEFW_OK;
 }
 
 int
 defwScanchain(const char *name)
 {
-    defwFunc = DEFW_SCANCHAIN;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SCANCHAIN;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_SCANCHAIN_START && defwState != DEFW_SCANCHAIN &&
-        defwState != DEFW_SCAN_FLOATING && defwState != DEFW_SCAN_ORDERED)
+    if (defwCtx->defwState != DEFW_SCANCHAIN_START && defwCtx->defwState != DEFW_SCANCHAIN &&
+        defwCtx->defwState != DEFW_SCAN_FLOATING && defwCtx->defwState != DEFW_SCAN_ORDERED)
         return DEFW_BAD_ORDER;
 
-    if (defwState == DEFW_SCANCHAIN || defwState == DEFW_SCAN_FLOATING ||
-        defwState == DEFW_SCAN_ORDERED) // put a ; for the previous scanchain
-        fprintf(defwFile, " ;\n");
+    if (defwCtx->defwState == DEFW_SCANCHAIN || defwCtx->defwState == DEFW_SCAN_FLOATING ||
+        defwCtx->defwState == DEFW_SCAN_ORDERED) // put a ; for the previous scanchain
+        defwPrintf(" ;\n");
 
-    fprintf(defwFile, "   - %s", name);
-    defwLines++;
+    defwPrintf("   - %s", name);
+    defwCtx->defwLines++;
 
-    defwCounter--;
-    defwState = DEFW_SCANCHAIN;
+    defwCtx->defwCounter--;
+    defwCtx->defwState = DEFW_SCANCHAIN;
     return DEFW_OK;
 }
 
@@ -4693,15 +5496,15 @@ defwScanchainCommonscanpins(const char  *inst1,
                             const char  *inst2,
                             const char  *pin2)
 {
-    defwFunc = DEFW_SCANCHAIN;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SCANCHAIN;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_SCANCHAIN_START && defwState != DEFW_SCANCHAIN &&
-        defwState != DEFW_SCAN_FLOATING && defwState != DEFW_SCAN_ORDERED)
+    if (defwCtx->defwState != DEFW_SCANCHAIN_START && defwCtx->defwState != DEFW_SCANCHAIN &&
+        defwCtx->defwState != DEFW_SCAN_FLOATING && defwCtx->defwState != DEFW_SCAN_ORDERED)
         return DEFW_BAD_ORDER;
 
     if (!inst1) {     // if inst1 is null, nothing will be written
-        defwState = DEFW_SCANCHAIN;
+        defwCtx->defwState = DEFW_SCANCHAIN;
         return DEFW_OK;
     }
 
@@ -4711,7 +5514,7 @@ defwScanchainCommonscanpins(const char  *inst1,
     if (inst1 && !pin1)        // pin1 can't be NULL if inst1 is not
         return DEFW_BAD_DATA;
 
-    fprintf(defwFile, "\n      + COMMONSCANPINS ( %s %s )", inst1, pin1);
+    defwPrintf("\n      + COMMONSCANPINS ( %s %s )", inst1, pin1);
 
     if (inst2 && !pin2)        // pin2 can't be NULL if inst2 is not
         return DEFW_BAD_DATA;
@@ -4720,11 +5523,11 @@ defwScanchainCommonscanpins(const char  *inst1,
         return DEFW_BAD_DATA;
 
     if (inst2)
-        fprintf(defwFile, " ( %s %s )", inst2, pin2);
+        defwPrintf(" ( %s %s )", inst2, pin2);
 
-    defwLines++;
+    defwCtx->defwLines++;
 
-    defwState = DEFW_SCANCHAIN;
+    defwCtx->defwState = DEFW_SCANCHAIN;
     return DEFW_OK;
 }
 
@@ -4732,22 +5535,22 @@ int
 defwScanchainPartition(const char   *name,
                        int          maxBits)
 {
-    defwFunc = DEFW_SCANCHAIN;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SCANCHAIN;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_SCANCHAIN_START && defwState != DEFW_SCANCHAIN &&
-        defwState != DEFW_SCAN_FLOATING && defwState != DEFW_SCAN_ORDERED)
+    if (defwCtx->defwState != DEFW_SCANCHAIN_START && defwCtx->defwState != DEFW_SCANCHAIN &&
+        defwCtx->defwState != DEFW_SCAN_FLOATING && defwCtx->defwState != DEFW_SCAN_ORDERED)
         return DEFW_BAD_ORDER;
 
     if (!name || !*name)        // require
         return DEFW_BAD_DATA;
 
-    fprintf(defwFile, "\n      + PARTITION %s", name);
+    defwPrintf("\n      + PARTITION %s", name);
     if (maxBits != -1)
-        fprintf(defwFile, " MAXBITS %d", maxBits);
-    defwLines++;
+        defwPrintf(" MAXBITS %d", maxBits);
+    defwCtx->defwLines++;
 
-    defwState = DEFW_SCANCHAIN;
+    defwCtx->defwState = DEFW_SCANCHAIN;
     return DEFW_OK;
 }
 
@@ -4755,22 +5558,22 @@ int
 defwScanchainStart(const char   *inst,
                    const char   *pin)
 {
-    defwFunc = DEFW_SCANCHAIN;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SCANCHAIN;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_SCANCHAIN_START && defwState != DEFW_SCANCHAIN &&
-        defwState != DEFW_SCAN_FLOATING && defwState != DEFW_SCAN_ORDERED)
+    if (defwCtx->defwState != DEFW_SCANCHAIN_START && defwCtx->defwState != DEFW_SCANCHAIN &&
+        defwCtx->defwState != DEFW_SCAN_FLOATING && defwCtx->defwState != DEFW_SCAN_ORDERED)
         return DEFW_BAD_ORDER;
 
     if (!inst || !*inst)        // require
         return DEFW_BAD_DATA;
 
-    fprintf(defwFile, "\n      + START %s", inst);
+    defwPrintf("\n      + START %s", inst);
     if (pin)
-        fprintf(defwFile, " %s", pin);
-    defwLines++;
+        defwPrintf(" %s", pin);
+    defwCtx->defwLines++;
 
-    defwState = DEFW_SCANCHAIN;
+    defwCtx->defwState = DEFW_SCANCHAIN;
     return DEFW_OK;
 }
 
@@ -4779,22 +5582,22 @@ int
 defwScanchainStop(const char    *inst,
                   const char    *pin)
 {
-    defwFunc = DEFW_SCANCHAIN;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SCANCHAIN;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_SCANCHAIN_START && defwState != DEFW_SCANCHAIN &&
-        defwState != DEFW_SCAN_FLOATING && defwState != DEFW_SCAN_ORDERED)
+    if (defwCtx->defwState != DEFW_SCANCHAIN_START && defwCtx->defwState != DEFW_SCANCHAIN &&
+        defwCtx->defwState != DEFW_SCAN_FLOATING && defwCtx->defwState != DEFW_SCAN_ORDERED)
         return DEFW_BAD_ORDER;
 
     if (!inst || !*inst)        // require
         return DEFW_BAD_DATA;
 
-    fprintf(defwFile, "\n      + STOP %s", inst);
+    defwPrintf("\n      + STOP %s", inst);
     if (pin)
-        fprintf(defwFile, " %s", pin);
-    defwLines++;
+        defwPrintf(" %s", pin);
+    defwCtx->defwLines++;
 
-    defwState = DEFW_SCANCHAIN;
+    defwCtx->defwState = DEFW_SCANCHAIN;
     return DEFW_OK;
 }
 
@@ -4805,11 +5608,11 @@ defwScanchainFloating(const char    *name,
                       const char    *inst2,
                       const char    *pin2)
 {
-    defwFunc = DEFW_SCAN_FLOATING;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SCAN_FLOATING;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_SCANCHAIN_START && defwState != DEFW_SCANCHAIN &&
-        defwState != DEFW_SCAN_FLOATING && defwState != DEFW_SCAN_ORDERED)
+    if (defwCtx->defwState != DEFW_SCANCHAIN_START && defwCtx->defwState != DEFW_SCANCHAIN &&
+        defwCtx->defwState != DEFW_SCAN_FLOATING && defwCtx->defwState != DEFW_SCAN_ORDERED)
         return DEFW_BAD_ORDER;
 
     if (!name || !*name)        // require
@@ -4823,19 +5626,19 @@ defwScanchainFloating(const char    *name,
     if (inst2 && !pin2)
         return DEFW_BAD_DATA;
 
-    if (defwState != DEFW_SCAN_FLOATING)
-        fprintf(defwFile, "\n      + FLOATING");
+    if (defwCtx->defwState != DEFW_SCAN_FLOATING)
+        defwPrintf("\n      + FLOATING");
     else
-        fprintf(defwFile, "\n         ");
+        defwPrintf("\n         ");
 
-    fprintf(defwFile, " %s", name);
+    defwPrintf(" %s", name);
     if (inst1)
-        fprintf(defwFile, " ( %s %s )", inst1, pin1);
+        defwPrintf(" ( %s %s )", inst1, pin1);
     if (inst2)
-        fprintf(defwFile, " ( %s %s )", inst2, pin2);
+        defwPrintf(" ( %s %s )", inst2, pin2);
 
-    defwState = DEFW_SCAN_FLOATING;
-    defwLines++;
+    defwCtx->defwState = DEFW_SCAN_FLOATING;
+    defwCtx->defwLines++;
 
     return DEFW_OK;
 }
@@ -4848,11 +5651,11 @@ defwScanchainFloatingBits(const char    *name,
                           const char    *pin2,
                           int           bits)
 {
-    defwFunc = DEFW_SCAN_FLOATING;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SCAN_FLOATING;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_SCANCHAIN_START && defwState != DEFW_SCANCHAIN &&
-        defwState != DEFW_SCAN_FLOATING && defwState != DEFW_SCAN_ORDERED)
+    if (defwCtx->defwState != DEFW_SCANCHAIN_START && defwCtx->defwState != DEFW_SCANCHAIN &&
+        defwCtx->defwState != DEFW_SCAN_FLOATING && defwCtx->defwState != DEFW_SCAN_ORDERED)
         return DEFW_BAD_ORDER;
 
     if (!name || !*name)        // require
@@ -4866,21 +5669,21 @@ defwScanchainFloatingBits(const char    *name,
     if (inst2 && !pin2)
         return DEFW_BAD_DATA;
 
-    if (defwState != DEFW_SCAN_FLOATING)
-        fprintf(defwFile, "\n      + FLOATING");
+    if (defwCtx->defwState != DEFW_SCAN_FLOATING)
+        defwPrintf("\n      + FLOATING");
     else
-        fprintf(defwFile, "\n         ");
+        defwPrintf("\n         ");
 
-    fprintf(defwFile, " %s", name);
+    defwPrintf(" %s", name);
     if (inst1)
-        fprintf(defwFile, " ( %s %s )", inst1, pin1);
+        defwPrintf(" ( %s %s )", inst1, pin1);
     if (inst2)
-        fprintf(defwFile, " ( %s %s )", inst2, pin2);
+        defwPrintf(" ( %s %s )", inst2, pin2);
     if (bits != -1)
-        fprintf(defwFile, " ( BITS %d )", bits);
+        defwPrintf(" ( BITS %d )", bits);
 
-    defwState = DEFW_SCAN_FLOATING;
-    defwLines++;
+    defwCtx->defwState = DEFW_SCAN_FLOATING;
+    defwCtx->defwLines++;
 
     return DEFW_OK;
 }
@@ -4896,11 +5699,11 @@ defwScanchainOrdered(const char *name1,
                      const char *inst4,
                      const char *pin4)
 {
-    defwFunc = DEFW_SCAN_ORDERED;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SCAN_ORDERED;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_SCANCHAIN_START && defwState != DEFW_SCANCHAIN &&
-        defwState != DEFW_SCAN_FLOATING && defwState != DEFW_SCAN_ORDERED)
+    if (defwCtx->defwState != DEFW_SCANCHAIN_START && defwCtx->defwState != DEFW_SCANCHAIN &&
+        defwCtx->defwState != DEFW_SCAN_FLOATING && defwCtx->defwState != DEFW_SCAN_ORDERED)
         return DEFW_BAD_ORDER;
 
     if (!name1 || !*name1)        // require
@@ -4913,7 +5716,7 @@ defwScanchainOrdered(const char *name1,
         return DEFW_BAD_DATA;
     if (inst2 && !pin2)
         return DEFW_BAD_DATA;
-    if (defwState != DEFW_SCAN_ORDERED) {  // 1st time require both name1 & name2
+    if (defwCtx->defwState != DEFW_SCAN_ORDERED) {  // 1st time require both name1 & name2
         if (!name2 || !*name2)        // require
             return DEFW_BAD_DATA;
         if (inst3 && strcmp(inst3, "IN") && strcmp(inst3, "OUT"))
@@ -4926,28 +5729,28 @@ defwScanchainOrdered(const char *name1,
             return DEFW_BAD_DATA;
     }
 
-    if (defwState != DEFW_SCAN_ORDERED)
-        fprintf(defwFile, "\n      + ORDERED");
+    if (defwCtx->defwState != DEFW_SCAN_ORDERED)
+        defwPrintf("\n      + ORDERED");
     else
-        fprintf(defwFile, "\n         ");
+        defwPrintf("\n         ");
 
-    fprintf(defwFile, " %s", name1);
+    defwPrintf(" %s", name1);
     if (inst1)
-        fprintf(defwFile, " ( %s %s )", inst1, pin1);
+        defwPrintf(" ( %s %s )", inst1, pin1);
     if (inst2)
-        fprintf(defwFile, " ( %s %s )", inst2, pin2);
-    defwLines++;
+        defwPrintf(" ( %s %s )", inst2, pin2);
+    defwCtx->defwLines++;
 
     if (name2) {
-        fprintf(defwFile, "\n          %s", name2);
+        defwPrintf("\n          %s", name2);
         if (inst3)
-            fprintf(defwFile, " ( %s %s )", inst3, pin3);
+            defwPrintf(" ( %s %s )", inst3, pin3);
         if (inst4)
-            fprintf(defwFile, " ( %s %s )", inst4, pin4);
-        defwLines++;
+            defwPrintf(" ( %s %s )", inst4, pin4);
+        defwCtx->defwLines++;
     }
 
-    defwState = DEFW_SCAN_ORDERED;
+    defwCtx->defwState = DEFW_SCAN_ORDERED;
 
     return DEFW_OK;
 }
@@ -4966,11 +5769,11 @@ defwScanchainOrderedBits(const char *name1,
                          const char *pin4,
                          int        bits2)
 {
-    defwFunc = DEFW_SCAN_ORDERED;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SCAN_ORDERED;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_SCANCHAIN_START && defwState != DEFW_SCANCHAIN &&
-        defwState != DEFW_SCAN_FLOATING && defwState != DEFW_SCAN_ORDERED)
+    if (defwCtx->defwState != DEFW_SCANCHAIN_START && defwCtx->defwState != DEFW_SCANCHAIN &&
+        defwCtx->defwState != DEFW_SCAN_FLOATING && defwCtx->defwState != DEFW_SCAN_ORDERED)
         return DEFW_BAD_ORDER;
 
     if (!name1 || !*name1)        // require
@@ -4983,7 +5786,7 @@ defwScanchainOrderedBits(const char *name1,
         return DEFW_BAD_DATA;
     if (inst2 && !pin2)
         return DEFW_BAD_DATA;
-    if (defwState != DEFW_SCAN_ORDERED) {  // 1st time require both name1 & name2
+    if (defwCtx->defwState != DEFW_SCAN_ORDERED) {  // 1st time require both name1 & name2
         if (!name2 || !*name2)        // require
             return DEFW_BAD_DATA;
         if (inst3 && strcmp(inst3, "IN") && strcmp(inst3, "OUT"))
@@ -4996,32 +5799,32 @@ defwScanchainOrderedBits(const char *name1,
             return DEFW_BAD_DATA;
     }
 
-    if (defwState != DEFW_SCAN_ORDERED)
-        fprintf(defwFile, "\n      + ORDERED");
+    if (defwCtx->defwState != DEFW_SCAN_ORDERED)
+        defwPrintf("\n      + ORDERED");
     else
-        fprintf(defwFile, "\n         ");
+        defwPrintf("\n         ");
 
-    fprintf(defwFile, " %s", name1);
+    defwPrintf(" %s", name1);
     if (inst1)
-        fprintf(defwFile, " ( %s %s )", inst1, pin1);
+        defwPrintf(" ( %s %s )", inst1, pin1);
     if (inst2)
-        fprintf(defwFile, " ( %s %s )", inst2, pin2);
+        defwPrintf(" ( %s %s )", inst2, pin2);
     if (bits1 != -1)
-        fprintf(defwFile, " ( BITS %d )", bits1);
-    defwLines++;
+        defwPrintf(" ( BITS %d )", bits1);
+    defwCtx->defwLines++;
 
     if (name2) {
-        fprintf(defwFile, "\n          %s", name2);
+        defwPrintf("\n          %s", name2);
         if (inst3)
-            fprintf(defwFile, " ( %s %s )", inst3, pin3);
+            defwPrintf(" ( %s %s )", inst3, pin3);
         if (inst4)
-            fprintf(defwFile, " ( %s %s )", inst4, pin4);
+            defwPrintf(" ( %s %s )", inst4, pin4);
         if (bits2 != -1)
-            fprintf(defwFile, " ( BITS %d )", bits2);
-        defwLines++;
+            defwPrintf(" ( BITS %d )", bits2);
+        defwCtx->defwLines++;
     }
 
-    defwState = DEFW_SCAN_ORDERED;
+    defwCtx->defwState = DEFW_SCAN_ORDERED;
 
     return DEFW_OK;
 }
@@ -5029,80 +5832,82 @@ defwScanchainOrderedBits(const char *name1,
 int
 defwEndScanchain()
 {
-    defwFunc = DEFW_SCANCHAIN_END;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SCANCHAIN_END;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_SCANCHAIN_START && defwState != DEFW_SCAN_ORDERED &&
-        defwState != DEFW_SCAN_FLOATING && defwState != DEFW_SCANCHAIN)
+    if (defwCtx->defwState != DEFW_SCANCHAIN_START && defwCtx->defwState != DEFW_SCAN_ORDERED &&
+        defwCtx->defwState != DEFW_SCAN_FLOATING && defwCtx->defwState != DEFW_SCANCHAIN)
         return DEFW_BAD_ORDER;
 
-    if (defwState != DEFW_SCANCHAIN_START)  // from previous statement
-        fprintf(defwFile, " ;\n");
+    if (defwCtx->defwState != DEFW_SCANCHAIN_START)  // from previous statement
+        defwPrintf(" ;\n");
 
-    if (defwCounter > 0)
+    if (defwCtx->defwCounter > 0)
         return DEFW_BAD_DATA;
-    else if (defwCounter < 0)
+    else if (defwCtx->defwCounter < 0)
         return DEFW_TOO_MANY_STMS;
 
-    fprintf(defwFile, "END SCANCHAINS\n\n");
-    defwLines++;
+    defwPrintf("END SCANCHAINS\n\n");
+    defwCtx->defwLines++;
 
-    defwState = DEFW_SCANCHAIN_END;
+    defwCtx->defwState = DEFW_SCANCHAIN_END;
+    defwTraceSectionEnd("SCANCHAINS");
     return DEFW_OK;
 }
 
 int
 defwStartConstraints(int count)
 {
-    defwObsoleteNum = DEFW_FPC_START;
-    defwFunc = DEFW_FPC_START;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwObsoleteNum = DEFW_FPC_START;
+    defwCtx->defwFunc = DEFW_FPC_START;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if ((defwState >= DEFW_FPC_START) && (defwState <= DEFW_FPC_END))
+    if ((defwCtx->defwState >= DEFW_FPC_START) && (defwCtx->defwState <= DEFW_FPC_END))
         return DEFW_BAD_ORDER;
-    if (defVersionNum >= 5.4)
+    if (defwCtx->defVersionNum >= 5.4)
         return DEFW_OBSOLETE;
 
-    fprintf(defwFile, "CONSTRAINTS %d ;\n", count);
-    defwLines++;
+    defwPrintf("CONSTRAINTS %d ;\n", count);
+    defwCtx->defwLines++;
 
-    defwState = DEFW_FPC_START;
-    defwCounter = count;
+    defwCtx->defwState = DEFW_FPC_START;
+    defwCtx->defwCounter = count;
+    defwTraceSectionStart();
     return DEFW_OK;
 }
 
 int
 defwConstraintOperand()
 {
-    defwFunc = DEFW_FPC_OPER;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_FPC_OPER;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_FPC_START && defwState != DEFW_FPC)
+    if (defwCtx->defwState != DEFW_FPC_START && defwCtx->defwState != DEFW_FPC)
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, "   -");
-    defwCounter--;
-    defwFPC = 0;
-    defwState = DEFW_FPC_OPER;
+    defwPrintf("   -");
+    defwCtx->defwCounter--;
+    defwCtx->defwFPC = 0;
+    defwCtx->defwState = DEFW_FPC_OPER;
     return DEFW_OK;
 }
 
 int
 defwConstraintOperandNet(const char *netName)
 {
-    defwFunc = DEFW_FPC_OPER;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_FPC_OPER;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_FPC_OPER && defwState != DEFW_FPC_OPER_SUM)
+    if (defwCtx->defwState != DEFW_FPC_OPER && defwCtx->defwState != DEFW_FPC_OPER_SUM)
         return DEFW_BAD_ORDER;          // net can be within SUM
 
     if (!netName || !*netName)        // require
         return DEFW_BAD_DATA;
-    if (defwFPC > 0)
-        fprintf(defwFile, " ,");
-    if (defwState == DEFW_FPC_OPER_SUM)
-        defwFPC++;
-    fprintf(defwFile, " NET %s", netName);
+    if (defwCtx->defwFPC > 0)
+        defwPrintf(" ,");
+    if (defwCtx->defwState == DEFW_FPC_OPER_SUM)
+        defwCtx->defwFPC++;
+    defwPrintf(" NET %s", netName);
     return DEFW_OK;
 }
 
@@ -5112,49 +5917,49 @@ defwConstraintOperandPath(const char    *comp1,
                           const char    *comp2,
                           const char    *toPin)
 {
-    defwFunc = DEFW_FPC_OPER;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_FPC_OPER;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_FPC_OPER && defwState != DEFW_FPC_OPER_SUM)
+    if (defwCtx->defwState != DEFW_FPC_OPER && defwCtx->defwState != DEFW_FPC_OPER_SUM)
         return DEFW_BAD_ORDER;          // path can be within SUM
 
     if ((comp1 == 0) || (*comp1 == 0) || (fromPin == 0) || (*fromPin == 0) ||
         (comp2 == 0) || (*comp2 == 0) || (toPin == 0) || (*toPin == 0)) // require
         return DEFW_BAD_DATA;
-    if (defwFPC > 0)
-        fprintf(defwFile, " ,");
-    if (defwState == DEFW_FPC_OPER_SUM)
-        defwFPC++;
-    fprintf(defwFile, " PATH %s %s %s %s", comp1, fromPin, comp2, toPin);
+    if (defwCtx->defwFPC > 0)
+        defwPrintf(" ,");
+    if (defwCtx->defwState == DEFW_FPC_OPER_SUM)
+        defwCtx->defwFPC++;
+    defwPrintf(" PATH %s %s %s %s", comp1, fromPin, comp2, toPin);
     return DEFW_OK;
 }
 
 int
 defwConstraintOperandSum()
 {
-    defwFunc = DEFW_FPC_OPER;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_FPC_OPER;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_FPC_OPER && defwState != DEFW_FPC_OPER_SUM)
+    if (defwCtx->defwState != DEFW_FPC_OPER && defwCtx->defwState != DEFW_FPC_OPER_SUM)
         return DEFW_BAD_ORDER;          // sum can be within SUM
 
-    fprintf(defwFile, " SUM (");
-    defwState = DEFW_FPC_OPER_SUM;
-    defwFPC = 0;
+    defwPrintf(" SUM (");
+    defwCtx->defwState = DEFW_FPC_OPER_SUM;
+    defwCtx->defwFPC = 0;
     return DEFW_OK;
 }
 
 int
 defwConstraintOperandSumEnd()
 {
-    defwFunc = DEFW_FPC_OPER;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_FPC_OPER;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_FPC_OPER_SUM)
+    if (defwCtx->defwState != DEFW_FPC_OPER_SUM)
         return DEFW_BAD_ORDER;
-    fprintf(defwFile, " )");
-    defwState = DEFW_FPC_OPER;
-    defwFPC = 0;
+    defwPrintf(" )");
+    defwCtx->defwState = DEFW_FPC_OPER;
+    defwCtx->defwFPC = 0;
     return DEFW_OK;
 }
 
@@ -5162,28 +5967,28 @@ int
 defwConstraintOperandTime(const char    *timeType,
                           int           time)
 {
-    defwFunc = DEFW_FPC_OPER;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_FPC_OPER;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_FPC_OPER)
+    if (defwCtx->defwState != DEFW_FPC_OPER)
         return DEFW_BAD_ORDER;
     if (timeType && strcmp(timeType, "RISEMAX") && strcmp(timeType, "FALLMAX") &&
         strcmp(timeType, "RISEMIN") && strcmp(timeType, "FALLMIN"))
         return DEFW_BAD_DATA;
-    fprintf(defwFile, " + %s %d", timeType, time);
+    defwPrintf(" + %s %d", timeType, time);
     return DEFW_OK;
 }
 
 int
 defwConstraintOperandEnd()
 {
-    defwFunc = DEFW_FPC_OPER;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_FPC_OPER;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_FPC_OPER)
+    if (defwCtx->defwState != DEFW_FPC_OPER)
         return DEFW_BAD_ORDER;
-    fprintf(defwFile, " ;\n");
-    defwState = DEFW_FPC;
+    defwPrintf(" ;\n");
+    defwCtx->defwState = DEFW_FPC;
     return DEFW_OK;
 }
 
@@ -5191,55 +5996,57 @@ int
 defwConstraintWiredlogic(const char *netName,
                          int        distance)
 {
-    defwFunc = DEFW_FPC;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_FPC;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_FPC_START && defwState != DEFW_FPC)
+    if (defwCtx->defwState != DEFW_FPC_START && defwCtx->defwState != DEFW_FPC)
         return DEFW_BAD_ORDER;
 
     if (!netName || !*netName)        // require
         return DEFW_BAD_DATA;
-    fprintf(defwFile, "   - WIREDLOGIC %s MAXDIST %d ;\n", netName, distance);
-    defwCounter--;
-    defwState = DEFW_FPC;
-    defwLines++;
+    defwPrintf("   - WIREDLOGIC %s MAXDIST %d ;\n", netName, distance);
+    defwCtx->defwCounter--;
+    defwCtx->defwState = DEFW_FPC;
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
 int
 defwEndConstraints()
 {
-    defwFunc = DEFW_FPC_END;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_FPC_END;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_FPC_START && defwState != DEFW_FPC)
+    if (defwCtx->defwState != DEFW_FPC_START && defwCtx->defwState != DEFW_FPC)
         return DEFW_BAD_ORDER;
-    if (defwCounter > 0)
+    if (defwCtx->defwCounter > 0)
         return DEFW_BAD_DATA;
-    else if (defwCounter < 0)
+    else if (defwCtx->defwCounter < 0)
         return DEFW_TOO_MANY_STMS;
 
-    fprintf(defwFile, "END CONSTRAINTS\n\n");
-    defwLines++;
+    defwPrintf("END CONSTRAINTS\n\n");
+    defwCtx->defwLines++;
 
-    defwState = DEFW_FPC_END;
+    defwCtx->defwState = DEFW_FPC_END;
+    defwTraceSectionEnd("CONSTRAINTS");
     return DEFW_OK;
 }
 
 int
 defwStartGroups(int count)
 {
-    defwFunc = DEFW_GROUP_START;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_GROUP_START;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if ((defwState >= DEFW_GROUP_START) && (defwState <= DEFW_GROUP_END))
+    if ((defwCtx->defwState >= DEFW_GROUP_START) && (defwCtx->defwState <= DEFW_GROUP_END))
         return DEFW_BAD_ORDER;
 
-    fprintf(defwFile, "GROUPS %d ;\n", count);
-    defwLines++;
+    defwPrintf("GROUPS %d ;\n", count);
+    defwCtx->defwLines++;
 
-    defwState = DEFW_GROUP_START;
-    defwCounter = count;
+    defwCtx->defwState = DEFW_GROUP_START;
+    defwCtx->defwCounter = count;
+    defwTraceSectionStart();
     return DEFW_OK;
 }
 
@@ -5250,25 +6057,25 @@ defwGroup(const char    *groupName,
 {
     int i;
 
-    defwFunc = DEFW_GROUP;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_GROUP;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_GROUP_START && defwState != DEFW_GROUP)
+    if (defwCtx->defwState != DEFW_GROUP_START && defwCtx->defwState != DEFW_GROUP)
         return DEFW_BAD_ORDER;
 
     if ((groupName == 0) || (*groupName == 0) || (groupExpr == 0) ||
         (*groupExpr == 0))  // require
         return DEFW_BAD_DATA;
-    if (defwState == DEFW_GROUP)
-        fprintf(defwFile, " ;\n");          // add ; for the previous group
-    fprintf(defwFile, "   - %s", groupName);
+    if (defwCtx->defwState == DEFW_GROUP)
+        defwPrintf(" ;\n");          // add ; for the previous group
+    defwPrintf("   - %s", groupName);
     if (numExpr) {
         for (i = 0; i < numExpr; i++)
-            fprintf(defwFile, " %s", groupExpr[i]);
+            defwPrintf(" %s", groupExpr[i]);
     }
-    defwCounter--;
-    defwLines++;
-    defwState = DEFW_GROUP;
+    defwCtx->defwCounter--;
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_GROUP;
     return DEFW_OK;
 }
 
@@ -5281,10 +6088,10 @@ defwGroupSoft(const char    *type1,
               const char    *type3,
               double        value3)
 {
-    defwFunc = DEFW_GROUP;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_GROUP;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_GROUP)
+    if (defwCtx->defwState != DEFW_GROUP)
         return DEFW_BAD_ORDER;
 
     if (type1 && strcmp(type1, "MAXHALFPERIMETER") && strcmp(type1, "MAXX") &&
@@ -5297,12 +6104,12 @@ defwGroupSoft(const char    *type1,
         strcmp(type3, "MAXY"))
         return DEFW_BAD_DATA;
     if (type1)
-        fprintf(defwFile, "\n     + SOFT %s %.11g", type1, value1);
+        defwPrintf("\n     + SOFT %s %.11g", type1, value1);
     if (type2)
-        fprintf(defwFile, " %s %.11g", type2, value2);
+        defwPrintf(" %s %.11g", type2, value2);
     if (type3)
-        fprintf(defwFile, " %s %.11g", type3, value3);
-    defwLines++;
+        defwPrintf(" %s %.11g", type3, value3);
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -5313,44 +6120,45 @@ defwGroupRegion(int         xl,
                 int         yh,
                 const char  *regionName)
 {
-    defwFunc = DEFW_GROUP;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_GROUP;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_GROUP)
+    if (defwCtx->defwState != DEFW_GROUP)
         return DEFW_BAD_ORDER;
 
     if ((xl || yl || xh || yh) && (regionName))  // ether pts or regionName
         return DEFW_BAD_DATA;
 
     if (regionName)
-        fprintf(defwFile, "\n      + REGION %s", regionName);
+        defwPrintf("\n      + REGION %s", regionName);
     else
-        fprintf(defwFile, "\n      + REGION ( %d %d ) ( %d %d )",
+        defwPrintf("\n      + REGION ( %d %d ) ( %d %d )",
                 xl, yl, xh, yh);
-    defwLines++;
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
 int
 defwEndGroups()
 {
-    defwFunc = DEFW_GROUP_END;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_GROUP_END;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_GROUP_START && defwState != DEFW_GROUP)
+    if (defwCtx->defwState != DEFW_GROUP_START && defwCtx->defwState != DEFW_GROUP)
         return DEFW_BAD_ORDER;
-    if (defwCounter > 0)
+    if (defwCtx->defwCounter > 0)
         return DEFW_BAD_DATA;
-    else if (defwCounter < 0)
+    else if (defwCtx->defwCounter < 0)
         return DEFW_TOO_MANY_STMS;
 
-    if (defwState != DEFW_GROUP_START)
-        fprintf(defwFile, " ;\n");
+    if (defwCtx->defwState != DEFW_GROUP_START)
+        defwPrintf(" ;\n");
 
-    fprintf(defwFile, "END GROUPS\n\n");
-    defwLines++;
+    defwPrintf("END GROUPS\n\n");
+    defwCtx->defwLines++;
 
-    defwState = DEFW_GROUP_END;
+    defwCtx->defwState = DEFW_GROUP_END;
+    defwTraceSectionEnd("GROUPS");
     return DEFW_OK;
 }
 
@@ -5358,131 +6166,132 @@ defwEndGroups()
 int
 defwStartBlockages(int count)
 {
-    defwFunc = DEFW_BLOCKAGE_START;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_BLOCKAGE_START;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if ((defwState >= DEFW_BLOCKAGE_START) && (defwState <= DEFW_BLOCKAGE_END))
+    if ((defwCtx->defwState >= DEFW_BLOCKAGE_START) && (defwCtx->defwState <= DEFW_BLOCKAGE_END))
         return DEFW_BAD_ORDER;
-    if (defVersionNum < 5.4)
+    if (defwCtx->defVersionNum < 5.4)
         return DEFW_WRONG_VERSION;
 
-    fprintf(defwFile, "BLOCKAGES %d ;\n", count);
-    defwLines++;
+    defwPrintf("BLOCKAGES %d ;\n", count);
+    defwCtx->defwLines++;
 
-    defwState = DEFW_BLOCKAGE_START;
-    defwCounter = count;
+    defwCtx->defwState = DEFW_BLOCKAGE_START;
+    defwCtx->defwCounter = count;
+    defwTraceSectionStart();
     return DEFW_OK;
 }
 
 int
 defwBlockagesLayer(const char *layerName)
 {
-    defwFunc = DEFW_BLOCKAGE_LAYER;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_BLOCKAGE_LAYER;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
 
-    if (defwState != DEFW_BLOCKAGE_START && ((defwState == DEFW_BLOCKAGE_PLACE)
-                                             || (defwState == DEFW_BLOCKAGE_LAYER)))
+    if (defwCtx->defwState != DEFW_BLOCKAGE_START && ((defwCtx->defwState == DEFW_BLOCKAGE_PLACE)
+                                             || (defwCtx->defwState == DEFW_BLOCKAGE_LAYER)))
         return DEFW_BAD_ORDER;
 
     if (!layerName || !*layerName)  // require
         return DEFW_BAD_DATA;
 
-    if (defwState == DEFW_BLOCKAGE_RECT)
-        fprintf(defwFile, " ;\n");   // end the previous rectangle
+    if (defwCtx->defwState == DEFW_BLOCKAGE_RECT)
+        defwPrintf(" ;\n");   // end the previous rectangle
 
-    fprintf(defwFile, "   - LAYER %s", layerName);
-    fprintf(defwFile, "\n");
-    defwCounter--;
-    defwLines++;
-    defwState = DEFW_BLOCKAGE_LAYER;
-    defwBlockageHasSD = 0;
-    defwBlockageHasSF = 0;
+    defwPrintf("   - LAYER %s", layerName);
+    defwPrintf("\n");
+    defwCtx->defwCounter--;
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_BLOCKAGE_LAYER;
+    defwCtx->defwBlockageHasSD = 0;
+    defwCtx->defwBlockageHasSF = 0;
     return DEFW_OK;
 }
 
 int
 defwBlockagesLayerSlots()
 {
-    defwFunc = DEFW_BLOCKAGE_LAYER;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_BLOCKAGE_LAYER;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
 
-    if ((defwState != DEFW_BLOCKAGE_LAYER) && (defwState != DEFW_BLOCKAGE_RECT))
+    if ((defwCtx->defwState != DEFW_BLOCKAGE_LAYER) && (defwCtx->defwState != DEFW_BLOCKAGE_RECT))
         return DEFW_BAD_ORDER;
 
-    if (defwBlockageHasSF)
+    if (defwCtx->defwBlockageHasSF)
         return DEFW_BAD_DATA;
 
-    if (defwState == DEFW_BLOCKAGE_RECT)
-        fprintf(defwFile, " ;\n");   // end the previous rectangle
-    fprintf(defwFile, "      + SLOTS\n");
-    defwLines++;
-    defwState = DEFW_BLOCKAGE_LAYER;
-    defwBlockageHasSF = 1;
+    if (defwCtx->defwState == DEFW_BLOCKAGE_RECT)
+        defwPrintf(" ;\n");   // end the previous rectangle
+    defwPrintf("      + SLOTS\n");
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_BLOCKAGE_LAYER;
+    defwCtx->defwBlockageHasSF = 1;
     return DEFW_OK;
 }
 
 int
 defwBlockagesLayerFills()
 {
-    defwFunc = DEFW_BLOCKAGE_LAYER;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_BLOCKAGE_LAYER;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
 
-    if ((defwState != DEFW_BLOCKAGE_LAYER) && (defwState != DEFW_BLOCKAGE_RECT))
+    if ((defwCtx->defwState != DEFW_BLOCKAGE_LAYER) && (defwCtx->defwState != DEFW_BLOCKAGE_RECT))
         return DEFW_BAD_ORDER;
 
-    if (defwBlockageHasSF)
+    if (defwCtx->defwBlockageHasSF)
         return DEFW_BAD_DATA;
 
-    if (defwState == DEFW_BLOCKAGE_RECT)
-        fprintf(defwFile, " ;\n");   // end the previous rectangle
+    if (defwCtx->defwState == DEFW_BLOCKAGE_RECT)
+        defwPrintf(" ;\n");   // end the previous rectangle
 
-    fprintf(defwFile, "     + FILLS\n");
-    defwLines++;
-    defwState = DEFW_BLOCKAGE_LAYER;
-    defwBlockageHasSF = 1;
+    defwPrintf("     + FILLS\n");
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_BLOCKAGE_LAYER;
+    defwCtx->defwBlockageHasSF = 1;
     return DEFW_OK;
 }
 
 int
 defwBlockagesLayerComponent(const char *compName)
 {
-    defwFunc = DEFW_BLOCKAGE_LAYER;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_BLOCKAGE_LAYER;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
 
-    if ((defwState != DEFW_BLOCKAGE_LAYER) && (defwState != DEFW_BLOCKAGE_RECT))
+    if ((defwCtx->defwState != DEFW_BLOCKAGE_LAYER) && (defwCtx->defwState != DEFW_BLOCKAGE_RECT))
         return DEFW_BAD_ORDER;
 
     if ((compName == 0) || (*compName == 0))  // require
         return DEFW_BAD_DATA;
 
-    if (defwState == DEFW_BLOCKAGE_RECT)
-        fprintf(defwFile, " ;\n");   // end the previous rectangle
-    fprintf(defwFile, "     + COMPONENT %s\n", compName);
-    defwLines++;
-    defwState = DEFW_BLOCKAGE_LAYER;
+    if (defwCtx->defwState == DEFW_BLOCKAGE_RECT)
+        defwPrintf(" ;\n");   // end the previous rectangle
+    defwPrintf("     + COMPONENT %s\n", compName);
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_BLOCKAGE_LAYER;
     return DEFW_OK;
 }
 
 int
 defwBlockagesLayerPushdown()
 {
-    defwFunc = DEFW_BLOCKAGE_LAYER;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_BLOCKAGE_LAYER;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
 
-    if ((defwState != DEFW_BLOCKAGE_LAYER) && (defwState != DEFW_BLOCKAGE_RECT))
+    if ((defwCtx->defwState != DEFW_BLOCKAGE_LAYER) && (defwCtx->defwState != DEFW_BLOCKAGE_RECT))
         return DEFW_BAD_ORDER;
 
-    if (defwState == DEFW_BLOCKAGE_RECT)
-        fprintf(defwFile, " ;\n");   // end the previous rectangle
+    if (defwCtx->defwState == DEFW_BLOCKAGE_RECT)
+        defwPrintf(" ;\n");   // end the previous rectangle
 
-    fprintf(defwFile, "     + PUSHDOWN\n");
-    defwLines++;
-    defwState = DEFW_BLOCKAGE_LAYER;
+    defwPrintf("     + PUSHDOWN\n");
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_BLOCKAGE_LAYER;
     return DEFW_OK;
 }
 
@@ -5490,80 +6299,80 @@ defwBlockagesLayerPushdown()
 int
 defwBlockagesLayerExceptpgnet()
 {
-    defwFunc = DEFW_BLOCKAGE_LAYER;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_BLOCKAGE_LAYER;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
 
-    if ((defwState != DEFW_BLOCKAGE_LAYER) && (defwState != DEFW_BLOCKAGE_RECT))
+    if ((defwCtx->defwState != DEFW_BLOCKAGE_LAYER) && (defwCtx->defwState != DEFW_BLOCKAGE_RECT))
         return DEFW_BAD_ORDER;
 
-    if (defwState == DEFW_BLOCKAGE_RECT)
-        fprintf(defwFile, " ;\n");   // end the previous rectangle
+    if (defwCtx->defwState == DEFW_BLOCKAGE_RECT)
+        defwPrintf(" ;\n");   // end the previous rectangle
 
-    fprintf(defwFile, "     + EXCEPTPGNET\n");
-    defwLines++;
-    defwState = DEFW_BLOCKAGE_LAYER;
+    defwPrintf("     + EXCEPTPGNET\n");
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_BLOCKAGE_LAYER;
     return DEFW_OK;
 }
 
 int
 defwBlockagesLayerSpacing(int minSpacing)
 {
-    defwFunc = DEFW_BLOCKAGE_LAYER;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_BLOCKAGE_LAYER;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
 
-    if ((defwState != DEFW_BLOCKAGE_LAYER) && (defwState != DEFW_BLOCKAGE_RECT))
+    if ((defwCtx->defwState != DEFW_BLOCKAGE_LAYER) && (defwCtx->defwState != DEFW_BLOCKAGE_RECT))
         return DEFW_BAD_ORDER;
-    if (defwBlockageHasSD)    // Either spacing or designrulewidth has defined
+    if (defwCtx->defwBlockageHasSD)    // Either spacing or designrulewidth has defined
         return DEFW_BAD_DATA;
 
-    fprintf(defwFile, "     + SPACING %d\n", minSpacing);
-    defwLines++;
-    defwBlockageHasSD = 1;
-    defwState = DEFW_BLOCKAGE_LAYER;
+    defwPrintf("     + SPACING %d\n", minSpacing);
+    defwCtx->defwLines++;
+    defwCtx->defwBlockageHasSD = 1;
+    defwCtx->defwState = DEFW_BLOCKAGE_LAYER;
     return DEFW_OK;
 }
 
 int
 defwBlockagesLayerDesignRuleWidth(int effectiveWidth)
 {
-    defwFunc = DEFW_BLOCKAGE_LAYER;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_BLOCKAGE_LAYER;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
 
-    if ((defwState != DEFW_BLOCKAGE_LAYER) && (defwState != DEFW_BLOCKAGE_RECT))
+    if ((defwCtx->defwState != DEFW_BLOCKAGE_LAYER) && (defwCtx->defwState != DEFW_BLOCKAGE_RECT))
         return DEFW_BAD_ORDER;
-    if (defwBlockageHasSD)    // Either spacing or designrulewidth has defined
+    if (defwCtx->defwBlockageHasSD)    // Either spacing or designrulewidth has defined
         return DEFW_BAD_DATA;
 
-    fprintf(defwFile, "     + DESIGNRULEWIDTH %d\n", effectiveWidth);
-    defwLines++;
-    defwBlockageHasSD = 1;
-    defwState = DEFW_BLOCKAGE_LAYER;
+    defwPrintf("     + DESIGNRULEWIDTH %d\n", effectiveWidth);
+    defwCtx->defwLines++;
+    defwCtx->defwBlockageHasSD = 1;
+    defwCtx->defwState = DEFW_BLOCKAGE_LAYER;
     return DEFW_OK;
 }
 
 int
 defwBlockagesLayerMask(int colorMask)
 {
-    if (defVersionNum < 5.8) {
+    if (defwCtx->defVersionNum < 5.8) {
         return DEFW_WRONG_VERSION;
     }
 
-    defwFunc = DEFW_BLOCKAGE_MASK;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_BLOCKAGE_MASK;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
 
-    if ((defwState != DEFW_BLOCKAGE_LAYER) && (defwState != DEFW_BLOCKAGE_RECT))
+    if ((defwCtx->defwState != DEFW_BLOCKAGE_LAYER) && (defwCtx->defwState != DEFW_BLOCKAGE_RECT))
         return DEFW_BAD_ORDER;
 
-    if (defwState == DEFW_BLOCKAGE_RECT)
-        fprintf(defwFile, "\n");   // set a newline for the previous rectangle
+    if (defwCtx->defwState == DEFW_BLOCKAGE_RECT)
+        defwPrintf("\n");   // set a newline for the previous rectangle
 
-    fprintf(defwFile, "     + MASK %d", colorMask);
-    defwLines++;
-    defwState = DEFW_BLOCKAGE_LAYER;
+    defwPrintf("     + MASK %d", colorMask);
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_BLOCKAGE_LAYER;
     return DEFW_OK;
 }
 
@@ -5572,26 +6381,26 @@ int
 defwBlockageLayer(const char    *layerName,
                   const char    *compName)
 {      // optional(NULL) 
-    defwFunc = DEFW_BLOCKAGE_LAYER;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_BLOCKAGE_LAYER;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     // May be user already define component or layer slots or fills
-    if (defwState != DEFW_BLOCKAGE_START && ((defwState == DEFW_BLOCKAGE_PLACE)
-                                             || (defwState == DEFW_BLOCKAGE_LAYER)))
+    if (defwCtx->defwState != DEFW_BLOCKAGE_START && ((defwCtx->defwState == DEFW_BLOCKAGE_PLACE)
+                                             || (defwCtx->defwState == DEFW_BLOCKAGE_LAYER)))
         return DEFW_BAD_DATA;
 
     if (!layerName || !*layerName)  // require
         return DEFW_BAD_DATA;
-    if (defwState == DEFW_BLOCKAGE_RECT)
-        fprintf(defwFile, " ;\n");   // end the previous rectangle
-    fprintf(defwFile, "   - LAYER %s ", layerName);
+    if (defwCtx->defwState == DEFW_BLOCKAGE_RECT)
+        defwPrintf(" ;\n");   // end the previous rectangle
+    defwPrintf("   - LAYER %s ", layerName);
     if (compName && *compName != 0)  // optional
-        fprintf(defwFile, "+ COMPONENT %s ", compName);
-    fprintf(defwFile, "\n");
-    defwCounter--;
-    defwLines++;
-    defwState = DEFW_BLOCKAGE_LAYER;
-    defwBlockageHasSD = 0;
+        defwPrintf("+ COMPONENT %s ", compName);
+    defwPrintf("\n");
+    defwCtx->defwCounter--;
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_BLOCKAGE_LAYER;
+    defwCtx->defwBlockageHasSD = 0;
     return DEFW_OK;
 }
 
@@ -5599,23 +6408,23 @@ defwBlockageLayer(const char    *layerName,
 int
 defwBlockageLayerSlots(const char *layerName)
 {
-    defwFunc = DEFW_BLOCKAGE_LAYER;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_BLOCKAGE_LAYER;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     // May be user already define component or layer or layer fills
-    if (defwState != DEFW_BLOCKAGE_START && ((defwState == DEFW_BLOCKAGE_PLACE)
-                                             || (defwState == DEFW_BLOCKAGE_LAYER)))
+    if (defwCtx->defwState != DEFW_BLOCKAGE_START && ((defwCtx->defwState == DEFW_BLOCKAGE_PLACE)
+                                             || (defwCtx->defwState == DEFW_BLOCKAGE_LAYER)))
         return DEFW_BAD_DATA;
 
     if (!layerName || !*layerName)  // require
         return DEFW_BAD_DATA;
-    if (defwState == DEFW_BLOCKAGE_RECT)
-        fprintf(defwFile, " ;\n");   // end the previous rectangle
-    fprintf(defwFile, "   - LAYER %s + SLOTS\n", layerName);
-    defwCounter--;
-    defwLines++;
-    defwState = DEFW_BLOCKAGE_LAYER;
-    defwBlockageHasSD = 0;
+    if (defwCtx->defwState == DEFW_BLOCKAGE_RECT)
+        defwPrintf(" ;\n");   // end the previous rectangle
+    defwPrintf("   - LAYER %s + SLOTS\n", layerName);
+    defwCtx->defwCounter--;
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_BLOCKAGE_LAYER;
+    defwCtx->defwBlockageHasSD = 0;
     return DEFW_OK;
 }
 
@@ -5623,23 +6432,23 @@ defwBlockageLayerSlots(const char *layerName)
 int
 defwBlockageLayerFills(const char *layerName)
 {
-    defwFunc = DEFW_BLOCKAGE_LAYER;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_BLOCKAGE_LAYER;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     // May be user already define component or layer or layer slots
-    if (defwState != DEFW_BLOCKAGE_START && ((defwState == DEFW_BLOCKAGE_PLACE)
-                                             || (defwState == DEFW_BLOCKAGE_LAYER)))
+    if (defwCtx->defwState != DEFW_BLOCKAGE_START && ((defwCtx->defwState == DEFW_BLOCKAGE_PLACE)
+                                             || (defwCtx->defwState == DEFW_BLOCKAGE_LAYER)))
         return DEFW_BAD_DATA;
 
     if (!layerName || !*layerName)  // require
         return DEFW_BAD_DATA;
-    if (defwState == DEFW_BLOCKAGE_RECT)
-        fprintf(defwFile, " ;\n");   // end the previous rectangle
-    fprintf(defwFile, "   - LAYER %s + FILLS\n", layerName);
-    defwCounter--;
-    defwLines++;
-    defwState = DEFW_BLOCKAGE_LAYER;
-    defwBlockageHasSD = 0;
+    if (defwCtx->defwState == DEFW_BLOCKAGE_RECT)
+        defwPrintf(" ;\n");   // end the previous rectangle
+    defwPrintf("   - LAYER %s + FILLS\n", layerName);
+    defwCtx->defwCounter--;
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_BLOCKAGE_LAYER;
+    defwCtx->defwBlockageHasSD = 0;
     return DEFW_OK;
 }
 
@@ -5647,23 +6456,23 @@ defwBlockageLayerFills(const char *layerName)
 int
 defwBlockageLayerPushdown(const char *layerName)
 {
-    defwFunc = DEFW_BLOCKAGE_LAYER;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_BLOCKAGE_LAYER;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     // May be user already define component or layer or layer slots
-    if (defwState != DEFW_BLOCKAGE_START && ((defwState == DEFW_BLOCKAGE_PLACE)
-                                             || (defwState == DEFW_BLOCKAGE_LAYER)))
+    if (defwCtx->defwState != DEFW_BLOCKAGE_START && ((defwCtx->defwState == DEFW_BLOCKAGE_PLACE)
+                                             || (defwCtx->defwState == DEFW_BLOCKAGE_LAYER)))
         return DEFW_BAD_DATA;
 
     if ((layerName == 0) || (*layerName == 0))  // require
         return DEFW_BAD_DATA;
-    if (defwState == DEFW_BLOCKAGE_RECT)
-        fprintf(defwFile, " ;\n");   // end the previous rectangle
-    fprintf(defwFile, "   - LAYER %s + PUSHDOWN\n", layerName);
-    defwCounter--;
-    defwLines++;
-    defwState = DEFW_BLOCKAGE_LAYER;
-    defwBlockageHasSD = 0;
+    if (defwCtx->defwState == DEFW_BLOCKAGE_RECT)
+        defwPrintf(" ;\n");   // end the previous rectangle
+    defwPrintf("   - LAYER %s + PUSHDOWN\n", layerName);
+    defwCtx->defwCounter--;
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_BLOCKAGE_LAYER;
+    defwCtx->defwBlockageHasSD = 0;
     return DEFW_OK;
 }
 
@@ -5671,23 +6480,23 @@ defwBlockageLayerPushdown(const char *layerName)
 int
 defwBlockageLayerExceptpgnet(const char *layerName)
 {
-    defwFunc = DEFW_BLOCKAGE_LAYER;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_BLOCKAGE_LAYER;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     // May be user already define component or layer or layer slots
-    if (defwState != DEFW_BLOCKAGE_START && ((defwState == DEFW_BLOCKAGE_PLACE)
-                                             || (defwState == DEFW_BLOCKAGE_LAYER)))
+    if (defwCtx->defwState != DEFW_BLOCKAGE_START && ((defwCtx->defwState == DEFW_BLOCKAGE_PLACE)
+                                             || (defwCtx->defwState == DEFW_BLOCKAGE_LAYER)))
         return DEFW_BAD_DATA;
 
     if ((layerName == 0) || (*layerName == 0))  // require
         return DEFW_BAD_DATA;
-    if (defwState == DEFW_BLOCKAGE_RECT)
-        fprintf(defwFile, " ;\n");   // end the previous rectangle
-    fprintf(defwFile, "   - LAYER %s + EXCEPTPGNET\n", layerName);
-    defwCounter--;
-    defwLines++;
-    defwState = DEFW_BLOCKAGE_LAYER;
-    defwBlockageHasSD = 0;
+    if (defwCtx->defwState == DEFW_BLOCKAGE_RECT)
+        defwPrintf(" ;\n");   // end the previous rectangle
+    defwPrintf("   - LAYER %s + EXCEPTPGNET\n", layerName);
+    defwCtx->defwCounter--;
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_BLOCKAGE_LAYER;
+    defwCtx->defwBlockageHasSD = 0;
     return DEFW_OK;
 }
 
@@ -5695,19 +6504,19 @@ defwBlockageLayerExceptpgnet(const char *layerName)
 int
 defwBlockageSpacing(int minSpacing)
 {
-    defwFunc = DEFW_BLOCKAGE_LAYER;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_BLOCKAGE_LAYER;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     // Checked if defwBlockageDesignRuleWidth has already called
-    if ((defwState != DEFW_BLOCKAGE_LAYER) && (defwState != DEFW_BLOCKAGE_RECT))
+    if ((defwCtx->defwState != DEFW_BLOCKAGE_LAYER) && (defwCtx->defwState != DEFW_BLOCKAGE_RECT))
         return DEFW_BAD_DATA;
-    if (defwBlockageHasSD)    // Either spacing or designrulewidth has defined
+    if (defwCtx->defwBlockageHasSD)    // Either spacing or designrulewidth has defined
         return DEFW_BAD_DATA;
 
-    fprintf(defwFile, "     + SPACING %d\n", minSpacing);
-    defwLines++;
-    defwBlockageHasSD = 1;
-    defwState = DEFW_BLOCKAGE_LAYER;
+    defwPrintf("     + SPACING %d\n", minSpacing);
+    defwCtx->defwLines++;
+    defwCtx->defwBlockageHasSD = 1;
+    defwCtx->defwState = DEFW_BLOCKAGE_LAYER;
     return DEFW_OK;
 }
 
@@ -5715,41 +6524,41 @@ defwBlockageSpacing(int minSpacing)
 int
 defwBlockageDesignRuleWidth(int effectiveWidth)
 {
-    defwFunc = DEFW_BLOCKAGE_LAYER;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_BLOCKAGE_LAYER;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     // Checked if defwBlockageDesignRuleWidth has already called
-    if ((defwState != DEFW_BLOCKAGE_LAYER) && (defwState != DEFW_BLOCKAGE_RECT))
+    if ((defwCtx->defwState != DEFW_BLOCKAGE_LAYER) && (defwCtx->defwState != DEFW_BLOCKAGE_RECT))
         return DEFW_BAD_DATA;
-    if (defwBlockageHasSD)    // Either spacing or designrulewidth has defined
+    if (defwCtx->defwBlockageHasSD)    // Either spacing or designrulewidth has defined
         return DEFW_BAD_DATA;
 
-    fprintf(defwFile, "     + DESIGNRULEWIDTH %d\n", effectiveWidth);
-    defwLines++;
-    defwBlockageHasSD = 1;
-    defwState = DEFW_BLOCKAGE_LAYER;
+    defwPrintf("     + DESIGNRULEWIDTH %d\n", effectiveWidth);
+    defwCtx->defwLines++;
+    defwCtx->defwBlockageHasSD = 1;
+    defwCtx->defwState = DEFW_BLOCKAGE_LAYER;
     return DEFW_OK;
 }
 
 int
 defwBlockagesPlacement()
 {
-    defwFunc = DEFW_BLOCKAGE_PLACE;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_BLOCKAGE_PLACE;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
 
-    if (defwState != DEFW_BLOCKAGE_START && ((defwState == DEFW_BLOCKAGE_LAYER)
-                                             || (defwState == DEFW_BLOCKAGE_PLACE)))
+    if (defwCtx->defwState != DEFW_BLOCKAGE_START && ((defwCtx->defwState == DEFW_BLOCKAGE_LAYER)
+                                             || (defwCtx->defwState == DEFW_BLOCKAGE_PLACE)))
         return DEFW_BAD_DATA;
 
-    if (defwState == DEFW_BLOCKAGE_RECT)
-        fprintf(defwFile, " ;\n");   // end the previous rectangle
+    if (defwCtx->defwState == DEFW_BLOCKAGE_RECT)
+        defwPrintf(" ;\n");   // end the previous rectangle
 
-    fprintf(defwFile, "   - PLACEMENT\n");
-    defwCounter--;
-    defwLines++;
-    defwState = DEFW_BLOCKAGE_PLACE;
-    defwBlockageHasSP = 0;
+    defwPrintf("   - PLACEMENT\n");
+    defwCtx->defwCounter--;
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_BLOCKAGE_PLACE;
+    defwCtx->defwBlockageHasSP = 0;
     return DEFW_OK;
 }
 
@@ -5757,20 +6566,20 @@ defwBlockagesPlacement()
 int
 defwBlockagesPlacementComponent(const char *compName)
 {
-    defwFunc = DEFW_BLOCKAGE_PLACE;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_BLOCKAGE_PLACE;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
 
-    if ((defwState != DEFW_BLOCKAGE_PLACE) && (defwState != DEFW_BLOCKAGE_RECT))
+    if ((defwCtx->defwState != DEFW_BLOCKAGE_PLACE) && (defwCtx->defwState != DEFW_BLOCKAGE_RECT))
         return DEFW_BAD_ORDER;
 
     if ((compName == 0) || (*compName == 0))  // require
         return DEFW_BAD_DATA;
-    if (defwState == DEFW_BLOCKAGE_RECT)
-        fprintf(defwFile, " ;\n");   // end the previous rectangle
-    fprintf(defwFile, "     + COMPONENT %s\n", compName);
-    defwLines++;
-    defwState = DEFW_BLOCKAGE_PLACE;
+    if (defwCtx->defwState == DEFW_BLOCKAGE_RECT)
+        defwPrintf(" ;\n");   // end the previous rectangle
+    defwPrintf("     + COMPONENT %s\n", compName);
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_BLOCKAGE_PLACE;
     return DEFW_OK;
 }
 
@@ -5778,18 +6587,18 @@ defwBlockagesPlacementComponent(const char *compName)
 int
 defwBlockagesPlacementPushdown()
 {
-    defwFunc = DEFW_BLOCKAGE_PLACE;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_BLOCKAGE_PLACE;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
 
-    if ((defwState != DEFW_BLOCKAGE_PLACE) && (defwState != DEFW_BLOCKAGE_RECT))
+    if ((defwCtx->defwState != DEFW_BLOCKAGE_PLACE) && (defwCtx->defwState != DEFW_BLOCKAGE_RECT))
         return DEFW_BAD_ORDER;
 
-    if (defwState == DEFW_BLOCKAGE_RECT)
-        fprintf(defwFile, " ;\n");   // end the previous rectangle
-    fprintf(defwFile, "     + PUSHDOWN\n");
-    defwLines++;
-    defwState = DEFW_BLOCKAGE_PLACE;
+    if (defwCtx->defwState == DEFW_BLOCKAGE_RECT)
+        defwPrintf(" ;\n");   // end the previous rectangle
+    defwPrintf("     + PUSHDOWN\n");
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_BLOCKAGE_PLACE;
     return DEFW_OK;
 }
 
@@ -5797,22 +6606,22 @@ defwBlockagesPlacementPushdown()
 int
 defwBlockagesPlacementSoft()
 {
-    defwFunc = DEFW_BLOCKAGE_PLACE;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_BLOCKAGE_PLACE;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
 
-    if ((defwState != DEFW_BLOCKAGE_PLACE) && (defwState != DEFW_BLOCKAGE_RECT))
+    if ((defwCtx->defwState != DEFW_BLOCKAGE_PLACE) && (defwCtx->defwState != DEFW_BLOCKAGE_RECT))
         return DEFW_BAD_ORDER;
 
-    if (defwBlockageHasSP)
+    if (defwCtx->defwBlockageHasSP)
         return DEFW_BAD_DATA;
 
-    if (defwState == DEFW_BLOCKAGE_RECT)
-        fprintf(defwFile, " ;\n");   // end the previous rectangle
-    fprintf(defwFile, "     + SOFT\n");
-    defwLines++;
-    defwState = DEFW_BLOCKAGE_PLACE;
-    defwBlockageHasSP = 1;
+    if (defwCtx->defwState == DEFW_BLOCKAGE_RECT)
+        defwPrintf(" ;\n");   // end the previous rectangle
+    defwPrintf("     + SOFT\n");
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_BLOCKAGE_PLACE;
+    defwCtx->defwBlockageHasSP = 1;
     return DEFW_OK;
 }
 
@@ -5820,22 +6629,22 @@ defwBlockagesPlacementSoft()
 int
 defwBlockagesPlacementPartial(double maxDensity)
 {
-    defwFunc = DEFW_BLOCKAGE_PLACE;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_BLOCKAGE_PLACE;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
 
-    if ((defwState != DEFW_BLOCKAGE_PLACE) && (defwState != DEFW_BLOCKAGE_RECT))
+    if ((defwCtx->defwState != DEFW_BLOCKAGE_PLACE) && (defwCtx->defwState != DEFW_BLOCKAGE_RECT))
         return DEFW_BAD_ORDER;
 
-    if (defwBlockageHasSP)
+    if (defwCtx->defwBlockageHasSP)
         return DEFW_BAD_DATA;
 
-    if (defwState == DEFW_BLOCKAGE_RECT)
-        fprintf(defwFile, " ;\n");   // end the previous rectangle
-    fprintf(defwFile, "     + PARTIAL %.11g\n", maxDensity);
-    defwLines++;
-    defwState = DEFW_BLOCKAGE_PLACE;
-    defwBlockageHasSP = 1;
+    if (defwCtx->defwState == DEFW_BLOCKAGE_RECT)
+        defwPrintf(" ;\n");   // end the previous rectangle
+    defwPrintf("     + PARTIAL %.11g\n", maxDensity);
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_BLOCKAGE_PLACE;
+    defwCtx->defwBlockageHasSP = 1;
     return DEFW_OK;
 }
 
@@ -5845,20 +6654,20 @@ defwBlockagesRect(int   xl,
                   int   xh,
                   int   yh)
 {
-    defwFunc = DEFW_BLOCKAGE_RECT;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_BLOCKAGE_RECT;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     // May be user already define layer
-    if (defwState != DEFW_BLOCKAGE_PLACE && defwState != DEFW_BLOCKAGE_LAYER &&
-        defwState != DEFW_BLOCKAGE_RECT)
+    if (defwCtx->defwState != DEFW_BLOCKAGE_PLACE && defwCtx->defwState != DEFW_BLOCKAGE_LAYER &&
+        defwCtx->defwState != DEFW_BLOCKAGE_RECT)
         return DEFW_BAD_DATA;
 
-    if (defwState == DEFW_BLOCKAGE_RECT)
-        fprintf(defwFile, "\n");   // set a newline for the previous rectangle
+    if (defwCtx->defwState == DEFW_BLOCKAGE_RECT)
+        defwPrintf("\n");   // set a newline for the previous rectangle
 
-    fprintf(defwFile, "     RECT ( %d %d ) ( %d %d )", xl, yl, xh, yh);
-    defwLines++;
-    defwState = DEFW_BLOCKAGE_RECT;
+    defwPrintf("     RECT ( %d %d ) ( %d %d )", xl, yl, xh, yh);
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_BLOCKAGE_RECT;
     return DEFW_OK;
 }
 
@@ -5870,27 +6679,27 @@ defwBlockagesPolygon(int    num_polys,
 {
     int i;
 
-    defwFunc = DEFW_BLOCKAGE_RECT;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_BLOCKAGE_RECT;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     // May be user already define layer
-    if (defwState != DEFW_BLOCKAGE_LAYER && defwState != DEFW_BLOCKAGE_RECT)
+    if (defwCtx->defwState != DEFW_BLOCKAGE_LAYER && defwCtx->defwState != DEFW_BLOCKAGE_RECT)
         return DEFW_BAD_DATA;
 
-    if (defwState == DEFW_BLOCKAGE_RECT)
-        fprintf(defwFile, "\n");   // set a newline for the previous rectangle
+    if (defwCtx->defwState == DEFW_BLOCKAGE_RECT)
+        defwPrintf("\n");   // set a newline for the previous rectangle
 
-    fprintf(defwFile, "     POLYGON ");
+    defwPrintf("     POLYGON ");
     for (i = 0; i < num_polys; i++) {
         if ((i == 0) || ((i % 5) != 0))
-            fprintf(defwFile, "( %d %d ) ", *xl++, *yl++);
+            defwPrintf("( %d %d ) ", *xl++, *yl++);
         else {
-            fprintf(defwFile, "\n             ( %d %d ) ", *xl++, *yl++);
-            defwLines++;
+            defwPrintf("\n             ( %d %d ) ", *xl++, *yl++);
+            defwCtx->defwLines++;
         }
     }
-    defwLines++;
-    defwState = DEFW_BLOCKAGE_RECT;  // use rect flag.  It works the same for poly
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_BLOCKAGE_RECT;  // use rect flag.  It works the same for poly
     return DEFW_OK;
 }
 
@@ -5899,20 +6708,20 @@ defwBlockagesPolygon(int    num_polys,
 int
 defwBlockagePlacement()
 {
-    defwFunc = DEFW_BLOCKAGE_PLACE;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_BLOCKAGE_PLACE;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     // May be user already define layer
-    if (defwState != DEFW_BLOCKAGE_START && ((defwState == DEFW_BLOCKAGE_LAYER)
-                                             || (defwState == DEFW_BLOCKAGE_PLACE)))
+    if (defwCtx->defwState != DEFW_BLOCKAGE_START && ((defwCtx->defwState == DEFW_BLOCKAGE_LAYER)
+                                             || (defwCtx->defwState == DEFW_BLOCKAGE_PLACE)))
         return DEFW_BAD_DATA;
 
-    if (defwState == DEFW_BLOCKAGE_RECT)
-        fprintf(defwFile, " ;\n");   // end the previous rectangle
-    fprintf(defwFile, "   - PLACEMENT\n");
-    defwCounter--;
-    defwLines++;
-    defwState = DEFW_BLOCKAGE_PLACE;
+    if (defwCtx->defwState == DEFW_BLOCKAGE_RECT)
+        defwPrintf(" ;\n");   // end the previous rectangle
+    defwPrintf("   - PLACEMENT\n");
+    defwCtx->defwCounter--;
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_BLOCKAGE_PLACE;
     return DEFW_OK;
 }
 
@@ -5920,22 +6729,22 @@ defwBlockagePlacement()
 int
 defwBlockagePlacementComponent(const char *compName)
 {
-    defwFunc = DEFW_BLOCKAGE_PLACE;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_BLOCKAGE_PLACE;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     // May be user already define layer
-    if (defwState != DEFW_BLOCKAGE_START && ((defwState == DEFW_BLOCKAGE_LAYER)
-                                             || (defwState == DEFW_BLOCKAGE_PLACE)))
+    if (defwCtx->defwState != DEFW_BLOCKAGE_START && ((defwCtx->defwState == DEFW_BLOCKAGE_LAYER)
+                                             || (defwCtx->defwState == DEFW_BLOCKAGE_PLACE)))
         return DEFW_BAD_DATA;
 
     if ((compName == 0) || (*compName == 0))  // require
         return DEFW_BAD_DATA;
-    if (defwState == DEFW_BLOCKAGE_RECT)
-        fprintf(defwFile, " ;\n");   // end the previous rectangle
-    fprintf(defwFile, "   - PLACEMENT + COMPONENT %s\n", compName);
-    defwCounter--;
-    defwLines++;
-    defwState = DEFW_BLOCKAGE_PLACE;
+    if (defwCtx->defwState == DEFW_BLOCKAGE_RECT)
+        defwPrintf(" ;\n");   // end the previous rectangle
+    defwPrintf("   - PLACEMENT + COMPONENT %s\n", compName);
+    defwCtx->defwCounter--;
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_BLOCKAGE_PLACE;
     return DEFW_OK;
 }
 
@@ -5943,19 +6752,19 @@ defwBlockagePlacementComponent(const char *compName)
 int
 defwBlockagePlacementPushdown()
 {
-    defwFunc = DEFW_BLOCKAGE_PLACE;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_BLOCKAGE_PLACE;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     // May be user already define layer
-    if (defwState != DEFW_BLOCKAGE_START && ((defwState == DEFW_BLOCKAGE_LAYER)
-                                             || (defwState == DEFW_BLOCKAGE_PLACE)))
+    if (defwCtx->defwState != DEFW_BLOCKAGE_START && ((defwCtx->defwState == DEFW_BLOCKAGE_LAYER)
+                                             || (defwCtx->defwState == DEFW_BLOCKAGE_PLACE)))
         return DEFW_BAD_DATA;
-    if (defwState == DEFW_BLOCKAGE_RECT)
-        fprintf(defwFile, " ;\n");   // end the previous rectangle
-    fprintf(defwFile, "   - PLACEMENT + PUSHDOWN\n");
-    defwCounter--;
-    defwLines++;
-    defwState = DEFW_BLOCKAGE_PLACE;
+    if (defwCtx->defwState == DEFW_BLOCKAGE_RECT)
+        defwPrintf(" ;\n");   // end the previous rectangle
+    defwPrintf("   - PLACEMENT + PUSHDOWN\n");
+    defwCtx->defwCounter--;
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_BLOCKAGE_PLACE;
     return DEFW_OK;
 }
 
@@ -5963,19 +6772,19 @@ defwBlockagePlacementPushdown()
 int
 defwBlockagePlacementSoft()
 {
-    defwFunc = DEFW_BLOCKAGE_PLACE;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_BLOCKAGE_PLACE;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     // May be user already define layer
-    if (defwState != DEFW_BLOCKAGE_START && ((defwState == DEFW_BLOCKAGE_LAYER)
-                                             || (defwState == DEFW_BLOCKAGE_PLACE)))
+    if (defwCtx->defwState != DEFW_BLOCKAGE_START && ((defwCtx->defwState == DEFW_BLOCKAGE_LAYER)
+                                             || (defwCtx->defwState == DEFW_BLOCKAGE_PLACE)))
         return DEFW_BAD_DATA;
-    if (defwState == DEFW_BLOCKAGE_RECT)
-        fprintf(defwFile, " ;\n");   // end the previous rectangle
-    fprintf(defwFile, "   - PLACEMENT + SOFT\n");
-    defwCounter--;
-    defwLines++;
-    defwState = DEFW_BLOCKAGE_PLACE;
+    if (defwCtx->defwState == DEFW_BLOCKAGE_RECT)
+        defwPrintf(" ;\n");   // end the previous rectangle
+    defwPrintf("   - PLACEMENT + SOFT\n");
+    defwCtx->defwCounter--;
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_BLOCKAGE_PLACE;
     return DEFW_OK;
 }
 
@@ -5983,20 +6792,20 @@ defwBlockagePlacementSoft()
 int
 defwBlockagePlacementPartial(double maxDensity)
 {
-    defwFunc = DEFW_BLOCKAGE_PLACE;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_BLOCKAGE_PLACE;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     // May be user already define layer
-    if (defwState != DEFW_BLOCKAGE_START && ((defwState == DEFW_BLOCKAGE_LAYER)
-                                             || (defwState == DEFW_BLOCKAGE_PLACE)))
+    if (defwCtx->defwState != DEFW_BLOCKAGE_START && ((defwCtx->defwState == DEFW_BLOCKAGE_LAYER)
+                                             || (defwCtx->defwState == DEFW_BLOCKAGE_PLACE)))
         return DEFW_BAD_DATA;
 
-    if (defwState == DEFW_BLOCKAGE_RECT)
-        fprintf(defwFile, " ;\n");   // end the previous rectangle
-    fprintf(defwFile, "   - PLACEMENT + PARTIAL %.11g\n", maxDensity);
-    defwCounter--;
-    defwLines++;
-    defwState = DEFW_BLOCKAGE_PLACE;
+    if (defwCtx->defwState == DEFW_BLOCKAGE_RECT)
+        defwPrintf(" ;\n");   // end the previous rectangle
+    defwPrintf("   - PLACEMENT + PARTIAL %.11g\n", maxDensity);
+    defwCtx->defwCounter--;
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_BLOCKAGE_PLACE;
     return DEFW_OK;
 }
 
@@ -6004,24 +6813,24 @@ defwBlockagePlacementPartial(double maxDensity)
 int
 defwBlockageMask(int colorMask)
 {
-    if (defVersionNum < 5.8) {
+    if (defwCtx->defVersionNum < 5.8) {
         return DEFW_WRONG_VERSION;
     }
 
-    defwFunc = DEFW_BLOCKAGE_MASK;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_BLOCKAGE_MASK;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     // May be user already define layer
-    if (defwState != DEFW_BLOCKAGE_PLACE && defwState != DEFW_BLOCKAGE_LAYER &&
-        defwState != DEFW_BLOCKAGE_RECT)
+    if (defwCtx->defwState != DEFW_BLOCKAGE_PLACE && defwCtx->defwState != DEFW_BLOCKAGE_LAYER &&
+        defwCtx->defwState != DEFW_BLOCKAGE_RECT)
         return DEFW_BAD_DATA;
 
-    if (defwState == DEFW_BLOCKAGE_RECT)
-        fprintf(defwFile, "\n");   // set a newline for the previous rectangle
+    if (defwCtx->defwState == DEFW_BLOCKAGE_RECT)
+        defwPrintf("\n");   // set a newline for the previous rectangle
 
-    fprintf(defwFile, "     + MASK %d", colorMask);
-    defwLines++;
-    defwState = DEFW_BLOCKAGE_LAYER;
+    defwPrintf("     + MASK %d", colorMask);
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_BLOCKAGE_LAYER;
     return DEFW_OK;
 }
 
@@ -6032,20 +6841,20 @@ defwBlockageRect(int    xl,
                  int    xh,
                  int    yh)
 {
-    defwFunc = DEFW_BLOCKAGE_RECT;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_BLOCKAGE_RECT;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     // May be user already define layer
-    if (defwState != DEFW_BLOCKAGE_PLACE && defwState != DEFW_BLOCKAGE_LAYER &&
-        defwState != DEFW_BLOCKAGE_RECT && defwState != DEFW_BLOCKAGE_MASK)
+    if (defwCtx->defwState != DEFW_BLOCKAGE_PLACE && defwCtx->defwState != DEFW_BLOCKAGE_LAYER &&
+        defwCtx->defwState != DEFW_BLOCKAGE_RECT && defwCtx->defwState != DEFW_BLOCKAGE_MASK)
         return DEFW_BAD_DATA;
 
-    if (defwState == DEFW_BLOCKAGE_RECT)
-        fprintf(defwFile, "\n");   // set a newline for the previous rectangle
+    if (defwCtx->defwState == DEFW_BLOCKAGE_RECT)
+        defwPrintf("\n");   // set a newline for the previous rectangle
 
-    fprintf(defwFile, "     RECT ( %d %d ) ( %d %d )", xl, yl, xh, yh);
-    defwLines++;
-    defwState = DEFW_BLOCKAGE_RECT;
+    defwPrintf("     RECT ( %d %d ) ( %d %d )", xl, yl, xh, yh);
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_BLOCKAGE_RECT;
     return DEFW_OK;
 }
 
@@ -6057,28 +6866,28 @@ defwBlockagePolygon(int num_polys,
 {
     int i;
 
-    defwFunc = DEFW_BLOCKAGE_RECT;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_BLOCKAGE_RECT;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     // May be user already define layer
-    if (defwState != DEFW_BLOCKAGE_LAYER && defwState != DEFW_BLOCKAGE_RECT
-        && defwState != DEFW_BLOCKAGE_MASK)
+    if (defwCtx->defwState != DEFW_BLOCKAGE_LAYER && defwCtx->defwState != DEFW_BLOCKAGE_RECT
+        && defwCtx->defwState != DEFW_BLOCKAGE_MASK)
         return DEFW_BAD_DATA;
 
-    if (defwState == DEFW_BLOCKAGE_RECT)
-        fprintf(defwFile, "\n");   // set a newline for the previous rectangle
+    if (defwCtx->defwState == DEFW_BLOCKAGE_RECT)
+        defwPrintf("\n");   // set a newline for the previous rectangle
 
-    fprintf(defwFile, "     POLYGON ");
+    defwPrintf("     POLYGON ");
     for (i = 0; i < num_polys; i++) {
         if ((i == 0) || ((i % 5) != 0))
-            fprintf(defwFile, "( %d %d ) ", *xl++, *yl++);
+            defwPrintf("( %d %d ) ", *xl++, *yl++);
         else {
-            fprintf(defwFile, "\n             ( %d %d ) ", *xl++, *yl++);
-            defwLines++;
+            defwPrintf("\n             ( %d %d ) ", *xl++, *yl++);
+            defwCtx->defwLines++;
         }
     }
-    defwLines++;
-    defwState = DEFW_BLOCKAGE_RECT;  // use rect flag.  It works the same for poly
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_BLOCKAGE_RECT;  // use rect flag.  It works the same for poly
     return DEFW_OK;
 }
 
@@ -6086,22 +6895,23 @@ defwBlockagePolygon(int num_polys,
 int
 defwEndBlockages()
 {
-    defwFunc = DEFW_BLOCKAGE_END;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_BLOCKAGE_END;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_BLOCKAGE_RECT)
+    if (defwCtx->defwState != DEFW_BLOCKAGE_RECT)
         return DEFW_BAD_ORDER;
-    if (defwCounter > 0)
+    if (defwCtx->defwCounter > 0)
         return DEFW_BAD_DATA;
-    else if (defwCounter < 0)
+    else if (defwCtx->defwCounter < 0)
         return DEFW_TOO_MANY_STMS;
 
-    fprintf(defwFile, " ;\n");
+    defwPrintf(" ;\n");
 
-    fprintf(defwFile, "END BLOCKAGES\n\n");
-    defwLines++;
+    defwPrintf("END BLOCKAGES\n\n");
+    defwCtx->defwLines++;
 
-    defwState = DEFW_BLOCKAGE_END;
+    defwCtx->defwState = DEFW_BLOCKAGE_END;
+    defwTraceSectionEnd("BLOCKAGES");
     return DEFW_OK;
 }
 
@@ -6109,40 +6919,41 @@ defwEndBlockages()
 int
 defwStartSlots(int count)
 {
-    defwFunc = DEFW_SLOT_START;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SLOT_START;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if ((defwState >= DEFW_SLOT_START) && (defwState <= DEFW_SLOT_END))
+    if ((defwCtx->defwState >= DEFW_SLOT_START) && (defwCtx->defwState <= DEFW_SLOT_END))
         return DEFW_BAD_ORDER;
-    if (defVersionNum < 5.4)
+    if (defwCtx->defVersionNum < 5.4)
         return DEFW_WRONG_VERSION;
 
-    fprintf(defwFile, "SLOTS %d ;\n", count);
-    defwLines++;
+    defwPrintf("SLOTS %d ;\n", count);
+    defwCtx->defwLines++;
 
-    defwState = DEFW_SLOT_START;
-    defwCounter = count;
+    defwCtx->defwState = DEFW_SLOT_START;
+    defwCtx->defwCounter = count;
+    defwTraceSectionStart();
     return DEFW_OK;
 }
 
 int
 defwSlotLayer(const char *layerName)
 {
-    defwFunc = DEFW_SLOT_LAYER;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SLOT_LAYER;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     // May be user already define layer
-    if (defwState != DEFW_SLOT_START && defwState == DEFW_SLOT_LAYER)
+    if (defwCtx->defwState != DEFW_SLOT_START && defwCtx->defwState == DEFW_SLOT_LAYER)
         return DEFW_BAD_DATA;
 
     if (!layerName || !*layerName)  // require
         return DEFW_BAD_DATA;
-    if (defwState == DEFW_SLOT_RECT)
-        fprintf(defwFile, " ;\n");   // end the previous rectangle
-    fprintf(defwFile, "   - LAYER %s \n", layerName);
-    defwCounter--;
-    defwLines++;
-    defwState = DEFW_SLOT_LAYER;
+    if (defwCtx->defwState == DEFW_SLOT_RECT)
+        defwPrintf(" ;\n");   // end the previous rectangle
+    defwPrintf("   - LAYER %s \n", layerName);
+    defwCtx->defwCounter--;
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_SLOT_LAYER;
     return DEFW_OK;
 }
 
@@ -6153,19 +6964,19 @@ defwSlotRect(int    xl,
              int    xh,
              int    yh)
 {
-    defwFunc = DEFW_SLOT_RECT;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SLOT_RECT;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     // May be user already define layer
-    if (defwState != DEFW_SLOT_LAYER && defwState != DEFW_SLOT_RECT)
+    if (defwCtx->defwState != DEFW_SLOT_LAYER && defwCtx->defwState != DEFW_SLOT_RECT)
         return DEFW_BAD_DATA;
 
-    if (defwState == DEFW_SLOT_RECT)
-        fprintf(defwFile, "\n");   // set a newline for the previous rectangle
+    if (defwCtx->defwState == DEFW_SLOT_RECT)
+        defwPrintf("\n");   // set a newline for the previous rectangle
 
-    fprintf(defwFile, "     RECT ( %d %d ) ( %d %d )", xl, yl, xh, yh);
-    defwLines++;
-    defwState = DEFW_SLOT_RECT;
+    defwPrintf("     RECT ( %d %d ) ( %d %d )", xl, yl, xh, yh);
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_SLOT_RECT;
     return DEFW_OK;
 }
 
@@ -6177,29 +6988,29 @@ defwSlotPolygon(int     num_polys,
 {
     int i;
 
-    defwFunc = DEFW_SLOT_RECT;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SLOT_RECT;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     // May be user already define layer
-    if (defwState != DEFW_SLOT_LAYER && defwState != DEFW_SLOT_RECT)
+    if (defwCtx->defwState != DEFW_SLOT_LAYER && defwCtx->defwState != DEFW_SLOT_RECT)
         return DEFW_BAD_DATA;
 
-    if (defwState == DEFW_SLOT_RECT)
-        fprintf(defwFile, "\n");   // set a newline for the previous rectangle
+    if (defwCtx->defwState == DEFW_SLOT_RECT)
+        defwPrintf("\n");   // set a newline for the previous rectangle
 
-    fprintf(defwFile, "     POLYGON ");
+    defwPrintf("     POLYGON ");
 
-    printPointsNum = 0;
+    defwCtx->printPointsNum = 0;
     for (i = 0; i < num_polys; i++) {
         if ((i == 0) || ((i % 5) != 0))
-            printPoints(defwFile, *xl++, *yl++, "", " ");
+            printPoints(*xl++, *yl++, "", " ");
         else {
-            printPoints(defwFile, *xl++, *yl++, "\n             ", " ");
-            defwLines++;
+            printPoints(*xl++, *yl++, "\n             ", " ");
+            defwCtx->defwLines++;
         }
     }
-    defwLines++;
-    defwState = DEFW_SLOT_RECT;
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_SLOT_RECT;
     return DEFW_OK;
 }
 
@@ -6207,22 +7018,23 @@ defwSlotPolygon(int     num_polys,
 int
 defwEndSlots()
 {
-    defwFunc = DEFW_SLOT_END;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_SLOT_END;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_SLOT_RECT)
+    if (defwCtx->defwState != DEFW_SLOT_RECT)
         return DEFW_BAD_ORDER;
-    if (defwCounter > 0)
+    if (defwCtx->defwCounter > 0)
         return DEFW_BAD_DATA;
-    else if (defwCounter < 0)
+    else if (defwCtx->defwCounter < 0)
         return DEFW_TOO_MANY_STMS;
 
-    fprintf(defwFile, " ;\n");
+    defwPrintf(" ;\n");
 
-    fprintf(defwFile, "END SLOTS\n\n");
-    defwLines++;
+    defwPrintf("END SLOTS\n\n");
+    defwCtx->defwLines++;
 
-    defwState = DEFW_SLOT_END;
+    defwCtx->defwState = DEFW_SLOT_END;
+    defwTraceSectionEnd("SLOTS");
     return DEFW_OK;
 }
 
@@ -6230,60 +7042,61 @@ defwEndSlots()
 int
 defwStartFills(int count)
 {
-    defwFunc = DEFW_FILL_START;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_FILL_START;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if ((defwState >= DEFW_FILL_START) && (defwState <= DEFW_FILL_END))
+    if ((defwCtx->defwState >= DEFW_FILL_START) && (defwCtx->defwState <= DEFW_FILL_END))
         return DEFW_BAD_ORDER;
-    if (defVersionNum < 5.4)
+    if (defwCtx->defVersionNum < 5.4)
         return DEFW_WRONG_VERSION;
 
-    fprintf(defwFile, "FILLS %d ;\n", count);
-    defwLines++;
+    defwPrintf("FILLS %d ;\n", count);
+    defwCtx->defwLines++;
 
-    defwState = DEFW_FILL_START;
-    defwCounter = count;
+    defwCtx->defwState = DEFW_FILL_START;
+    defwCtx->defwCounter = count;
+    defwTraceSectionStart();
     return DEFW_OK;
 }
 
 int
 defwFillLayer(const char *layerName)
 {
-    defwFunc = DEFW_FILL_LAYER;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_FILL_LAYER;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     // May be user already define layer
-    if (defwState != DEFW_FILL_START && defwState == DEFW_FILL_LAYER)
+    if (defwCtx->defwState != DEFW_FILL_START && defwCtx->defwState == DEFW_FILL_LAYER)
         return DEFW_BAD_DATA;
 
     if (!layerName || !*layerName)  // require
         return DEFW_BAD_DATA;
-    if (defwState == DEFW_FILL_RECT)
-        fprintf(defwFile, " ;\n");   // end the previous rectangle
-    fprintf(defwFile, "   - LAYER %s \n", layerName);
-    defwCounter--;
-    defwLines++;
-    defwState = DEFW_FILL_LAYER;
+    if (defwCtx->defwState == DEFW_FILL_RECT)
+        defwPrintf(" ;\n");   // end the previous rectangle
+    defwPrintf("   - LAYER %s \n", layerName);
+    defwCtx->defwCounter--;
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_FILL_LAYER;
     return DEFW_OK;
 }
 
 int
 defwFillLayerMask(int colorMask)
 {
-    if (defVersionNum < 5.8) {
+    if (defwCtx->defVersionNum < 5.8) {
         return DEFW_WRONG_VERSION;
     }
 
-    defwFunc = DEFW_FILL_LAYERMASK;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_FILL_LAYERMASK;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     // May be user already define layer
-    if (defwState != DEFW_FILL_LAYER)
+    if (defwCtx->defwState != DEFW_FILL_LAYER)
         return DEFW_BAD_DATA;
 
-    fprintf(defwFile, "     + MASK %d", colorMask);
-    defwLines++;
-    defwState = DEFW_FILL_LAYERMASK;
+    defwPrintf("     + MASK %d", colorMask);
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_FILL_LAYERMASK;
     return DEFW_OK;
 }
 
@@ -6292,16 +7105,16 @@ defwFillLayerMask(int colorMask)
 int
 defwFillLayerOPC()
 {
-    defwFunc = DEFW_FILL_OPC;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_FILL_OPC;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     // May be user already define layer
-    if (defwState != DEFW_FILL_LAYER && defwState != DEFW_FILL_LAYERMASK)
+    if (defwCtx->defwState != DEFW_FILL_LAYER && defwCtx->defwState != DEFW_FILL_LAYERMASK)
         return DEFW_BAD_DATA;
 
-    fprintf(defwFile, "     + OPC");
-    defwLines++;
-    defwState = DEFW_FILL_OPC;
+    defwPrintf("     + OPC");
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_FILL_OPC;
     return DEFW_OK;
 }
 
@@ -6311,20 +7124,20 @@ defwFillRect(int    xl,
              int    xh,
              int    yh)
 {
-    defwFunc = DEFW_FILL_RECT;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_FILL_RECT;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     // May be user already define layer
-    if (defwState != DEFW_FILL_LAYER && defwState != DEFW_FILL_RECT &&
-        defwState != DEFW_FILL_OPC && defwState != DEFW_FILL_LAYERMASK)
+    if (defwCtx->defwState != DEFW_FILL_LAYER && defwCtx->defwState != DEFW_FILL_RECT &&
+        defwCtx->defwState != DEFW_FILL_OPC && defwCtx->defwState != DEFW_FILL_LAYERMASK)
         return DEFW_BAD_DATA;
 
-    if (defwState == DEFW_FILL_RECT)
-        fprintf(defwFile, "\n");   // set a newline for the previous rectangle
+    if (defwCtx->defwState == DEFW_FILL_RECT)
+        defwPrintf("\n");   // set a newline for the previous rectangle
 
-    fprintf(defwFile, "     RECT ( %d %d ) ( %d %d )", xl, yl, xh, yh);
-    defwLines++;
-    defwState = DEFW_FILL_RECT;
+    defwPrintf("     RECT ( %d %d ) ( %d %d )", xl, yl, xh, yh);
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_FILL_RECT;
     return DEFW_OK;
 }
 
@@ -6336,29 +7149,29 @@ defwFillPolygon(int     num_polys,
 {
     int i;
 
-    defwFunc = DEFW_FILL_RECT;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_FILL_RECT;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     // May be user already define layer
-    if (defwState != DEFW_FILL_LAYER && defwState != DEFW_FILL_RECT &&
-        defwState != DEFW_FILL_OPC && defwState != DEFW_FILL_LAYERMASK)
+    if (defwCtx->defwState != DEFW_FILL_LAYER && defwCtx->defwState != DEFW_FILL_RECT &&
+        defwCtx->defwState != DEFW_FILL_OPC && defwCtx->defwState != DEFW_FILL_LAYERMASK)
         return DEFW_BAD_DATA;
 
-    if (defwState == DEFW_FILL_RECT)
-        fprintf(defwFile, "\n");   // set a newline for the previous rectangle
+    if (defwCtx->defwState == DEFW_FILL_RECT)
+        defwPrintf("\n");   // set a newline for the previous rectangle
 
-    fprintf(defwFile, "     POLYGON ");
-    printPointsNum = 0;
+    defwPrintf("     POLYGON ");
+    defwCtx->printPointsNum = 0;
     for (i = 0; i < num_polys; i++) {
         if ((i == 0) || ((i % 5) != 0))
-            printPoints(defwFile, *xl++, *yl++, "", " ");
+            printPoints(*xl++, *yl++, "", " ");
         else {
-            printPoints(defwFile, *xl++, *yl++,  "\n             ", " ");
-            defwLines++;
+            printPoints(*xl++, *yl++,  "\n             ", " ");
+            defwCtx->defwLines++;
         }
     }
-    defwLines++;
-    defwState = DEFW_FILL_RECT;
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_FILL_RECT;
     return DEFW_OK;
 }
 
@@ -6366,41 +7179,41 @@ defwFillPolygon(int     num_polys,
 int
 defwFillVia(const char *viaName)
 {
-    defwFunc = DEFW_FILL_LAYER;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_FILL_LAYER;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     // May be user already define layer
-    if (defwState != DEFW_FILL_START && defwState == DEFW_FILL_LAYER)
+    if (defwCtx->defwState != DEFW_FILL_START && defwCtx->defwState == DEFW_FILL_LAYER)
         return DEFW_BAD_DATA;
 
     if (!viaName || !*viaName)  // require
         return DEFW_BAD_DATA;
-    if (defwState == DEFW_FILL_RECT)
-        fprintf(defwFile, " ;\n");   // end the previous rectangle
-    fprintf(defwFile, "   - VIA %s \n", viaName);
-    defwCounter--;
-    defwLines++;
-    defwState = DEFW_FILL_VIA;
+    if (defwCtx->defwState == DEFW_FILL_RECT)
+        defwPrintf(" ;\n");   // end the previous rectangle
+    defwPrintf("   - VIA %s \n", viaName);
+    defwCtx->defwCounter--;
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_FILL_VIA;
     return DEFW_OK;
 }
 
 int
 defwFillViaMask(int maskColor)
 {
-    if (defVersionNum < 5.8) {
+    if (defwCtx->defVersionNum < 5.8) {
         return DEFW_WRONG_VERSION;
     }
 
-    defwFunc = DEFW_FILL_VIAMASK;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_FILL_VIAMASK;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     // May be user already define layer
-    if (defwState != DEFW_FILL_VIA)
+    if (defwCtx->defwState != DEFW_FILL_VIA)
         return DEFW_BAD_DATA;
 
-    fprintf(defwFile, "     + MASK %d", maskColor);
-    defwLines++;
-    defwState = DEFW_FILL_VIAMASK;
+    defwPrintf("     + MASK %d", maskColor);
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_FILL_VIAMASK;
     return DEFW_OK;
 }
 
@@ -6409,16 +7222,16 @@ defwFillViaMask(int maskColor)
 int
 defwFillViaOPC()
 {
-    defwFunc = DEFW_FILL_OPC;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_FILL_OPC;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     // May be user already define layer
-    if (defwState != DEFW_FILL_VIA && defwState != DEFW_FILL_VIAMASK)
+    if (defwCtx->defwState != DEFW_FILL_VIA && defwCtx->defwState != DEFW_FILL_VIAMASK)
         return DEFW_BAD_DATA;
 
-    fprintf(defwFile, "     + OPC");
-    defwLines++;
-    defwState = DEFW_FILL_OPC;
+    defwPrintf("     + OPC");
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_FILL_OPC;
     return DEFW_OK;
 }
 
@@ -6430,31 +7243,31 @@ defwFillPoints(int      num_points,
 {
     int i;
 
-    defwFunc = DEFW_FILL_RECT;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_FILL_RECT;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     // May be user already define layer
-    if (defwState != DEFW_FILL_VIA && defwState != DEFW_FILL_RECT &&
-        defwState != DEFW_FILL_OPC && defwState != DEFW_FILL_VIAMASK)
+    if (defwCtx->defwState != DEFW_FILL_VIA && defwCtx->defwState != DEFW_FILL_RECT &&
+        defwCtx->defwState != DEFW_FILL_OPC && defwCtx->defwState != DEFW_FILL_VIAMASK)
         return DEFW_BAD_DATA;
 
-    if (defwState == DEFW_FILL_RECT)
-        fprintf(defwFile, "\n");   // set a newline for the previous rectangle
+    if (defwCtx->defwState == DEFW_FILL_RECT)
+        defwPrintf("\n");   // set a newline for the previous rectangle
 
-    fprintf(defwFile, "     ");
-    printPointsNum = 0;
+    defwPrintf("     ");
+    defwCtx->printPointsNum = 0;
 
     for (i = 0; i < num_points; i++) {
         if ((i == 0) || ((i % 5) != 0))
-            printPoints(defwFile, *xl++, *yl++, "", " ");
+            printPoints(*xl++, *yl++, "", " ");
         else {
-            printPoints(defwFile, *xl++, *yl++, "\n             ", " ");
-            defwLines++;
+            printPoints(*xl++, *yl++, "\n             ", " ");
+            defwCtx->defwLines++;
         }
     }
 
-    defwLines++;
-    defwState = DEFW_FILL_RECT;
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_FILL_RECT;
     return DEFW_OK;
 }
 
@@ -6462,22 +7275,23 @@ defwFillPoints(int      num_points,
 int
 defwEndFills()
 {
-    defwFunc = DEFW_FILL_END;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_FILL_END;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_FILL_RECT && defwState != DEFW_FILL_OPC)
+    if (defwCtx->defwState != DEFW_FILL_RECT && defwCtx->defwState != DEFW_FILL_OPC)
         return DEFW_BAD_ORDER;
-    if (defwCounter > 0)
+    if (defwCtx->defwCounter > 0)
         return DEFW_BAD_DATA;
-    else if (defwCounter < 0)
+    else if (defwCtx->defwCounter < 0)
         return DEFW_TOO_MANY_STMS;
 
-    fprintf(defwFile, " ;\n");
+    defwPrintf(" ;\n");
 
-    fprintf(defwFile, "END FILLS\n\n");
-    defwLines++;
+    defwPrintf("END FILLS\n\n");
+    defwCtx->defwLines++;
 
-    defwState = DEFW_FILL_END;
+    defwCtx->defwState = DEFW_FILL_END;
+    defwTraceSectionEnd("FILLS");
     return DEFW_OK;
 }
 
@@ -6485,19 +7299,20 @@ defwEndFills()
 int
 defwStartNonDefaultRules(int count)
 {
-    defwFunc = DEFW_NDR_START;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_NDR_START;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if ((defwState >= DEFW_NDR_START) && (defwState <= DEFW_NDR_END))
+    if ((defwCtx->defwState >= DEFW_NDR_START) && (defwCtx->defwState <= DEFW_NDR_END))
         return DEFW_BAD_ORDER;
-    if (defVersionNum < 5.6)
+    if (defwCtx->defVersionNum < 5.6)
         return DEFW_WRONG_VERSION;
 
-    fprintf(defwFile, "NONDEFAULTRULES %d ;\n", count);
-    defwLines++;
+    defwPrintf("NONDEFAULTRULES %d ;\n", count);
+    defwCtx->defwLines++;
 
-    defwState = DEFW_NDR_START;
-    defwCounter = count;
+    defwCtx->defwState = DEFW_NDR_START;
+    defwCtx->defwCounter = count;
+    defwTraceSectionStart();
     return DEFW_OK;
 }
 
@@ -6505,23 +7320,23 @@ int
 defwNonDefaultRule(const char   *ruleName,
                    int          hardSpacing)
 {
-    defwFunc = DEFW_NDR;
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_NDR;
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     // May be user already define layer
-    if (defwState != DEFW_NDR_START && defwState != DEFW_NDR)
+    if (defwCtx->defwState != DEFW_NDR_START && defwCtx->defwState != DEFW_NDR)
         return DEFW_BAD_ORDER;
 
     if (!ruleName || !*ruleName)  // require
         return DEFW_BAD_DATA;
-    if (defwState == DEFW_NDR)
-        fprintf(defwFile, ";\n");
-    fprintf(defwFile, "   - %s", ruleName);
+    if (defwCtx->defwState == DEFW_NDR)
+        defwPrintf(";\n");
+    defwPrintf("   - %s", ruleName);
     if (hardSpacing)
-        fprintf(defwFile, "\n      + HARDSPACING");
-    defwCounter--;
-    defwLines++;
-    defwState = DEFW_NDR;
+        defwPrintf("\n      + HARDSPACING");
+    defwCtx->defwCounter--;
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_NDR;
     return DEFW_OK;
 }
 
@@ -6533,61 +7348,61 @@ defwNonDefaultRuleLayer(const char  *layerName,
                         int         spacing,
                         int         wireExt)
 {
-    defwFunc = DEFW_NDR;
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_NDR;
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     // May be user already define layer
-    if (defwState != DEFW_NDR)
+    if (defwCtx->defwState != DEFW_NDR)
         return DEFW_BAD_ORDER;
 
     if (!layerName || !*layerName)  // require
         return DEFW_BAD_DATA;
-    fprintf(defwFile, "\n      + LAYER %s ", layerName);
-    fprintf(defwFile, " WIDTH %d ", width);
+    defwPrintf("\n      + LAYER %s ", layerName);
+    defwPrintf(" WIDTH %d ", width);
     if (diagWidth)
-        fprintf(defwFile, " DIAGWIDTH %d ", diagWidth);
+        defwPrintf(" DIAGWIDTH %d ", diagWidth);
     if (spacing)
-        fprintf(defwFile, " SPACING %d ", spacing);
+        defwPrintf(" SPACING %d ", spacing);
     if (wireExt)
-        fprintf(defwFile, " WIREEXT %d ", wireExt);
-    defwLines++;
-    defwState = DEFW_NDR;
+        defwPrintf(" WIREEXT %d ", wireExt);
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_NDR;
     return DEFW_OK;
 }
 
 int
 defwNonDefaultRuleVia(const char *viaName)
 {
-    defwFunc = DEFW_NDR;
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_NDR;
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     // May be user already define layer
-    if (defwState != DEFW_NDR)
+    if (defwCtx->defwState != DEFW_NDR)
         return DEFW_BAD_ORDER;
 
     if (!viaName || !*viaName)  // require
         return DEFW_BAD_DATA;
-    fprintf(defwFile, "\n      + VIA %s ", viaName);
-    defwLines++;
-    defwState = DEFW_NDR;
+    defwPrintf("\n      + VIA %s ", viaName);
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_NDR;
     return DEFW_OK;
 }
 
 int
 defwNonDefaultRuleViaRule(const char *viaRuleName)
 {
-    defwFunc = DEFW_NDR;
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_NDR;
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     // May be user already define layer
-    if (defwState != DEFW_NDR)
+    if (defwCtx->defwState != DEFW_NDR)
         return DEFW_BAD_ORDER;
 
     if ((viaRuleName == 0) || (*viaRuleName == 0))  // require
         return DEFW_BAD_DATA;
-    fprintf(defwFile, "\n      + VIARULE %s ", viaRuleName);
-    defwLines++;
-    defwState = DEFW_NDR;
+    defwPrintf("\n      + VIARULE %s ", viaRuleName);
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_NDR;
     return DEFW_OK;
 }
 
@@ -6595,38 +7410,39 @@ int
 defwNonDefaultRuleMinCuts(const char    *cutLayerName,
                           int           numCuts)
 {
-    defwFunc = DEFW_NDR;
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_NDR;
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     // May be user already define layer
-    if (defwState != DEFW_NDR)
+    if (defwCtx->defwState != DEFW_NDR)
         return DEFW_BAD_ORDER;
 
     if ((cutLayerName == 0) || (*cutLayerName == 0))  // require
         return DEFW_BAD_DATA;
-    fprintf(defwFile, "\n      + MINCUTS %s %d ", cutLayerName, numCuts);
-    defwLines++;
-    defwState = DEFW_NDR;
+    defwPrintf("\n      + MINCUTS %s %d ", cutLayerName, numCuts);
+    defwCtx->defwLines++;
+    defwCtx->defwState = DEFW_NDR;
     return DEFW_OK;
 }
 
 int
 defwEndNonDefaultRules()
 {
-    defwFunc = DEFW_NDR_END;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_NDR_END;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_NDR)
+    if (defwCtx->defwState != DEFW_NDR)
         return DEFW_BAD_ORDER;
-    if (defwCounter > 0)
+    if (defwCtx->defwCounter > 0)
         return DEFW_BAD_DATA;
-    else if (defwCounter < 0)
+    else if (defwCtx->defwCounter < 0)
         return DEFW_TOO_MANY_STMS;
 
-    fprintf(defwFile, ";\nEND NONDEFAULTRULES\n\n");
-    defwLines++;
+    defwPrintf(";\nEND NONDEFAULTRULES\n\n");
+    defwCtx->defwLines++;
 
-    defwState = DEFW_NDR_END;
+    defwCtx->defwState = DEFW_NDR_END;
+    defwTraceSectionEnd("NONDEFAULTRULES");
     return DEFW_OK;
 }
 
@@ -6634,19 +7450,20 @@ defwEndNonDefaultRules()
 int
 defwStartStyles(int count)
 {
-    defwFunc = DEFW_STYLES_START;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_STYLES_START;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if ((defwState >= DEFW_STYLES_START) && (defwState <= DEFW_STYLES_END))
+    if ((defwCtx->defwState >= DEFW_STYLES_START) && (defwCtx->defwState <= DEFW_STYLES_END))
         return DEFW_BAD_ORDER;
-    if (defVersionNum < 5.6)
+    if (defwCtx->defVersionNum < 5.6)
         return DEFW_WRONG_VERSION;
 
-    fprintf(defwFile, "STYLES %d ;\n", count);
-    defwLines++;
+    defwPrintf("STYLES %d ;\n", count);
+    defwCtx->defwLines++;
 
-    defwState = DEFW_STYLES_START;
-    defwCounter = count;
+    defwCtx->defwState = DEFW_STYLES_START;
+    defwCtx->defwCounter = count;
+    defwTraceSectionStart();
     return DEFW_OK;
 }
 
@@ -6658,51 +7475,52 @@ defwStyles(int      styleNums,
 {
     int i;
 
-    defwFunc = DEFW_STYLES;
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_STYLES;
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
     // May be user already define layer
-    if (defwState != DEFW_STYLES_START && defwState != DEFW_STYLES)
+    if (defwCtx->defwState != DEFW_STYLES_START && defwCtx->defwState != DEFW_STYLES)
         return DEFW_BAD_ORDER;
 
     if (styleNums < 0)  // require
         return DEFW_BAD_DATA;
-    fprintf(defwFile, "   - STYLE %d ", styleNums);
+    defwPrintf("   - STYLE %d ", styleNums);
 
-    printPointsNum = 0;
+    defwCtx->printPointsNum = 0;
     for (i = 0; i < num_points; i++) {
         if ((i == 0) || ((i % 5) != 0))
-            printPoints(defwFile, *xp++, *yp++, "", " ");
+            printPoints(*xp++, *yp++, "", " ");
         else {
-            printPoints(defwFile, *xp++, *yp++, "\n       ", " ");
-            defwLines++;
+            printPoints(*xp++, *yp++, "\n       ", " ");
+            defwCtx->defwLines++;
         }
     }
 
-    defwCounter--;
-    defwLines++;
-    fprintf(defwFile, ";\n");
-    defwState = DEFW_STYLES;
+    defwCtx->defwCounter--;
+    defwCtx->defwLines++;
+    defwPrintf(";\n");
+    defwCtx->defwState = DEFW_STYLES;
     return DEFW_OK;
 }
 
 int
 defwEndStyles()
 {
-    defwFunc = DEFW_STYLES_END;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_STYLES_END;   // Current function of writer
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (defwState != DEFW_STYLES)
+    if (defwCtx->defwState != DEFW_STYLES)
         return DEFW_BAD_ORDER;
-    if (defwCounter > 0)
+    if (defwCtx->defwCounter > 0)
         return DEFW_BAD_DATA;
-    else if (defwCounter < 0)
+    else if (defwCtx->defwCounter < 0)
         return DEFW_TOO_MANY_STMS;
 
-    fprintf(defwFile, "END STYLES\n\n");
-    defwLines++;
+    defwPrintf("END STYLES\n\n");
+    defwCtx->defwLines++;
 
-    defwState = DEFW_STYLES_END;
+    defwCtx->defwState = DEFW_STYLES_END;
+    defwTraceSectionEnd("STYLES");
     return DEFW_OK;
 }
 
@@ -6710,38 +7528,38 @@ defwEndStyles()
 int
 defwStartBeginext(const char *name)
 {
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (!defwDidInit)
+    if (!defwCtx->defwDidInit)
         return DEFW_BAD_ORDER;
-    if (defwState == DEFW_BEGINEXT_START ||
-        defwState == DEFW_BEGINEXT)
+    if (defwCtx->defwState == DEFW_BEGINEXT_START ||
+        defwCtx->defwState == DEFW_BEGINEXT)
         return DEFW_BAD_ORDER;
     if (!name || name == 0 || *name == 0)
         return DEFW_BAD_DATA;
-    fprintf(defwFile, "BEGINEXT \"%s\"\n", name);
+    defwPrintf("BEGINEXT \"%s\"\n", name);
 
-    defwState = DEFW_BEGINEXT_START;
-    defwLines++;
+    defwCtx->defwState = DEFW_BEGINEXT_START;
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
 int
 defwBeginextCreator(const char *creatorName)
 {
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (!defwDidInit)
+    if (!defwCtx->defwDidInit)
         return DEFW_BAD_ORDER;
-    if (defwState != DEFW_BEGINEXT_START &&
-        defwState != DEFW_BEGINEXT)
+    if (defwCtx->defwState != DEFW_BEGINEXT_START &&
+        defwCtx->defwState != DEFW_BEGINEXT)
         return DEFW_BAD_ORDER;
     if (!creatorName || creatorName == 0 || *creatorName == 0)
         return DEFW_BAD_DATA;
-    fprintf(defwFile, "   CREATOR \"%s\"\n", creatorName);
+    defwPrintf("   CREATOR \"%s\"\n", creatorName);
 
-    defwState = DEFW_BEGINEXT;
-    defwLines++;
+    defwCtx->defwState = DEFW_BEGINEXT;
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -6752,21 +7570,21 @@ defwBeginextDate()
     time_t  todayTime;
     char    *rettime;
 
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (!defwDidInit)
+    if (!defwCtx->defwDidInit)
         return DEFW_BAD_ORDER;
-    if (defwState != DEFW_BEGINEXT_START &&
-        defwState != DEFW_BEGINEXT)
+    if (defwCtx->defwState != DEFW_BEGINEXT_START &&
+        defwCtx->defwState != DEFW_BEGINEXT)
         return DEFW_BAD_ORDER;
 
     todayTime = time(NULL);             // time in UTC 
     rettime = ctime(&todayTime);        // convert to string
     rettime[strlen(rettime) - 1] = '\0';  // replace \n with \0
-    fprintf(defwFile, "   DATE \"%s\"", rettime);
+    defwPrintf("   DATE \"%s\"", rettime);
 
-    defwState = DEFW_BEGINEXT;
-    defwLines++;
+    defwCtx->defwState = DEFW_BEGINEXT;
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -6775,17 +7593,17 @@ int
 defwBeginextRevision(int    vers1,
                      int    vers2)
 {
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (!defwDidInit)
+    if (!defwCtx->defwDidInit)
         return DEFW_BAD_ORDER;
-    if (defwState != DEFW_BEGINEXT_START &&
-        defwState != DEFW_BEGINEXT)
+    if (defwCtx->defwState != DEFW_BEGINEXT_START &&
+        defwCtx->defwState != DEFW_BEGINEXT)
         return DEFW_BAD_ORDER;
-    fprintf(defwFile, "\n   REVISION %d.%d", vers1, vers2);
+    defwPrintf("\n   REVISION %d.%d", vers1, vers2);
 
-    defwState = DEFW_BEGINEXT;
-    defwLines++;
+    defwCtx->defwState = DEFW_BEGINEXT;
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -6794,17 +7612,17 @@ int
 defwBeginextSyntax(const char   *title,
                    const char   *string)
 {
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (!defwDidInit)
+    if (!defwCtx->defwDidInit)
         return DEFW_BAD_ORDER;
-    if (defwState != DEFW_BEGINEXT_START &&
-        defwState != DEFW_BEGINEXT)
+    if (defwCtx->defwState != DEFW_BEGINEXT_START &&
+        defwCtx->defwState != DEFW_BEGINEXT)
         return DEFW_BAD_ORDER;
-    fprintf(defwFile, "\n   - %s %s", title, string);
+    defwPrintf("\n   - %s %s", title, string);
 
-    defwState = DEFW_BEGINEXT;
-    defwLines++;
+    defwCtx->defwState = DEFW_BEGINEXT;
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -6812,17 +7630,17 @@ defwBeginextSyntax(const char   *title,
 int
 defwEndBeginext()
 {
-    if (!defwFile)
+    if (!defwCtx->defwFile)
         return DEFW_UNINITIALIZED;
-    if (!defwDidInit)
+    if (!defwCtx->defwDidInit)
         return DEFW_BAD_ORDER;
-    if (defwState != DEFW_BEGINEXT_START &&
-        defwState != DEFW_BEGINEXT)
+    if (defwCtx->defwState != DEFW_BEGINEXT_START &&
+        defwCtx->defwState != DEFW_BEGINEXT)
         return DEFW_BAD_ORDER;
-    fprintf(defwFile, ";\nENDEXT\n\n");
+    defwPrintf(";\nENDEXT\n\n");
 
-    defwState = DEFW_BEGINEXT_END;
-    defwLines++;
+    defwCtx->defwState = DEFW_BEGINEXT_END;
+    defwCtx->defwLines++;
     return DEFW_OK;
 }
 
@@ -6830,17 +7648,18 @@ defwEndBeginext()
 int
 defwEnd()
 {
-    defwFunc = DEFW_END;   // Current function of writer
-    if (!defwFile)
+    defwCtx->defwFunc = DEFW_END;   // Current function of writer
+    if (!defwCtx->defwFile)
         return 1;
 
-    if (defwState == DEFW_ROW)
-        fprintf(defwFile, ";\n\n");  // add the ; and \n for the previous row.
+    if (defwCtx->defwState == DEFW_ROW)
+        defwPrintf(";\n\n");  // add the ; and \n for the previous row.
 
-    fprintf(defwFile, "END DESIGN\n\n");
-    defwLines++;
+    defwPrintf("END DESIGN\n\n");
+    defwCtx->defwLines++;
+    defwFlushOutputBuffer();
     //defwFile = 0;
-    defwState = DEFW_DONE;
+    defwCtx->defwState = DEFW_DONE;
     return DEFW_OK;
 }
 
@@ -6848,7 +7667,7 @@ defwEnd()
 int
 defwCurrentLineNumber()
 {
-    return defwLines;
+    return defwCtx->defwLines;
 }
 
 
@@ -6857,30 +7676,30 @@ defwPrintError(int status)
 {
     switch (status) {
     case DEFW_OK:
-        fprintf(defwFile, "No Error.\n");
+        defwPrintf("No Error.\n");
         break;
     case DEFW_UNINITIALIZED:
         printf("Need to call defwInit first.\n");
         break;
     case DEFW_BAD_ORDER:
-        fprintf(defwFile, "%s - Incorrect order of data.\n",
-                defwStateStr[defwFunc]);
+        defwPrintf("%s - Incorrect order of data.\n",
+                defwStateStr[defwCtx->defwFunc]);
         break;
     case DEFW_BAD_DATA:
-        fprintf(defwFile, "%s - Invalid data.\n",
-                defwStateStr[defwFunc]);
+        defwPrintf("%s - Invalid data.\n",
+                defwStateStr[defwCtx->defwFunc]);
         break;
     case DEFW_ALREADY_DEFINED:
-        fprintf(defwFile, "%s - Section is allowed to define only once.\n",
-                defwStateStr[defwFunc]);
+        defwPrintf("%s - Section is allowed to define only once.\n",
+                defwStateStr[defwCtx->defwFunc]);
         break;
     case DEFW_WRONG_VERSION:
-        fprintf(defwFile, "%s - Version number is set before 5.6, but 5.6 API is used.\n",
-                defwStateStr[defwFunc]);
+        defwPrintf("%s - Version number is set before 5.6, but 5.6 API is used.\n",
+                defwStateStr[defwCtx->defwFunc]);
         break;
     case DEFW_OBSOLETE:
-        fprintf(defwFile, "%s - is no longer valid in 5.6.\n",
-                defwStateStr[defwObsoleteNum]);
+        defwPrintf("%s - is no longer valid in 5.6.\n",
+                defwStateStr[defwCtx->defwObsoleteNum]);
         break;
     }
     return;
@@ -6891,7 +7710,7 @@ void
 defwAddComment(const char *comment)
 {
     if (comment)
-        fprintf(defwFile, "# %s\n", comment);
+        defwPrintf("# %s\n", comment);
     return;
 }
 
@@ -6899,7 +7718,7 @@ defwAddComment(const char *comment)
 void
 defwAddIndent()
 {
-    fprintf(defwFile, "   ");
+    defwPrintf("   ");
     return;
 }
 
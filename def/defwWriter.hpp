@@ -39,6 +39,8 @@
 
 BEGIN_LEFDEF_PARSER_NAMESPACE
 
+class defwContext;
+
 /* Return codes for writing functions: */
 #define DEFW_OK                0
 #define DEFW_UNINITIALIZED     1
@@ -62,6 +64,74 @@ BEGIN_LEFDEF_PARSER_NAMESPACE
    7 = FE
 */
 
+/* Output sink.  By default the writer writes with stdio to the FILE*
+ * given to defwInit or defwInitCbk.  A write function replaces stdio:
+ * it is called with that FILE* (which may then be NULL or any handle
+ * cast to FILE*) and must return the number of bytes written.
+ * Set the sink before defwInit or defwInitCbk. */
+typedef size_t (*DEFW_WRITE_FUNCTION) (FILE*, const char*, size_t);
+extern void defwSetWriteFunction (DEFW_WRITE_FUNCTION);
+extern void defwUnsetWriteFunction ();
+
+/* Collect the output in a user space buffer of the given size and pass
+ * it to the sink in large blocks.  0, the default, turns it off.  The
+ * buffer is flushed by defwFlush and defwEnd. */
+extern int defwSetOutputBufferSize (size_t size);
+extern int defwFlush ();
+
+/* Built in sinks.  The memory sink keeps the output in a NUL terminated
+ * buffer owned by the writer, valid until the next write or
+ * defwMemorySinkClear.  The file descriptor sink writes with write(2),
+ * and with writev(2) to pass the buffer and a block that does not fit
+ * in it in one call when useWritev is set. */
+extern void defwSetMemorySink ();
+extern const char* defwMemorySinkData (size_t* size);
+extern void defwMemorySinkClear ();
+extern void defwSetFdSink (int fd, int useWritev);
+
+/* Writer contexts.  All the writer state, including the output sink,
+ * lives in a defwContext.  Every thread starts out with a default
+ * context shared by all threads; a thread that writes its own DEF
+ * concurrently with others makes a context with defwNewContext and
+ * makes it current with defwSetContext before calling defwInit.
+ * defwSetContext returns the previous context, NULL restores the
+ * default one.  A context must only be used by one thread at a time.
+ * The callback writer (defwInitCbk, defwWrite) is not reentrant. */
+extern defwContext* defwNewContext ();
+extern void defwDeleteContext (defwContext* context);
+extern defwContext* defwSetContext (defwContext* context);
+extern defwContext* defwGetContext ();
+
+/* Parallel section formatting.  After defwStartComponents,
+ * defwStartNets or defwStartSpecialNets, defwNewChunk makes a context
+ * that formats part of that section into its own memory.  Each chunk
+ * is made current in a worker thread with defwSetContext and filled
+ * with complete statements (defwComponent..., or defwNet ...
+ * defwNetEndOneNet).  Back in the writing thread the chunks are added
+ * in order with defwAppendChunk, which gives the same output, line
+ * and statement counts as writing the statements directly.  An
+ * appended chunk is empty again and can be reused; free it with
+ * defwDeleteContext.  defwNewChunk returns NULL outside of those
+ * sections. */
+extern defwContext* defwNewChunk ();
+extern int defwAppendChunk (defwContext* chunk);
+
+/* Splice writing.  Copies length bytes at offset of the file open on fd
+ * (typically the input DEF, with the ranges of defrGetSourceMap) to the
+ * output, so that unchanged sections or statements need not be parsed
+ * into objects and written again.  numLines is added to the line count
+ * and numStatements is counted against the count of the current
+ * section, as if the statements had been written.  A component, row
+ * or pin the writer has not ended yet is ended first.  section is the
+ * defiSection_e of a whole section being copied (defiSourceRange
+ * section), after which the writer is in the same state as after the
+ * End routine of that section, or defiSectionUnknown (0) for
+ * statements and the text between sections.  With the file descriptor
+ * sink the copy is done with copy_file_range(2) where possible.
+ * Returns 0 if successful. */
+extern int defwCopyRange (int fd, long long offset, long long length,
+                          int numLines, int numStatements, int section);
+
 /* This routine will write a new line */
 extern int defwNewLine();
 
@@ -540,6 +610,39 @@ extern int defwComponent(const char* instance,  /* compName */
               int xh, int yh);              /* optional(0) - region pt2 */
 
 
+/* The arguments of defwComponent as a record. */
+struct defwComponentRec {
+    const char*  instance;
+    const char*  master;
+    int          numNetName;
+    const char** netNames;
+    const char*  eeq;
+    const char*  genName;
+    const char*  genParemeters;
+    const char*  source;
+    int          numForeign;
+    const char** foreigns;
+    int*         foreignX;
+    int*         foreignY;
+    int*         foreignOrients;
+    const char*  status;
+    int          statusX;
+    int          statusY;
+    int          statusOrient;
+    double       weight;
+    const char*  region;
+    int          xl;
+    int          yl;
+    int          xh;
+    int          yh;
+};
+
+/* This routine enters n components into the file, the same as calling
+ * defwComponent for each record.  The writer state is checked once.
+ * Returns 0 if successful, otherwise the status of the first record
+ * that failed; the records before it have been written. */
+extern int defwComponentsBulk(const defwComponentRec* recs, size_t n);
+
 /* This routine enter each component into the file.
  * This routine must be called after the defwStartComponents call.
  * The optional fields will be ignored if they are set to zero
@@ -1021,11 +1124,26 @@ extern int defwStartNets(int count);
 extern int defwNet(const char* name);
 
 /* This routine is for { compName | PIN } pinName [+ SYNTHESIZED] */
-/* It can be called multiple times */
+/* It can be called multiple times.  inst and pin are required. */
 extern int defwNetConnection(const char* inst,    /* compName */
                    const char* pin,      /* pinName */
                    int synthesized);    /* 0 - ignore, 1 - SYNTHESIZED */
 
+/* A { compName | PIN } pinName [+ SYNTHESIZED] connection. */
+struct defwNetConnectionRec {
+    const char* inst;         /* compName */
+    const char* pin;          /* pinName */
+    int         synthesized;  /* 0 - ignore, 1 - SYNTHESIZED */
+};
+
+/* This routine enters n connections of the current net, the same as
+ * calling defwNetConnection for each record.  Returns 0 if successful,
+ * otherwise the status of the first record that failed, DEFW_BAD_DATA
+ * for a record without inst or pin; the records before it have been
+ * written. */
+extern int defwNetConnectionsBulk(const defwNetConnectionRec* conns,
+                                  size_t n);
+
 /* This routine is for MUSTJOIN, compName, pinName */
 extern int defwNetMustjoinConnection(const char* inst,  /* compName */
                                      const char* pin);     /* pinName */
@@ -48,6 +48,7 @@
 
 #include "defwWriterCalls.hpp"
 #include "defwWriter.hpp"
+#include "defwContext.hpp"
 #include <stdlib.h>
 #include <string.h>
 #include "lex.h"
@@ -94,8 +95,6 @@ BEGIN_LEFDEF_PARSER_NAMESPACE
 /* NEW CALLBACK - then place it here. */
 
 int defWRetVal;
-extern int defwHasInit;
-extern int defwHasInitCbk;
 
 DEFI_LOG_FUNCTION defwErrorLogFunction;
 DEFI_WARNING_LOG_FUNCTION defwWarningLogFunction;
@@ -123,7 +122,7 @@ defiUserData defwUserData = 0;
 static char* defwFileName = 0;
 static int defwRegisterUnused = 0;
 
-extern FILE* defwFile;
+extern void defwSetOutputFile(FILE* f);
 
 ////////////////////////////////////
 //
@@ -295,17 +294,17 @@ const char* defwFName() {
 int defwWrite(FILE* f, const char* fName, defiUserData uData) {
   int i;
 
-  if (defwHasInit == 0 && defwHasInitCbk == 0) {
+  if (defwCtx->defwHasInit == 0 && defwCtx->defwHasInitCbk == 0) {
     fprintf(stderr, "ERROR DEFWRIT-9010): The function defwWrite is called before the function defwInitCbk.\nYou need to call defwInitCbk before calling any other functions.\nUpdate your program and then try again.");
     return -1;
   }
 
-  if (defwHasInit) {
+  if (defwCtx->defwHasInit) {
     fprintf(stderr, "ERROR DEFWRIT-9011): You program has called the function defwInit to initialize the writer.\nIf you want to use the callback option you need to use the function defwInitCbk.");
   }
 
   defwFileName = (char*)fName;
-  defwFile = f;
+  defwSetOutputFile(f);
   defwUserData = uData;
 
   // Loop through the list of callbacks and call the user define
@@ -28,11 +28,11 @@
  ******************************************************************************/
 
 #include "defiKRDefs.hpp"
+#include "defiAlloc.hpp"
 
 
 BEGIN_LEFDEF_PARSER_NAMESPACE
 
-extern int yylex();
 extern void lex_init();
 extern void lex_un_init();
 extern int defyyparse();
@@ -47,7 +47,18 @@ void defInfo(int msgNum, const char *s);
 void* defMalloc(size_t def_size);
 void* defRealloc(void *name, size_t def_size);
 void defFree(void *name);
+void* defMallocType(size_t def_size, int type);
+void* defReallocType(void *name, size_t def_size, int type);
+void defSetAlias(const char *name, const char *value);
+void defProgress(int force);
 
 int fake_ftell();
 
 END_LEFDEF_PARSER_NAMESPACE
+
+// A file that defines DEF_ALLOC_TYPE before including lex.h accounts its
+// allocations to that defiAllocType_e, see defrSetAllocAccounting().
+#ifdef DEF_ALLOC_TYPE
+#define defMalloc(size) defMallocType(size, DEF_ALLOC_TYPE)
+#define defRealloc(name, size) defReallocType(name, size, DEF_ALLOC_TYPE)
+#endif
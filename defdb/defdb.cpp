@@ -0,0 +1,1499 @@
+// *****************************************************************************
+// *****************************************************************************
+// Copyright 2013-2014, Cadence Design Systems
+// 
+// This  file  is  part  of  the  Cadence  LEF/DEF  Open   Source
+// Distribution,  Product Version 5.8. 
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+//    implied. See the License for the specific language governing
+//    permissions and limitations under the License.
+// 
+// For updates, support, or to become part of the LEF/DEF Community,
+// check www.openeda.org for details.
+// 
+//  $Author$
+//  $Revision$
+//  $Date$
+//  $State:  $
+// *****************************************************************************
+// *****************************************************************************
+
+#include <string.h>
+#include "defdb.hpp"
+#include "defiBlockage.hpp"
+#include "defiComponent.hpp"
+#include "defiMisc.hpp"
+#include "defiNet.hpp"
+#include "defiPinCap.hpp"
+#include "defiRegion.hpp"
+#include "defiSite.hpp"
+#include "defiVia.hpp"
+
+BEGIN_LEFDEF_PARSER_NAMESPACE
+
+////////////////////////////////////////////////////
+//
+//    defdbNameTable
+//
+////////////////////////////////////////////////////
+
+defdbNameTable::defdbNameTable()
+{
+}
+
+
+defdbNameTable::~defdbNameTable()
+{
+}
+
+
+void
+defdbNameTable::clear()
+{
+    table_.clear();
+}
+
+
+int
+defdbNameTable::intern(const char* name)
+{
+    return table_.addName(name);
+}
+
+
+int
+defdbNameTable::find(const char* name) const
+{
+    return table_.findName(name);
+}
+
+
+int
+defdbNameTable::numNames() const
+{
+    return table_.numNames();
+}
+
+
+const char*
+defdbNameTable::name(int id) const
+{
+    const char* str = table_.name(id);
+
+    return str ? str : "";
+}
+
+
+////////////////////////////////////////////////////
+//
+//    defdbNets
+//
+////////////////////////////////////////////////////
+
+defdbNets::defdbNets()
+{
+    connBegin_.push_back(0);
+}
+
+
+defdbNets::~defdbNets()
+{
+}
+
+
+void
+defdbNets::clear()
+{
+    nameId_.clear();
+    connBegin_.clear();
+    connBegin_.push_back(0);
+    routed_.clear();
+    connComp_.clear();
+    connPin_.clear();
+    connSyn_.clear();
+    byName_.clear();
+}
+
+
+int
+defdbNets::addNet(int nameId, int isRouted)
+{
+    int net = (int) nameId_.size();
+
+    // The connections added since the previous net belong to this one.
+    nameId_.push_back(nameId);
+    routed_.push_back(isRouted ? 1 : 0);
+    connBegin_.push_back((int) connComp_.size());
+
+    if (nameId >= (int) byName_.size()) {
+        byName_.resize(nameId + 1, -1);
+    }
+    byName_[nameId] = net;
+    return net;
+}
+
+
+void
+defdbNets::addConnection(int component, int pinId, int synthesized)
+{
+    connComp_.push_back(component);
+    connPin_.push_back(pinId);
+    connSyn_.push_back(synthesized ? 1 : 0);
+}
+
+
+void
+defdbNets::setConnComponent(int conn, int component)
+{
+    connComp_[conn] = component;
+}
+
+
+int
+defdbNets::numNets() const
+{
+    return (int) nameId_.size();
+}
+
+
+int
+defdbNets::nameId(int net) const
+{
+    return nameId_[net];
+}
+
+
+int
+defdbNets::numConnections(int net) const
+{
+    return connBegin_[net + 1] - connBegin_[net];
+}
+
+
+int
+defdbNets::connBegin(int net) const
+{
+    return connBegin_[net];
+}
+
+
+int
+defdbNets::numAllConnections() const
+{
+    return (int) connComp_.size();
+}
+
+
+int
+defdbNets::connComponent(int conn) const
+{
+    return connComp_[conn];
+}
+
+
+int
+defdbNets::connPinId(int conn) const
+{
+    return connPin_[conn];
+}
+
+
+int
+defdbNets::connIsSynthesized(int conn) const
+{
+    return connSyn_[conn];
+}
+
+
+int
+defdbNets::hasRouting(int net) const
+{
+    return routed_[net];
+}
+
+
+int
+defdbNets::find(int nameId) const
+{
+    if (nameId < 0 || nameId >= (int) byName_.size()) {
+        return -1;
+    }
+    return byName_[nameId];
+}
+
+
+const int*
+defdbNets::nameIds() const
+{
+    return nameId_.empty() ? 0 : &nameId_[0];
+}
+
+
+const int*
+defdbNets::connOffsets() const
+{
+    return &connBegin_[0];
+}
+
+
+const int*
+defdbNets::connComponents() const
+{
+    return connComp_.empty() ? 0 : &connComp_[0];
+}
+
+
+const int*
+defdbNets::connPinIds() const
+{
+    return connPin_.empty() ? 0 : &connPin_[0];
+}
+
+
+////////////////////////////////////////////////////
+//
+//    Reader callbacks
+//
+////////////////////////////////////////////////////
+
+static int
+defdbDesignCbk(defrCallbackType_e, const char* name, defiUserData ud)
+{
+    ((defdbDatabase*) ud)->setDesignName(name);
+    return 0;
+}
+
+
+static int
+defdbUnitsCbk(defrCallbackType_e, double units, defiUserData ud)
+{
+    ((defdbDatabase*) ud)->setDbUnits(units);
+    return 0;
+}
+
+
+static int
+defdbDieAreaCbk(defrCallbackType_e, defiBox* box, defiUserData ud)
+{
+    ((defdbDatabase*) ud)->setDieArea(box);
+    return 0;
+}
+
+
+static int
+defdbComponentCbk(defrCallbackType_e, defiComponent* comp, defiUserData ud)
+{
+    return ((defdbDatabase*) ud)->addComponent(comp);
+}
+
+
+static int
+defdbPinCbk(defrCallbackType_e, defiPin* pin, defiUserData ud)
+{
+    return ((defdbDatabase*) ud)->addPin(pin);
+}
+
+
+static int
+defdbNetCbk(defrCallbackType_e, defiNet* net, defiUserData ud)
+{
+    return ((defdbDatabase*) ud)->addNet(net, 0);
+}
+
+
+static int
+defdbSNetCbk(defrCallbackType_e, defiNet* net, defiUserData ud)
+{
+    return ((defdbDatabase*) ud)->addNet(net, 1);
+}
+
+
+static int
+defdbBlockageCbk(defrCallbackType_e, defiBlockage* block, defiUserData ud)
+{
+    return ((defdbDatabase*) ud)->addBlockage(block);
+}
+
+
+static int
+defdbViaCbk(defrCallbackType_e, defiVia* via, defiUserData ud)
+{
+    return ((defdbDatabase*) ud)->addVia(via);
+}
+
+
+static int
+defdbRegionCbk(defrCallbackType_e, defiRegion* region, defiUserData ud)
+{
+    return ((defdbDatabase*) ud)->addRegion(region);
+}
+
+
+// Bounding box of a polygon.
+static void
+defdbPolygonBox(const defiPoints& pts, int* xl, int* yl, int* xh, int* yh)
+{
+    *xl = *xh = pts.x[0];
+    *yl = *yh = pts.y[0];
+    for (int i = 1; i < pts.numPoints; i++) {
+        if (pts.x[i] < *xl) *xl = pts.x[i];
+        if (pts.x[i] > *xh) *xh = pts.x[i];
+        if (pts.y[i] < *yl) *yl = pts.y[i];
+        if (pts.y[i] > *yh) *yh = pts.y[i];
+    }
+}
+
+
+// Apply a DEF orientation (defiComponent encoding) to a point.
+static void
+defdbOrientPoint(int orient, int x, int y, int* ox, int* oy)
+{
+    switch (orient) {
+    case 1:  *ox = -y; *oy = x;  break;    // W
+    case 2:  *ox = -x; *oy = -y; break;    // S
+    case 3:  *ox = y;  *oy = -x; break;    // E
+    case 4:  *ox = -x; *oy = y;  break;    // FN
+    case 5:  *ox = -y; *oy = -x; break;    // FW
+    case 6:  *ox = x;  *oy = -y; break;    // FS
+    case 7:  *ox = y;  *oy = x;  break;    // FE
+    default: *ox = x;  *oy = y;  break;    // N
+    }
+}
+
+
+////////////////////////////////////////////////////
+//
+//    defdbDatabase
+//
+////////////////////////////////////////////////////
+
+defdbDatabase::defdbDatabase()
+  : loadRouting_(0)
+{
+    clear();
+}
+
+
+defdbDatabase::~defdbDatabase()
+{
+}
+
+
+void
+defdbDatabase::clear()
+{
+    names_.clear();
+    designName_ = "";
+    dbUnits_ = 0.0;
+    hasDieArea_ = 0;
+    dieXl_ = dieYl_ = dieXh_ = dieYh_ = 0;
+
+    compName_.clear();
+    compMaster_.clear();
+    compX_.clear();
+    compY_.clear();
+    compOrient_.clear();
+    compStatus_.clear();
+    compByName_.clear();
+
+    pinName_.clear();
+    pinNet_.clear();
+    pinDirection_.clear();
+    pinUse_.clear();
+    pinStatus_.clear();
+    pinX_.clear();
+    pinY_.clear();
+    pinOrient_.clear();
+    pinByName_.clear();
+    pinShapeBegin_.clear();
+    pinShapeBegin_.push_back(0);
+    pinShape_.clear();
+    pinShapeLayer_.clear();
+
+    blockageRect_.clear();
+    blockageLayer_.clear();
+    regionRect_.clear();
+    regionName_.clear();
+
+    shape_.clear();
+    shapeLayer_.clear();
+    shapeNet_.clear();
+    shapeType_.clear();
+    shapeSpecial_.clear();
+    numUnknownVias_ = 0;
+
+    viaByName_.clear();
+    viaShapeBegin_.clear();
+    viaShapeBegin_.push_back(0);
+    viaShape_.clear();
+    viaShapeLayer_.clear();
+    viaBottom_.clear();
+    viaTop_.clear();
+
+    nets_.clear();
+    specialNets_.clear();
+
+    pendingConn_.clear();
+    pendingName_.clear();
+    pendingSpecial_.clear();
+}
+
+
+void
+defdbDatabase::registerCallbacks()
+{
+    defrSetDesignCbk(defdbDesignCbk);
+    defrSetUnitsCbk(defdbUnitsCbk);
+    defrSetDieAreaCbk(defdbDieAreaCbk);
+    defrSetComponentCbk(defdbComponentCbk);
+    defrSetPinCbk(defdbPinCbk);
+    defrSetNetCbk(defdbNetCbk);
+    defrSetSNetCbk(defdbSNetCbk);
+    defrSetBlockageCbk(defdbBlockageCbk);
+    defrSetRegionCbk(defdbRegionCbk);
+    if (loadRouting_) {
+        defrSetViaCbk(defdbViaCbk);
+        defrSetAddPathToNet();
+    }
+}
+
+
+void
+defdbDatabase::setLoadRouting(int load)
+{
+    loadRouting_ = load;
+}
+
+
+void
+defdbDatabase::setWireWidth(const char* layer, int width)
+{
+    wireWidth_[layer] = width;
+}
+
+
+int
+defdbDatabase::read(FILE* f, const char* fileName)
+{
+    int res;
+
+    registerCallbacks();
+    res = defrRead(f, fileName, (defiUserData) this, 1);
+    finish();
+    return res;
+}
+
+
+void
+defdbDatabase::finish()
+{
+    // Nets may precede COMPONENTS; resolve those connections now.
+    for (int i = 0; i < (int) pendingConn_.size(); i++) {
+        int comp = resolveComponent(names_.name(pendingName_[i]));
+
+        if (pendingSpecial_[i]) {
+            specialNets_.setConnComponent(pendingConn_[i], comp);
+        } else {
+            nets_.setConnComponent(pendingConn_[i], comp);
+        }
+    }
+
+    pendingConn_.clear();
+    pendingName_.clear();
+    pendingSpecial_.clear();
+}
+
+
+int
+defdbDatabase::resolveComponent(const char* instance)
+{
+    int id = names_.find(instance);
+
+    if (id < 0 || id >= (int) compByName_.size() || compByName_[id] < 0) {
+        return DEFDB_CONN_UNKNOWN;
+    }
+    return compByName_[id];
+}
+
+
+void
+defdbDatabase::setDesignName(const char* name)
+{
+    designName_ = name;
+}
+
+
+void
+defdbDatabase::setDbUnits(double units)
+{
+    dbUnits_ = units;
+}
+
+
+void
+defdbDatabase::setDieArea(const defiBox* box)
+{
+    hasDieArea_ = 1;
+    dieXl_ = box->xl();
+    dieYl_ = box->yl();
+    dieXh_ = box->xh();
+    dieYh_ = box->yh();
+}
+
+
+int
+defdbDatabase::addComponent(const defiComponent* comp)
+{
+    int nameId = names_.intern(comp->id());
+    int index = (int) compName_.size();
+
+    compName_.push_back(nameId);
+    compMaster_.push_back(names_.intern(comp->name()));
+    compX_.push_back(comp->placementX());
+    compY_.push_back(comp->placementY());
+    compOrient_.push_back((char) comp->placementOrient());
+    compStatus_.push_back((char) comp->placementStatus());
+
+    if (nameId >= (int) compByName_.size()) {
+        compByName_.resize(nameId + 1, -1);
+    }
+    compByName_[nameId] = index;
+    return 0;
+}
+
+
+int
+defdbDatabase::addPin(const defiPin* pin)
+{
+    int nameId = names_.intern(pin->pinName());
+    int index = (int) pinName_.size();
+    int status = 0;
+
+    if (pin->isUnplaced()) {
+        status = DEFI_COMPONENT_UNPLACED;
+    } else if (pin->isPlaced()) {
+        status = DEFI_COMPONENT_PLACED;
+    } else if (pin->isFixed()) {
+        status = DEFI_COMPONENT_FIXED;
+    } else if (pin->isCover()) {
+        status = DEFI_COMPONENT_COVER;
+    }
+
+    pinName_.push_back(nameId);
+    pinNet_.push_back(names_.intern(pin->netName()));
+    pinDirection_.push_back(pin->hasDirection() ?
+                            names_.intern(pin->direction()) : -1);
+    pinUse_.push_back(pin->hasUse() ? names_.intern(pin->use()) : -1);
+    pinStatus_.push_back((char) status);
+    pinX_.push_back(pin->hasPlacement() ? pin->placementX() : 0);
+    pinY_.push_back(pin->hasPlacement() ? pin->placementY() : 0);
+    pinOrient_.push_back((char) (pin->hasPlacement() ? pin->orient() : 0));
+
+    if (nameId >= (int) pinByName_.size()) {
+        pinByName_.resize(nameId + 1, -1);
+    }
+    pinByName_[nameId] = index;
+
+    addPinShapes(pin);
+    return 0;
+}
+
+
+void
+defdbDatabase::addPinShape(int placed, int x, int y, int orient, int layerId,
+                           int xl, int yl, int xh, int yh)
+{
+    defdbRect r;
+
+    if (placed) {
+        int x1, y1, x2, y2;
+
+        defdbOrientPoint(orient, xl, yl, &x1, &y1);
+        defdbOrientPoint(orient, xh, yh, &x2, &y2);
+        r.xl = x + (x1 < x2 ? x1 : x2);
+        r.yl = y + (y1 < y2 ? y1 : y2);
+        r.xh = x + (x1 < x2 ? x2 : x1);
+        r.yh = y + (y1 < y2 ? y2 : y1);
+    } else {
+        r.xl = xl;
+        r.yl = yl;
+        r.xh = xh;
+        r.yh = yh;
+    }
+    pinShape_.push_back(r);
+    pinShapeLayer_.push_back(layerId);
+}
+
+
+void
+defdbDatabase::addPinShapes(const defiPin* pin)
+{
+    int placed = pin->hasPlacement() && !pin->isUnplaced();
+    int i, j, xl, yl, xh, yh;
+
+    // Pre 5.7 single port syntax.
+    for (i = 0; i < pin->numLayer(); i++) {
+        pin->bounds(i, &xl, &yl, &xh, &yh);
+        addPinShape(placed, pin->placementX(), pin->placementY(),
+                    pin->orient(), names_.intern(pin->layer(i)),
+                    xl, yl, xh, yh);
+    }
+    for (i = 0; i < pin->numPolygons(); i++) {
+        defdbPolygonBox(pin->getPolygon(i), &xl, &yl, &xh, &yh);
+        addPinShape(placed, pin->placementX(), pin->placementY(),
+                    pin->orient(), names_.intern(pin->polygonName(i)),
+                    xl, yl, xh, yh);
+    }
+
+    // 5.7 PORT syntax, each port has its own placement.
+    for (j = 0; j < pin->numPorts(); j++) {
+        const defiPinPort* port = pin->pinPort(j);
+        int portPlaced = port->hasPlacement();
+
+        for (i = 0; i < port->numLayer(); i++) {
+            port->bounds(i, &xl, &yl, &xh, &yh);
+            addPinShape(portPlaced, port->placementX(),
+                        port->placementY(), port->orient(),
+                        names_.intern(port->layer(i)), xl, yl, xh, yh);
+        }
+        for (i = 0; i < port->numPolygons(); i++) {
+            defdbPolygonBox(port->getPolygon(i), &xl, &yl, &xh, &yh);
+            addPinShape(portPlaced, port->placementX(),
+                        port->placementY(), port->orient(),
+                        names_.intern(port->polygonName(i)), xl, yl, xh, yh);
+        }
+    }
+    pinShapeBegin_.push_back((int) pinShape_.size());
+}
+
+
+int
+defdbDatabase::addBlockage(const defiBlockage* block)
+{
+    int layerId = block->hasLayer() ? names_.intern(block->layerName()) : -1;
+    int i;
+
+    for (i = 0; i < block->numRectangles(); i++) {
+        defdbRect r;
+
+        r.xl = block->xl(i);
+        r.yl = block->yl(i);
+        r.xh = block->xh(i);
+        r.yh = block->yh(i);
+        blockageRect_.push_back(r);
+        blockageLayer_.push_back(layerId);
+    }
+    for (i = 0; i < block->numPolygons(); i++) {
+        defdbRect r;
+
+        defdbPolygonBox(block->getPolygon(i), &r.xl, &r.yl, &r.xh, &r.yh);
+        blockageRect_.push_back(r);
+        blockageLayer_.push_back(layerId);
+    }
+    return 0;
+}
+
+
+int
+defdbDatabase::addRegion(const defiRegion* region)
+{
+    int nameId = names_.intern(region->name());
+
+    for (int i = 0; i < region->numRectangles(); i++) {
+        defdbRect r;
+
+        r.xl = region->xl(i);
+        r.yl = region->yl(i);
+        r.xh = region->xh(i);
+        r.yh = region->yh(i);
+        regionRect_.push_back(r);
+        regionName_.push_back(nameId);
+    }
+    return 0;
+}
+
+
+int
+defdbDatabase::addVia(const defiVia* via)
+{
+    int   nameId = names_.intern(via->name());
+    int   bottom = -1, top = -1;
+    char* layer;
+    int   i;
+
+    if (via->hasViaRule()) {
+        char *rule, *botLayer, *cutLayer, *topLayer;
+        int  xSize, ySize, xSpacing, ySpacing;
+        int  xBotEnc, yBotEnc, xTopEnc, yTopEnc;
+        int  rows = 1, cols = 1, xOrigin = 0, yOrigin = 0;
+        int  xBotOs = 0, yBotOs = 0, xTopOs = 0, yTopOs = 0;
+        int  cutW, cutH;
+        defdbRect cut;
+
+        via->viaRule(&rule, &xSize, &ySize, &botLayer, &cutLayer, &topLayer,
+                     &xSpacing, &ySpacing, &xBotEnc, &yBotEnc,
+                     &xTopEnc, &yTopEnc);
+        if (via->hasRowCol()) {
+            via->rowCol(&rows, &cols);
+        }
+        if (via->hasOrigin()) {
+            via->origin(&xOrigin, &yOrigin);
+        }
+        if (via->hasOffset()) {
+            via->offset(&xBotOs, &yBotOs, &xTopOs, &yTopOs);
+        }
+
+        // The cut array is centered on the origin, the enclosures are
+        // shifted by the layer offsets.
+        cutW = cols * xSize + (cols - 1) * xSpacing;
+        cutH = rows * ySize + (rows - 1) * ySpacing;
+        cut.xl = xOrigin - cutW / 2;
+        cut.yl = yOrigin - cutH / 2;
+        cut.xh = cut.xl + cutW;
+        cut.yh = cut.yl + cutH;
+
+        bottom = names_.intern(botLayer);
+        top = names_.intern(topLayer);
+        viaShape_.push_back(cut);
+        viaShapeLayer_.push_back(names_.intern(cutLayer));
+        viaShape_.push_back(cut);
+        viaShape_.back().xl += xBotOs - xBotEnc;
+        viaShape_.back().yl += yBotOs - yBotEnc;
+        viaShape_.back().xh += xBotOs + xBotEnc;
+        viaShape_.back().yh += yBotOs + yBotEnc;
+        viaShapeLayer_.push_back(bottom);
+        viaShape_.push_back(cut);
+        viaShape_.back().xl += xTopOs - xTopEnc;
+        viaShape_.back().yl += yTopOs - yTopEnc;
+        viaShape_.back().xh += xTopOs + xTopEnc;
+        viaShape_.back().yh += yTopOs + yTopEnc;
+        viaShapeLayer_.push_back(top);
+    } else {
+        // Without LEF the layer order is unknown; take the first and the
+        // last layer given as the bottom and top routing layers.
+        for (i = 0; i < via->numLayers(); i++) {
+            defdbRect r;
+
+            via->layer(i, &layer, &r.xl, &r.yl, &r.xh, &r.yh);
+            viaShape_.push_back(r);
+            viaShapeLayer_.push_back(names_.intern(layer));
+        }
+        for (i = 0; i < via->numPolygons(); i++) {
+            defdbRect r;
+
+            defdbPolygonBox(via->getPolygon(i), &r.xl, &r.yl, &r.xh, &r.yh);
+            viaShape_.push_back(r);
+            viaShapeLayer_.push_back(names_.intern(via->polygonName(i)));
+        }
+        if ((int) viaShape_.size() > viaShapeBegin_.back()) {
+            bottom = viaShapeLayer_[viaShapeBegin_.back()];
+            top = viaShapeLayer_.back();
+        }
+    }
+
+    if (nameId >= (int) viaByName_.size()) {
+        viaByName_.resize(nameId + 1, -1);
+    }
+    viaByName_[nameId] = (int) viaBottom_.size();
+    viaBottom_.push_back(bottom);
+    viaTop_.push_back(top);
+    viaShapeBegin_.push_back((int) viaShape_.size());
+    return 0;
+}
+
+
+void
+defdbDatabase::addShape(int type, int layerId, int net, int special,
+                        int xl, int yl, int xh, int yh)
+{
+    defdbRect r;
+
+    r.xl = xl;
+    r.yl = yl;
+    r.xh = xh;
+    r.yh = yh;
+    shape_.push_back(r);
+    shapeLayer_.push_back(layerId);
+    shapeNet_.push_back(net);
+    shapeType_.push_back((char) type);
+    shapeSpecial_.push_back((char) special);
+}
+
+
+void
+defdbDatabase::addWire(int layerId, int width, int net, int special,
+                       int x1, int y1, int ext1, int x2, int y2, int ext2)
+{
+    int half = width / 2;
+
+    if (ext1 < 0) ext1 = half;
+    if (ext2 < 0) ext2 = half;
+
+    if (y1 == y2) {
+        if (x1 <= x2) {
+            addShape(DEFDB_SHAPE_WIRE, layerId, net, special,
+                     x1 - ext1, y1 - half, x2 + ext2, y1 + half);
+        } else {
+            addShape(DEFDB_SHAPE_WIRE, layerId, net, special,
+                     x2 - ext2, y1 - half, x1 + ext1, y1 + half);
+        }
+    } else if (x1 == x2) {
+        if (y1 <= y2) {
+            addShape(DEFDB_SHAPE_WIRE, layerId, net, special,
+                     x1 - half, y1 - ext1, x1 + half, y2 + ext2);
+        } else {
+            addShape(DEFDB_SHAPE_WIRE, layerId, net, special,
+                     x1 - half, y2 - ext2, x1 + half, y1 + ext1);
+        }
+    } else {
+        // 45 degree wire, kept as its bounding box.
+        addShape(DEFDB_SHAPE_WIRE, layerId, net, special,
+                 (x1 < x2 ? x1 : x2) - half, (y1 < y2 ? y1 : y2) - half,
+                 (x1 < x2 ? x2 : x1) + half, (y1 < y2 ? y2 : y1) + half);
+    }
+}
+
+
+// Add the shapes of a via placed at (x, y) and return the layer the
+// route continues on.
+int
+defdbDatabase::addViaShapes(int nameId, int x, int y, int orient,
+                            int layerId, int net, int special)
+{
+    int via = -1;
+    int i;
+
+    if (nameId < (int) viaByName_.size()) {
+        via = viaByName_[nameId];
+    }
+    if (via < 0) {
+        numUnknownVias_++;
+        return layerId;
+    }
+
+    for (i = viaShapeBegin_[via]; i < viaShapeBegin_[via + 1]; i++) {
+        const defdbRect& r = viaShape_[i];
+        int x1, y1, x2, y2;
+
+        defdbOrientPoint(orient, r.xl, r.yl, &x1, &y1);
+        defdbOrientPoint(orient, r.xh, r.yh, &x2, &y2);
+        addShape(DEFDB_SHAPE_VIA, viaShapeLayer_[i], net, special,
+                 x + (x1 < x2 ? x1 : x2), y + (y1 < y2 ? y1 : y2),
+                 x + (x1 < x2 ? x2 : x1), y + (y1 < y2 ? y2 : y1));
+    }
+    return (layerId == viaTop_[via]) ? viaBottom_[via] : viaTop_[via];
+}
+
+
+void
+defdbDatabase::addPathShapes(const defiPath* path, int net, int special)
+{
+    std::map<std::string, int>::const_iterator it;
+    int layer = -1, width = 0;
+    int havePoint = 0, px = 0, py = 0, pext = -1;
+    int via = -1, viaOrient = 0;
+    int numX = 1, numY = 1, stepX = 0, stepY = 0;
+    int type, x, y, ext, dx1, dy1, dx2, dy2, i, j;
+
+    path->initTraverse();
+    do {
+        type = path->next();
+
+        // A via is complete once the element after it is not one of its
+        // options.
+        if (via >= 0 && type != DEFIPATH_VIAROTATION &&
+            type != DEFIPATH_VIADATA && type != DEFIPATH_VIAMASK) {
+            int newLayer = layer;
+
+            for (i = 0; i < numX; i++) {
+                for (j = 0; j < numY; j++) {
+                    newLayer = addViaShapes(via, px + i * stepX,
+                                            py + j * stepY, viaOrient,
+                                            layer, net, special);
+                }
+            }
+            if (newLayer != layer) {
+                layer = newLayer;
+                if (!special) {
+                    it = wireWidth_.find(names_.name(layer));
+                    width = (it == wireWidth_.end()) ? 0 : it->second;
+                }
+            }
+            via = -1;
+        }
+
+        switch (type) {
+        case DEFIPATH_LAYER:
+            layer = names_.intern(path->getLayer());
+            it = wireWidth_.find(path->getLayer());
+            width = (it == wireWidth_.end()) ? 0 : it->second;
+            havePoint = 0;
+            break;
+        case DEFIPATH_WIDTH:
+            width = path->getWidth();
+            break;
+        case DEFIPATH_POINT:
+        case DEFIPATH_FLUSHPOINT:
+            ext = -1;
+            if (type == DEFIPATH_POINT) {
+                path->getPoint(&x, &y);
+            } else {
+                path->getFlushPoint(&x, &y, &ext);
+            }
+            if (havePoint && layer >= 0) {
+                addWire(layer, width, net, special, px, py, pext, x, y, ext);
+            }
+            px = x;
+            py = y;
+            pext = ext;
+            havePoint = 1;
+            break;
+        case DEFIPATH_VIRTUALPOINT:
+            path->getVirtualPoint(&px, &py);
+            pext = -1;
+            havePoint = 1;
+            break;
+        case DEFIPATH_VIA:
+            via = names_.intern(path->getVia());
+            viaOrient = 0;
+            numX = numY = 1;
+            stepX = stepY = 0;
+            break;
+        case DEFIPATH_VIAROTATION:
+            viaOrient = path->getViaRotation();
+            break;
+        case DEFIPATH_VIADATA:
+            path->getViaData(&numX, &numY, &stepX, &stepY);
+            break;
+        case DEFIPATH_RECT:
+            path->getViaRect(&dx1, &dy1, &dx2, &dy2);
+            if (layer >= 0) {
+                addShape(DEFDB_SHAPE_RECT, layer, net, special,
+                         px + dx1, py + dy1, px + dx2, py + dy2);
+            }
+            break;
+        default:
+            break;
+        }
+    } while (type != DEFIPATH_DONE);
+}
+
+
+void
+defdbDatabase::addRouting(const defiNet* net, int netIndex, int special)
+{
+    int i, j, k;
+
+    for (i = 0; i < net->numWires(); i++) {
+        const defiWire* wire = net->wire(i);
+
+        for (j = 0; j < wire->numPaths(); j++) {
+            addPathShapes(wire->path(j), netIndex, special);
+        }
+    }
+    for (k = 0; k < net->numSubnets(); k++) {
+        const defiSubnet* sub = net->subnet(k);
+
+        for (i = 0; i < sub->numWires(); i++) {
+            const defiWire* wire = sub->wire(i);
+
+            for (j = 0; j < wire->numPaths(); j++) {
+                addPathShapes(wire->path(j), netIndex, special);
+            }
+        }
+    }
+
+    for (i = 0; i < net->numRectangles(); i++) {
+        addShape(DEFDB_SHAPE_RECT, names_.intern(net->rectName(i)),
+                 netIndex, special,
+                 net->xl(i), net->yl(i), net->xh(i), net->yh(i));
+    }
+    for (i = 0; i < net->numPolygons(); i++) {
+        int xl, yl, xh, yh;
+
+        defdbPolygonBox(net->getPolygon(i), &xl, &yl, &xh, &yh);
+        addShape(DEFDB_SHAPE_POLYGON, names_.intern(net->polygonName(i)),
+                 netIndex, special, xl, yl, xh, yh);
+    }
+    for (i = 0; i < net->numViaSpecs(); i++) {
+        defiPoints pts = net->getViaPts(i);
+        int        via = names_.intern(net->viaName(i));
+
+        for (j = 0; j < pts.numPoints; j++) {
+            addViaShapes(via, pts.x[j], pts.y[j], net->viaOrient(i), -1,
+                         netIndex, special);
+        }
+    }
+}
+
+
+int
+defdbDatabase::addNet(const defiNet* net, int special)
+{
+    defdbNets& table = special ? specialNets_ : nets_;
+    int        i;
+
+    for (i = 0; i < net->numConnections(); i++) {
+        const char* inst = net->instance(i);
+        int         pinId = names_.intern(net->pin(i));
+        int         comp;
+
+        if (strcmp(inst, "PIN") == 0) {
+            comp = DEFDB_CONN_PIN;
+        } else if (strcmp(inst, "*") == 0) {
+            comp = DEFDB_CONN_ALL;
+        } else {
+            comp = resolveComponent(inst);
+            if (comp == DEFDB_CONN_UNKNOWN) {
+                pendingConn_.push_back(table.numAllConnections());
+                pendingName_.push_back(names_.intern(inst));
+                pendingSpecial_.push_back((char) special);
+            }
+        }
+        table.addConnection(comp, pinId, net->pinIsSynthesized(i));
+    }
+
+    if (loadRouting_) {
+        addRouting(net, table.numNets(), special);
+    }
+    table.addNet(names_.intern(net->name()),
+                 net->numWires() > 0 || net->numPaths() > 0);
+    return 0;
+}
+
+
+const char*
+defdbDatabase::designName() const
+{
+    return designName_.c_str();
+}
+
+
+double
+defdbDatabase::dbUnits() const
+{
+    return dbUnits_;
+}
+
+
+int
+defdbDatabase::hasDieArea() const
+{
+    return hasDieArea_;
+}
+
+
+void
+defdbDatabase::dieArea(int* xl, int* yl, int* xh, int* yh) const
+{
+    *xl = dieXl_;
+    *yl = dieYl_;
+    *xh = dieXh_;
+    *yh = dieYh_;
+}
+
+
+const defdbNameTable&
+defdbDatabase::names() const
+{
+    return names_;
+}
+
+
+const char*
+defdbDatabase::name(int nameId) const
+{
+    return names_.name(nameId);
+}
+
+
+int
+defdbDatabase::numComponents() const
+{
+    return (int) compName_.size();
+}
+
+
+int
+defdbDatabase::findComponent(const char* name) const
+{
+    int id = names_.find(name);
+
+    if (id < 0 || id >= (int) compByName_.size()) {
+        return -1;
+    }
+    return compByName_[id];
+}
+
+
+int
+defdbDatabase::componentNameId(int comp) const
+{
+    return compName_[comp];
+}
+
+
+int
+defdbDatabase::componentMasterId(int comp) const
+{
+    return compMaster_[comp];
+}
+
+
+const char*
+defdbDatabase::componentName(int comp) const
+{
+    return names_.name(compName_[comp]);
+}
+
+
+const char*
+defdbDatabase::componentMaster(int comp) const
+{
+    return names_.name(compMaster_[comp]);
+}
+
+
+int
+defdbDatabase::componentX(int comp) const
+{
+    return compX_[comp];
+}
+
+
+int
+defdbDatabase::componentY(int comp) const
+{
+    return compY_[comp];
+}
+
+
+int
+defdbDatabase::componentOrient(int comp) const
+{
+    return compOrient_[comp];
+}
+
+
+int
+defdbDatabase::componentStatus(int comp) const
+{
+    return compStatus_[comp];
+}
+
+
+const int*
+defdbDatabase::componentNameIds() const
+{
+    return compName_.empty() ? 0 : &compName_[0];
+}
+
+
+const int*
+defdbDatabase::componentMasterIds() const
+{
+    return compMaster_.empty() ? 0 : &compMaster_[0];
+}
+
+
+const int*
+defdbDatabase::componentXs() const
+{
+    return compX_.empty() ? 0 : &compX_[0];
+}
+
+
+const int*
+defdbDatabase::componentYs() const
+{
+    return compY_.empty() ? 0 : &compY_[0];
+}
+
+
+const char*
+defdbDatabase::componentOrients() const
+{
+    return compOrient_.empty() ? 0 : &compOrient_[0];
+}
+
+
+const char*
+defdbDatabase::componentStatuses() const
+{
+    return compStatus_.empty() ? 0 : &compStatus_[0];
+}
+
+
+int
+defdbDatabase::numPins() const
+{
+    return (int) pinName_.size();
+}
+
+
+int
+defdbDatabase::findPin(const char* name) const
+{
+    int id = names_.find(name);
+
+    if (id < 0 || id >= (int) pinByName_.size()) {
+        return -1;
+    }
+    return pinByName_[id];
+}
+
+
+int
+defdbDatabase::pinNameId(int pin) const
+{
+    return pinName_[pin];
+}
+
+
+int
+defdbDatabase::pinNetNameId(int pin) const
+{
+    return pinNet_[pin];
+}
+
+
+const char*
+defdbDatabase::pinName(int pin) const
+{
+    return names_.name(pinName_[pin]);
+}
+
+
+const char*
+defdbDatabase::pinNetName(int pin) const
+{
+    return names_.name(pinNet_[pin]);
+}
+
+
+const char*
+defdbDatabase::pinDirection(int pin) const
+{
+    return names_.name(pinDirection_[pin]);
+}
+
+
+const char*
+defdbDatabase::pinUse(int pin) const
+{
+    return names_.name(pinUse_[pin]);
+}
+
+
+int
+defdbDatabase::pinStatus(int pin) const
+{
+    return pinStatus_[pin];
+}
+
+
+int
+defdbDatabase::pinX(int pin) const
+{
+    return pinX_[pin];
+}
+
+
+int
+defdbDatabase::pinY(int pin) const
+{
+    return pinY_[pin];
+}
+
+
+int
+defdbDatabase::pinOrient(int pin) const
+{
+    return pinOrient_[pin];
+}
+
+
+const int*
+defdbDatabase::pinXs() const
+{
+    return pinX_.empty() ? 0 : &pinX_[0];
+}
+
+
+const int*
+defdbDatabase::pinYs() const
+{
+    return pinY_.empty() ? 0 : &pinY_[0];
+}
+
+
+int
+defdbDatabase::pinShapeBegin(int pin) const
+{
+    return pinShapeBegin_[pin];
+}
+
+
+int
+defdbDatabase::numPinShapes() const
+{
+    return (int) pinShape_.size();
+}
+
+
+const defdbRect&
+defdbDatabase::pinShape(int shape) const
+{
+    return pinShape_[shape];
+}
+
+
+int
+defdbDatabase::pinShapeLayerId(int shape) const
+{
+    return pinShapeLayer_[shape];
+}
+
+
+int
+defdbDatabase::numBlockageRects() const
+{
+    return (int) blockageRect_.size();
+}
+
+
+const defdbRect&
+defdbDatabase::blockageRect(int i) const
+{
+    return blockageRect_[i];
+}
+
+
+int
+defdbDatabase::blockageLayerId(int i) const
+{
+    return blockageLayer_[i];
+}
+
+
+int
+defdbDatabase::numRegionRects() const
+{
+    return (int) regionRect_.size();
+}
+
+
+const defdbRect&
+defdbDatabase::regionRect(int i) const
+{
+    return regionRect_[i];
+}
+
+
+int
+defdbDatabase::regionNameId(int i) const
+{
+    return regionName_[i];
+}
+
+
+int
+defdbDatabase::numShapes() const
+{
+    return (int) shape_.size();
+}
+
+
+const defdbRect&
+defdbDatabase::shape(int i) const
+{
+    return shape_[i];
+}
+
+
+int
+defdbDatabase::shapeLayerId(int i) const
+{
+    return shapeLayer_[i];
+}
+
+
+int
+defdbDatabase::shapeType(int i) const
+{
+    return shapeType_[i];
+}
+
+
+int
+defdbDatabase::shapeNet(int i) const
+{
+    return shapeNet_[i];
+}
+
+
+int
+defdbDatabase::shapeIsSpecial(int i) const
+{
+    return shapeSpecial_[i];
+}
+
+
+int
+defdbDatabase::numUnknownVias() const
+{
+    return numUnknownVias_;
+}
+
+
+const defdbNets&
+defdbDatabase::nets() const
+{
+    return nets_;
+}
+
+
+const defdbNets&
+defdbDatabase::specialNets() const
+{
+    return specialNets_;
+}
+
+
+int
+defdbDatabase::findNet(const char* name) const
+{
+    return nets_.find(names_.find(name));
+}
+
+
+int
+defdbDatabase::findSpecialNet(const char* name) const
+{
+    return specialNets_.find(names_.find(name));
+}
+
+
+const char*
+defdbDatabase::netName(int net) const
+{
+    return names_.name(nets_.nameId(net));
+}
+
+
+const char*
+defdbDatabase::specialNetName(int net) const
+{
+    return names_.name(specialNets_.nameId(net));
+}
+
+END_LEFDEF_PARSER_NAMESPACE
@@ -0,0 +1,347 @@
+// *****************************************************************************
+// *****************************************************************************
+// Copyright 2013-2014, Cadence Design Systems
+// 
+// This  file  is  part  of  the  Cadence  LEF/DEF  Open   Source
+// Distribution,  Product Version 5.8. 
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+//    implied. See the License for the specific language governing
+//    permissions and limitations under the License.
+// 
+// For updates, support, or to become part of the LEF/DEF Community,
+// check www.openeda.org for details.
+// 
+//  $Author$
+//  $Revision$
+//  $Date$
+//  $State:  $
+// *****************************************************************************
+// *****************************************************************************
+
+// In-memory DEF database.
+//
+// defdbDatabase is filled from the reader callbacks while defrRead() runs
+// and keeps the placement and connectivity data in flat, column-oriented
+// arrays (one array per attribute) so that scans over all components,
+// nets or pins touch only the attributes they need.  All names are
+// interned in a single name table and referenced by integer id.
+//
+// Typical use:
+//
+//     defrInit();
+//     defdbDatabase db;
+//     if (db.read(f, fileName) == 0) {
+//         for (int i = 0; i < db.numComponents(); i++)
+//             ... db.componentX(i), db.componentY(i) ...
+//     }
+//
+// or, to combine the database with application callbacks:
+//
+//     defdbDatabase db;
+//     db.registerCallbacks();
+//     defrSetViaCbk(myViaCbk);          // application callbacks
+//     defrRead(f, fileName, &db, 1);    // db must be the user data
+//     db.finish();
+
+#ifndef defdb_h
+#define defdb_h
+
+#include <stdio.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "defiNameIndex.hpp"
+#include "defrReader.hpp"
+
+BEGIN_LEFDEF_PARSER_NAMESPACE
+
+// Special values of defdbDatabase::connectionComponent().
+#define DEFDB_CONN_PIN        -1   // connection to an I/O pin ( PIN name )
+#define DEFDB_CONN_ALL        -2   // connection to all components ( * name )
+#define DEFDB_CONN_UNKNOWN    -3   // component not found in COMPONENTS
+
+// Axis aligned rectangle in database units.
+struct defdbRect {
+  int xl, yl, xh, yh;
+};
+
+// Types of routing shapes.
+#define DEFDB_SHAPE_WIRE      0    // path segment expanded by its width
+#define DEFDB_SHAPE_VIA       1    // layer rectangle of a via
+#define DEFDB_SHAPE_RECT      2    // RECT of a net or of a path
+#define DEFDB_SHAPE_POLYGON   3    // POLYGON, kept as its bounding box
+
+// Interned string table, kept in a defiNameTable: each distinct string
+// is stored once in a character arena and identified by a dense integer
+// id.
+class defdbNameTable {
+public:
+  defdbNameTable();
+  ~defdbNameTable();
+
+  void clear();
+
+  int         intern(const char* name);      // returns id, adds if new
+  int         find(const char* name) const;  // returns id, or -1
+  int         numNames() const;
+  const char* name(int id) const;
+
+protected:
+  defiNameTable table_;
+
+private:
+  defdbNameTable(const defdbNameTable&);
+  defdbNameTable& operator=(const defdbNameTable&);
+};
+
+// Nets or special nets with their connections in CSR form: the
+// connections of net n are [connBegin(n), connBegin(n+1)).
+class defdbNets {
+public:
+  defdbNets();
+  ~defdbNets();
+
+  void clear();
+
+  int        numNets() const;
+  int        nameId(int net) const;
+  int        numConnections(int net) const;
+  int        connBegin(int net) const;
+  int        numAllConnections() const;
+  int        connComponent(int conn) const;
+  int        connPinId(int conn) const;
+  int        connIsSynthesized(int conn) const;
+  int        hasRouting(int net) const;
+  int        find(int nameId) const;           // net index, or -1
+
+  // Raw columns for scans.
+  const int* nameIds() const;
+  const int* connOffsets() const;   // numNets() + 1 entries
+  const int* connComponents() const;
+  const int* connPinIds() const;
+
+  // Routines used by defdbDatabase to fill the table.
+  int  addNet(int nameId, int isRouted);
+  void addConnection(int component, int pinId, int synthesized);
+  void setConnComponent(int conn, int component);
+
+protected:
+  std::vector<int>  nameId_;
+  std::vector<int>  connBegin_;
+  std::vector<char> routed_;
+  std::vector<int>  connComp_;
+  std::vector<int>  connPin_;
+  std::vector<char> connSyn_;
+  std::vector<int>  byName_;        // name id -> net index, -1 if none
+};
+
+class defdbDatabase {
+public:
+  defdbDatabase();
+  ~defdbDatabase();
+
+  void clear();
+
+  // Register the callbacks which fill this database.  The database
+  // pointer has to be passed as user data to defrRead().  Callbacks
+  // registered by the application for other constructs are not touched.
+  void registerCallbacks();
+
+  // Resolve the references which could not be resolved during the
+  // read (for example nets read before COMPONENTS).  Must be called
+  // after defrRead() when registerCallbacks() was used.
+  void finish();
+
+  // Convenience routine: registerCallbacks(), defrRead(), finish().
+  // Returns the defrRead() status.
+  int read(FILE* f, const char* fileName);
+
+  // Design header.
+  const char* designName() const;
+  double      dbUnits() const;
+  int         hasDieArea() const;
+  void        dieArea(int* xl, int* yl, int* xh, int* yh) const;
+
+  // Name table shared by all objects.
+  const defdbNameTable& names() const;
+  const char* name(int nameId) const;
+
+  // COMPONENTS.
+  int         numComponents() const;
+  int         findComponent(const char* name) const;   // index, or -1
+  int         componentNameId(int comp) const;
+  int         componentMasterId(int comp) const;
+  const char* componentName(int comp) const;
+  const char* componentMaster(int comp) const;
+  int         componentX(int comp) const;
+  int         componentY(int comp) const;
+  int         componentOrient(int comp) const;   // 0-7, see defiComponent
+  int         componentStatus(int comp) const;   // DEFI_COMPONENT_*, or 0
+
+  const int*  componentNameIds() const;
+  const int*  componentMasterIds() const;
+  const int*  componentXs() const;
+  const int*  componentYs() const;
+  const char* componentOrients() const;
+  const char* componentStatuses() const;
+
+  // PINS.
+  int         numPins() const;
+  int         findPin(const char* name) const;         // index, or -1
+  int         pinNameId(int pin) const;
+  int         pinNetNameId(int pin) const;
+  const char* pinName(int pin) const;
+  const char* pinNetName(int pin) const;
+  const char* pinDirection(int pin) const;   // "" if not given
+  const char* pinUse(int pin) const;         // "" if not given
+  int         pinStatus(int pin) const;      // DEFI_COMPONENT_*, or 0
+  int         pinX(int pin) const;
+  int         pinY(int pin) const;
+  int         pinOrient(int pin) const;
+
+  const int*  pinXs() const;
+  const int*  pinYs() const;
+
+  // Port shapes of the pins, transformed to absolute coordinates for
+  // placed pins.  The shapes of pin p are [pinShapeBegin(p),
+  // pinShapeBegin(p + 1)); polygons are stored by their bounding box.
+  int              pinShapeBegin(int pin) const;
+  int              numPinShapes() const;
+  const defdbRect& pinShape(int shape) const;
+  int              pinShapeLayerId(int shape) const;
+
+  // BLOCKAGES rectangles (polygons by their bounding box).
+  int              numBlockageRects() const;
+  const defdbRect& blockageRect(int i) const;
+  int              blockageLayerId(int i) const;   // -1 for PLACEMENT
+
+  // REGIONS rectangles.
+  int              numRegionRects() const;
+  const defdbRect& regionRect(int i) const;
+  int              regionNameId(int i) const;
+
+  // Routing of NETS and SPECIALNETS as rectangles.  Only read if
+  // setLoadRouting() was called before registerCallbacks() or read().
+  // Wires get their width from the path; NETS paths have none in DEF,
+  // so their width is taken from setWireWidth().  Wire ends extend by
+  // the given extension or else by half the width.  Vias are expanded
+  // from their VIAS definition; vias defined only in LEF are counted by
+  // numUnknownVias().
+  void             setLoadRouting(int load);
+  void             setWireWidth(const char* layer, int width);
+  int              numShapes() const;
+  const defdbRect& shape(int i) const;
+  int              shapeLayerId(int i) const;
+  int              shapeType(int i) const;       // DEFDB_SHAPE_*
+  int              shapeNet(int i) const;        // index in nets() or
+  int              shapeIsSpecial(int i) const;  // specialNets()
+  int              numUnknownVias() const;
+
+  // NETS and SPECIALNETS.
+  const defdbNets& nets() const;
+  const defdbNets& specialNets() const;
+  int         findNet(const char* name) const;         // index, or -1
+  int         findSpecialNet(const char* name) const;  // index, or -1
+  const char* netName(int net) const;
+  const char* specialNetName(int net) const;
+
+  // Callback handlers, public so that application callbacks may
+  // forward to them.
+  int addComponent(const defiComponent* comp);
+  int addPin(const defiPin* pin);
+  int addNet(const defiNet* net, int special);
+  int addBlockage(const defiBlockage* block);
+  int addRegion(const defiRegion* region);
+  int addVia(const defiVia* via);
+  void setDesignName(const char* name);
+  void setDbUnits(double units);
+  void setDieArea(const defiBox* box);
+
+protected:
+  int  resolveComponent(const char* instance);
+  void addShape(int type, int layerId, int net, int special,
+                int xl, int yl, int xh, int yh);
+  void addWire(int layerId, int width, int net, int special,
+               int x1, int y1, int ext1, int x2, int y2, int ext2);
+  int  addViaShapes(int nameId, int x, int y, int orient, int layerId,
+                    int net, int special);
+  void addPathShapes(const defiPath* path, int net, int special);
+  void addRouting(const defiNet* net, int netIndex, int special);
+  void addPinShapes(const defiPin* pin);
+  void addPinShape(int placed, int x, int y, int orient, int layerId,
+                   int xl, int yl, int xh, int yh);
+
+  defdbNameTable    names_;
+
+  std::string       designName_;
+  double            dbUnits_;
+  int               hasDieArea_;
+  int               dieXl_, dieYl_, dieXh_, dieYh_;
+
+  std::vector<int>  compName_;
+  std::vector<int>  compMaster_;
+  std::vector<int>  compX_;
+  std::vector<int>  compY_;
+  std::vector<char> compOrient_;
+  std::vector<char> compStatus_;
+  std::vector<int>  compByName_;    // name id -> component, -1 if none
+
+  std::vector<int>  pinName_;
+  std::vector<int>  pinNet_;
+  std::vector<int>  pinDirection_;  // name id, -1 if not given
+  std::vector<int>  pinUse_;        // name id, -1 if not given
+  std::vector<char> pinStatus_;
+  std::vector<int>  pinX_;
+  std::vector<int>  pinY_;
+  std::vector<char> pinOrient_;
+  std::vector<int>  pinByName_;     // name id -> pin, -1 if none
+  std::vector<int>  pinShapeBegin_;
+  std::vector<defdbRect> pinShape_;
+  std::vector<int>  pinShapeLayer_;
+
+  std::vector<defdbRect> blockageRect_;
+  std::vector<int>  blockageLayer_;
+  std::vector<defdbRect> regionRect_;
+  std::vector<int>  regionName_;
+
+  int               loadRouting_;
+  std::map<std::string, int> wireWidth_;
+  std::vector<defdbRect> shape_;
+  std::vector<int>  shapeLayer_;
+  std::vector<int>  shapeNet_;
+  std::vector<char> shapeType_;
+  std::vector<char> shapeSpecial_;
+  int               numUnknownVias_;
+
+  // VIAS, shapes of via v are [viaShapeBegin_[v], viaShapeBegin_[v+1]).
+  std::vector<int>  viaByName_;     // name id -> via, -1 if none
+  std::vector<int>  viaShapeBegin_;
+  std::vector<defdbRect> viaShape_;
+  std::vector<int>  viaShapeLayer_;
+  std::vector<int>  viaBottom_;     // name id of the bottom layer
+  std::vector<int>  viaTop_;        // name id of the top layer
+
+  defdbNets         nets_;
+  defdbNets         specialNets_;
+
+  // Connections whose component was not yet known when the net was read.
+  std::vector<int>  pendingConn_;
+  std::vector<int>  pendingName_;
+  std::vector<char> pendingSpecial_;
+};
+
+END_LEFDEF_PARSER_NAMESPACE
+
+USE_LEFDEF_PARSER_NAMESPACE
+
+#endif
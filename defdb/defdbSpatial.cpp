@@ -0,0 +1,751 @@
+// *****************************************************************************
+// *****************************************************************************
+// Copyright 2013-2014, Cadence Design Systems
+// 
+// This  file  is  part  of  the  Cadence  LEF/DEF  Open   Source
+// Distribution,  Product Version 5.8. 
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+//    implied. See the License for the specific language governing
+//    permissions and limitations under the License.
+// 
+// For updates, support, or to become part of the LEF/DEF Community,
+// check www.openeda.org for details.
+// 
+//  $Author$
+//  $Revision$
+//  $Date$
+//  $State:  $
+// *****************************************************************************
+// *****************************************************************************
+
+#include <math.h>
+#include <algorithm>
+#include <queue>
+#include "defdbSpatial.hpp"
+
+BEGIN_LEFDEF_PARSER_NAMESPACE
+
+// Orders indexes by the x or y center of their rectangle.
+class defdbCenterLess {
+public:
+  defdbCenterLess(const std::vector<defdbRect>& boxes, int useY)
+    : boxes_(boxes), useY_(useY) {}
+
+  bool operator()(int a, int b) const {
+    const defdbRect& ra = boxes_[a];
+    const defdbRect& rb = boxes_[b];
+
+    if (useY_)
+      return (long long) ra.yl + ra.yh < (long long) rb.yl + rb.yh;
+    return (long long) ra.xl + ra.xh < (long long) rb.xl + rb.xh;
+  }
+
+private:
+  const std::vector<defdbRect>& boxes_;
+  int                           useY_;
+};
+
+
+// Sort-Tile-Recursive order of boxes[first .. first+count-1]: sort by x
+// center, cut into vertical slices of S * FANOUT entries and sort every
+// slice by y center.  order receives absolute indexes into boxes.
+static void
+defdbStrOrder(const std::vector<defdbRect>& boxes, int first, int count,
+              std::vector<int>& order)
+{
+    int pages = (count + DEFDB_RTREE_FANOUT - 1) / DEFDB_RTREE_FANOUT;
+    int slices = (int) ceil(sqrt((double) pages));
+    int sliceSize = slices * DEFDB_RTREE_FANOUT;
+    int i;
+
+    order.resize(count);
+    for (i = 0; i < count; i++) {
+        order[i] = first + i;
+    }
+
+    std::sort(order.begin(), order.end(), defdbCenterLess(boxes, 0));
+    for (i = 0; i < count; i += sliceSize) {
+        int end = std::min(count, i + sliceSize);
+        std::sort(order.begin() + i, order.begin() + end,
+                  defdbCenterLess(boxes, 1));
+    }
+}
+
+
+static void
+defdbAddToBox(defdbRect& box, const defdbRect& r)
+{
+    if (r.xl < box.xl) box.xl = r.xl;
+    if (r.yl < box.yl) box.yl = r.yl;
+    if (r.xh > box.xh) box.xh = r.xh;
+    if (r.yh > box.yh) box.yh = r.yh;
+}
+
+
+static int
+defdbTouches(const defdbRect& a, const defdbRect& b)
+{
+    return a.xl <= b.xh && b.xl <= a.xh && a.yl <= b.yh && b.yl <= a.yh;
+}
+
+
+// Squared distance from a point to a rectangle.
+static double
+defdbDistance2(const defdbRect& r, int x, int y)
+{
+    double dx = 0.0, dy = 0.0;
+
+    if (x < r.xl) dx = (double) r.xl - x;
+    else if (x > r.xh) dx = (double) x - r.xh;
+    if (y < r.yl) dy = (double) r.yl - y;
+    else if (y > r.yh) dy = (double) y - r.yh;
+    return dx * dx + dy * dy;
+}
+
+
+////////////////////////////////////////////////////
+//
+//    defdbRTree
+//
+////////////////////////////////////////////////////
+
+defdbRTree::defdbRTree()
+  : numLeaves_(0)
+{
+}
+
+
+defdbRTree::~defdbRTree()
+{
+}
+
+
+void
+defdbRTree::clear()
+{
+    itemBox_.clear();
+    itemId_.clear();
+    nodeBox_.clear();
+    nodeFirst_.clear();
+    nodeCount_.clear();
+    numLeaves_ = 0;
+}
+
+
+void
+defdbRTree::addNode(const std::vector<defdbRect>& boxes, int first, int count)
+{
+    defdbRect box = boxes[first];
+
+    for (int i = 1; i < count; i++) {
+        defdbAddToBox(box, boxes[first + i]);
+    }
+    nodeBox_.push_back(box);
+    nodeFirst_.push_back(first);
+    nodeCount_.push_back(count);
+}
+
+
+void
+defdbRTree::build(const std::vector<defdbRect>& rects,
+                  const std::vector<int>& ids)
+{
+    std::vector<int> order;
+    int n = (int) rects.size();
+    int levelFirst, levelCount, i;
+
+    clear();
+    if (n == 0) {
+        return;
+    }
+
+    defdbStrOrder(rects, 0, n, order);
+    itemBox_.resize(n);
+    itemId_.resize(n);
+    for (i = 0; i < n; i++) {
+        itemBox_[i] = rects[order[i]];
+        itemId_[i] = ids[order[i]];
+    }
+
+    for (i = 0; i < n; i += DEFDB_RTREE_FANOUT) {
+        addNode(itemBox_, i, std::min(DEFDB_RTREE_FANOUT, n - i));
+    }
+    numLeaves_ = (int) nodeBox_.size();
+
+    // Pack each level in STR order and put its parents on top of it,
+    // until a single root remains.
+    levelFirst = 0;
+    levelCount = numLeaves_;
+    while (levelCount > 1) {
+        std::vector<defdbRect> box(levelCount);
+        std::vector<int>       first(levelCount), count(levelCount);
+        int                    parentFirst;
+
+        defdbStrOrder(nodeBox_, levelFirst, levelCount, order);
+        for (i = 0; i < levelCount; i++) {
+            box[i] = nodeBox_[order[i]];
+            first[i] = nodeFirst_[order[i]];
+            count[i] = nodeCount_[order[i]];
+        }
+        for (i = 0; i < levelCount; i++) {
+            nodeBox_[levelFirst + i] = box[i];
+            nodeFirst_[levelFirst + i] = first[i];
+            nodeCount_[levelFirst + i] = count[i];
+        }
+
+        parentFirst = (int) nodeBox_.size();
+        for (i = 0; i < levelCount; i += DEFDB_RTREE_FANOUT) {
+            addNode(nodeBox_, levelFirst + i,
+                    std::min(DEFDB_RTREE_FANOUT, levelCount - i));
+        }
+        levelFirst = parentFirst;
+        levelCount = (int) nodeBox_.size() - parentFirst;
+    }
+}
+
+
+int
+defdbRTree::numItems() const
+{
+    return (int) itemId_.size();
+}
+
+
+int
+defdbRTree::numNodes() const
+{
+    return (int) nodeBox_.size();
+}
+
+
+const defdbRect&
+defdbRTree::bounds() const
+{
+    return nodeBox_.back();
+}
+
+
+void
+defdbRTree::window(const defdbRect& w, std::vector<int>& result) const
+{
+    std::vector<int> stack;
+
+    if (nodeBox_.empty()) {
+        return;
+    }
+
+    stack.push_back((int) nodeBox_.size() - 1);
+    while (!stack.empty()) {
+        int node = stack.back();
+        int end = nodeFirst_[node] + nodeCount_[node];
+        int i;
+
+        stack.pop_back();
+        if (node < numLeaves_) {
+            for (i = nodeFirst_[node]; i < end; i++) {
+                if (defdbTouches(itemBox_[i], w)) {
+                    result.push_back(itemId_[i]);
+                }
+            }
+        } else {
+            for (i = nodeFirst_[node]; i < end; i++) {
+                if (defdbTouches(nodeBox_[i], w)) {
+                    stack.push_back(i);
+                }
+            }
+        }
+    }
+}
+
+
+// Entry of the nearest neighbour search queue; node < 0 marks item -node-1.
+struct defdbNearEntry {
+    double dist;
+    int    node;
+
+    bool operator<(const defdbNearEntry& other) const {
+        return dist > other.dist;    // std::priority_queue is a max heap
+    }
+};
+
+
+void
+defdbRTree::nearest(int x, int y, int k, std::vector<int>& result) const
+{
+    std::priority_queue<defdbNearEntry> queue;
+    defdbNearEntry e;
+    int found = 0;
+
+    if (nodeBox_.empty() || k <= 0) {
+        return;
+    }
+
+    e.node = (int) nodeBox_.size() - 1;
+    e.dist = defdbDistance2(nodeBox_[e.node], x, y);
+    queue.push(e);
+
+    // Best first search: an item popped from the queue is nearer than
+    // everything still in it.
+    while (!queue.empty() && found < k) {
+        defdbNearEntry top = queue.top();
+        int            end, i;
+
+        queue.pop();
+        if (top.node < 0) {
+            result.push_back(itemId_[-top.node - 1]);
+            found++;
+            continue;
+        }
+
+        end = nodeFirst_[top.node] + nodeCount_[top.node];
+        for (i = nodeFirst_[top.node]; i < end; i++) {
+            if (top.node < numLeaves_) {
+                e.node = -i - 1;
+                e.dist = defdbDistance2(itemBox_[i], x, y);
+            } else {
+                e.node = i;
+                e.dist = defdbDistance2(nodeBox_[i], x, y);
+            }
+            queue.push(e);
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////
+//
+//    defdbSpatialIndex
+//
+////////////////////////////////////////////////////
+
+defdbSpatialIndex::defdbSpatialIndex()
+{
+}
+
+
+defdbSpatialIndex::~defdbSpatialIndex()
+{
+}
+
+
+void
+defdbSpatialIndex::clear()
+{
+    masterSize_.clear();
+    for (int i = 0; i < defdbSpatialNumKinds; i++) {
+        trees_[i].clear();
+    }
+}
+
+
+void
+defdbSpatialIndex::setMasterSize(const char* master, int width, int height)
+{
+    masterSize_[master] = std::make_pair(width, height);
+}
+
+
+void
+defdbSpatialIndex::build(const defdbDatabase& db)
+{
+    std::vector<defdbRect> rects;
+    std::vector<int>       ids;
+    std::vector<std::pair<int, int> > size;
+    int i;
+
+    // Master sizes by master name id.
+    size.resize(db.names().numNames(), std::make_pair(-1, -1));
+    std::map<std::string, std::pair<int, int> >::const_iterator it;
+    for (it = masterSize_.begin(); it != masterSize_.end(); ++it) {
+        int id = db.names().find(it->first.c_str());
+        if (id >= 0) {
+            size[id] = it->second;
+        }
+    }
+
+    for (i = 0; i < db.numComponents(); i++) {
+        int       status = db.componentStatus(i);
+        int       master = db.componentMasterId(i);
+        defdbRect r;
+
+        if (status != DEFI_COMPONENT_PLACED && status != DEFI_COMPONENT_FIXED &&
+            status != DEFI_COMPONENT_COVER) {
+            continue;
+        }
+        r.xl = r.xh = db.componentX(i);
+        r.yl = r.yh = db.componentY(i);
+        if (size[master].first >= 0) {
+            // W, E, FW and FE swap width and height.
+            if (db.componentOrient(i) & 1) {
+                r.xh += size[master].second;
+                r.yh += size[master].first;
+            } else {
+                r.xh += size[master].first;
+                r.yh += size[master].second;
+            }
+        }
+        rects.push_back(r);
+        ids.push_back(i);
+    }
+    trees_[defdbSpatialComponent].build(rects, ids);
+
+    rects.clear();
+    ids.clear();
+    for (i = 0; i < db.numPinShapes(); i++) {
+        rects.push_back(db.pinShape(i));
+        ids.push_back(i);
+    }
+    trees_[defdbSpatialPin].build(rects, ids);
+
+    rects.clear();
+    ids.clear();
+    for (i = 0; i < db.numBlockageRects(); i++) {
+        rects.push_back(db.blockageRect(i));
+        ids.push_back(i);
+    }
+    trees_[defdbSpatialBlockage].build(rects, ids);
+
+    rects.clear();
+    ids.clear();
+    for (i = 0; i < db.numRegionRects(); i++) {
+        rects.push_back(db.regionRect(i));
+        ids.push_back(i);
+    }
+    trees_[defdbSpatialRegion].build(rects, ids);
+}
+
+
+const defdbRTree&
+defdbSpatialIndex::tree(defdbSpatialKind_e kind) const
+{
+    return trees_[kind];
+}
+
+
+void
+defdbSpatialIndex::window(defdbSpatialKind_e kind, const defdbRect& w,
+                          std::vector<int>& result) const
+{
+    trees_[kind].window(w, result);
+}
+
+
+void
+defdbSpatialIndex::nearest(defdbSpatialKind_e kind, int x, int y, int k,
+                           std::vector<int>& result) const
+{
+    trees_[kind].nearest(x, y, k, result);
+}
+
+////////////////////////////////////////////////////
+//
+//    defdbLayerGrid
+//
+////////////////////////////////////////////////////
+
+defdbLayerGrid::defdbLayerGrid()
+{
+    clear();
+}
+
+
+defdbLayerGrid::~defdbLayerGrid()
+{
+}
+
+
+void
+defdbLayerGrid::clear()
+{
+    bounds_.xl = bounds_.yl = bounds_.xh = bounds_.yh = 0;
+    area_ = bounds_;
+    numShapes_ = 0;
+    nx_ = ny_ = 1;
+    binW_ = binH_ = 1;
+    binBegin_.assign(2, 0);
+    entryBox_.clear();
+    entryId_.clear();
+    long_.clear();
+}
+
+
+void
+defdbLayerGrid::binRange(const defdbRect& r, int* bx1, int* by1,
+                         int* bx2, int* by2) const
+{
+    long long x1 = ((long long) r.xl - area_.xl) / binW_;
+    long long y1 = ((long long) r.yl - area_.yl) / binH_;
+    long long x2 = ((long long) r.xh - area_.xl) / binW_;
+    long long y2 = ((long long) r.yh - area_.yl) / binH_;
+
+    *bx1 = (int) std::max(0LL, std::min(x1, (long long) nx_ - 1));
+    *by1 = (int) std::max(0LL, std::min(y1, (long long) ny_ - 1));
+    *bx2 = (int) std::max(0LL, std::min(x2, (long long) nx_ - 1));
+    *by2 = (int) std::max(0LL, std::min(y2, (long long) ny_ - 1));
+}
+
+
+void
+defdbLayerGrid::build(const std::vector<defdbRect>& rects,
+                      const std::vector<int>& ids, int shapesPerBin,
+                      const defdbRect* area)
+{
+    int n = (int) rects.size();
+    int i, bx, by, bx1, by1, bx2, by2;
+    long long w, h;
+    double bins;
+    std::vector<char>      isLong(n, 0);
+    std::vector<defdbRect> longRects;
+    std::vector<int>       longIds;
+
+    clear();
+    if (n == 0) {
+        return;
+    }
+    numShapes_ = n;
+
+    bounds_ = rects[0];
+    for (i = 1; i < n; i++) {
+        defdbAddToBox(bounds_, rects[i]);
+    }
+
+    if (area && area->xl <= area->xh && area->yl <= area->yh) {
+        area_ = *area;
+    } else {
+        area_ = bounds_;
+    }
+
+    // About shapesPerBin shapes per bin, bins as square as possible.
+    w = (long long) area_.xh - area_.xl + 1;
+    h = (long long) area_.yh - area_.yl + 1;
+    bins = std::max(1.0, (double) n / (shapesPerBin > 0 ? shapesPerBin : 1));
+    nx_ = (int) std::max(1.0, std::min(bins, floor(sqrt(bins * w / h) + 0.5)));
+    ny_ = (int) std::max(1.0, std::min(bins, floor(bins / nx_ + 0.5)));
+    nx_ = (int) std::min((long long) nx_, w);
+    ny_ = (int) std::min((long long) ny_, h);
+    binW_ = (w + nx_ - 1) / nx_;
+    binH_ = (h + ny_ - 1) / ny_;
+
+    // Count, prefix sum, fill.
+    binBegin_.assign(nx_ * ny_ + 1, 0);
+    for (i = 0; i < n; i++) {
+        binRange(rects[i], &bx1, &by1, &bx2, &by2);
+        if ((long long) (bx2 - bx1 + 1) * (by2 - by1 + 1) >
+            DEFDB_GRID_LONG_BINS) {
+            isLong[i] = 1;
+            longRects.push_back(rects[i]);
+            longIds.push_back(ids[i]);
+            continue;
+        }
+        for (by = by1; by <= by2; by++) {
+            for (bx = bx1; bx <= bx2; bx++) {
+                binBegin_[by * nx_ + bx + 1]++;
+            }
+        }
+    }
+    for (i = 0; i < nx_ * ny_; i++) {
+        binBegin_[i + 1] += binBegin_[i];
+    }
+
+    std::vector<int> fill(binBegin_.begin(), binBegin_.end() - 1);
+    entryBox_.resize(binBegin_.back());
+    entryId_.resize(binBegin_.back());
+    for (i = 0; i < n; i++) {
+        if (isLong[i]) {
+            continue;
+        }
+        binRange(rects[i], &bx1, &by1, &bx2, &by2);
+        for (by = by1; by <= by2; by++) {
+            for (bx = bx1; bx <= bx2; bx++) {
+                int pos = fill[by * nx_ + bx]++;
+                entryBox_[pos] = rects[i];
+                entryId_[pos] = ids[i];
+            }
+        }
+    }
+    long_.build(longRects, longIds);
+}
+
+
+int
+defdbLayerGrid::numShapes() const
+{
+    return numShapes_;
+}
+
+
+int
+defdbLayerGrid::numLongShapes() const
+{
+    return long_.numItems();
+}
+
+
+int
+defdbLayerGrid::numBins() const
+{
+    return nx_ * ny_;
+}
+
+
+const defdbRect&
+defdbLayerGrid::bounds() const
+{
+    return bounds_;
+}
+
+
+void
+defdbLayerGrid::window(const defdbRect& w, std::vector<int>& result) const
+{
+    int bx, by, bx1, by1, bx2, by2, i;
+
+    if (numShapes_ == 0 || !defdbTouches(w, bounds_)) {
+        return;
+    }
+
+    binRange(w, &bx1, &by1, &bx2, &by2);
+    for (by = by1; by <= by2; by++) {
+        for (bx = bx1; bx <= bx2; bx++) {
+            int bin = by * nx_ + bx;
+
+            for (i = binBegin_[bin]; i < binBegin_[bin + 1]; i++) {
+                const defdbRect& r = entryBox_[i];
+                int sx1, sy1, sx2, sy2;
+
+                if (!defdbTouches(r, w)) {
+                    continue;
+                }
+                // Report a shape stored in several bins only from the
+                // first bin that both it and the window touch.
+                binRange(r, &sx1, &sy1, &sx2, &sy2);
+                if (bx == std::max(bx1, sx1) && by == std::max(by1, sy1)) {
+                    result.push_back(entryId_[i]);
+                }
+            }
+        }
+    }
+    if (long_.numItems()) {
+        long_.window(w, result);
+    }
+}
+
+
+////////////////////////////////////////////////////
+//
+//    defdbShapeIndex
+//
+////////////////////////////////////////////////////
+
+defdbShapeIndex::defdbShapeIndex()
+{
+}
+
+
+defdbShapeIndex::~defdbShapeIndex()
+{
+}
+
+
+void
+defdbShapeIndex::clear()
+{
+    layerName_.clear();
+    layerByName_.clear();
+    grids_.clear();
+}
+
+
+void
+defdbShapeIndex::build(const defdbDatabase& db, int shapesPerBin)
+{
+    std::vector<std::vector<defdbRect> > rects;
+    std::vector<std::vector<int> >       ids;
+    defdbRect area;
+    int i;
+
+    clear();
+    layerByName_.assign(db.names().numNames(), -1);
+
+    // Partition by layer.
+    for (i = 0; i < db.numShapes(); i++) {
+        int nameId = db.shapeLayerId(i);
+        int layer;
+
+        if (nameId < 0) {
+            continue;
+        }
+        layer = layerByName_[nameId];
+        if (layer < 0) {
+            layer = layerByName_[nameId] = (int) layerName_.size();
+            layerName_.push_back(nameId);
+            rects.resize(layer + 1);
+            ids.resize(layer + 1);
+        }
+        rects[layer].push_back(db.shape(i));
+        ids[layer].push_back(i);
+    }
+
+    if (db.hasDieArea()) {
+        db.dieArea(&area.xl, &area.yl, &area.xh, &area.yh);
+    }
+    grids_.resize(layerName_.size());
+    for (i = 0; i < (int) grids_.size(); i++) {
+        grids_[i].build(rects[i], ids[i], shapesPerBin,
+                        db.hasDieArea() ? &area : 0);
+    }
+}
+
+
+int
+defdbShapeIndex::numLayers() const
+{
+    return (int) layerName_.size();
+}
+
+
+int
+defdbShapeIndex::layerNameId(int layer) const
+{
+    return layerName_[layer];
+}
+
+
+int
+defdbShapeIndex::findLayer(int layerNameId) const
+{
+    if (layerNameId < 0 || layerNameId >= (int) layerByName_.size()) {
+        return -1;
+    }
+    return layerByName_[layerNameId];
+}
+
+
+const defdbLayerGrid&
+defdbShapeIndex::grid(int layer) const
+{
+    return grids_[layer];
+}
+
+
+void
+defdbShapeIndex::window(int layerNameId, const defdbRect& w,
+                        std::vector<int>& result) const
+{
+    int layer = findLayer(layerNameId);
+
+    if (layer >= 0) {
+        grids_[layer].window(w, result);
+    }
+}
+
+END_LEFDEF_PARSER_NAMESPACE
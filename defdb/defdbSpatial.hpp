@@ -0,0 +1,205 @@
+// *****************************************************************************
+// *****************************************************************************
+// Copyright 2013-2014, Cadence Design Systems
+// 
+// This  file  is  part  of  the  Cadence  LEF/DEF  Open   Source
+// Distribution,  Product Version 5.8. 
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+//    implied. See the License for the specific language governing
+//    permissions and limitations under the License.
+// 
+// For updates, support, or to become part of the LEF/DEF Community,
+// check www.openeda.org for details.
+// 
+//  $Author$
+//  $Revision$
+//  $Date$
+//  $State:  $
+// *****************************************************************************
+// *****************************************************************************
+
+// Spatial queries over a defdbDatabase.
+//
+// defdbRTree is a static R-tree bulk loaded with Sort-Tile-Recursive
+// packing: every level is stored contiguously and every node except the
+// last of a level is full, which keeps the tree small and the queries
+// cache friendly.  defdbSpatialIndex holds one tree per kind of object.
+//
+// defdbShapeIndex partitions the routing shapes of the database by
+// layer and bins every layer into a uniform grid stored in CSR form,
+// with the long shapes kept in an R-tree beside the grid.
+
+#ifndef defdbSpatial_h
+#define defdbSpatial_h
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "defdb.hpp"
+
+BEGIN_LEFDEF_PARSER_NAMESPACE
+
+#define DEFDB_RTREE_FANOUT 16
+
+// A shape touching more bins than this is a long shape of the grid.
+#define DEFDB_GRID_LONG_BINS 4
+
+class defdbRTree {
+public:
+  defdbRTree();
+  ~defdbRTree();
+
+  void clear();
+
+  // Bulk load; item i has rectangle rects[i] and is reported as ids[i].
+  void build(const std::vector<defdbRect>& rects,
+             const std::vector<int>& ids);
+
+  int  numItems() const;
+  int  numNodes() const;
+  const defdbRect& bounds() const;   // only valid if numItems() > 0
+
+  // Append to result the ids of all items touching the window
+  // (boundaries included).
+  void window(const defdbRect& w, std::vector<int>& result) const;
+
+  // Append to result the ids of the k items nearest to (x, y), nearest
+  // first.  The distance is measured to the item rectangle, so items
+  // containing the point are at distance 0.
+  void nearest(int x, int y, int k, std::vector<int>& result) const;
+
+protected:
+  void addNode(const std::vector<defdbRect>& boxes, int first, int count);
+
+  // Items in leaf order.
+  std::vector<defdbRect> itemBox_;
+  std::vector<int>       itemId_;
+
+  // Nodes, leaves first and the root last.  The children of a leaf are
+  // items, the children of the other nodes are nodes.
+  std::vector<defdbRect> nodeBox_;
+  std::vector<int>       nodeFirst_;
+  std::vector<int>       nodeCount_;
+  int                    numLeaves_;
+};
+
+typedef enum {
+  defdbSpatialComponent = 0,   // ids are component indexes
+  defdbSpatialPin,             // ids are pin shape indexes
+  defdbSpatialBlockage,        // ids are blockage rectangle indexes
+  defdbSpatialRegion,          // ids are region rectangle indexes
+  defdbSpatialNumKinds
+} defdbSpatialKind_e;
+
+class defdbSpatialIndex {
+public:
+  defdbSpatialIndex();
+  ~defdbSpatialIndex();
+
+  void clear();
+
+  // Size of a master in the N orientation.  Components of masters with
+  // a size are indexed by their outline, the others by their placement
+  // point.  Must be called before build().
+  void setMasterSize(const char* master, int width, int height);
+
+  // Index the placed (PLACED, FIXED or COVER) components, the pin
+  // shapes, the blockages and the regions of the database.
+  void build(const defdbDatabase& db);
+
+  const defdbRTree& tree(defdbSpatialKind_e kind) const;
+
+  void window(defdbSpatialKind_e kind, const defdbRect& w,
+              std::vector<int>& result) const;
+  void nearest(defdbSpatialKind_e kind, int x, int y, int k,
+               std::vector<int>& result) const;
+
+protected:
+  std::map<std::string, std::pair<int, int> > masterSize_;
+  defdbRTree trees_[defdbSpatialNumKinds];
+};
+
+// Uniform grid over the shapes of one layer.  A shape is stored in every
+// bin it touches, together with a copy of its rectangle so that a query
+// only reads the bins.  A long shape, touching more than
+// DEFDB_GRID_LONG_BINS bins, such as a power stripe, is kept once in an
+// R-tree instead.
+class defdbLayerGrid {
+public:
+  defdbLayerGrid();
+  ~defdbLayerGrid();
+
+  void clear();
+
+  // Bin the given shapes; about shapesPerBin shapes per bin on average.
+  // The grid covers area, usually the DIEAREA, or the bounds of the
+  // shapes if area is null; shapes outside it go to the edge bins.
+  void build(const std::vector<defdbRect>& rects,
+             const std::vector<int>& ids, int shapesPerBin,
+             const defdbRect* area = 0);
+
+  int  numShapes() const;
+  int  numLongShapes() const;
+  int  numBins() const;
+  const defdbRect& bounds() const;   // of the shapes
+
+  // Append the ids of the shapes touching the window, each once.
+  void window(const defdbRect& w, std::vector<int>& result) const;
+
+protected:
+  void binRange(const defdbRect& r, int* bx1, int* by1,
+                int* bx2, int* by2) const;
+
+  defdbRect              bounds_;
+  defdbRect              area_;       // covered by the bins
+  int                    numShapes_;
+  int                    nx_, ny_;
+  long long              binW_, binH_;
+  std::vector<int>       binBegin_;   // nx_ * ny_ + 1 entries
+  std::vector<defdbRect> entryBox_;
+  std::vector<int>       entryId_;
+  defdbRTree             long_;
+};
+
+class defdbShapeIndex {
+public:
+  defdbShapeIndex();
+  ~defdbShapeIndex();
+
+  void clear();
+
+  // Index the routing shapes of the database (see setLoadRouting()).
+  // The grids of all layers cover the DIEAREA if the database has one.
+  void build(const defdbDatabase& db, int shapesPerBin = 4);
+
+  int  numLayers() const;
+  int  layerNameId(int layer) const;
+  int  findLayer(int layerNameId) const;   // layer index, or -1
+  const defdbLayerGrid& grid(int layer) const;
+
+  // Append the database shape indexes of the shapes on the layer
+  // touching the window.
+  void window(int layerNameId, const defdbRect& w,
+              std::vector<int>& result) const;
+
+protected:
+  std::vector<int>            layerName_;
+  std::vector<int>            layerByName_;   // name id -> layer
+  std::vector<defdbLayerGrid> grids_;
+};
+
+END_LEFDEF_PARSER_NAMESPACE
+
+USE_LEFDEF_PARSER_NAMESPACE
+
+#endif
@@ -0,0 +1,290 @@
+// *****************************************************************************
+// *****************************************************************************
+// Copyright 2013-2014, Cadence Design Systems
+// 
+// This  file  is  part  of  the  Cadence  LEF/DEF  Open   Source
+// Distribution,  Product Version 5.8. 
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+//    implied. See the License for the specific language governing
+//    permissions and limitations under the License.
+// 
+// For updates, support, or to become part of the LEF/DEF Community,
+// check www.openeda.org for details.
+// 
+//  $Author$
+//  $Revision$
+//  $Date$
+//  $State:  $
+// *****************************************************************************
+// *****************************************************************************
+
+// In process diff of two DEF files: the normalised lines written by the
+// callbacks of diffDefRW.cpp are hashed per object and the objects of
+// both files compared by name, instead of writing, sorting and diffing
+// two text files.
+
+#include <string.h>
+#include <algorithm>
+#include "diffDefHash.hpp"
+
+static unsigned long long diffMix(unsigned long long h) {
+  // splitmix64 finalizer
+  h ^= h >> 30;
+  h *= 0xbf58476d1ce4e5b9ULL;
+  h ^= h >> 27;
+  h *= 0x94d049bb133111ebULL;
+  h ^= h >> 31;
+  return h;
+}
+
+void diffDefHashLine(const char* line, size_t len,
+                     unsigned long long* h1, unsigned long long* h2) {
+  unsigned long long a = 14695981039346656037ULL;   // FNV-1a 64
+  unsigned long long b = 0x9e3779b97f4a7c15ULL;
+  size_t             i;
+
+  for (i = 0; i < len; i++) {
+    unsigned char c = (unsigned char) line[i];
+    a = (a ^ c) * 1099511628211ULL;
+    b = (b + c) * 0xff51afd7ed558ccdULL;
+    b ^= b >> 29;
+  }
+  *h1 = diffMix(a ^ len);
+  *h2 = diffMix(b + a);
+}
+
+void diffDefObjects::addText(const char* text, size_t len) {
+  const char* end = text + len;
+  const char* nl;
+
+  while ((nl = (const char*) memchr(text, '\n', end - text)) != 0) {
+    if (line_.size()) {
+      line_.append(text, nl - text);
+      addLine(line_.data(), line_.size());
+      line_.resize(0);
+    } else {
+      addLine(text, nl - text);
+    }
+    text = nl + 1;
+  }
+  line_.append(text, end - text);
+}
+
+void diffDefObjects::flush() {
+  if (line_.size())
+    addLine(line_.data(), line_.size());
+  line_.resize(0);
+}
+
+void diffDefObjects::addLine(const char* line, size_t len) {
+  const char*        p = line;
+  const char*        end = line + len;
+  unsigned long long h1, h2;
+
+  // skip the blank lines
+  while (p < end && (*p == ' ' || *p == '\t'))
+    p++;
+  if (p == end)
+    return;
+
+  // the key is the first two words
+  const char* k = p;
+  while (p < end && *p != ' ' && *p != '\t')
+    p++;
+  while (p < end && (*p == ' ' || *p == '\t'))
+    p++;
+  while (p < end && *p != ' ' && *p != '\t')
+    p++;
+  key_.assign(k, p - k);
+
+  if (!detail_.empty()) {
+    if (detail_.count(key_))
+      lines_[key_].push_back(std::string(line, len));
+    return;
+  }
+
+  diffDefHashLine(line, len, &h1, &h2);
+
+  ObjectMap::iterator it = objects_.find(key_);
+  if (it == objects_.end()) {
+    diffDefHashValue v;
+    v.h1 = 0;
+    v.h2 = 0;
+    v.numLines = 0;
+    it = objects_.insert(ObjectMap::value_type(key_, v)).first;
+  }
+  // Sums make the hash independent of the order of the lines.
+  it->second.h1 += h1;
+  it->second.h2 += h2;
+  it->second.numLines++;
+}
+
+void diffDefObjects::setDetail(const std::set<std::string>& keys) {
+  detail_ = keys;
+}
+
+void diffDefObjects::addViaLayers(const char* via, const char* bottom,
+                                  const char* top) {
+  vias_[via] = std::make_pair(std::string(bottom), std::string(top));
+}
+
+const char* diffDefObjects::viaLayer(const char* via,
+                                     const char* layer) const {
+  ViaMap::const_iterator it = vias_.find(via);
+
+  if (it == vias_.end())
+    return 0;
+  if (it->second.first == layer)
+    return it->second.second.c_str();
+  if (it->second.second == layer)
+    return it->second.first.c_str();
+  return 0;
+}
+
+const std::vector<std::string>*
+diffDefObjects::lines(const std::string& key) const {
+  LineMap::iterator it = lines_.find(key);
+
+  if (it == lines_.end())
+    return 0;
+  std::sort(it->second.begin(), it->second.end());
+  return &it->second;
+}
+
+void diffDefChanged(const diffDefObjects& objs1, const diffDefObjects& objs2,
+                    const char* type, std::set<std::string>* keys) {
+  const diffDefObjects::ObjectMap&          o1 = objs1.objects();
+  const diffDefObjects::ObjectMap&          o2 = objs2.objects();
+  diffDefObjects::ObjectMap::const_iterator i1, i2;
+  size_t                                    len = strlen(type);
+
+  for (i1 = o1.begin(); i1 != o1.end(); ++i1) {
+    if (i1->first.compare(0, len, type) != 0 || i1->first[len] != ' ')
+      continue;
+    i2 = o2.find(i1->first);
+    if (i2 != o2.end() &&
+        (i1->second.h1 != i2->second.h1 || i1->second.h2 != i2->second.h2 ||
+         i1->second.numLines != i2->second.numLines))
+      keys->insert(i1->first);
+  }
+}
+
+// Writes the lines of one changed object that are only in one file.
+static void diffDefDetail(const std::vector<std::string>* l1,
+                          const std::vector<std::string>* l2, FILE* out) {
+  std::vector<std::string> empty;
+  size_t                   i = 0, j = 0;
+
+  if (!l1)
+    l1 = &empty;
+  if (!l2)
+    l2 = &empty;
+  // Both are sorted, walk them together.
+  while (i < l1->size() || j < l2->size()) {
+    if (j == l2->size() || (i < l1->size() && (*l1)[i] < (*l2)[j])) {
+      fprintf(out, "< %s\n", (*l1)[i].c_str());
+      i++;
+    } else if (i == l1->size() || (*l2)[j] < (*l1)[i]) {
+      fprintf(out, "> %s\n", (*l2)[j].c_str());
+      j++;
+    } else {
+      i++;
+      j++;
+    }
+  }
+}
+
+// Counts per object type for the summary.
+struct diffDefTypeCount {
+  int objects1;
+  int objects2;
+  int deleted;
+  int added;
+  int changed;
+};
+
+static diffDefTypeCount& diffTypeCount(
+    std::map<std::string, diffDefTypeCount>& counts, const std::string& key) {
+  std::string type(key, 0, key.find(' '));
+  std::map<std::string, diffDefTypeCount>::iterator it = counts.find(type);
+
+  if (it == counts.end()) {
+    diffDefTypeCount c;
+    memset(&c, 0, sizeof(c));
+    it = counts.insert(std::make_pair(type, c)).first;
+  }
+  return it->second;
+}
+
+int diffDefCompare(const diffDefObjects& objs1, const diffDefObjects& objs2,
+                   FILE* out, const diffDefObjects* detail1,
+                   const diffDefObjects* detail2) {
+  const diffDefObjects::ObjectMap&          o1 = objs1.objects();
+  const diffDefObjects::ObjectMap&          o2 = objs2.objects();
+  diffDefObjects::ObjectMap::const_iterator i1 = o1.begin();
+  diffDefObjects::ObjectMap::const_iterator i2 = o2.begin();
+  std::map<std::string, diffDefTypeCount>   counts;
+  int                                       numDiffs = 0;
+
+  // Both maps are sorted by name, walk them together.
+  while (i1 != o1.end() || i2 != o2.end()) {
+    int cmp;
+
+    if (i1 == o1.end())
+      cmp = 1;
+    else if (i2 == o2.end())
+      cmp = -1;
+    else
+      cmp = i1->first.compare(i2->first);
+
+    if (cmp < 0) {
+      diffDefTypeCount& c = diffTypeCount(counts, i1->first);
+      c.objects1++;
+      c.deleted++;
+      fprintf(out, "Deleted: %s\n", i1->first.c_str());
+      numDiffs++;
+      ++i1;
+    } else if (cmp > 0) {
+      diffDefTypeCount& c = diffTypeCount(counts, i2->first);
+      c.objects2++;
+      c.added++;
+      fprintf(out, "Added: %s\n", i2->first.c_str());
+      numDiffs++;
+      ++i2;
+    } else {
+      diffDefTypeCount& c = diffTypeCount(counts, i1->first);
+      c.objects1++;
+      c.objects2++;
+      if (i1->second.h1 != i2->second.h1 || i1->second.h2 != i2->second.h2 ||
+          i1->second.numLines != i2->second.numLines) {
+        c.changed++;
+        fprintf(out, "Changed: %s\n", i1->first.c_str());
+        if (detail1 && detail2)
+          diffDefDetail(detail1->lines(i1->first), detail2->lines(i1->first),
+                        out);
+        numDiffs++;
+      }
+      ++i1;
+      ++i2;
+    }
+  }
+
+  std::map<std::string, diffDefTypeCount>::const_iterator it;
+  for (it = counts.begin(); it != counts.end(); ++it) {
+    const diffDefTypeCount& c = it->second;
+    if (c.deleted || c.added || c.changed)
+      fprintf(out, "Summary: %s %d %d deleted %d added %d changed %d\n",
+              it->first.c_str(), c.objects1, c.objects2, c.deleted, c.added,
+              c.changed);
+  }
+  return numDiffs;
+}
@@ -0,0 +1,108 @@
+// *****************************************************************************
+// *****************************************************************************
+// Copyright 2013-2014, Cadence Design Systems
+// 
+// This  file  is  part  of  the  Cadence  LEF/DEF  Open   Source
+// Distribution,  Product Version 5.8. 
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+//    implied. See the License for the specific language governing
+//    permissions and limitations under the License.
+// 
+// For updates, support, or to become part of the LEF/DEF Community,
+// check www.openeda.org for details.
+// 
+//  $Author$
+//  $Revision$
+//  $Date$
+//  $State:  $
+// *****************************************************************************
+// *****************************************************************************
+
+#ifndef DIFFDEFHASH_H
+#define DIFFDEFHASH_H
+
+#include <stdio.h>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+// Order independent 128 bit hash of the normalised lines of one object.
+struct diffDefHashValue {
+  unsigned long long h1;
+  unsigned long long h2;
+  unsigned int       numLines;
+};
+
+// The objects of one DEF file for the in process diff.  Every line the
+// diff callbacks write is added to the object named by its first two
+// words ("COMP I1", "NET n1"), so only one entry per object is kept
+// instead of the whole normalised text.
+class diffDefObjects {
+public:
+  void addLine(const char* line, size_t len);
+
+  // Adds text that may hold several or partial lines; the last line
+  // is kept until its newline or flush().
+  void addText(const char* text, size_t len);
+  void flush();
+  int  numObjects() const { return (int) objects_.size(); }
+
+  typedef std::map<std::string, diffDefHashValue> ObjectMap;
+  const ObjectMap& objects() const { return objects_; }
+
+  // Keeps the lines of the given objects only, to list how they
+  // differ.  lines() returns the sorted lines of one of them.
+  void setDetail(const std::set<std::string>& keys);
+  const std::vector<std::string>* lines(const std::string& key) const;
+
+  // The two routing layers of a via of the VIAS section.  viaLayer()
+  // returns the layer a wire continues on after the via from layer, or
+  // 0 if the via is not in the VIAS section or layer is not one of its
+  // routing layers.
+  void addViaLayers(const char* via, const char* bottom, const char* top);
+  const char* viaLayer(const char* via, const char* layer) const;
+
+private:
+  typedef std::map<std::string, std::vector<std::string> > LineMap;
+  typedef std::map<std::string, std::pair<std::string, std::string> > ViaMap;
+
+  ObjectMap             objects_;
+  std::set<std::string> detail_;
+  mutable LineMap       lines_;
+  ViaMap                vias_;
+  std::string           key_;
+  std::string           line_;
+};
+
+// Hash of one normalised line.
+extern void diffDefHashLine(const char* line, size_t len,
+                            unsigned long long* h1, unsigned long long* h2);
+
+// Adds to keys the objects of the given type ("NET") that are in both
+// files with different hashes.
+extern void diffDefChanged(const diffDefObjects& objs1,
+                           const diffDefObjects& objs2, const char* type,
+                           std::set<std::string>* keys);
+
+// Writes "Deleted:", "Added:" and "Changed:" records for the objects
+// only in the first file, only in the second file and different in
+// both, followed by a summary per object type.  If detail1 and detail2
+// hold the lines of a changed object, the lines only in the first file
+// ("< ") and only in the second file ("> ") follow its record.
+// Returns the number of differences.
+extern int diffDefCompare(const diffDefObjects& objs1,
+                          const diffDefObjects& objs2, FILE* out,
+                          const diffDefObjects* detail1 = 0,
+                          const diffDefObjects* detail2 = 0);
+
+#endif
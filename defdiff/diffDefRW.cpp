@@ -37,29 +37,66 @@
 #ifndef WIN32
 #   include <unistd.h>
 #endif /* not WIN32 */
+#include <stdarg.h>
 #include "defrReader.hpp"
+#include "diffDefRW.hpp"
+#include "diffDefHash.hpp"
 
 
 char defaultName[64];
 char defaultOut[64];
-static int ignorePE = 0;
-static int ignoreRN = 0;
-static int ignoreVN = 0;
-static int netSeCmp = 0;
+
+// The state of one read.  It is thread local so defdiff can read both
+// files at the same time, each thread with its own parser.
+static DEFR_THREAD_LOCAL int ignorePE = 0;
+static DEFR_THREAD_LOCAL int ignoreRN = 0;
+static DEFR_THREAD_LOCAL int ignoreVN = 0;
+static DEFR_THREAD_LOCAL int netSeCmp = 0;
 
 // Global variables
-FILE* fout;
-void  *userData;
-int numObjs;
-int isSumSet;      // to keep track if within SUM
-int isProp = 0;    // for PROPDEF
-int begOperand;    // to keep track for constraint, to print - as the 1st char
-static double curVer = 5.7;
+DEFR_THREAD_LOCAL FILE* fout;
+DEFR_THREAD_LOCAL void  *userData;
+DEFR_THREAD_LOCAL int numObjs;
+DEFR_THREAD_LOCAL int isSumSet;      // to keep track if within SUM
+DEFR_THREAD_LOCAL int isProp = 0;    // for PROPDEF
+DEFR_THREAD_LOCAL int begOperand;    // to keep track for constraint, to print - as the 1st char
+static DEFR_THREAD_LOCAL double curVer = 5.7;
+
+// In the hash mode the lines go to diffObjs instead of fout.
+static DEFR_THREAD_LOCAL diffDefObjects* diffObjs = 0;
+
+static void diffPrintf(const char* format, ...) {
+  va_list args;
+  char    buf[1024];
+  char*   text = buf;
+  int     len;
+
+  va_start(args, format);
+  if (!diffObjs) {
+    vfprintf(fout, format, args);
+    va_end(args);
+    return;
+  }
+  len = vsnprintf(buf, sizeof(buf), format, args);
+  va_end(args);
+  if (len < 0)
+    return;
+  if (len >= (int) sizeof(buf)) {
+    text = (char*) malloc(len + 1);
+    va_start(args, format);
+    vsnprintf(text, len + 1, format, args);
+    va_end(args);
+  }
+
+  diffObjs->addText(text, len);
+  if (text != buf)
+    free(text);
+}
 
 // TX_DIR:TRANSLATION ON
 
 void dataError() {
-  fprintf(fout, "ERROR: returned user data is not correct!\n");
+  diffPrintf("ERROR: returned user data is not correct!\n");
 }
 
 
@@ -67,7 +104,7 @@ void checkType(defrCallbackType_e c) {
   if (c >= 0 && c <= defrDesignEndCbkType) {
     // OK
   } else {
-    fprintf(fout, "ERROR: callback type is out of bounds!\n");
+    diffPrintf("ERROR: callback type is out of bounds!\n");
   }
 }
 
@@ -92,12 +129,12 @@ int compMSL(defrCallbackType_e c, defiComponentMaskShiftLayer* co, defiUserData
   if (ud != userData) dataError();
 
     if (co->numMaskShiftLayers()) {
-	fprintf(fout, "\nCOMPONENTMASKSHIFT ");
+	diffPrintf("\nCOMPONENTMASKSHIFT ");
 	
 	for (i = 0; i < co->numMaskShiftLayers(); i++) {
-           fprintf(fout, "%s ", co->maskShiftLayer(i));
+           diffPrintf("%s ", co->maskShiftLayer(i));
 	}
-	fprintf(fout, ";\n");
+	diffPrintf(";\n");
     }
 
   return 0;
@@ -111,87 +148,87 @@ int compf(defrCallbackType_e c, defiComponent* co, defiUserData ud) {
   checkType(c);
   if (ud != userData) dataError();
 //  missing GENERATE, FOREIGN
-    fprintf(fout, "COMP %s %s", co->id(), co->name());
+    diffPrintf("COMP %s %s", co->id(), co->name());
     if (co->hasNets()) {
         for (i = 0; i < co->numNets(); i++)
-             fprintf(fout, " %s", co->net(i));
-        fprintf(fout,"\n");
+             diffPrintf(" %s", co->net(i));
+        diffPrintf("\n");
     } else
-        fprintf(fout,"\n");
+        diffPrintf("\n");
     if (co->isFixed()) 
-        fprintf(fout, "COMP %s FIXED ( %d %d ) %s\n", co->id(),
+        diffPrintf("COMP %s FIXED ( %d %d ) %s\n", co->id(),
                 co->placementX(), co->placementY(), co->placementOrientStr());
     if (co->isCover()) 
-        fprintf(fout, "COMP %s COVER ( %d %d ) %s\n", co->id(),
+        diffPrintf("COMP %s COVER ( %d %d ) %s\n", co->id(),
                 co->placementX(), co->placementY(), co->placementOrientStr());
     if (co->isPlaced()) 
-        fprintf(fout,"COMP %s PLACED ( %d %d ) %s\n", co->id(),
+        diffPrintf("COMP %s PLACED ( %d %d ) %s\n", co->id(),
                 co->placementX(), co->placementY(), co->placementOrientStr());
     if (co->isUnplaced()) 
-        fprintf(fout,"COMP %s UNPLACED\n", co->id());
+        diffPrintf("COMP %s UNPLACED\n", co->id());
     if (co->hasSource())
-        fprintf(fout, "COMP %s SOURCE %s\n", co->id(), co->source());
+        diffPrintf("COMP %s SOURCE %s\n", co->id(), co->source());
     if (co->hasGenerate())
-        fprintf(fout, "COMP %s GENERATE %s %s\n", co->id(),
+        diffPrintf("COMP %s GENERATE %s %s\n", co->id(),
                 co->generateName(), co->macroName());
     if (co->hasHalo()) {
         int left, bottom, right, top;
         (void) co->haloEdges(&left, &bottom, &right, &top);
-        fprintf(fout, "COMP %s HALO", co->id());
+        diffPrintf("COMP %s HALO", co->id());
         if (co->hasHaloSoft())
-           fprintf(fout, " SOFT");
-        fprintf(fout, " %d %d %d %d\n", left, bottom, right, top);
+           diffPrintf(" SOFT");
+        diffPrintf(" %d %d %d %d\n", left, bottom, right, top);
         
     }
     if (co->hasRouteHalo()) {
-        fprintf(fout, "COMP %s ROUTEHALO %d %s %s\n", co->id(),
+        diffPrintf("COMP %s ROUTEHALO %d %s %s\n", co->id(),
                 co->haloDist(), co->minLayer(), co->maxLayer());
     }
     if (co->hasForeignName())
-        fprintf(fout, "COMP %s FOREIGN %s %d %d %s\n", co->id(),
+        diffPrintf("COMP %s FOREIGN %s %d %d %s\n", co->id(),
                 co->foreignName(), co->foreignX(), co->foreignY(),
                 co->foreignOri());
     if (co->hasWeight())
-        fprintf(fout, "COMP %s WEIGHT %d\n", co->id(), co->weight());
+        diffPrintf("COMP %s WEIGHT %d\n", co->id(), co->weight());
     if (co->hasEEQ())
-        fprintf(fout, "COMP %s EEQMASTER %s\n", co->id(), co->EEQ());
+        diffPrintf("COMP %s EEQMASTER %s\n", co->id(), co->EEQ());
     if (co->hasRegionName())
-        fprintf(fout, "COMP %s REGION %s\n", co->id(), co->regionName());
+        diffPrintf("COMP %s REGION %s\n", co->id(), co->regionName());
     if (co->hasRegionBounds()) {
         int *xl, *yl, *xh, *yh;
         int size;
         co->regionBounds(&size, &xl, &yl, &xh, &yh);
         for (i = 0; i < size; i++) { 
-            fprintf(fout, "COMP %s REGION ( %d %d ) ( %d %d )\n", co->id(),
+            diffPrintf("COMP %s REGION ( %d %d ) ( %d %d )\n", co->id(),
                     xl[i], yl[i], xh[i], yh[i]);
         }
     }
     if (co->maskShiftSize()) {
-	fprintf(fout, "MASKSHIFT ");
+	diffPrintf("MASKSHIFT ");
 
         for (int i = co->maskShiftSize()-1; i >= 0; i--) {
-            fprintf(fout, "%d", co->maskShift(i));
+            diffPrintf("%d", co->maskShift(i));
         }
-        fprintf(fout, "\n");
+        diffPrintf("\n");
     }
     if (co->numProps()) {
         for (i = 0; i < co->numProps(); i++) {
-            fprintf(fout, "COMP %s PROP %s %s ", co->id(),
+            diffPrintf("COMP %s PROP %s %s ", co->id(),
                     co->propName(i),
                     co->propValue(i));
             switch (co->propType(i)) {
-               case 'R': fprintf(fout, "REAL ");
+               case 'R': diffPrintf("REAL ");
                          break;
-               case 'I': fprintf(fout, "INT ");
+               case 'I': diffPrintf("INT ");
                          break;
-               case 'S': fprintf(fout, "STR ");
+               case 'S': diffPrintf("STR ");
                          break;
-               case 'Q': fprintf(fout, "QSTR ");
+               case 'Q': diffPrintf("QSTR ");
                          break;
-               case 'N': fprintf(fout, "NUM ");
+               case 'N': diffPrintf("NUM ");
                          break;
             }
-            fprintf(fout, "\n");
+            diffPrintf("\n");
         }
     }
 
@@ -199,6 +236,187 @@ int compf(defrCallbackType_e c, defiComponent* co, defiUserData ud) {
   return 0;
 }
 
+// One end of a net segment.
+struct diffSegPoint {
+  int x, y, ext;     // ext is -1 without an extension
+};
+
+static int diffSegLess(const diffSegPoint& a, const diffSegPoint& b) {
+  if (a.x != b.x)
+    return a.x < b.x;
+  if (a.y != b.y)
+    return a.y < b.y;
+  return a.ext < b.ext;
+}
+
+static void diffSegPointPrint(const diffSegPoint& a) {
+  if (a.ext != -1)
+    diffPrintf(" ( %d %d %d )", a.x, a.y, a.ext);
+  else
+    diffPrintf(" ( %d %d )", a.x, a.y);
+}
+
+// Keeps the routing layers of a via of the VIAS section for
+// diffNetSegments().  A VIARULE via names them; a via of rectangles and
+// polygons has the bottom and top layers first and last (bottom, cut,
+// top), or only two layers.  Other vias are left unknown.
+static void diffViaLayers(defiVia* via) {
+  const char* layers[3];
+  const char* name;
+  char*       rectLayer;
+  int         numLayers = 0, i, j, xl, yl, xh, yh;
+
+  if (via->hasViaRule()) {
+    char *vrn, *bl, *cl, *tl;
+    int  xs, ys, xcs, ycs, xbe, ybe, xte, yte;
+
+    (void)via->viaRule(&vrn, &xs, &ys, &bl, &cl, &tl, &xcs, &ycs, &xbe,
+                       &ybe, &xte, &yte);
+    diffObjs->addViaLayers(via->name(), bl, tl);
+    return;
+  }
+  for (i = 0; i < via->numLayers() + via->numPolygons(); i++) {
+    if (i < via->numLayers()) {
+      via->layer(i, &rectLayer, &xl, &yl, &xh, &yh);
+      name = rectLayer;
+    } else {
+      name = via->polygonName(i - via->numLayers());
+    }
+    for (j = 0; j < numLayers; j++)
+      if (strcmp(layers[j], name) == 0)
+        break;
+    if (j < numLayers)
+      continue;
+    if (numLayers == 3)
+      return;
+    layers[numLayers++] = name;
+  }
+  if (numLayers >= 2)
+    diffObjs->addViaLayers(via->name(), layers[0], layers[numLayers - 1]);
+}
+
+// Writes the routing of one path of a regular net in canonical form for
+// -netSegComp in the hash mode: one line per segment with its layer,
+// width, mask, taper and style and its end points in sorted order, and
+// one line per via with its location.  A net compares equal however its
+// routing is split into paths and in which direction they are written.
+// After a via the wire continues on the other routing layer of the via,
+// or on the unknown layer "?" for a via not in the VIAS section.
+static void diffNetSegments(const char* netName, const char* wireType,
+                            defiPath* p) {
+  const char*  layer = "N/A";
+  const char*  via = 0;
+  const char*  taperRule = 0;
+  int          width = 0, mask = 0, viaMask = 0, style = -1, taper = 0;
+  int          rotation = -1, numX = 0, numY = 0, stepX = 0, stepY = 0;
+  int          hasPrev = 0, path, w, x, y, z;
+  diffSegPoint prev, cur;
+
+  p->initTraverse();
+  while (1) {
+    path = (int)p->next();
+
+    // a via ends at the next item that is not one of its attributes
+    if (via && path != DEFIPATH_VIAROTATION && path != DEFIPATH_VIADATA) {
+      diffPrintf("\nNET %s %s VIA %s", netName, wireType,
+                 ignoreVN ? "-" : via);
+      if (hasPrev)
+        diffPrintf(" ( %d %d )", prev.x, prev.y);
+      if (rotation != -1)
+        diffPrintf(" ROTATION %d", rotation);
+      if (numX || numY)
+        diffPrintf(" DO %d BY %d STEP %d %d", numX, numY, stepX, stepY);
+      if (viaMask)
+        diffPrintf(" MASK %d", viaMask);
+      via = 0;
+      viaMask = 0;
+    }
+    if (path == DEFIPATH_DONE)
+      break;
+
+    switch (path) {
+      case DEFIPATH_LAYER:
+           layer = p->getLayer();
+           hasPrev = 0;
+           break;
+      case DEFIPATH_WIDTH:
+           width = p->getWidth();
+           break;
+      case DEFIPATH_MASK:
+           mask = p->getMask();
+           break;
+      case DEFIPATH_VIAMASK:
+           viaMask = p->getViaTopMask() * 100 + p->getViaCutMask() * 10 +
+                     p->getViaBottomMask();
+           break;
+      case DEFIPATH_STYLE:
+           style = p->getStyle();
+           break;
+      case DEFIPATH_TAPER:
+           taper = 1;
+           break;
+      case DEFIPATH_TAPERRULE:
+           taperRule = p->getTaperRule();
+           break;
+      case DEFIPATH_VIA:
+           via = p->getVia();
+           if (!(layer = diffObjs->viaLayer(via, layer)))
+             layer = "?";
+           rotation = -1;
+           numX = numY = stepX = stepY = 0;
+           break;
+      case DEFIPATH_VIAROTATION:
+           rotation = p->getViaRotation();
+           break;
+      case DEFIPATH_VIADATA:
+           p->getViaData(&numX, &numY, &stepX, &stepY);
+           break;
+      case DEFIPATH_RECT:
+           p->getViaRect(&w, &x, &y, &z);
+           diffPrintf("\nNET %s %s RECT %s ( %d %d %d %d )", netName,
+                      wireType, layer, w, x, y, z);
+           break;
+      case DEFIPATH_VIRTUALPOINT:
+           // no wire up to a virtual point
+           p->getVirtualPoint(&prev.x, &prev.y);
+           prev.ext = -1;
+           hasPrev = 1;
+           break;
+      case DEFIPATH_POINT:
+      case DEFIPATH_FLUSHPOINT:
+           if (path == DEFIPATH_POINT) {
+              p->getPoint(&cur.x, &cur.y);
+              cur.ext = -1;
+           } else {
+              p->getFlushPoint(&cur.x, &cur.y, &cur.ext);
+           }
+           if (hasPrev && (cur.x != prev.x || cur.y != prev.y)) {
+              diffPrintf("\nNET %s %s SEG %s %d", netName, wireType, layer,
+                         width);
+              if (mask)
+                 diffPrintf(" MASK %d", mask);
+              if (taper)
+                 diffPrintf(" TAPER");
+              if (taperRule)
+                 diffPrintf(" TAPERRULE %s", taperRule);
+              if (style != -1)
+                 diffPrintf(" STYLE %d", style);
+              if (diffSegLess(cur, prev)) {
+                 diffSegPointPrint(cur);
+                 diffSegPointPrint(prev);
+              } else {
+                 diffSegPointPrint(prev);
+                 diffSegPointPrint(cur);
+              }
+              mask = 0;
+           }
+           prev = cur;
+           hasPrev = 1;
+           break;
+    }
+  }
+}
+
 // Net
 int netf(defrCallbackType_e c, defiNet* net, defiUserData ud) {
   // For net and special net.
@@ -215,47 +433,47 @@ int netf(defrCallbackType_e c, defiNet* net, defiUserData ud) {
   checkType(c);
   if (ud != userData) dataError();
   if (c != defrNetCbkType)
-      fprintf(fout, "BOGUS NET TYPE  ");
+      diffPrintf("BOGUS NET TYPE  ");
   if (net->pinIsMustJoin(0))
-      fprintf(fout, "NET MUSTJOIN ");
+      diffPrintf("NET MUSTJOIN ");
   else
-      fprintf(fout, "NET %s ", net->name());
+      diffPrintf("NET %s ", net->name());
  
   // compName & pinName
   for (i = 0; i < net->numConnections(); i++) {
-      fprintf(fout, "\nNET %s ( %s %s ) ", net->name(), net->instance(i),
+      diffPrintf("\nNET %s ( %s %s ) ", net->name(), net->instance(i),
               net->pin(i));
   }
 
   if (net->hasNonDefaultRule())
-      fprintf(fout, "\nNET %s NONDEFAULTRULE %s", net->name(),
+      diffPrintf("\nNET %s NONDEFAULTRULE %s", net->name(),
               net->nonDefaultRule());
  
   for (i = 0; i < net->numVpins(); i++) {
       vpin = net->vpin(i);
-      fprintf(fout, "\nNET %s %s", net->name(), vpin->name());
+      diffPrintf("\nNET %s %s", net->name(), vpin->name());
       if (vpin->layer())
-          fprintf(fout, " %s", vpin->layer());
-      fprintf(fout, " %d %d %d %d", vpin->xl(), vpin->yl(), vpin->xh(),
+          diffPrintf(" %s", vpin->layer());
+      diffPrintf(" %d %d %d %d", vpin->xl(), vpin->yl(), vpin->xh(),
               vpin->yh());
       if (vpin->status() != ' ') {
           switch (vpin->status()) {
               case 'P':
               case 'p':
-                   fprintf(fout, " PLACED"); 
+                   diffPrintf(" PLACED"); 
                    break;
               case 'F':
               case 'f':
-                   fprintf(fout, " FIXED"); 
+                   diffPrintf(" FIXED"); 
                    break;
               case 'C':
               case 'c':
-                   fprintf(fout, " COVER"); 
+                   diffPrintf(" COVER"); 
                    break;
           }
-          fprintf(fout, " %d %d", vpin->xLoc(), vpin->yLoc());
+          diffPrintf(" %d %d", vpin->xLoc(), vpin->yLoc());
           if (vpin->orient() != -1)
-              fprintf(fout, " %s", vpin->orientStr());
+              diffPrintf(" %s", vpin->orientStr());
       }
   }
 
@@ -265,22 +483,26 @@ int netf(defrCallbackType_e c, defiNet* net, defiUserData ud) {
       wire = net->wire(i);
       for (j = 0; j < wire->numPaths(); j++) {
         p = wire->path(j);
+        if (diffObjs && netSeCmp) {
+          diffNetSegments(net->name(), wire->wireType(), p);
+          continue;
+        }
         p->initTraverse();
-        fprintf(fout, "\nNET %s %s", net->name(), wire->wireType());
+        diffPrintf("\nNET %s %s", net->name(), wire->wireType());
         nline = 0;
         while ((path = (int)p->next()) != DEFIPATH_DONE) {
           switch (path) {
             case DEFIPATH_LAYER:
                  if (!netSeCmp)
-                    fprintf(fout, " %s", p->getLayer());
+                    diffPrintf(" %s", p->getLayer());
                  layerName = p->getLayer();
                  px = py = pz = -99;     // reset the 1 set of point to 0
                  break;
 	    case DEFIPATH_MASK:
-		 fprintf(fout, "MASK %d ", p->getMask());
+		 diffPrintf("MASK %d ", p->getMask());
                  break;
 	    case DEFIPATH_VIAMASK:
-                     fprintf(fout, "MASK %d%d%d ", 
+                     diffPrintf("MASK %d%d%d ", 
                              p->getViaTopMask(), 
                              p->getViaCutMask(),
                              p->getViaBottomMask());
@@ -288,20 +510,20 @@ int netf(defrCallbackType_e c, defiNet* net, defiUserData ud) {
             case DEFIPATH_VIA:
                  if (!netSeCmp) {
                     if (!ignoreVN)
-                       fprintf(fout, " %s", p->getVia());
+                       diffPrintf(" %s", p->getVia());
                  } else {
                     if (nline) {
                        if (!ignoreVN)
-                          fprintf(fout, "\nNET %s %s ( %d %d ) %s", net->name(),
+                          diffPrintf("\nNET %s %s ( %d %d ) %s", net->name(),
                                wire->wireType(), px, py, p->getVia());
                        else
-                          fprintf(fout, "\nNET %s %s ( %d %d )", net->name(),
+                          diffPrintf("\nNET %s %s ( %d %d )", net->name(),
                                wire->wireType(), px, py);
                     } else {
                        if (!ignoreVN)
-                          fprintf(fout, " ( %d %d ) %s", px, py, p->getVia());
+                          diffPrintf(" ( %d %d ) %s", px, py, p->getVia());
                        else
-                          fprintf(fout, " ( %d %d )", px, py);
+                          diffPrintf(" ( %d %d )", px, py);
                     }
                     px = py = pz = -99;     // reset the 1 set of point to 0
                  }
@@ -309,27 +531,27 @@ int netf(defrCallbackType_e c, defiNet* net, defiUserData ud) {
                  break;
 	    case DEFIPATH_RECT:
 		 p->getViaRect(&w, &x, &y, &z);
-                 fprintf(fout, "RECT ( %d %d %d %d ) ", w, x, y, z);
+                 diffPrintf("RECT ( %d %d %d %d ) ", w, x, y, z);
                  break;
 	    case DEFIPATH_VIRTUALPOINT:
 	         p->getVirtualPoint(&x, &y);
-		 fprintf(fout, "VIRTUAL ( %d %d ) ", x, y);
+		 diffPrintf("VIRTUAL ( %d %d ) ", x, y);
                  break;
             case DEFIPATH_VIAROTATION:
-                 fprintf(fout, "%d ",p->getViaRotation());
+                 diffPrintf("%d ",p->getViaRotation());
                  nline = 1;
                  break;
             case DEFIPATH_WIDTH:
-                 fprintf(fout, " %d ", p->getWidth());
+                 diffPrintf(" %d ", p->getWidth());
                  break;
             case DEFIPATH_POINT:
                  p->getPoint(&x, &y);
                  if (!netSeCmp) {
                     if (!nline) {
-                       fprintf(fout, " ( %d %d )", x, y);
+                       diffPrintf(" ( %d %d )", x, y);
                        nline = 1; 
                     } else {
-                       fprintf(fout, "\nNET %s %s %s ( %d %d )", net->name(),
+                       diffPrintf("\nNET %s %s %s ( %d %d )", net->name(),
                                wire->wireType(), layerName, x, y);
                     }
                  } else {
@@ -338,19 +560,19 @@ int netf(defrCallbackType_e c, defiNet* net, defiUserData ud) {
                        py = y;
                     } else {
                        if (nline)
-                          fprintf(fout, "\nNET %s %s %s", net->name(),
+                          diffPrintf("\nNET %s %s %s", net->name(),
                                   wire->wireType(), layerName);
                        if (px < x) {
-                          fprintf (fout, " ( %d %d ) ( %d %d )", px, py, x, y);
+                          diffPrintf(" ( %d %d ) ( %d %d )", px, py, x, y);
                        } else if (px == x) {
                           if (py < y) 
-                              fprintf (fout, " ( %d %d ) ( %d %d )",
+                              diffPrintf(" ( %d %d ) ( %d %d )",
                                        px, py, x, y);
                           else
-                              fprintf (fout, " ( %d %d ) ( %d %d )",
+                              diffPrintf(" ( %d %d ) ( %d %d )",
                                        x, y, px, py);
                        } else {  // px > x
-                          fprintf (fout, " ( %d %d ) ( %d %d )", x, y, px, py);
+                          diffPrintf(" ( %d %d ) ( %d %d )", x, y, px, py);
                        }
                        px = x;
                        py = y;
@@ -362,9 +584,9 @@ int netf(defrCallbackType_e c, defiNet* net, defiUserData ud) {
                  p->getFlushPoint(&x, &y, &z);
                  if (!netSeCmp) {
                     if (!nline) {
-                       fprintf(fout, " ( %d %d %d )", x, y, z);
+                       diffPrintf(" ( %d %d %d )", x, y, z);
                     } else {
-                       fprintf(fout, "\nNET %s %s %s ( %d %d %d )", net->name(),
+                       diffPrintf("\nNET %s %s %s ( %d %d %d )", net->name(),
                                wire->wireType(), layerName, x, y, z);
                     }
                  } else {
@@ -374,37 +596,37 @@ int netf(defrCallbackType_e c, defiNet* net, defiUserData ud) {
                        pz = z;
                     } else {
                        if (nline)
-                          fprintf(fout, "\nNET %s %s %s", net->name(),
+                          diffPrintf("\nNET %s %s %s", net->name(),
                                   wire->wireType(), layerName);
                        if (px < x) {
                           if (pz != -99)
-                             fprintf (fout, " ( %d %d %d ) ( %d %d %d )",
+                             diffPrintf(" ( %d %d %d ) ( %d %d %d )",
                                       px, py, pz, x, y, z);
                           else
-                             fprintf (fout, " ( %d %d ) ( %d %d %d )",
+                             diffPrintf(" ( %d %d ) ( %d %d %d )",
                                       px, py, x, y, z);
                        } else if (px == x) {
                           if (py < y)  {
                              if (pz != -99)
-                                fprintf (fout, " ( %d %d %d ) ( %d %d %d )",
+                                diffPrintf(" ( %d %d %d ) ( %d %d %d )",
                                          px, py, pz, x, y, z);
                              else
-                                fprintf (fout, " ( %d %d ) ( %d %d %d )",
+                                diffPrintf(" ( %d %d ) ( %d %d %d )",
                                          px, py, x, y, z);
                           } else {
                              if (pz != -99)
-                                fprintf (fout, " ( %d %d %d ) ( %d %d %d )",
+                                diffPrintf(" ( %d %d %d ) ( %d %d %d )",
                                          x, y, z, px, py, pz);
                              else
-                                fprintf (fout, " ( %d %d %d ) ( %d %d )",
+                                diffPrintf(" ( %d %d %d ) ( %d %d )",
                                          x, y, z, px, py);
                           }
                        } else {  // px > x
                           if (pz != -99)
-                             fprintf (fout, " ( %d %d %d ) ( %d %d %d )",
+                             diffPrintf(" ( %d %d %d ) ( %d %d %d )",
                                       x, y, z, px, py, pz);
                           else
-                             fprintf (fout, " ( %d %d %d ) ( %d %d )",
+                             diffPrintf(" ( %d %d %d ) ( %d %d )",
                                       x, y, z, px, py);
                        }
                        px = x;
@@ -415,10 +637,10 @@ int netf(defrCallbackType_e c, defiNet* net, defiUserData ud) {
                  }
                  break;
             case DEFIPATH_TAPER:
-                 fprintf(fout, " TAPER");
+                 diffPrintf(" TAPER");
                  break;
             case DEFIPATH_TAPERRULE:
-                 fprintf(fout, " TAPERRULE %s",p->getTaperRule());
+                 diffPrintf(" TAPERRULE %s",p->getTaperRule());
                  break;
           }
         }
@@ -429,7 +651,7 @@ int netf(defrCallbackType_e c, defiNet* net, defiUserData ud) {
   // shieldnet
   if (net->numShieldNets()) {
      for (i = 0; i < net->numShieldNets(); i++)
-         fprintf(fout, "\nNET %s SHIELDNET %s ", net->name(),
+         diffPrintf("\nNET %s SHIELDNET %s ", net->name(),
                  net->shieldNet(i));
   }
   if (net->numNoShields()) {
@@ -438,42 +660,42 @@ int netf(defrCallbackType_e c, defiNet* net, defiUserData ud) {
          for (j = 0; j < noShield->numPaths(); j++) {
             p = noShield->path(j);
             p->initTraverse();
-            fprintf(fout, "\nNET %s NOSHIELD", net->name());
+            diffPrintf("\nNET %s NOSHIELD", net->name());
             nline = 0;
             while ((path = (int)p->next()) != DEFIPATH_DONE) {
                switch (path) {
                  case DEFIPATH_LAYER:
-                      fprintf(fout, " %s", p->getLayer());
+                      diffPrintf(" %s", p->getLayer());
                       layerName = p->getLayer();
                       break;
 				 case DEFIPATH_MASK:
-					  fprintf(fout, "MASK %d ", p->getMask());
+					  diffPrintf("MASK %d ", p->getMask());
 					  break;
                  case DEFIPATH_VIAMASK:
-                      fprintf(fout, "MASK %d%d%d ", 
+                      diffPrintf("MASK %d%d%d ", 
                               p->getViaTopMask(), 
                               p->getViaCutMask(),
                               p->getViaBottomMask());
                       break;
                  case DEFIPATH_VIA:
                       if (!ignoreVN)
-                         fprintf(fout, " %s", p->getVia());
+                         diffPrintf(" %s", p->getVia());
                       nline = 1;
                       break;
                  case DEFIPATH_VIAROTATION:
-                      fprintf(fout, " %d", p->getViaRotation());
+                      diffPrintf(" %d", p->getViaRotation());
                       nline = 1;
                       break;
                  case DEFIPATH_WIDTH:
-                      fprintf(fout, " %d", p->getWidth());
+                      diffPrintf(" %d", p->getWidth());
                       break;
                  case DEFIPATH_POINT:
                       p->getPoint(&x, &y);
                       if (!nline) {
-                         fprintf(fout, " ( %d %d )", x, y);
+                         diffPrintf(" ( %d %d )", x, y);
                          nline = 1;
                       } else {
-                         fprintf(fout, "\nNET %s %s ( %d %d )",
+                         diffPrintf("\nNET %s %s ( %d %d )",
                                  net->name(), layerName, x, y);
                          nline = 1;
                       }
@@ -481,18 +703,18 @@ int netf(defrCallbackType_e c, defiNet* net, defiUserData ud) {
                  case DEFIPATH_FLUSHPOINT:
                       p->getFlushPoint(&x, &y, &z);
                       if (!nline) {
-                         fprintf(fout, " ( %d %d )", x, y);
+                         diffPrintf(" ( %d %d )", x, y);
                          nline = 1;
                       } else {
-                         fprintf(fout, "\nNET %s %s ( %d %d )",
+                         diffPrintf("\nNET %s %s ( %d %d )",
                                  net->name(), layerName, x, y);
                          nline = 1;
                       }
                  case DEFIPATH_TAPER:
-                      fprintf(fout, " TAPER");
+                      diffPrintf(" TAPER");
                       break;
                  case DEFIPATH_TAPERRULE:
-                      fprintf(fout, " TAPERRULE %s",
+                      diffPrintf(" TAPERRULE %s",
                               p->getTaperRule());
                       break;
                }
@@ -508,10 +730,10 @@ int netf(defrCallbackType_e c, defiNet* net, defiUserData ud) {
       if (s->numConnections()) {
           for (j = 0; j < s->numConnections(); j++) {
               if (s->pinIsMustJoin(0))
-                  fprintf(fout, "\nNET MUSTJOIN");
+                  diffPrintf("\nNET MUSTJOIN");
               else
-                  fprintf(fout, "\nNET %s", s->name());
-              fprintf(fout, " ( %s %s )", s->instance(j), s->pin(j));
+                  diffPrintf("\nNET %s", s->name());
+              diffPrintf(" ( %s %s )", s->instance(j), s->pin(j));
           }
       }
  
@@ -522,43 +744,43 @@ int netf(defrCallbackType_e c, defiNet* net, defiUserData ud) {
              int elem;
              p = wire->path(k);
              p->initTraverse();
-             fprintf(fout, "\nNET %s %s", s->name(), wire->wireType()); 
+             diffPrintf("\nNET %s %s", s->name(), wire->wireType()); 
              nline = 0;
              elem = p->next();
              while (elem) { 
                 switch (elem) {
                   case DEFIPATH_LAYER:
-                       fprintf(fout, " LAYER %s",  p->getLayer());
+                       diffPrintf(" LAYER %s",  p->getLayer());
                        layerName = p->getLayer();
                        break;
 		  case DEFIPATH_MASK:
-		       fprintf(fout, "MASK %d ", p->getMask());
+		       diffPrintf("MASK %d ", p->getMask());
 		       break;
                   case DEFIPATH_VIAMASK:
-                       fprintf(fout, "MASK %d%d%d ", 
+                       diffPrintf("MASK %d%d%d ", 
                                p->getViaTopMask(), 
                                p->getViaCutMask(),
                                p->getViaBottomMask());
                        break;
                   case DEFIPATH_VIA:
                        if (!ignoreVN)
-                          fprintf(fout, " VIA %s", p->getVia());
+                          diffPrintf(" VIA %s", p->getVia());
                        nline = 1;
                        break;
                   case DEFIPATH_VIAROTATION:
-                       fprintf(fout, " VIAROTATION %d", p->getViaRotation());
+                       diffPrintf(" VIAROTATION %d", p->getViaRotation());
                        nline = 1;
                        break;
                   case DEFIPATH_WIDTH:
-                       fprintf(fout, " WIDTH %d", p->getWidth());
+                       diffPrintf(" WIDTH %d", p->getWidth());
                        break;
                   case DEFIPATH_POINT:
                        p->getPoint(&x, &y);
                        if (!nline) {
-                          fprintf(fout, " POINT %d %d", x, y);
+                          diffPrintf(" POINT %d %d", x, y);
                           nline = 1;
                        } else {
-                          fprintf(fout, "\nNET %s %s %s POINT %d %d",
+                          diffPrintf("\nNET %s %s %s POINT %d %d",
                                   s->name(), wire->wireType(), layerName, x, y);
                           nline = 1;
                        }
@@ -567,19 +789,19 @@ int netf(defrCallbackType_e c, defiNet* net, defiUserData ud) {
                        //l = 0;
                        //p->getFlushPoint(i1, i2, ext);
                        //while (i1[l] && i2[l] && ext[l]) {
-                          //fprintf(fout, "NET %s FLUSHPOINT %d %d %d\n",
+                          //diffPrintf("NET %s FLUSHPOINT %d %d %d\n",
                                   //s->name(), i1[l], i2[l], ext[l]);
                           //l++;
                        //}
                        //break;
                   case DEFIPATH_TAPERRULE:
-                       fprintf(fout, " TAPERRULE %s", p->getTaperRule());
+                       diffPrintf(" TAPERRULE %s", p->getTaperRule());
                        break;
                   case DEFIPATH_SHAPE:
-                       fprintf(fout, " SHAPE %s", p->getShape());
+                       diffPrintf(" SHAPE %s", p->getShape());
                        break;
                   case DEFIPATH_STYLE:
-                       fprintf(fout, " STYLE %d", p->getStyle());
+                       diffPrintf(" STYLE %d", p->getStyle());
                        break;
                }
                elem = p->next();
@@ -593,27 +815,27 @@ int netf(defrCallbackType_e c, defiNet* net, defiUserData ud) {
   /* Put the following all in one line */
   if (net->hasWeight() || net->hasCap() || net->hasSource() ||
       net->hasPattern() || net->hasOriginal() || net->hasUse()) {
-      fprintf(fout, "\nNET %s ", net->name());
+      diffPrintf("\nNET %s ", net->name());
 
      if (net->hasWeight())
-       fprintf(fout, "WEIGHT %d ", net->weight());
+       diffPrintf("WEIGHT %d ", net->weight());
      if (net->hasCap())
-       fprintf(fout, "ESTCAP %g ", checkDouble(net->cap()));
+       diffPrintf("ESTCAP %g ", checkDouble(net->cap()));
      if (net->hasSource())
-       fprintf(fout, "SOURCE %s ", net->source());
+       diffPrintf("SOURCE %s ", net->source());
      if (net->hasFixedbump())
-       fprintf(fout, "FIXEDBUMP ");
+       diffPrintf("FIXEDBUMP ");
      if (net->hasFrequency())
-       fprintf(fout, "FREQUENCY %g ", net->frequency());
+       diffPrintf("FREQUENCY %g ", net->frequency());
      if (net->hasPattern())
-       fprintf(fout, "PATTERN %s ", net->pattern());
+       diffPrintf("PATTERN %s ", net->pattern());
      if (net->hasOriginal())
-       fprintf(fout, "ORIGINAL %s ", net->original());
+       diffPrintf("ORIGINAL %s ", net->original());
      if (net->hasUse())
-       fprintf(fout, "USE %s ", net->use());
+       diffPrintf("USE %s ", net->use());
   }
 
-  fprintf (fout, "\n");
+  diffPrintf("\n");
   --numObjs;
   return 0;
 }
@@ -637,12 +859,12 @@ int snetf(defrCallbackType_e c, defiNet* net, defiUserData ud) {
   checkType(c);
   if (ud != userData) dataError();
   if (c != defrSNetCbkType)
-      fprintf(fout, "BOGUS NET TYPE  ");
+      diffPrintf("BOGUS NET TYPE  ");
 
   // compName & pinName
   if (net->numConnections() > 0) {
      for (i = 0; i < net->numConnections(); i++)
-         fprintf (fout, "SNET %s ( %s %s )\n", net->name(), net->instance(i),
+         diffPrintf("SNET %s ( %s %s )\n", net->name(), net->instance(i),
                   net->pin(i));
   }
 
@@ -650,24 +872,24 @@ int snetf(defrCallbackType_e c, defiNet* net, defiUserData ud) {
 
      for (i = 0; i < net->numRectangles(); i++) {
        if (curVer >= 5.8 ) {
-         fprintf (fout, "\nSNET %s ", net->name());
+         diffPrintf("\nSNET %s ", net->name());
 	 if (strcmp(net->rectRouteStatus(i), "") != 0) {
-	   fprintf(fout, "%s ", net->rectRouteStatus(i));
+	   diffPrintf("%s ", net->rectRouteStatus(i));
 	   if (strcmp(net->rectRouteStatus(i), "SHIELD") == 0) {
-	      fprintf(fout, "%s ", net->rectRouteStatusShieldName(i));
+	      diffPrintf("%s ", net->rectRouteStatusShieldName(i));
 	   }
          }
          if (strcmp(net->rectShapeType(i), "") != 0) {
-	   fprintf(fout, "SHAPE %s ", net->rectShapeType(i));
+	   diffPrintf("SHAPE %s ", net->rectShapeType(i));
          }
        }
        if (net->rectMask(i)) {
-	  fprintf(fout, "MASK %d RECT %s %d %d %d %d", 
+	  diffPrintf("MASK %d RECT %s %d %d %d %d", 
 		  net->rectMask(i), net->rectName(i),
 		  net->xl(i), net->yl(i), net->xh(i),
                   net->yh(i));
        } else {
-	  fprintf(fout, "RECT %s %d %d %d %d", net->name(),
+	  diffPrintf("RECT %s %d %d %d %d", net->name(),
                net->xl(i), net->yl(i), net->xh(i),
                net->yh(i));
        }
@@ -678,60 +900,60 @@ int snetf(defrCallbackType_e c, defiNet* net, defiUserData ud) {
     struct defiPoints points;
 
     for (i = 0; i < net->numPolygons(); i++) {
-      fprintf (fout, "\nSNET %s ", net->name());
+      diffPrintf("\nSNET %s ", net->name());
       if (curVer >= 5.8 ) {
 	 if (strcmp(net->polyRouteStatus(i), "") != 0) {
-	   fprintf(fout, "%s ", net->polyRouteStatus(i));
+	   diffPrintf("%s ", net->polyRouteStatus(i));
 	   if (strcmp(net->polyRouteStatus(i), "SHIELD") == 0) {
-	      fprintf(fout, "%s ", net->polyRouteStatusShieldName(i));
+	      diffPrintf("%s ", net->polyRouteStatusShieldName(i));
 	   }
          }
          if (strcmp(net->polyShapeType(i), "") != 0) {
-	   fprintf(fout, "SHAPE %s ", net->polyShapeType(i));
+	   diffPrintf("SHAPE %s ", net->polyShapeType(i));
          }
       }
       if (net->polyMask(i)) {
-	  fprintf(fout, "MASK %d POLYGON % s ", 
+	  diffPrintf("MASK %d POLYGON % s ", 
 		  net->polyMask(i),
 		  net->polygonName(i));
       } else {
-	  fprintf(fout, "POLYGON %s", net->polygonName(i));
+	  diffPrintf("POLYGON %s", net->polygonName(i));
       }
 
       points = net->getPolygon(i);
       for (j = 0; j < points.numPoints; j++)
-        fprintf(fout, " %d %d", points.x[j], points.y[j]);
+        diffPrintf(" %d %d", points.x[j], points.y[j]);
     }
   }
 
    if (curVer >= 5.8 && net->numViaSpecs()) {
      for (i = 0; i < net->numViaSpecs(); i++) {
-       fprintf (fout, "\nSNET %s ", net->name());
+       diffPrintf("\nSNET %s ", net->name());
        if (strcmp(net->viaRouteStatus(i), "") != 0) {
-	fprintf(fout, "%s ", net->viaRouteStatus(i));
+	diffPrintf("%s ", net->viaRouteStatus(i));
 	if (strcmp(net->viaRouteStatus(i), "SHIELD") == 0) {
-	      fprintf(fout, "%s ", net->viaRouteStatusShieldName(i));
+	      diffPrintf("%s ", net->viaRouteStatusShieldName(i));
 	   }
        }
        if (strcmp(net->viaShapeType(i), "") != 0) {
-	fprintf(fout, "SHAPE %s ", net->viaShapeType(i));
+	diffPrintf("SHAPE %s ", net->viaShapeType(i));
        }
        if (net->topMaskNum(i) || net->cutMaskNum(i) || net->bottomMaskNum(i)) {
-	fprintf(fout, "MASK %d%d%d VIA %s ", net->topMaskNum(i), 
+	diffPrintf("MASK %d%d%d VIA %s ", net->topMaskNum(i), 
                 net->cutMaskNum(i),
                 net->bottomMaskNum(i),
 		net->viaName(i));
        } else {
-	fprintf(fout, "\n  VIA %s ", net->viaName(i));
+	diffPrintf("\n  VIA %s ", net->viaName(i));
        }
-       fprintf(fout, " %s", net->viaOrientStr(i));
+       diffPrintf(" %s", net->viaOrientStr(i));
       
        defiPoints points = net->getViaPts(i);
 
        for (int j = 0; j < points.numPoints; j++) {
-          fprintf(fout, " %d %d", points.x[j], points.y[j]);
+          diffPrintf(" %d %d", points.x[j], points.y[j]);
        }
-       fprintf(fout, ";\n"); 
+       diffPrintf(";\n"); 
      }
   } 
 
@@ -742,66 +964,66 @@ int snetf(defrCallbackType_e c, defiNet* net, defiUserData ud) {
         wire = net->wire(i);
         for (j = 0; j < wire->numPaths(); j++) {
            p = wire->path(j);
-           fprintf(fout, "\nSNET %s %s", net->name(), wire->wireType());
+           diffPrintf("\nSNET %s %s", net->name(), wire->wireType());
            nline = 0;
            p->initTraverse();
            while ((path = (int)p->next()) != DEFIPATH_DONE) {
               switch (path) {
                 case DEFIPATH_LAYER:
-                     fprintf(fout, " %s", p->getLayer());
+                     diffPrintf(" %s", p->getLayer());
                      sNLayerName = p->getLayer();
                      break;
 		case DEFIPATH_MASK:
-		     fprintf(fout, "MASK %d ", p->getMask());
+		     diffPrintf("MASK %d ", p->getMask());
 		     break;
                 case DEFIPATH_VIAMASK:
-                     fprintf(fout, "MASK %d%d%d ", 
+                     diffPrintf("MASK %d%d%d ", 
                              p->getViaTopMask(), 
                              p->getViaCutMask(),
                              p->getViaBottomMask());
                     break;
                 case DEFIPATH_VIA:
                      if (!ignoreVN)
-                        fprintf(fout, " %s", p->getVia());
+                        diffPrintf(" %s", p->getVia());
                      nline = 1;
                      break;
                 case DEFIPATH_VIAROTATION:
-                     fprintf(fout, " %d", p->getViaRotation());
+                     diffPrintf(" %d", p->getViaRotation());
                      nline = 1;
                      break;
                 case DEFIPATH_VIADATA:
                      p->getViaData(&numX, &numY, &stepX, &stepY);
-                     fprintf(fout, " DO %d BY %d STEP %d %d", numX, numY,
+                     diffPrintf(" DO %d BY %d STEP %d %d", numX, numY,
                              stepX, stepY);
                      nline = 1;
                      break;
                 case DEFIPATH_WIDTH:
-                     fprintf(fout, " %d", p->getWidth());
+                     diffPrintf(" %d", p->getWidth());
                      break;
                 case DEFIPATH_POINT:
                      p->getPoint(&x, &y);
                      if (!nline) {
-                        fprintf(fout, " ( %d %d ) ", x, y);
+                        diffPrintf(" ( %d %d ) ", x, y);
                         nline = 1;
                      } else {
-                        fprintf(fout, "\nSNET %s %s %s ( %d %d )", net->name(),
+                        diffPrintf("\nSNET %s %s %s ( %d %d )", net->name(),
                                 wire->wireType(), sNLayerName, x, y);
                         nline = 1;
                      }
                      break;
                 case DEFIPATH_FLUSHPOINT:
                      p->getFlushPoint(&x, &y, &z);
-                     fprintf(fout, "( %d %d %d ) ", x, y, z);
+                     diffPrintf("( %d %d %d ) ", x, y, z);
                      nline = 1;
                      break;
                 case DEFIPATH_TAPER:
-                     fprintf(fout, " TAPER");
+                     diffPrintf(" TAPER");
                      break;
                 case DEFIPATH_SHAPE:
-                     fprintf(fout, " + SHAPE %s", p->getShape());
+                     diffPrintf(" + SHAPE %s", p->getShape());
                      break;
                 case DEFIPATH_STYLE:
-                     fprintf(fout, " + STYLE %d", p->getStyle());
+                     diffPrintf(" + STYLE %d", p->getStyle());
                      break;
               }
            }
@@ -814,11 +1036,11 @@ int snetf(defrCallbackType_e c, defiNet* net, defiUserData ud) {
        s = net->subnet(i);
        if (s->numConnections()) {
            if (s->pinIsMustJoin(0))
-               fprintf(fout, "\nSNET %s MUSTJOIN", net->name());
+               diffPrintf("\nSNET %s MUSTJOIN", net->name());
            else
-               fprintf(fout, "\nSNET %s", net->name());
+               diffPrintf("\nSNET %s", net->name());
            for (j = 0; j < s->numConnections(); j++) {
-               fprintf(fout, "( %s %s ) ", s->instance(j), s->pin(j));
+               diffPrintf("( %s %s ) ", s->instance(j), s->pin(j));
            }
       }
  
@@ -829,48 +1051,48 @@ int snetf(defrCallbackType_e c, defiNet* net, defiUserData ud) {
             for (j = 0; j < wire->numPaths(); j++) {
               p = wire->path(j);
               p->initTraverse();
-              fprintf(fout, "\nSNET %s %s", net->name(), wire->wireType());
+              diffPrintf("\nSNET %s %s", net->name(), wire->wireType());
               nline = 0;
               while ((path = (int)p->next()) != DEFIPATH_DONE) {
                 switch (path) {
                   case DEFIPATH_LAYER:
-                       fprintf(fout, " %s", p->getLayer());
+                       diffPrintf(" %s", p->getLayer());
                        sNLayerName = p->getLayer();
                        break;
                   case DEFIPATH_VIA:
                        if (!ignoreVN)
-                          fprintf(fout, " %s", p->getVia());
+                          diffPrintf(" %s", p->getVia());
                        break;
 		  case DEFIPATH_MASK:
-		       fprintf(fout, "MASK %d ", p->getMask());
+		       diffPrintf("MASK %d ", p->getMask());
 		       break;
                   case DEFIPATH_VIAMASK:
-                       fprintf(fout, "MASK %d%d%d ", 
+                       diffPrintf("MASK %d%d%d ", 
                            p->getViaTopMask(), 
                            p->getViaCutMask(),
                            p->getViaBottomMask());
                    break;
 
                   case DEFIPATH_VIAROTATION:
-                       fprintf(fout, " %d", p->getViaRotation());
+                       diffPrintf(" %d", p->getViaRotation());
                        break;
                   case DEFIPATH_WIDTH:
-                       fprintf(fout, " %d", p->getWidth());
+                       diffPrintf(" %d", p->getWidth());
                        break;
                   case DEFIPATH_POINT:
                        p->getPoint(&x, &y);
                        if (!nline) {
-                          fprintf(fout, "( %d %d ) ", x, y);
+                          diffPrintf("( %d %d ) ", x, y);
                           nline = 1;
                        } else {
-                          fprintf(fout, "\nSNET %s %s %s ( %d %d ) ",
+                          diffPrintf("\nSNET %s %s %s ( %d %d ) ",
                                   net->name(), wire->wireType(), sNLayerName,
                                   x, y);
                           nline = 1;
                        }
                        break;
                   case DEFIPATH_TAPER:
-                       fprintf(fout, " TAPER");
+                       diffPrintf(" TAPER");
                        break;
                 }
               }
@@ -882,18 +1104,18 @@ int snetf(defrCallbackType_e c, defiNet* net, defiUserData ud) {
  
   if (net->numProps()) {
     for (i = 0; i < net->numProps(); i++) {
-        fprintf(fout, "\nSNET %s PROP %s %s ", net->name(),
+        diffPrintf("\nSNET %s PROP %s %s ", net->name(),
                 net->propName(i), net->propValue(i));
         switch (net->propType(i)) {
-           case 'R': fprintf(fout, "REAL ");
+           case 'R': diffPrintf("REAL ");
                      break;
-           case 'I': fprintf(fout, "INT ");
+           case 'I': diffPrintf("INT ");
                      break;
-           case 'S': fprintf(fout, "STR ");
+           case 'S': diffPrintf("STR ");
                      break;
-           case 'Q': fprintf(fout, "QSTR ");
+           case 'Q': diffPrintf("QSTR ");
                      break;
-           case 'N': fprintf(fout, "NUM ");
+           case 'N': diffPrintf("NUM ");
                      break;
         }
     }
@@ -906,47 +1128,47 @@ int snetf(defrCallbackType_e c, defiNet* net, defiUserData ud) {
        shield = net->shield(i);
        for (j = 0; j < shield->numPaths(); j++) {
           p = shield->path(j);
-          fprintf(fout, "\nSNET %s SHIELD %s", net->name(),
+          diffPrintf("\nSNET %s SHIELD %s", net->name(),
                   shield->shieldName());
           p->initTraverse();
           while ((path = (int)p->next()) != DEFIPATH_DONE) {
              switch (path) {
                case DEFIPATH_LAYER:
-                    fprintf(fout, " %s", p->getLayer());
+                    diffPrintf(" %s", p->getLayer());
                     sNLayerName = p->getLayer();
                     break;
                case DEFIPATH_VIA:
                     if (!ignoreVN)
-                       fprintf(fout, " %s", p->getVia());
+                       diffPrintf(" %s", p->getVia());
                     break;
 	       case DEFIPATH_MASK:
-		    fprintf(fout, "MASK %d ", p->getMask());
+		    diffPrintf("MASK %d ", p->getMask());
 		    break;
                case DEFIPATH_VIAMASK:
-                   fprintf(fout, "MASK %d%d%d ", 
+                   diffPrintf("MASK %d%d%d ", 
                            p->getViaTopMask(), 
                            p->getViaCutMask(),
                            p->getViaBottomMask());
                    break;
                case DEFIPATH_VIAROTATION:
-                    fprintf(fout, " %d", p->getViaRotation());
+                    diffPrintf(" %d", p->getViaRotation());
                     break;
                case DEFIPATH_WIDTH:
-                    fprintf(fout, " %d", p->getWidth());
+                    diffPrintf(" %d", p->getWidth());
                     break;
                case DEFIPATH_POINT:
                     p->getPoint(&x, &y);
                     if (!nline) {
-                       fprintf(fout, "( %d %d ) ", x, y);
+                       diffPrintf("( %d %d ) ", x, y);
                        nline = 1;
                     } else {
-                      fprintf(fout, "\nSNET %s SHIELD %s %s ( %d %d )",
+                      diffPrintf("\nSNET %s SHIELD %s %s ( %d %d )",
                               net->name(), shield->shieldName(), sNLayerName,
                               x, y);
                     }
                     break;
                case DEFIPATH_TAPER:
-                    fprintf(fout, " TAPER");
+                    diffPrintf(" TAPER");
                     break;
              }
           }
@@ -956,22 +1178,22 @@ int snetf(defrCallbackType_e c, defiNet* net, defiUserData ud) {
 
   // layerName width
   if (net->hasWidthRules()) {
-    fprintf(fout, "\nSNET %s", net->name());
+    diffPrintf("\nSNET %s", net->name());
     for (i = 0; i < net->numWidthRules(); i++) {
         net->widthRule(i, &layerName, &dist);
-        fprintf (fout, " WIDTH %s %g ", layerName, checkDouble(dist));
+        diffPrintf(" WIDTH %s %g ", layerName, checkDouble(dist));
     }
   }
 
   // layerName spacing
   if (net->hasSpacingRules()) {
-    fprintf(fout, "\nSNET %s", net->name());
+    diffPrintf("\nSNET %s", net->name());
     for (i = 0; i < net->numSpacingRules(); i++) {
         net->spacingRule(i, &layerName, &dist, &left, &right);
         if (left == right)
-            fprintf (fout, " SPACING %s %g ", layerName, checkDouble(dist));
+            diffPrintf(" SPACING %s %g ", layerName, checkDouble(dist));
         else
-            fprintf (fout, " SPACING %s %g RANGE %g %g ",
+            diffPrintf(" SPACING %s %g RANGE %g %g ",
                      layerName, checkDouble(dist), checkDouble(left),
                      checkDouble(right));
     }
@@ -980,24 +1202,24 @@ int snetf(defrCallbackType_e c, defiNet* net, defiUserData ud) {
   if (net->hasVoltage() || net->hasWeight() || net->hasCap() ||
       net->hasSource() || net->hasPattern() || net->hasOriginal() ||
       net->hasUse()) {
-    fprintf(fout, "\nSNET %s", net->name());
+    diffPrintf("\nSNET %s", net->name());
     if (net->hasVoltage())
-      fprintf(fout, " VOLTAGE %g", checkDouble(net->voltage()));
+      diffPrintf(" VOLTAGE %g", checkDouble(net->voltage()));
     if (net->hasWeight())
-      fprintf(fout, " WEIGHT %d", net->weight());
+      diffPrintf(" WEIGHT %d", net->weight());
     if (net->hasCap())
-      fprintf(fout, " ESTCAP %g", checkDouble(net->cap()));
+      diffPrintf(" ESTCAP %g", checkDouble(net->cap()));
     if (net->hasSource())
-      fprintf(fout, " SOURCE %s", net->source());
+      diffPrintf(" SOURCE %s", net->source());
     if (net->hasPattern())
-      fprintf(fout, " PATTERN %s", net->pattern());
+      diffPrintf(" PATTERN %s", net->pattern());
     if (net->hasOriginal())
-      fprintf(fout, " ORIGINAL %s", net->original());
+      diffPrintf(" ORIGINAL %s", net->original());
     if (net->hasUse())
-      fprintf(fout, " USE %s", net->use());
+      diffPrintf(" USE %s", net->use());
   }
 
-  fprintf(fout,"\n");
+  diffPrintf("\n");
   --numObjs;
   return 0;
 }
@@ -1009,32 +1231,32 @@ int ndr(defrCallbackType_e c, defiNonDefault* nd, defiUserData ud) {
   checkType(c);
   if (ud != userData) dataError();
   if (c != defrNonDefaultCbkType)
-      fprintf(fout, "BOGUS NONDEFAULTRULE TYPE  ");
-  fprintf(fout, "NDR %s", nd->name());
+      diffPrintf("BOGUS NONDEFAULTRULE TYPE  ");
+  diffPrintf("NDR %s", nd->name());
   if (nd->hasHardspacing())
-     fprintf(fout, " HARDSPACING\n");
-  fprintf(fout, "\n");
+     diffPrintf(" HARDSPACING\n");
+  diffPrintf("\n");
   for (i = 0; i < nd->numLayers(); i++) {
-    fprintf(fout, "NDR %s LAYER %s", nd->name(), nd->layerName(i));
-    fprintf(fout, " WIDTH %d", nd->layerWidthVal(i));
+    diffPrintf("NDR %s LAYER %s", nd->name(), nd->layerName(i));
+    diffPrintf(" WIDTH %d", nd->layerWidthVal(i));
     if (nd->hasLayerDiagWidth(i))
-      fprintf(fout, " DIAGWIDTH %d",
+      diffPrintf(" DIAGWIDTH %d",
               nd->layerDiagWidthVal(i));
     if (nd->hasLayerSpacing(i))
-      fprintf(fout, " SPACING %d", nd->layerSpacingVal(i));
+      diffPrintf(" SPACING %d", nd->layerSpacingVal(i));
     if (nd->hasLayerWireExt(i))
-      fprintf(fout, " WIREEXT %d", nd->layerWireExtVal(i));
-    fprintf(fout, "\n");
+      diffPrintf(" WIREEXT %d", nd->layerWireExtVal(i));
+    diffPrintf("\n");
   }
   for (i = 0; i < nd->numVias(); i++)
-    fprintf(fout, "NDR %s VIA %s\n", nd->name(), nd->viaName(i));
+    diffPrintf("NDR %s VIA %s\n", nd->name(), nd->viaName(i));
   for (i = 0; i < nd->numViaRules(); i++)
-    fprintf(fout, "NDR %s VIARULE %s\n", nd->name(), nd->viaRuleName(i));
+    diffPrintf("NDR %s VIARULE %s\n", nd->name(), nd->viaRuleName(i));
   for (i = 0; i < nd->numMinCuts(); i++)
-    fprintf(fout, "NDR %s MINCUTS %s %d\n", nd->name(), nd->cutLayerName(i),
+    diffPrintf("NDR %s MINCUTS %s %d\n", nd->name(), nd->cutLayerName(i),
             nd->numCuts(i));
   for (i = 0; i < nd->numProps(); i++)
-    fprintf(fout, "NDR %s PROPERTY %s %s\n", nd->name(), nd->propName(i),
+    diffPrintf("NDR %s PROPERTY %s %s\n", nd->name(), nd->propName(i),
               nd->propValue(i));
   --numObjs;
   return 0;
@@ -1044,7 +1266,7 @@ int ndr(defrCallbackType_e c, defiNonDefault* nd, defiUserData ud) {
 int tname(defrCallbackType_e c, const char* string, defiUserData ud) {
   checkType(c);
   if (ud != userData) dataError();
-  fprintf(fout, "TECHNOLOGY %s\n", string);
+  diffPrintf("TECHNOLOGY %s\n", string);
   return 0;
 }
 
@@ -1052,7 +1274,7 @@ int tname(defrCallbackType_e c, const char* string, defiUserData ud) {
 int dname(defrCallbackType_e c, const char* string, defiUserData ud) {
   checkType(c);
   if (ud != userData) dataError();
-  fprintf(fout, "DESIGN %s\n", string);
+  diffPrintf("DESIGN %s\n", string);
 
   // Test changing the user data.
   userData = (void*)89;
@@ -1074,34 +1296,34 @@ void operand(defrCallbackType_e c, defiAssertion* a, int ind) {
 
   if (a->isSum()) {
       // Sum in operand, recursively call operand
-      fprintf(fout, "ASSERTIONS/CONSTRAINTS SUM ( ");
+      diffPrintf("ASSERTIONS/CONSTRAINTS SUM ( ");
       a->unsetSum();
       isSumSet = 1;
       begOperand = 0;
       operand (c, a, ind);
-      fprintf(fout, ") ");
+      diffPrintf(") ");
   } else {
       // operand
       if (ind >= a->numItems()) {
-          fprintf(fout, "ERROR: when writing out SUM in Constraints.\n");
+          diffPrintf("ERROR: when writing out SUM in Constraints.\n");
           return;
        }
       if (begOperand) {
-         fprintf(fout, "ASSRT/CONSTR ");
+         diffPrintf("ASSRT/CONSTR ");
          begOperand = 0;
       }
       for (i = ind; i < a->numItems(); i++) {
           if (a->isNet(i)) {
               a->net(i, &netName);
               if (!first)
-                  fprintf(fout, ", "); // print , as separator
-              fprintf(fout, "NET %s ", netName); 
+                  diffPrintf(", "); // print , as separator
+              diffPrintf("NET %s ", netName); 
           } else if (a->isPath(i)) {
               a->path(i, &fromInst, &fromPin, &toInst,
                                      &toPin);
               if (!first)
-                  fprintf(fout, ", ");
-              fprintf(fout, "PATH %s %s %s %s ", fromInst, fromPin, toInst,
+                  diffPrintf(", ");
+              diffPrintf("PATH %s %s %s %s ", fromInst, fromPin, toInst,
                       toPin);
           } else if (isSumSet) {
               // SUM within SUM, reset the flag
@@ -1122,7 +1344,7 @@ int constraint(defrCallbackType_e c, defiAssertion* a, defiUserData ud) {
   if (ud != userData) dataError();
   if (a->isWiredlogic())
       // Wirelogic
-      fprintf(fout, "ASSRT/CONSTR WIREDLOGIC %s + MAXDIST %g\n",
+      diffPrintf("ASSRT/CONSTR WIREDLOGIC %s + MAXDIST %g\n",
               a->netName(), checkDouble(a->fallMax()));
   else {
       // Call the operand function
@@ -1131,14 +1353,14 @@ int constraint(defrCallbackType_e c, defiAssertion* a, defiUserData ud) {
       operand (c, a, 0);
       // Get the Rise and Fall
       if (a->hasRiseMax())
-          fprintf(fout, " RISEMAX %g ", checkDouble(a->riseMax()));
+          diffPrintf(" RISEMAX %g ", checkDouble(a->riseMax()));
       if (a->hasFallMax())
-          fprintf(fout, " FALLMAX %g ", checkDouble(a->fallMax()));
+          diffPrintf(" FALLMAX %g ", checkDouble(a->fallMax()));
       if (a->hasRiseMin())
-          fprintf(fout, " RISEMIN %g ", checkDouble(a->riseMin()));
+          diffPrintf(" RISEMIN %g ", checkDouble(a->riseMin()));
       if (a->hasFallMin())
-          fprintf(fout, " FALLMIN %g ", checkDouble(a->fallMin()));
-      fprintf(fout, "\n");
+          diffPrintf(" FALLMIN %g ", checkDouble(a->fallMin()));
+      diffPrintf("\n");
   }
   --numObjs;
   return 0;
@@ -1150,40 +1372,40 @@ int prop(defrCallbackType_e c, defiProp* p, defiUserData ud) {
   checkType(c);
   if (ud != userData) dataError();
   if (strcmp(p->propType(), "design") == 0)
-      fprintf(fout, "PROPDEF DESIGN %s ", p->propName());
+      diffPrintf("PROPDEF DESIGN %s ", p->propName());
   else if (strcmp(p->propType(), "net") == 0)
-      fprintf(fout, "PROPDEF NET %s ", p->propName());
+      diffPrintf("PROPDEF NET %s ", p->propName());
   else if (strcmp(p->propType(), "component") == 0)
-      fprintf(fout, "PROPDEF COMP %s ", p->propName());
+      diffPrintf("PROPDEF COMP %s ", p->propName());
   else if (strcmp(p->propType(), "specialnet") == 0)
-      fprintf(fout, "PROPDEF SNET %s ", p->propName());
+      diffPrintf("PROPDEF SNET %s ", p->propName());
   else if (strcmp(p->propType(), "group") == 0)
-      fprintf(fout, "PROPDEF GROUP %s ", p->propName());
+      diffPrintf("PROPDEF GROUP %s ", p->propName());
   else if (strcmp(p->propType(), "row") == 0)
-      fprintf(fout, "PROPDEF ROW %s ", p->propName());
+      diffPrintf("PROPDEF ROW %s ", p->propName());
   else if (strcmp(p->propType(), "componentpin") == 0)
-      fprintf(fout, "PROPDEF COMPPIN %s ", p->propName());
+      diffPrintf("PROPDEF COMPPIN %s ", p->propName());
   else if (strcmp(p->propType(), "region") == 0)
-      fprintf(fout, "PROPDEF REGION %s ", p->propName());
+      diffPrintf("PROPDEF REGION %s ", p->propName());
   else if (strcmp(p->propType(), "nondefaultrule") == 0)
-      fprintf(fout, "PROPDEF NONDEFAULTRULE %s ", p->propName());
+      diffPrintf("PROPDEF NONDEFAULTRULE %s ", p->propName());
   if (p->dataType() == 'I')
-      fprintf(fout, "INT ");
+      diffPrintf("INT ");
   if (p->dataType() == 'R')
-      fprintf(fout, "REAL ");
+      diffPrintf("REAL ");
   if (p->dataType() == 'S')
-      fprintf(fout, "STR ");
+      diffPrintf("STR ");
   if (p->dataType() == 'Q')
-      fprintf(fout, "STR ");
+      diffPrintf("STR ");
   if (p->hasRange()) {
-      fprintf(fout, "RANGE %g %g ", checkDouble(p->left()),
+      diffPrintf("RANGE %g %g ", checkDouble(p->left()),
                     checkDouble(p->right()));
   }
   if (p->hasNumber())
-      fprintf(fout, "%g ", checkDouble(p->number()));
+      diffPrintf("%g ", checkDouble(p->number()));
   if (p->hasString())
-      fprintf(fout, "\"%s\" ", p->string());
-  fprintf(fout, "\n");
+      diffPrintf("\"%s\" ", p->string());
+  diffPrintf("\n");
 
   return 0;
 }
@@ -1193,7 +1415,7 @@ int prop(defrCallbackType_e c, defiProp* p, defiUserData ud) {
 int hist(defrCallbackType_e c, const char* h, defiUserData ud) {
   checkType(c);
   if (ud != userData) dataError();
-  fprintf(fout, "HIST %s\n", h);
+  diffPrintf("HIST %s\n", h);
   return 0;
 }
 
@@ -1202,7 +1424,7 @@ int hist(defrCallbackType_e c, const char* h, defiUserData ud) {
 int bbn(defrCallbackType_e c, const char* h, defiUserData ud) {
   checkType(c);
   if (ud != userData) dataError();
-  fprintf(fout, "BUSBITCHARS \"%s\" \n", h);
+  diffPrintf("BUSBITCHARS \"%s\" \n", h);
   return 0;
 }
 
@@ -1211,7 +1433,7 @@ int bbn(defrCallbackType_e c, const char* h, defiUserData ud) {
 int vers(defrCallbackType_e c, double d, defiUserData ud) {
   checkType(c);
   if (ud != userData) dataError();
-  fprintf(fout, "VERSION %g\n", d);
+  diffPrintf("VERSION %g\n", d);
 
   curVer = d;
   return 0;
@@ -1222,7 +1444,7 @@ int vers(defrCallbackType_e c, double d, defiUserData ud) {
 int units(defrCallbackType_e c, double d, defiUserData ud) {
   checkType(c);
   if (ud != userData) dataError();
-  fprintf(fout, "UNITS DISTANCE MICRONS %g\n", checkDouble(d));
+  diffPrintf("UNITS DISTANCE MICRONS %g\n", checkDouble(d));
   return 0;
 }
 
@@ -1232,9 +1454,9 @@ int casesens(defrCallbackType_e c, int d, defiUserData ud) {
   checkType(c);
   if (ud != userData) dataError();
   if (d == 1)
-     fprintf(fout, "NAMESCASESENSITIVE OFF\n", d);
+     diffPrintf("NAMESCASESENSITIVE OFF\n", d);
   else
-     fprintf(fout, "NAMESCASESENSITIVE ON\n", d);
+     diffPrintf("NAMESCASESENSITIVE ON\n", d);
   return 0;
 }
 
@@ -1286,42 +1508,42 @@ int cls(defrCallbackType_e c, void* cl, defiUserData ud) {
 
   case defrSiteCbkType :
          site = (defiSite*)cl;
-         fprintf(fout, "SITE %s %g %g %s ", site->name(),
+         diffPrintf("SITE %s %g %g %s ", site->name(),
                  checkDouble(site->x_orig()), checkDouble(site->y_orig()),
                  site->orientStr());
-         fprintf(fout, "DO %g BY %g STEP %g %g\n",
+         diffPrintf("DO %g BY %g STEP %g %g\n",
                  checkDouble(site->x_num()), checkDouble(site->y_num()),
                  checkDouble(site->x_step()), checkDouble(site->y_step()));
          break;
   case defrCanplaceCbkType :
          site = (defiSite*)cl;
-         fprintf(fout, "CANPLACE %s %g %g %s ", site->name(),
+         diffPrintf("CANPLACE %s %g %g %s ", site->name(),
                  checkDouble(site->x_orig()), checkDouble(site->y_orig()),
                  site->orientStr());
-         fprintf(fout, "DO %g BY %g STEP %g %g\n",
+         diffPrintf("DO %g BY %g STEP %g %g\n",
                  checkDouble(site->x_num()), checkDouble(site->y_num()),
                  checkDouble(site->x_step()), checkDouble(site->y_step()));
          break;
   case defrCannotOccupyCbkType : 
          site = (defiSite*)cl;
-         fprintf(fout, "CANNOTOCCUPY %s %g %g %s ",
+         diffPrintf("CANNOTOCCUPY %s %g %g %s ",
                  site->name(), checkDouble(site->x_orig()),
                  checkDouble(site->y_orig()), site->orientStr());
-         fprintf(fout, "DO %g BY %g STEP %g %g\n",
+         diffPrintf("DO %g BY %g STEP %g %g\n",
                  checkDouble(site->x_num()), checkDouble(site->y_num()),
                  checkDouble(site->x_step()), checkDouble(site->y_step()));
          break;
   case defrDieAreaCbkType :
          box = (defiBox*)cl;
-         fprintf(fout, "DIEAREA");
+         diffPrintf("DIEAREA");
          points = box->getPoint();
          for (i = 0; i < points.numPoints; i++)
-           fprintf(fout, " %d %d", points.x[i], points.y[i]);
-         fprintf(fout, "\n");
+           diffPrintf(" %d %d", points.x[i], points.y[i]);
+         diffPrintf("\n");
          break;
   case defrPinCapCbkType :
          pc = (defiPinCap*)cl;
-         fprintf(fout, "DEFCAP MINPINS %d WIRECAP %g\n", pc->pin(),
+         diffPrintf("DEFCAP MINPINS %d WIRECAP %g\n", pc->pin(),
                  checkDouble(pc->cap()));
          --numObjs;
          break;
@@ -1353,51 +1575,51 @@ int cls(defrCallbackType_e c, void* cl, defiUserData ud) {
             }
          } else
             tmpPinName = pName;
-         fprintf(fout, "PIN %s + NET %s ", tmpPinName,
+         diffPrintf("PIN %s + NET %s ", tmpPinName,
                  pin->netName());
          if (pin->hasDirection())
-             fprintf(fout, "+ DIRECTION %s ", pin->direction());
+             diffPrintf("+ DIRECTION %s ", pin->direction());
          if (pin->hasUse())
-             fprintf(fout, "+ USE %s ", pin->use());
+             diffPrintf("+ USE %s ", pin->use());
          if (pin->hasNetExpr())
-             fprintf(fout, "+ NETEXPR %s", pin->netExpr());
+             diffPrintf("+ NETEXPR %s", pin->netExpr());
          if (pin->hasSupplySensitivity())
-             fprintf(fout, "+ SUPPLYSENSITIVITY %s ", pin->supplySensitivity());
+             diffPrintf("+ SUPPLYSENSITIVITY %s ", pin->supplySensitivity());
          if (pin->hasGroundSensitivity())
-             fprintf(fout, "+ GROUNDSENSITIVITY %s ", pin->groundSensitivity());
+             diffPrintf("+ GROUNDSENSITIVITY %s ", pin->groundSensitivity());
          if (pin->hasLayer()) {
              for (i = 0; i < pin->numLayer(); i++) {
-                 fprintf(fout, "+ LAYER %s ", pin->layer(i));
+                 diffPrintf("+ LAYER %s ", pin->layer(i));
 		 if (pin->layerMask(i)) 
-                    fprintf(fout, "MASK %d ",
+                    diffPrintf("MASK %d ",
 			    pin->layerMask(i));
                  if (pin->hasLayerSpacing(i))
-                   fprintf(fout, "SPACING %d ",
+                   diffPrintf("SPACING %d ",
                            pin->layerSpacing(i));
                  if (pin->hasLayerDesignRuleWidth(i))
-                   fprintf(fout, "DESIGNRULEWIDTH %d ",
+                   diffPrintf("DESIGNRULEWIDTH %d ",
                            pin->layerDesignRuleWidth(i));
                  pin->bounds(i, &xl, &yl, &xh, &yh);
-                 fprintf(fout, "( %d %d ) ( %d %d ) ", xl, yl, xh, yh);
+                 diffPrintf("( %d %d ) ( %d %d ) ", xl, yl, xh, yh);
              }
              for (i = 0; i < pin->numPolygons(); i++) {
-                 fprintf(fout, "+ POLYGON %s", pin->polygonName(i));
+                 diffPrintf("+ POLYGON %s", pin->polygonName(i));
 		 if (pin->polygonMask(i))
-                  fprintf(fout, "MASK %d ",
+                  diffPrintf("MASK %d ",
                           pin->polygonMask(i));
                  if (pin->hasPolygonSpacing(i))
-                   fprintf(fout, "SPACING %d ",
+                   diffPrintf("SPACING %d ",
                            pin->polygonSpacing(i));
                  if (pin->hasPolygonDesignRuleWidth(i))
-                   fprintf(fout, "DESIGNRULEWIDTH %d ",
+                   diffPrintf("DESIGNRULEWIDTH %d ",
                            pin->polygonDesignRuleWidth(i));
                  points = pin->getPolygon(i);
                  for (k = 0; k < points.numPoints; k++)
-                    fprintf(fout, " %d %d", points.x[k], points.y[k]);
+                    diffPrintf(" %d %d", points.x[k], points.y[k]);
              }
              for (i = 0; i < pin->numVias(); i++) {
 		 if (pin->viaTopMask(i) || pin->viaCutMask(i) || pin->viaBottomMask(i)) {
-                     fprintf(fout, "\nVIA %s MASK %d%d%d %d %d ", 
+                     diffPrintf("\nVIA %s MASK %d%d%d %d %d ", 
                          pin->viaName(i),
                          pin->viaTopMask(i),
                          pin->viaCutMask(i),
@@ -1405,63 +1627,63 @@ int cls(defrCallbackType_e c, void* cl, defiUserData ud) {
                          pin->viaPtX(i), 
                          pin->viaPtY(i));
                  } else {
-		    fprintf(fout, "\nVIA %s %d %d ", pin->viaName(i),
+		    diffPrintf("\nVIA %s %d %d ", pin->viaName(i),
                          pin->viaPtX(i), pin->viaPtY(i));
 		 }
              }
          }
          if (pin->hasPlacement()) {
              if (pin->isPlaced())
-                 fprintf(fout, " PLACED ");
+                 diffPrintf(" PLACED ");
              if (pin->isCover())
-                 fprintf(fout, " COVER ");
+                 diffPrintf(" COVER ");
              if (pin->isFixed())
-                 fprintf(fout, " FIXED ");
-             fprintf(fout, "( %d %d ) %s ", pin->placementX(),
+                 diffPrintf(" FIXED ");
+             diffPrintf("( %d %d ) %s ", pin->placementX(),
                      pin->placementY(), pin->orientStr());
          }
          if (pin->hasSpecial())
-             fprintf(fout, " SPECIAL ");
-         fprintf(fout, "\n");
+             diffPrintf(" SPECIAL ");
+         diffPrintf("\n");
 
          if (pin->hasPort()) {
              struct defiPoints points;
              defiPinPort* port;
              for (j = 0; j < pin->numPorts(); j++) {
-                fprintf(fout, "PIN %s", tmpPinName);
+                diffPrintf("PIN %s", tmpPinName);
                 port = pin->pinPort(j);
-                fprintf(fout, " + PORT");
+                diffPrintf(" + PORT");
                 for (i = 0; i < port->numLayer(); i++) {
-                   fprintf(fout, "+ LAYER %s", port->layer(i));
+                   diffPrintf("+ LAYER %s", port->layer(i));
 		   if (port->layerMask(i))
-                       fprintf(fout, "MASK %d ",
+                       diffPrintf("MASK %d ",
                                port->layerMask(i));
                    if (port->hasLayerSpacing(i))
-                     fprintf(fout, " SPACING %d", port->layerSpacing(i));
+                     diffPrintf(" SPACING %d", port->layerSpacing(i));
                    if (port->hasLayerDesignRuleWidth(i))
-                     fprintf(fout, " DESIGNRULEWIDTH %d",
+                     diffPrintf(" DESIGNRULEWIDTH %d",
                             port->layerDesignRuleWidth(i));
                    port->bounds(i, &xl, &yl, &xh, &yh);
-                   fprintf(fout, " %d %d %d %d", xl, yl, xh, yh);
+                   diffPrintf(" %d %d %d %d", xl, yl, xh, yh);
                 }
                 for (i = 0; i < port->numPolygons(); i++) {
-                   fprintf(fout, " + POLYGON %s", port->polygonName(i));
+                   diffPrintf(" + POLYGON %s", port->polygonName(i));
 		   if (port->polygonMask(i))
-                     fprintf(fout, "MASK %d ",
+                     diffPrintf("MASK %d ",
                              port->polygonMask(i));
                    if (port->hasPolygonSpacing(i))
-                     fprintf(fout, " SPACING %d", port->polygonSpacing(i));
+                     diffPrintf(" SPACING %d", port->polygonSpacing(i));
                    if (port->hasPolygonDesignRuleWidth(i))
-                     fprintf(fout, " DESIGNRULEWIDTH %d",
+                     diffPrintf(" DESIGNRULEWIDTH %d",
                             port->polygonDesignRuleWidth(i));
                    points = port->getPolygon(i);
                    for (k = 0; k < points.numPoints; k++)
-                     fprintf(fout, " %d %d", points.x[k], points.y[k]);
+                     diffPrintf(" %d %d", points.x[k], points.y[k]);
                 }
                 for (i = 0; i < port->numVias(); i++) {
 		   if (port->viaTopMask(i) || port->viaCutMask(i) 
                         || port->viaBottomMask(i)) {
-                        fprintf(fout, "\n    VIA %s MASK %d%d%d ( %d %d ) ",
+                        diffPrintf("\n    VIA %s MASK %d%d%d ( %d %d ) ",
                             port->viaName(i),
                             port->viaTopMask(i),
                             port->viaCutMask(i),
@@ -1469,124 +1691,124 @@ int cls(defrCallbackType_e c, void* cl, defiUserData ud) {
                             port->viaPtX(i),
                             port->viaPtY(i));
                     } else {
-			fprintf(fout, " VIA %s %g %g", port->viaName(i),
+			diffPrintf(" VIA %s %d %d", port->viaName(i),
                            port->viaPtX(i), port->viaPtY(i));
 		    }
                 }
                 if (port->hasPlacement()) {
                    if (port->isPlaced()) {
-                      fprintf(fout, " + PLACED");
-                      fprintf(fout, " %d %d %d ", port->placementX(),
+                      diffPrintf(" + PLACED");
+                      diffPrintf(" %d %d %d ", port->placementX(),
                          port->placementY(), port->orient());
                    }
                    if (port->isCover()) {
-                      fprintf(fout, " + COVER");
-                      fprintf(fout, " %d %d %d ", port->placementX(),
+                      diffPrintf(" + COVER");
+                      diffPrintf(" %d %d %d ", port->placementX(),
                          port->placementY(), port->orient());
                    }
                    if (port->isFixed()) {
-                      fprintf(fout, " + FIXED");
-                      fprintf(fout, " %d %d %d", port->placementX(),
+                      diffPrintf(" + FIXED");
+                      diffPrintf(" %d %d %d", port->placementX(),
                          port->placementY(), port->orient());
                    }
                 }
-                fprintf(fout,"\n");
+                diffPrintf("\n");
             }
          }
          if (pin->hasAPinPartialMetalArea()) {
-             fprintf(fout, "PIN %s + NET %s ", tmpPinName,
+             diffPrintf("PIN %s + NET %s ", tmpPinName,
                      pin->netName());
              for (i = 0; i < pin->numAPinPartialMetalArea(); i++) {
-                 fprintf(fout, " ANTPINPARTIALMETALAREA %d ",
+                 diffPrintf(" ANTPINPARTIALMETALAREA %d ",
                          pin->APinPartialMetalArea(i));
                  if (*(pin->APinPartialMetalAreaLayer(i)))
-                    fprintf(fout, " %s ", pin->APinPartialMetalAreaLayer(i));
+                    diffPrintf(" %s ", pin->APinPartialMetalAreaLayer(i));
              }
-             fprintf(fout, "\n");
+             diffPrintf("\n");
          }
          if (pin->hasAPinPartialMetalSideArea()) {
-             fprintf(fout, "PIN %s + NET %s ", tmpPinName,
+             diffPrintf("PIN %s + NET %s ", tmpPinName,
                      pin->netName());
              for (i = 0; i < pin->numAPinPartialMetalSideArea(); i++) {
-                fprintf(fout, "ANTPINPARTIALMETALSIDEAREA %d",
+                diffPrintf("ANTPINPARTIALMETALSIDEAREA %d",
                         pin->APinPartialMetalSideArea(i));
                 if (*(pin->APinPartialMetalSideAreaLayer(i)))
-                    fprintf(fout, " %s", pin->APinPartialMetalSideAreaLayer(i));
+                    diffPrintf(" %s", pin->APinPartialMetalSideAreaLayer(i));
              }
-             fprintf(fout, "\n");
+             diffPrintf("\n");
          }
          if (pin->hasAPinPartialCutArea()) {
-             fprintf(fout, "PIN %s + NET %s ", tmpPinName,
+             diffPrintf("PIN %s + NET %s ", tmpPinName,
                      pin->netName());
              for (i = 0; i < pin->numAPinPartialCutArea(); i++) {
-                fprintf(fout, "ANTPINPARTIALCUTAREA %d",
+                diffPrintf("ANTPINPARTIALCUTAREA %d",
                         pin->APinPartialCutArea(i));
                 if (*(pin->APinPartialCutAreaLayer(i)))
-                    fprintf(fout, " %s", pin->APinPartialCutAreaLayer(i));
+                    diffPrintf(" %s", pin->APinPartialCutAreaLayer(i));
              }
-             fprintf(fout, "\n");
+             diffPrintf("\n");
          }
          if (pin->hasAPinDiffArea()) {
-             fprintf(fout, "PIN %s + NET %s ", tmpPinName,
+             diffPrintf("PIN %s + NET %s ", tmpPinName,
                      pin->netName());
              for (i = 0; i < pin->numAPinDiffArea(); i++) {
-                fprintf(fout, "ANTPINDIFFAREA %d", pin->APinDiffArea(i));
+                diffPrintf("ANTPINDIFFAREA %d", pin->APinDiffArea(i));
                 if (*(pin->APinDiffAreaLayer(i)))
-                    fprintf(fout, " %s", pin->APinDiffAreaLayer(i));
+                    diffPrintf(" %s", pin->APinDiffAreaLayer(i));
              }
-             fprintf(fout, "\n");
+             diffPrintf("\n");
          }
 
          for (j = 0; j < pin->numAntennaModel(); j++) {
              aModel = pin->antennaModel(j);
 
              if (aModel->hasAPinGateArea()) {
-                fprintf(fout, "PIN %s + NET %s %s ", tmpPinName,
+                diffPrintf("PIN %s + NET %s %s ", tmpPinName,
                         pin->netName(), aModel->antennaOxide());
                 for (i = 0; i < aModel->numAPinGateArea();
                      i++) {
-                   fprintf(fout, "ANTPINGATEAREA %d", aModel->APinGateArea(i));
+                   diffPrintf("ANTPINGATEAREA %d", aModel->APinGateArea(i));
                    if (*(aModel->APinGateAreaLayer(i)))
-                       fprintf(fout, " %s", aModel->APinGateAreaLayer(i));
+                       diffPrintf(" %s", aModel->APinGateAreaLayer(i));
                 }
-                fprintf(fout, "\n");
+                diffPrintf("\n");
              }
              if (aModel->hasAPinMaxAreaCar()) {
-                fprintf(fout, "PIN %s + NET %s %s ", tmpPinName,
+                diffPrintf("PIN %s + NET %s %s ", tmpPinName,
                         pin->netName(), aModel->antennaOxide());
                 for (i = 0; i <
                      aModel->numAPinMaxAreaCar(); i++) {
-                   fprintf(fout, "ANTPINMAXAREACAR %d",
+                   diffPrintf("ANTPINMAXAREACAR %d",
                            aModel->APinMaxAreaCar(i));
                    if (*(aModel->APinMaxAreaCarLayer(i)))
-                       fprintf(fout, " %s", aModel->APinMaxAreaCarLayer(i));
+                       diffPrintf(" %s", aModel->APinMaxAreaCarLayer(i));
                 }
-                fprintf(fout, "\n");
+                diffPrintf("\n");
              }
              if (aModel->hasAPinMaxSideAreaCar()) {
-                fprintf(fout, "PIN %s + NET %s %s ", tmpPinName,
+                diffPrintf("PIN %s + NET %s %s ", tmpPinName,
                         pin->netName(), aModel->antennaOxide());
                 for (i = 0;
                      i < aModel->numAPinMaxSideAreaCar();
                      i++) {
-                   fprintf(fout, "ANTPINMAXSIDEAREACAR %d",
+                   diffPrintf("ANTPINMAXSIDEAREACAR %d",
                            aModel->APinMaxSideAreaCar(i));
                    if (*(aModel->APinMaxSideAreaCarLayer(i)))
-                       fprintf(fout, " %s", aModel->APinMaxSideAreaCarLayer(i));
+                       diffPrintf(" %s", aModel->APinMaxSideAreaCarLayer(i));
                 }
-                fprintf(fout, "\n");
+                diffPrintf("\n");
              }
              if (aModel->hasAPinMaxCutCar()) {
-                fprintf(fout, "PIN %s + NET %s %s ", tmpPinName,
+                diffPrintf("PIN %s + NET %s %s ", tmpPinName,
                         pin->netName(), aModel->antennaOxide());
                 for (i = 0; i < aModel->numAPinMaxCutCar();
                      i++) {
-                   fprintf(fout, "ANTPINMAXCUTCAR %d",
+                   diffPrintf("ANTPINMAXCUTCAR %d",
                            aModel->APinMaxCutCar(i));
                    if (*(aModel->APinMaxCutCarLayer(i)))
-                       fprintf(fout, " %s", aModel->APinMaxCutCarLayer(i));
+                       diffPrintf(" %s", aModel->APinMaxCutCarLayer(i));
                 }
-                fprintf(fout, "\n");
+                diffPrintf("\n");
              }
          }
          if (tmpPinName)
@@ -1595,35 +1817,35 @@ int cls(defrCallbackType_e c, void* cl, defiUserData ud) {
          break;
   case defrDefaultCapCbkType :
          i = (long)cl;
-         fprintf(fout, "DEFAULTCAP %d\n", i);
+         diffPrintf("DEFAULTCAP %d\n", i);
          numObjs = i;
          break;
   case defrRowCbkType :
          row = (defiRow*)cl;
          if (ignoreRN)  // PCR 716759, if flag is set don't bother with name
-            fprintf(fout, "ROW %s %g %g %d",
+            diffPrintf("ROW %s %g %g %d",
                     row->macro(), checkDouble(row->x()), checkDouble(row->y()),
                     row->orient());
          else
-            fprintf(fout, "ROW %s %s %g %g %d", row->name(),
+            diffPrintf("ROW %s %s %g %g %d", row->name(),
                     row->macro(), checkDouble(row->x()), checkDouble(row->y()),
                     row->orient());
          if (row->hasDo()) {
-            fprintf(fout, " DO %g BY %g",
+            diffPrintf(" DO %g BY %g",
                     checkDouble(row->xNum()), checkDouble(row->yNum()));
             if (row->hasDoStep()) 
-               fprintf(fout, " STEP %g %g\n",
+               diffPrintf(" STEP %g %g\n",
                        checkDouble(row->xStep()), checkDouble(row->yStep()));
          }
-         fprintf(fout, "\n");
+         diffPrintf("\n");
          if (row->numProps() > 0) {
             if (ignoreRN) {
                 for (i = 0; i < row->numProps(); i++)
-                    fprintf(fout, "ROW PROP %s %s\n",
+                    diffPrintf("ROW PROP %s %s\n",
                             row->propName(i), row->propValue(i));
             } else {
                 for (i = 0; i < row->numProps(); i++)
-                    fprintf(fout, "ROW %s PROP %s %s\n", row->name(),
+                    diffPrintf("ROW %s PROP %s %s\n", row->name(),
                             row->propName(i), row->propValue(i));
             }
          }
@@ -1632,37 +1854,37 @@ int cls(defrCallbackType_e c, void* cl, defiUserData ud) {
          track = (defiTrack*)cl;
 	 /*if (track->firstTrackMask()) {
 	    if (track->sameMask()) {
-		fprintf(fout, "TRACKS %s %g DO %g STEP %g MASK %d SAMEMASK LAYER ",
+		diffPrintf("TRACKS %s %g DO %g STEP %g MASK %d SAMEMASK LAYER ",
                  track->macro(), track->x(),
                  track->xNum(), track->xStep(),
 	         track->firstTrackMask());
 	    } else {
-		fprintf(fout, "TRACKS %s %g DO %g STEP %g MASK %d LAYER ",
+		diffPrintf("TRACKS %s %g DO %g STEP %g MASK %d LAYER ",
                  track->macro(), track->x(),
                  track->xNum(), track->xStep(),
 	         track->firstTrackMask());
 	    }
 	 } else {
-	    fprintf(fout, "TRACKS %s %g DO %g STEP %g LAYER ",
+	    diffPrintf("TRACKS %s %g DO %g STEP %g LAYER ",
                  track->macro(), track->x(),
                  track->xNum(), track->xStep());
 	 } */
          for (i = 0; i < track->numLayers(); i++) {
 	    if (track->firstTrackMask()) {
 		if (track->sameMask()) {
-		    fprintf(fout, "TRACKS %s %g DO %g STEP %g MASK %d SAMEMASK LAYER %s\n",
+		    diffPrintf("TRACKS %s %g DO %g STEP %g MASK %d SAMEMASK LAYER %s\n",
 			    track->macro(), track->x(),
 			    track->xNum(), track->xStep(),
 			    track->firstTrackMask(), track->layer(i));
 		} else {
-		    fprintf(fout, "TRACKS %s %g DO %g STEP %g MASK %d LAYER %s\n",
+		    diffPrintf("TRACKS %s %g DO %g STEP %g MASK %d LAYER %s\n",
 			    track->macro(), track->x(),
 			    track->xNum(), track->xStep(),
 			    track->firstTrackMask(),
 			    track->layer(i));
 		} 
 	    } else {
-		    fprintf(fout, "TRACKS %s %g DO %g STEP %g LAYER %s\n",
+		    diffPrintf("TRACKS %s %g DO %g STEP %g LAYER %s\n",
 			    track->macro(), track->x(),
 			    track->xNum(), track->xStep(),
 			    track->layer(i));
@@ -1671,27 +1893,29 @@ int cls(defrCallbackType_e c, void* cl, defiUserData ud) {
          break;
   case defrGcellGridCbkType :
          gcg = (defiGcellGrid*)cl;
-         fprintf(fout, "GCELLGRID %s %d DO %d STEP %g\n",
+         diffPrintf("GCELLGRID %s %d DO %d STEP %g\n",
                  gcg->macro(), gcg->x(),
                  gcg->xNum(),
                  checkDouble(gcg->xStep()));
          break;
   case defrViaCbkType :
          via = (defiVia*)cl;
-         fprintf(fout, "VIA %s ", via->name());
+         if (diffObjs && netSeCmp)
+             diffViaLayers(via);
+         diffPrintf("VIA %s ", via->name());
          if (via->hasPattern())
-             fprintf(fout, " PATTERNNAME %s\n", via->pattern());
+             diffPrintf(" PATTERNNAME %s\n", via->pattern());
          else
-             fprintf(fout, "\n");
+             diffPrintf("\n");
          for (i = 0; i < via->numLayers(); i++) {
              via->layer(i, &name, &xl, &yl, &xh, &yh);
 	     int rectMask = via->rectMask(i);
 
 	     if (rectMask) {
-		fprintf(fout, "VIA %s RECT %s  MASK %d ( %d %d ) ( %d %d ) \n",
+		diffPrintf("VIA %s RECT %s  MASK %d ( %d %d ) ( %d %d ) \n",
                         via->name(), name, rectMask, xl, yl, xh, yh);
 	     } else {
-		fprintf(fout, "VIA %s RECT %s ( %d %d ) ( %d %d ) \n", via->name(),
+		diffPrintf("VIA %s RECT %s ( %d %d ) ( %d %d ) \n", via->name(),
                      name, xl, yl, xh, yh);
 	     }
          }
@@ -1702,16 +1926,16 @@ int cls(defrCallbackType_e c, void* cl, defiUserData ud) {
 	     int polyMask = via->polyMask(i);
 
 	     if (polyMask) {
-		fprintf(fout, "\n  POLYGON %s MASK %d ", 
+		diffPrintf("\n  POLYGON %s MASK %d ", 
 			via->polygonName(i), polyMask);
 	     } else {
-                fprintf(fout, "\n  POLYGON %s ", via->polygonName(i));
+                diffPrintf("\n  POLYGON %s ", via->polygonName(i));
 	     }
              points = via->getPolygon(i);
              for (j = 0; j < points.numPoints; j++)
-               fprintf(fout, "%d %d ", points.x[j], points.y[j]);
+               diffPrintf("%d %d ", points.x[j], points.y[j]);
            }
-           fprintf(fout, " \n");
+           diffPrintf(" \n");
          }
 
          if (via->hasViaRule()) {
@@ -1720,103 +1944,103 @@ int cls(defrCallbackType_e c, void* cl, defiUserData ud) {
              int cr, cc, xo, yo, xbo, ybo, xto, yto;
              (void)via->viaRule(&vrn, &xs, &ys, &bl, &cl, &tl, &xcs,
                                          &ycs, &xbe, &ybe, &xte, &yte);
-             fprintf(fout, "VIA %s VIARULE %s CUTSIZE %d %d LAYERS %s %s %s",
+             diffPrintf("VIA %s VIARULE %s CUTSIZE %d %d LAYERS %s %s %s",
                      via->name(), vrn, xs, ys, bl, cl, tl);
-             fprintf(fout, " CUTSPACING %d %d ENCLOSURE %d %d %d %d", xcs, ycs,
+             diffPrintf(" CUTSPACING %d %d ENCLOSURE %d %d %d %d", xcs, ycs,
                      xbe, ybe, xte, yte);
              if (via->hasRowCol()) {
                 (void)via->rowCol(&cr, &cc);
-                fprintf(fout, " ROWCOL %d %d", cr, cc);
+                diffPrintf(" ROWCOL %d %d", cr, cc);
              }
              if (via->hasOrigin()) {
                 (void)via->origin(&xo, &yo);
-                fprintf(fout, " ORIGIN %d %d", xo, yo);
+                diffPrintf(" ORIGIN %d %d", xo, yo);
              }
              if (via->hasOffset()) {
                 (void)via->offset(&xbo, &ybo, &xto, &yto);
-                fprintf(fout, " OFFSET %d %d %d %d", xbo, ybo, xto, yto);
+                diffPrintf(" OFFSET %d %d %d %d", xbo, ybo, xto, yto);
              }
              if (via->hasCutPattern())
-                fprintf(fout, " PATTERN %s", via->cutPattern());
-             fprintf(fout, "\n");
+                diffPrintf(" PATTERN %s", via->cutPattern());
+             diffPrintf("\n");
          }
          --numObjs;
          break;
   case defrRegionCbkType :
          re = (defiRegion*)cl;
          for (i = 0; i < re->numRectangles(); i++)
-             fprintf(fout, "REGION %s ( %d %d ) ( %d %d )\n",re->name(),
+             diffPrintf("REGION %s ( %d %d ) ( %d %d )\n",re->name(),
                      re->xl(i), re->yl(i), re->xh(i), re->yh(i));
          if (re->hasType())
-             fprintf(fout, "REGION %s TYPE %s\n",re->name(), re->type());
+             diffPrintf("REGION %s TYPE %s\n",re->name(), re->type());
          --numObjs;
          break;
   case defrGroupCbkType :
          group = (defiGroup*)cl;
-         fprintf(fout, "GROUP %s ", group->name());
+         diffPrintf("GROUP %s ", group->name());
          if (group->hasMaxX() | group->hasMaxY()
              | group->hasPerim()) {
-             fprintf(fout, "SOFT ");
+             diffPrintf("SOFT ");
              if (group->hasPerim()) 
-                 fprintf(fout, "MAXHALFPERIMETER %d ",
+                 diffPrintf("MAXHALFPERIMETER %d ",
                          group->perim());
              if (group->hasMaxX())
-                 fprintf(fout, "MAXX %d ", group->maxX());
+                 diffPrintf("MAXX %d ", group->maxX());
              if (group->hasMaxY()) 
-                 fprintf(fout, "MAXY %d ", group->maxY());
+                 diffPrintf("MAXY %d ", group->maxY());
          } 
          if (group->hasRegionName())
-             fprintf(fout, "REGION %s ", group->regionName());
+             diffPrintf("REGION %s ", group->regionName());
          if (group->hasRegionBox()) {
              int *gxl, *gyl, *gxh, *gyh;
              int size;
              group->regionRects(&size, &gxl, &gyl, &gxh, &gyh);
              for (i = 0; i < size; i++)
-                 fprintf(fout, "REGION (%d %d) (%d %d) ", gxl[i], gyl[i],
+                 diffPrintf("REGION (%d %d) (%d %d) ", gxl[i], gyl[i],
                          gxh[i], gyh[i]);
          }
-         fprintf(fout, "\n");
+         diffPrintf("\n");
          --numObjs;
          break;
   case defrComponentMaskShiftLayerCbkType :
-	 fprintf(fout, "COMPONENTMASKSHIFT ");
+	 diffPrintf("COMPONENTMASKSHIFT ");
         
         for (i = 0; i < maskShiftLayer->numMaskShiftLayers(); i++) {
-           fprintf(fout, "%s ", maskShiftLayer->maskShiftLayer(i));
+           diffPrintf("%s ", maskShiftLayer->maskShiftLayer(i));
         } 
-        fprintf(fout, ";\n");
+        diffPrintf(";\n");
 	 break;
   case defrScanchainCbkType :
          sc = (defiScanchain*)cl;
-         fprintf(fout, "SCANCHAINS %s", sc->name());
+         diffPrintf("SCANCHAINS %s", sc->name());
          if (sc->hasStart()) {
              sc->start(&a1, &b1);
-             fprintf(fout, " START %s %s", sc->name(), a1, b1);
+             diffPrintf(" START %s %s", sc->name(), a1, b1);
          }
          if (sc->hasStop()) {
              sc->stop(&a1, &b1);
-             fprintf(fout, " STOP %s %s", sc->name(), a1, b1);
+             diffPrintf(" STOP %s %s", sc->name(), a1, b1);
          }
          if (sc->hasCommonInPin() ||
              sc->hasCommonOutPin()) {
-             fprintf(fout, " COMMONSCANPINS ", sc->name());
+             diffPrintf(" COMMONSCANPINS ", sc->name());
              if (sc->hasCommonInPin())
-                fprintf(fout, " ( IN %s )", sc->commonInPin());
+                diffPrintf(" ( IN %s )", sc->commonInPin());
              if (sc->hasCommonOutPin())
-                fprintf(fout, " ( OUT %s )",sc->commonOutPin());
+                diffPrintf(" ( OUT %s )",sc->commonOutPin());
          }
-         fprintf(fout, "\n");
+         diffPrintf("\n");
          if (sc->hasFloating()) {
             sc->floating(&size, &inst, &inPin, &outPin, &bits);
             for (i = 0; i < size; i++) {
-                fprintf(fout, "SCANCHAINS %s FLOATING %s", sc->name(), inst[i]);
+                diffPrintf("SCANCHAINS %s FLOATING %s", sc->name(), inst[i]);
                 if (inPin[i])
-                   fprintf(fout, " IN %s", inPin[i]);
+                   diffPrintf(" IN %s", inPin[i]);
                 if (outPin[i])
-                   fprintf(fout, " OUT %s", outPin[i]);
+                   diffPrintf(" OUT %s", outPin[i]);
                 if (bits[i] != -1)
-                   fprintf(fout, " BITS %d", bits[i]);
-                fprintf(fout, "\n");
+                   diffPrintf(" BITS %d", bits[i]);
+                diffPrintf("\n");
             }
          }
 
@@ -1824,172 +2048,172 @@ int cls(defrCallbackType_e c, void* cl, defiUserData ud) {
             for (i = 0; i < sc->numOrderedLists(); i++) {
                 sc->ordered(i, &size, &inst, &inPin, &outPin, &bits);
                 for (j = 0; j < size; j++) {
-                    fprintf(fout, "SCANCHAINS %s ORDERED %s", sc->name(),
+                    diffPrintf("SCANCHAINS %s ORDERED %s", sc->name(),
                             inst[j]); 
                     if (inPin[j])
-                       fprintf(fout, " IN %s", inPin[j]);
+                       diffPrintf(" IN %s", inPin[j]);
                     if (outPin[j])
-                       fprintf(fout, " OUT %s", outPin[j]);
+                       diffPrintf(" OUT %s", outPin[j]);
                     if (bits[j] != -1)
-                       fprintf(fout, " BITS %d", bits[j]);
-                    fprintf(fout, "\n");
+                       diffPrintf(" BITS %d", bits[j]);
+                    diffPrintf("\n");
                 }
             }
          }
 
          if (sc->hasPartition()) {
-            fprintf(fout, "SCANCHAINS %s PARTITION %s", sc->name(),
+            diffPrintf("SCANCHAINS %s PARTITION %s", sc->name(),
                     sc->partitionName());
             if (sc->hasPartitionMaxBits())
-              fprintf(fout, " MAXBITS %d", sc->partitionMaxBits());
+              diffPrintf(" MAXBITS %d", sc->partitionMaxBits());
          }
-         fprintf(fout, "\n");
+         diffPrintf("\n");
          --numObjs;
          break;
   case defrIOTimingCbkType :
          iot = (defiIOTiming*)cl;
-         fprintf(fout, "IOTIMING ( %s %s )\n", iot->inst(), iot->pin());
+         diffPrintf("IOTIMING ( %s %s )\n", iot->inst(), iot->pin());
          if (iot->hasSlewRise())
-             fprintf(fout, "IOTIMING %s RISE SLEWRATE %g %g\n", iot->inst(),
+             diffPrintf("IOTIMING %s RISE SLEWRATE %g %g\n", iot->inst(),
                      checkDouble(iot->slewRiseMin()),
                      checkDouble(iot->slewRiseMax()));
          if (iot->hasSlewFall())
-             fprintf(fout, "IOTIMING %s FALL SLEWRATE %g %g\n", iot->inst(),
+             diffPrintf("IOTIMING %s FALL SLEWRATE %g %g\n", iot->inst(),
                      checkDouble(iot->slewFallMin()),
                      checkDouble(iot->slewFallMax()));
          if (iot->hasVariableRise())
-             fprintf(fout, "IOTIMING %s RISE VARIABLE %g %g\n", iot->inst(),
+             diffPrintf("IOTIMING %s RISE VARIABLE %g %g\n", iot->inst(),
                      checkDouble(iot->variableRiseMin()),
                      checkDouble(iot->variableRiseMax()));
          if (iot->hasVariableFall())
-             fprintf(fout, "IOTIMING %s FALL VARIABLE %g %g\n", iot->inst(),
+             diffPrintf("IOTIMING %s FALL VARIABLE %g %g\n", iot->inst(),
                      checkDouble(iot->variableFallMin()),
                      checkDouble(iot->variableFallMax()));
          if (iot->hasCapacitance())
-             fprintf(fout, "IOTIMING %s CAPACITANCE %g\n", iot->inst(),
+             diffPrintf("IOTIMING %s CAPACITANCE %g\n", iot->inst(),
                      checkDouble(iot->capacitance()));
          if (iot->hasDriveCell()) {
-             fprintf(fout, "IOTIMING %s DRIVECELL %s ", iot->inst(),
+             diffPrintf("IOTIMING %s DRIVECELL %s ", iot->inst(),
                      iot->driveCell());
              if (iot->hasFrom())
-                 fprintf(fout, " FROMPIN %s ",
+                 diffPrintf(" FROMPIN %s ",
                          iot->from());
              if (iot->hasTo())
-                 fprintf(fout, " TOPIN %s ",
+                 diffPrintf(" TOPIN %s ",
                          iot->to());
              if (iot->hasParallel())
-                 fprintf(fout, "PARALLEL %g", checkDouble(iot->parallel()));
-             fprintf(fout, "\n");
+                 diffPrintf("PARALLEL %g", checkDouble(iot->parallel()));
+             diffPrintf("\n");
          }
          --numObjs;
          break;
   case defrFPCCbkType :
          fpc = (defiFPC*)cl;
-         fprintf(fout, "FLOORPLAN %s ", fpc->name());
+         diffPrintf("FLOORPLAN %s ", fpc->name());
          if (fpc->isVertical())
-             fprintf(fout, "VERTICAL ");
+             diffPrintf("VERTICAL ");
          if (fpc->isHorizontal())
-             fprintf(fout, "HORIZONTAL ");
+             diffPrintf("HORIZONTAL ");
          if (fpc->hasAlign())
-             fprintf(fout, "ALIGN ");
+             diffPrintf("ALIGN ");
          if (fpc->hasMax())
-             fprintf(fout, "%g ", checkDouble(fpc->alignMax()));
+             diffPrintf("%g ", checkDouble(fpc->alignMax()));
          if (fpc->hasMin())
-             fprintf(fout, "%g ", checkDouble(fpc->alignMin()));
+             diffPrintf("%g ", checkDouble(fpc->alignMin()));
          if (fpc->hasEqual())
-             fprintf(fout, "%g ", checkDouble(fpc->equal()));
+             diffPrintf("%g ", checkDouble(fpc->equal()));
          for (i = 0; i < fpc->numParts(); i++) {
              fpc->getPart(i, &corner, &typ, &name);
              if (corner == 'B')
-                 fprintf(fout, "BOTTOMLEFT ");
+                 diffPrintf("BOTTOMLEFT ");
              else
-                 fprintf(fout, "TOPRIGHT ");
+                 diffPrintf("TOPRIGHT ");
              if (typ == 'R')
-                 fprintf(fout, "ROWS %s ", name);
+                 diffPrintf("ROWS %s ", name);
              else
-                 fprintf(fout, "COMPS %s ", name);
+                 diffPrintf("COMPS %s ", name);
          }
-         fprintf(fout, "\n");
+         diffPrintf("\n");
          --numObjs;
          break;
   case defrTimingDisableCbkType :
          td = (defiTimingDisable*)cl;
-         if (td->hasFromTo()) fprintf(fout, "TIMINGDISABLE FROMPIN %s %s ", td->fromInst(), td->fromPin(), td->toInst(), td->toPin()); if (td->hasThru())
-             fprintf(fout, " THRUPIN %s %s ", td->thruInst(), td->thruPin());
+         if (td->hasFromTo()) diffPrintf("TIMINGDISABLE FROMPIN %s %s ", td->fromInst(), td->fromPin(), td->toInst(), td->toPin()); if (td->hasThru())
+             diffPrintf(" THRUPIN %s %s ", td->thruInst(), td->thruPin());
          if (td->hasMacroFromTo())
-             fprintf(fout, " MACRO %s FROMPIN %s %s ", td->macroName(),
+             diffPrintf(" MACRO %s FROMPIN %s %s ", td->macroName(),
                      td->fromPin(), td->toPin());
          if (td->hasMacroThru())
-             fprintf(fout, " MACRO %s THRUPIN %s %s ", td->macroName(),
+             diffPrintf(" MACRO %s THRUPIN %s %s ", td->macroName(),
                      td->fromPin());
-         fprintf(fout, "\n");
+         diffPrintf("\n");
          break;
   case defrPartitionCbkType :
          part = (defiPartition*)cl;
-         fprintf(fout, "PARTITION %s ", part->name());
+         diffPrintf("PARTITION %s ", part->name());
          if (part->isSetupRise() | part->isSetupFall() | part->isHoldRise() |
              part->isHoldFall()) {
              // has turnoff 
-             fprintf(fout, "TURNOFF "); 
+             diffPrintf("TURNOFF "); 
              if (part->isSetupRise())
-                 fprintf(fout, "SETUPRISE "); 
+                 diffPrintf("SETUPRISE "); 
              if (part->isSetupFall())
-                 fprintf(fout, "SETUPFALL "); 
+                 diffPrintf("SETUPFALL "); 
              if (part->isHoldRise())
-                 fprintf(fout, "HOLDRISE "); 
+                 diffPrintf("HOLDRISE "); 
              if (part->isHoldFall())
-                 fprintf(fout, "HOLDFALL "); 
+                 diffPrintf("HOLDFALL "); 
          }
          itemT = part->itemType();
          dir = part->direction();
          if (strcmp(itemT, "CLOCK") == 0) {
              if (dir == 'T')    // toclockpin
-                 fprintf(fout, " TOCLOCKPIN %s %s ", part->instName(),
+                 diffPrintf(" TOCLOCKPIN %s %s ", part->instName(),
                          part->pinName());
              if (dir == 'F')    // fromclockpin
-                 fprintf(fout, " FROMCLOCKPIN %s %s ", part->instName(),
+                 diffPrintf(" FROMCLOCKPIN %s %s ", part->instName(),
                          part->pinName());
              if (part->hasMin())
-                 fprintf(fout, "MIN %g %g ",
+                 diffPrintf("MIN %g %g ",
                          checkDouble(part->partitionMin()),
                          checkDouble(part->partitionMax()));
              if (part->hasMax())
-                 fprintf(fout, "MAX %g %g ",
+                 diffPrintf("MAX %g %g ",
                          checkDouble(part->partitionMin()),
                          checkDouble(part->partitionMax()));
-             fprintf(fout, "PINS ");
+             diffPrintf("PINS ");
              for (i = 0; i < part->numPins(); i++)
-                  fprintf(fout, "%s ", part->pin(i));
+                  diffPrintf("%s ", part->pin(i));
          } else if (strcmp(itemT, "IO") == 0) {
              if (dir == 'T')    // toiopin
-                 fprintf(fout, " TOIOPIN %s %s ", part->instName(),
+                 diffPrintf(" TOIOPIN %s %s ", part->instName(),
                          part->pinName());
              if (dir == 'F')    // fromiopin
-                 fprintf(fout, " FROMIOPIN %s %s ", part->instName(),
+                 diffPrintf(" FROMIOPIN %s %s ", part->instName(),
                          part->pinName());
          } else if (strcmp(itemT, "COMP") == 0) {
              if (dir == 'T')    // tocomppin
-                 fprintf(fout, " TOCOMPPIN %s %s ", part->instName(),
+                 diffPrintf(" TOCOMPPIN %s %s ", part->instName(),
                          part->pinName());
              if (dir == 'F')    // fromcomppin
-                 fprintf(fout, " FROMCOMPPIN %s %s ", part->instName(),
+                 diffPrintf(" FROMCOMPPIN %s %s ", part->instName(),
                          part->pinName());
          }
-         fprintf(fout, "\n");
+         diffPrintf("\n");
          --numObjs;
          break;
 
   case defrPinPropCbkType :
          pprop = (defiPinProp*)cl;
          if (pprop->isPin())
-            fprintf(fout, "PINPROP PIN %s ", pprop->pinName());
+            diffPrintf("PINPROP PIN %s ", pprop->pinName());
          else 
-            fprintf(fout, "PINPROP %s %s ", pprop->instName(),
+            diffPrintf("PINPROP %s %s ", pprop->instName(),
                     pprop->pinName());
-         fprintf(fout, "\n");
+         diffPrintf("\n");
          if (pprop->numProps() > 0) {
             for (i = 0; i < pprop->numProps(); i++) {
-                fprintf(fout, "PINPROP PIN %s PROP %s %s\n",
+                diffPrintf("PINPROP PIN %s PROP %s %s\n",
                         pprop->pinName(), pprop->propName(i),
                         pprop->propValue(i));
             }
@@ -2000,51 +2224,51 @@ int cls(defrCallbackType_e c, void* cl, defiUserData ud) {
   case defrBlockageCbkType :
          block = (defiBlockage*)cl;
          if (block->hasLayer()) {
-            fprintf(fout, "BLOCKAGE LAYER %s", block->layerName());
+            diffPrintf("BLOCKAGE LAYER %s", block->layerName());
             if (block->hasComponent())
-               fprintf(fout, " COMP %s", block->layerComponentName());
+               diffPrintf(" COMP %s", block->layerComponentName());
             if (block->hasSlots())
-               fprintf(fout, " SLOTS");
+               diffPrintf(" SLOTS");
             if (block->hasFills())
-               fprintf(fout, " FILLS");
+               diffPrintf(" FILLS");
             if (block->hasPushdown())
-               fprintf(fout, " PUSHDOWN");
+               diffPrintf(" PUSHDOWN");
             if (block->hasExceptpgnet())
-               fprintf(fout, " EXCEPTPGNET");
+               diffPrintf(" EXCEPTPGNET");
 	    if (block->hasMask())
-	       fprintf(fout, " MASK %d", block->mask());
+	       diffPrintf(" MASK %d", block->mask());
             if (block->hasSpacing())
-               fprintf(fout, " SPACING %d",
+               diffPrintf(" SPACING %d",
                        block->minSpacing());
             if (block->hasDesignRuleWidth())
-               fprintf(fout, " DESIGNRULEWIDTH %d", block->designRuleWidth());
-            fprintf(fout, "\n");
+               diffPrintf(" DESIGNRULEWIDTH %d", block->designRuleWidth());
+            diffPrintf("\n");
             for (i = 0; i < block->numRectangles(); i++) {
-               fprintf(fout, "BLOCKAGE LAYER %s RECT %d %d %d %d\n",
+               diffPrintf("BLOCKAGE LAYER %s RECT %d %d %d %d\n",
                        block->layerName(), block->xl(i), block->yl(i),
                        block->xh(i), block->yh(i));
             }
             for (i = 0; i < block->numPolygons(); i++) {
-               fprintf(fout, "BLOCKAGE LAYER %s POLYGON", block->layerName());
+               diffPrintf("BLOCKAGE LAYER %s POLYGON", block->layerName());
                points = block->getPolygon(i);
                for (j = 0; j < points.numPoints; j++)
-                  fprintf(fout, "%d %d ", points.x[j], points.y[j]);
-               fprintf(fout, "\n");
+                  diffPrintf("%d %d ", points.x[j], points.y[j]);
+               diffPrintf("\n");
             }
          }
          else if (block->hasPlacement()) {
-            fprintf(fout, "BLOCKAGE PLACEMENT");
+            diffPrintf("BLOCKAGE PLACEMENT");
             if (block->hasSoft())
-               fprintf(fout, " SOFT");
+               diffPrintf(" SOFT");
             if (block->hasPartial())
-               fprintf(fout, " PARTIAL %g", block->placementMaxDensity());
+               diffPrintf(" PARTIAL %g", block->placementMaxDensity());
             if (block->hasComponent())
-               fprintf(fout, " COMP %s", block->layerComponentName());
+               diffPrintf(" COMP %s", block->layerComponentName());
             if (block->hasPushdown())
-               fprintf(fout, " PUSHDOWN");
-            fprintf(fout, "\n");
+               diffPrintf(" PUSHDOWN");
+            diffPrintf("\n");
             for (i = 0; i < block->numRectangles(); i++) {
-               fprintf(fout, "BLOCKAGE PLACEMENT RECT %d %d %d %d\n",
+               diffPrintf("BLOCKAGE PLACEMENT RECT %d %d %d %d\n",
                        block->xl(i), block->yl(i),
                        block->xh(i), block->yh(i));
             }
@@ -2055,17 +2279,17 @@ int cls(defrCallbackType_e c, void* cl, defiUserData ud) {
   case defrSlotCbkType :
          slot = (defiSlot*)cl;
          for (i = 0; i < slot->numRectangles(); i++) {
-            fprintf(fout, "SLOT LAYER %s", slot->layerName());
-            fprintf(fout, " RECT %d %d %d %d\n",
+            diffPrintf("SLOT LAYER %s", slot->layerName());
+            diffPrintf(" RECT %d %d %d %d\n",
                     slot->xl(i), slot->yl(i),
                     slot->xh(i), slot->yh(i));
          }
          for (i = 0; i < slot->numPolygons(); i++) {
-            fprintf(fout, "SLOT LAYER %s POLYGON");
+            diffPrintf("SLOT LAYER %s POLYGON", slot->layerName());
             points = slot->getPolygon(i);
             for (j = 0; j < points.numPoints; j++)
-              fprintf(fout, " %d %d", points.x[j], points.y[j]);
-            fprintf(fout, "\n");
+              diffPrintf(" %d %d", points.x[j], points.y[j]);
+            diffPrintf("\n");
          }
          --numObjs;
          break;
@@ -2073,40 +2297,40 @@ int cls(defrCallbackType_e c, void* cl, defiUserData ud) {
   case defrFillCbkType :
          fill = (defiFill*)cl;
          for (i = 0; i < fill->numRectangles(); i++) {
-            fprintf(fout, "FILL LAYER %s", fill->layerName());
+            diffPrintf("FILL LAYER %s", fill->layerName());
 	    if (fill->layerMask()) {
-                fprintf(fout, " MASK %d", fill->layerMask());
+                diffPrintf(" MASK %d", fill->layerMask());
 	    }
             if (fill->hasLayerOpc())
-               fprintf(fout, " OPC");
-            fprintf(fout, " RECT %d %d %d %d\n",
+               diffPrintf(" OPC");
+            diffPrintf(" RECT %d %d %d %d\n",
                     fill->xl(i), fill->yl(i),
                     fill->xh(i), fill->yh(i));
          }
          for (i = 0; i < fill->numPolygons(); i++) {
-            fprintf(fout, "FILL LAYER %s POLYGON", fill->layerName());
+            diffPrintf("FILL LAYER %s POLYGON", fill->layerName());
             points = fill->getPolygon(i);
             for (j = 0; j < points.numPoints; j++)
-              fprintf(fout, " %d %d", points.x[j], points.y[j]);
-            fprintf(fout, "\n");
+              diffPrintf(" %d %d", points.x[j], points.y[j]);
+            diffPrintf("\n");
          }
          if (fill->hasVia()) {
-            fprintf(fout, "FILL VIA %s", fill->viaName());
+            diffPrintf("FILL VIA %s", fill->viaName());
 	    if (fill->viaTopMask() || fill->viaCutMask()
                 || fill->viaBottomMask()) {
-	       fprintf(fout, " MASK %d%d%d", 
+	       diffPrintf(" MASK %d%d%d", 
 		       fill->viaTopMask(),
                        fill->viaCutMask(),
                        fill->viaBottomMask());
 	    }
             if (fill->hasViaOpc())
-               fprintf(fout, " OPC\n");
+               diffPrintf(" OPC\n");
             for (i = 0; i < fill->numViaPts(); i++) {
                points = fill->getViaPts(i);
                for (j = 0; j < points.numPoints; j++)
-                 fprintf(fout, " %d %d", points.x[j], points.y[j]);
+                 diffPrintf(" %d %d", points.x[j], points.y[j]);
             }
-            fprintf(fout, "\n");
+            diffPrintf("\n");
          }
          --numObjs;
          break;
@@ -2114,15 +2338,15 @@ int cls(defrCallbackType_e c, void* cl, defiUserData ud) {
   case defrStylesCbkType :
          struct defiPoints points;
          styles = (defiStyles*)cl;
-         fprintf(fout, "STYLE %d", styles->style());
+         diffPrintf("STYLE %d", styles->style());
          points = styles->getPolygon();
          for (j = 0; j < points.numPoints; j++)
-            fprintf(fout, " %d %d", points.x[j], points.y[j]);
-         fprintf(fout, "\n");
+            diffPrintf(" %d %d", points.x[j], points.y[j]);
+         diffPrintf("\n");
          --numObjs;
          break;
 
-  default: fprintf(fout, "BOGUS callback to cls.\n"); return 1;
+  default: diffPrintf("BOGUS callback to cls.\n"); return 1;
   }
   return 0;
 }
@@ -2131,7 +2355,7 @@ int cls(defrCallbackType_e c, void* cl, defiUserData ud) {
 int dn(defrCallbackType_e c, const char* h, defiUserData ud) {
   checkType(c);
   if (ud != userData) dataError();
-  fprintf(fout, "DIVIDERCHAR \"%s\" \n",h);
+  diffPrintf("DIVIDERCHAR \"%s\" \n",h);
   return 0;
 }
 
@@ -2154,17 +2378,14 @@ int ext(defrCallbackType_e t, const char* c, defiUserData ud) {
   case defrPartitionsExtCbkType : name = address("partition"); break;
   default: name = address("BOGUS"); return 1;
   }
-  fprintf(fout, "EXTENSION %s %s\n", name, c);
+  diffPrintf("EXTENSION %s %s\n", name, c);
   return 0;
 }
 
 //========
 
-int diffDefReadFile(char* inFile, char* outFile, char* ignorePinExtra,
-                 char* ignoreRowName, char* ignoreViaName, char* netSegComp) {
-  FILE* f;
-  int   res;
-
+static void diffDefSetup(char* ignorePinExtra, char* ignoreRowName,
+                         char* ignoreViaName, char* netSegComp) {
   userData = (void*)0x01020304;
   defrInit();
 
@@ -2238,6 +2459,16 @@ int diffDefReadFile(char* inFile, char* outFile, char* ignorePinExtra,
   if (strcmp(netSegComp, "0") != 0)
      netSeCmp = 1;
 
+}
+
+
+int diffDefReadFile(char* inFile, char* outFile, char* ignorePinExtra,
+                 char* ignoreRowName, char* ignoreViaName, char* netSegComp) {
+  FILE* f;
+  int   res;
+
+  diffDefSetup(ignorePinExtra, ignoreRowName, ignoreViaName, netSegComp);
+
   if ((f = fopen(inFile,"r")) == 0) {
     fprintf(stderr,"Couldn't open input file '%s'\n", inFile);
     return(2);
@@ -2250,9 +2481,34 @@ int diffDefReadFile(char* inFile, char* outFile, char* ignorePinExtra,
   }
 
   res = defrRead(f, inFile, userData, 1);
+  defrClear();
 
   fclose(f);
   fclose(fout);
 
   return 0;
 }
+
+int diffDefHashFile(char* inFile, diffDefObjects* objs, char* ignorePinExtra,
+                    char* ignoreRowName, char* ignoreViaName,
+                    char* netSegComp) {
+  FILE* f;
+  int   res;
+
+  diffDefSetup(ignorePinExtra, ignoreRowName, ignoreViaName, netSegComp);
+
+  if ((f = fopen(inFile,"r")) == 0) {
+    fprintf(stderr,"Couldn't open input file '%s'\n", inFile);
+    return(2);
+  }
+
+  diffObjs = objs;
+  res = defrRead(f, inFile, userData, 1);
+  defrClear();
+  diffObjs->flush();
+  diffObjs = 0;
+
+  fclose(f);
+
+  return res ? 1 : 0;
+}
@@ -33,7 +33,14 @@
 #include <stdarg.h>
 #include <stdio.h>
 
+class diffDefObjects;
+
 int diffDefReadFile(char* inFile, char* outFile, char* ignorePinExtra,
                     char* ignoreRowName, char* ignoreViaName, char* netSegComp);
 
+// Reads inFile and adds its normalised lines to objs instead of writing
+// them to a file.
+int diffDefHashFile(char* inFile, diffDefObjects* objs, char* ignorePinExtra,
+                    char* ignoreRowName, char* ignoreViaName, char* netSegComp);
+
 #endif
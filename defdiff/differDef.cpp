@@ -48,27 +48,147 @@
 #endif
 #ifndef WIN32
 #   include <unistd.h>
+#   include <pthread.h>
 extern char VersionIdent[];
 #else
 char* VersionIdent = "N/A";
 #endif /* not WIN32 */
 #include "defrReader.hpp"
 #include "diffDefRW.hpp"
+#include "diffDefHash.hpp"
 
 char * exeName;   // use to save the executable name
 
+// One of the two files to read.  The reader state is per thread, so
+// the two files are read at the same time in their own threads.
+struct diffReadJob {
+  char*           inFile;
+  char*           outFile;       // text mode output, or
+  diffDefObjects* objs;          // the objects in hash mode
+  char**          flags;         // ignorePinExtra ignoreRowName
+                                 // ignoreViaName netSegComp
+  int             res;
+};
+
+static void* diffReadRun(void* arg) {
+  diffReadJob* job = (diffReadJob*)arg;
+
+  if (job->objs)
+    job->res = diffDefHashFile(job->inFile, job->objs, job->flags[0],
+                               job->flags[1], job->flags[2], job->flags[3]);
+  else
+    job->res = diffDefReadFile(job->inFile, job->outFile, job->flags[0],
+                               job->flags[1], job->flags[2], job->flags[3]);
+  return 0;
+}
+
+// Reads both files, returns non zero if either read failed.
+static int diffReadBoth(diffReadJob* job1, diffReadJob* job2) {
+  printf("Reading file: %s\n", job1->inFile);
+  printf("Reading file: %s\n", job2->inFile);
+  fflush(stdout);
+#ifndef WIN32
+  pthread_t thread;
+  if (pthread_create(&thread, 0, diffReadRun, job2) == 0) {
+    diffReadRun(job1);
+    pthread_join(thread, 0);
+    return job1->res || job2->res;
+  }
+#endif
+  diffReadRun(job1);
+  diffReadRun(job2);
+  return job1->res || job2->res;
+}
+
 // This program requires 3 input, the type of the file, lef or def
 // fileName1 and fileName2
 void diffUsage() {
    printf("Usage: lefdefdiff -lef|-def fileName1 fileName2 [-o outputFileName]\n");
+   printf("       defdiff -hash fileName1 fileName2 [-o outputFileName]\n");
+   printf("               [-ignorePinExtra] [-ignoreRowName] [-ignoreViaName] [-netSegComp]\n");
+}
+
+// defdiff -hash fileName1 fileName2 [-o outputFileName] [-ignorePinExtra]
+//         [-ignoreRowName] [-ignoreViaName] [-netSegComp]
+// compares the files in process.  Returns 0 if they are the same, 1 if
+// they differ and 2 on errors.  With -netSegComp the routing of the
+// nets is hashed by segment, and only the nets whose hashes differ are
+// read again to list the segments that differ.
+int diffHash(int argc, char** argv) {
+  char *fileName1 = 0, *fileName2 = 0, *outFile = 0;
+  char ignorePinExtra[2] = "0", ignoreRowName[2] = "0";
+  char ignoreViaName[2] = "0", netSegComp[2] = "0";
+  char* flags[4] = { ignorePinExtra, ignoreRowName, ignoreViaName, netSegComp };
+  diffDefObjects objs1, objs2, detail1, detail2;
+  std::set<std::string> changedNets;
+  diffReadJob job1 = { 0, 0, &objs1, flags, 0 };
+  diffReadJob job2 = { 0, 0, &objs2, flags, 0 };
+  FILE* out = stdout;
+  int   i, numDiffs;
+
+  for (i = 2; i < argc; i++) {
+    if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+      outFile = argv[++i];
+    else if (strcmp(argv[i], "-ignorePinExtra") == 0)
+      ignorePinExtra[0] = '1';
+    else if (strcmp(argv[i], "-ignoreRowName") == 0)
+      ignoreRowName[0] = '1';
+    else if (strcmp(argv[i], "-ignoreViaName") == 0)
+      ignoreViaName[0] = '1';
+    else if (strcmp(argv[i], "-netSegComp") == 0)
+      netSegComp[0] = '1';
+    else if (!fileName1)
+      fileName1 = argv[i];
+    else if (!fileName2)
+      fileName2 = argv[i];
+    else {
+      diffUsage();
+      return(2);
+    }
+  }
+  if (!fileName2) {
+    diffUsage();
+    return(2);
+  }
+
+  job1.inFile = fileName1;
+  job2.inFile = fileName2;
+  if (diffReadBoth(&job1, &job2) != 0)
+      return(2);
+
+  if (netSegComp[0] == '1')
+    diffDefChanged(objs1, objs2, "NET", &changedNets);
+  if (!changedNets.empty()) {
+    detail1.setDetail(changedNets);
+    detail2.setDetail(changedNets);
+    job1.objs = &detail1;
+    job2.objs = &detail2;
+    if (diffReadBoth(&job1, &job2) != 0)
+      return(2);
+  }
+
+  if (outFile && (out = fopen(outFile, "w")) == 0) {
+    fprintf(stderr, "Couldn't open output file '%s'\n", outFile);
+    return(2);
+  }
+  fprintf(out, "< %s\n", fileName1);
+  fprintf(out, "> %s\n", fileName2);
+  numDiffs = diffDefCompare(objs1, objs2, out, &detail1, &detail2);
+  if (out != stdout)
+    fclose(out);
+  return numDiffs ? 1 : 0;
 }
 
 int main(int argc, char** argv) {
   char *fileName1, *fileName2;   // For the filenames to compare
   char *defOut1, *defOut2;       // For the tmp output files
+  diffReadJob job1, job2;
   
   exeName = argv[0];
 
+  if (argc > 1 && strcmp(argv[1], "-hash") == 0)
+      return diffHash(argc, argv);
+
   if (argc != 9) {               // If pass in from lefdefdiff, argc is
       diffUsage();               // always 9: defdiff file1 file2 out1 out2
       return(1);                 // ignorePinExtra ignoreRowName ignoreViaName
@@ -82,13 +202,16 @@ int main(int argc, char** argv) {
   defOut1 = argv[3];
   defOut2 = argv[4];
 
-  // def files
-  printf("Reading file: %s\n", fileName1);
-  if (diffDefReadFile(fileName1, defOut1, argv[5], argv[6], argv[7], argv[8]) != 0)
+  // def files, read at the same time
+  job1.inFile = fileName1;
+  job1.outFile = defOut1;
+  job1.objs = 0;
+  job1.flags = argv + 5;
+  job2 = job1;
+  job2.inFile = fileName2;
+  job2.outFile = defOut2;
+  if (diffReadBoth(&job1, &job2) != 0)
       return(1);
-  printf("Reading file: %s\n", fileName2);
-  if (diffDefReadFile(fileName2, defOut2, argv[5], argv[6], argv[7], argv[8]) != 0)
-      return(1); 
 
   return (0);
 }
@@ -0,0 +1,767 @@
+// *****************************************************************************
+// *****************************************************************************
+// Copyright 2013-2014, Cadence Design Systems
+// 
+// This  file  is  part  of  the  Cadence  LEF/DEF  Open   Source
+// Distribution,  Product Version 5.8. 
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+//    implied. See the License for the specific language governing
+//    permissions and limitations under the License.
+// 
+// For updates, support, or to become part of the LEF/DEF Community,
+// check www.openeda.org for details.
+// 
+//  $Author$
+//  $Revision$
+//  $Date$
+//  $State:  $
+// *****************************************************************************
+// *****************************************************************************
+
+// defgen writes a synthetic DEF file of a given size with the DEF writer,
+// for benchmarking the parser on designs that cannot be shared.  The
+// instances are placed in rows, the nets connect a driver to sinks near
+// it with a geometric fanout distribution, routed nets get a horizontal
+// and a vertical segment per sink, and the power nets are a grid of
+// followpins and stripes joined by via arrays.  Everything is derived
+// from the seed, so the same options always give the same file.
+//
+// A file name ending in .gz is written with gzip, in members of
+// -gzblock bytes compressed by -threads threads if that is more than 1.
+// With -chunks the COMPONENTS and NETS are formatted in that many
+// writer chunks by as many threads, which gives the same file.
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#ifndef WIN32
+#   include <unistd.h>
+#   include <pthread.h>
+#endif /* not WIN32 */
+#include "defwWriter.hpp"
+#include "defzlib.hpp"
+
+// Units and geometry, in database units of 1/1000 micron.
+#define DBU         1000
+#define SITE_WIDTH  200
+#define ROW_HEIGHT  2000
+#define SLOT_WIDTH  (4 * SITE_WIDTH)   // one instance per slot
+#define CORE_ORIGIN 10000
+
+// Random streams, so that each part of the design is independent of
+// the options used for the other parts.
+#define STREAM_MASTER 1
+#define STREAM_NET    2
+#define STREAM_PROP   3
+
+struct defgenMaster {
+  const char*  name;
+  int          numInputs;
+};
+
+static const defgenMaster masters[] = {
+  { "INV_X1", 1 }, { "INV_X2", 1 }, { "BUF_X1", 1 }, { "BUF_X4", 1 },
+  { "NAND2_X1", 2 }, { "NOR2_X1", 2 }, { "AND2_X1", 2 }, { "OR2_X1", 2 },
+  { "XOR2_X1", 2 }, { "AOI21_X1", 3 }, { "OAI21_X1", 3 }, { "MUX2_X1", 3 },
+  { "AOI22_X1", 4 }, { "DFF_X1", 2 }
+};
+#define NUM_MASTERS ((int) (sizeof(masters) / sizeof(masters[0])))
+
+static const char* inputPins[] = { "A1", "A2", "A3", "A4" };
+
+// Options
+static unsigned long long seed = 1;
+static int    numInsts = 10000;
+static int    numNets = -1;             // default numInsts
+static double fanout = 3.0;             // mean pins per net
+static int    maxFanout = 64;
+static double routed = 1.0;             // fraction of routed nets
+static int    pitch = 20000;            // power stripe pitch
+static int    viaArrays = 1;
+static int    numPins = 100;
+static double props = 0.1;              // fraction with properties
+static int    numThreads = 1;           // gzip threads
+static int    gzipBlock = 1 << 20;      // bytes per parallel gzip member
+static int    numChunks = 1;            // COMPONENTS and NETS chunks
+
+// Layout derived from the options
+static int    perRow;
+static int    numRows;
+static int    coreWidth;
+static int    coreHeight;
+
+static unsigned long long mix(unsigned long long h) {
+  // splitmix64 finalizer
+  h ^= h >> 30;
+  h *= 0xbf58476d1ce4e5b9ULL;
+  h ^= h >> 27;
+  h *= 0x94d049bb133111ebULL;
+  h ^= h >> 31;
+  return h;
+}
+
+// Random number of item index in a stream.
+static unsigned long long hash(int stream, unsigned long long index) {
+  return mix(seed ^ mix(((unsigned long long) stream << 56) ^ index));
+}
+
+// A sequence of random numbers.
+class defgenRandom {
+public:
+  defgenRandom(int stream, unsigned long long index)
+    : state_(hash(stream, index)) { }
+
+  unsigned long long next() {
+    state_ += 0x9e3779b97f4a7c15ULL;
+    return mix(state_);
+  }
+  // uniform in [0, 1)
+  double uniform() { return (next() >> 11) * (1.0 / 9007199254740992.0); }
+  // uniform in [0, n)
+  int below(int n) { return (int) (next() % (unsigned long long) n); }
+
+private:
+  unsigned long long state_;
+};
+
+static const defgenMaster& instMaster(int inst) {
+  return masters[hash(STREAM_MASTER, inst) % NUM_MASTERS];
+}
+
+static void instLocation(int inst, int* x, int* y) {
+  *x = CORE_ORIGIN + (inst % perRow) * SLOT_WIDTH;
+  *y = CORE_ORIGIN + (inst / perRow) * ROW_HEIGHT;
+}
+
+// Location of a pin, for the routing.
+static void pinLocation(int inst, int pin, int* x, int* y) {
+  instLocation(inst, x, y);
+  *x += SITE_WIDTH / 2 + pin * SITE_WIDTH;
+  *y += ROW_HEIGHT / 2;
+}
+
+#define CHECK_STATUS(status) \
+  if (status) {              \
+     defwPrintError(status); \
+     return(status);         \
+  }
+
+// Sinks of one net: a geometric number of them, mostly in the rows
+// around the driver.
+static int netSinks(defgenRandom& rnd, int driver, int* sinks) {
+  int    num = 1;
+  int    window = 2 * perRow;
+  double p = fanout > 2.0 ? 1.0 / (fanout - 1.0) : 1.0;
+  int    i;
+
+  if (p < 1.0)
+    num = 1 + (int) (log(1.0 - rnd.uniform()) / log(1.0 - p));
+  if (num > maxFanout - 1)
+    num = maxFanout - 1;
+  if (num < 1)
+    num = 1;
+
+  for (i = 0; i < num; i++) {
+    int s;
+    if (rnd.below(10) == 0) {
+      s = rnd.below(numInsts);      // a long net now and then
+    } else {
+      s = driver + rnd.below(2 * window + 1) - window;
+      if (s < 0)
+        s = -s;
+      if (s >= numInsts)
+        s = numInsts - 1 - (s - numInsts) % numInsts;
+    }
+    if (s == driver)
+      s = (driver + 1) % numInsts;
+    sinks[i] = s;
+  }
+  return num;
+}
+
+static int writePath(const char* type, const char* layer, int numPts,
+                     double* x, double* y, const char* via) {
+  int status;
+
+  status = defwNetPathStart(type);
+  CHECK_STATUS(status);
+  status = defwNetPathLayer(layer, 0, NULL);
+  CHECK_STATUS(status);
+  status = defwNetPathPoint(numPts, x, y);
+  CHECK_STATUS(status);
+  if (via) {
+    status = defwNetPathVia(via);
+    CHECK_STATUS(status);
+  }
+  return 0;
+}
+
+// Driver pin to every sink pin: M2 horizontally, M3 vertically.
+static int writeRouting(int driver, int* sinks, int num) {
+  double x[2], y[2];
+  int    dx, dy, sx, sy;
+  int    i, status;
+
+  pinLocation(driver, 0, &dx, &dy);
+  x[0] = dx;
+  y[0] = dy;
+  status = writePath("ROUTED", "M1", 1, x, y, "VIA12");
+  CHECK_STATUS(status);
+
+  for (i = 0; i < num; i++) {
+    pinLocation(sinks[i], 1 + i % instMaster(sinks[i]).numInputs, &sx, &sy);
+    if (sx != dx) {
+      x[0] = dx;
+      y[0] = dy;
+      x[1] = sx;
+      y[1] = dy;
+      status = writePath("NEW", "M2", 2, x, y, sy != dy ? "VIA23" : NULL);
+      CHECK_STATUS(status);
+    } else if (sy != dy) {
+      x[0] = dx;
+      y[0] = dy;
+      status = writePath("NEW", "M2", 1, x, y, "VIA23");
+      CHECK_STATUS(status);
+    }
+    if (sy != dy) {
+      x[0] = sx;
+      y[0] = dy;
+      x[1] = sx;
+      y[1] = sy;
+      status = writePath("NEW", "M3", 2, x, y, NULL);
+      CHECK_STATUS(status);
+      x[0] = sx;
+      y[0] = sy;
+      status = writePath("NEW", "M2", 1, x, y, "VIA23");
+      CHECK_STATUS(status);
+    }
+    x[0] = sx;
+    y[0] = sy;
+    status = writePath("NEW", "M1", 1, x, y, "VIA12");
+    CHECK_STATUS(status);
+  }
+  return defwNetPathEnd();
+}
+
+static int writeVia(const char* name, const char* bot, const char* cut,
+                    const char* top) {
+  int status;
+
+  status = defwViaName(name);
+  CHECK_STATUS(status);
+  status = defwViaRect(bot, -100, -70, 100, 70);
+  CHECK_STATUS(status);
+  status = defwViaRect(cut, -50, -50, 50, 50);
+  CHECK_STATUS(status);
+  status = defwViaRect(top, -70, -100, 70, 100);
+  CHECK_STATUS(status);
+  return defwOneViaEnd();
+}
+
+static int writeHeader() {
+  const char* layers[2];
+  int         status;
+
+  status = defwStartPropDef();
+  CHECK_STATUS(status);
+  status = defwIntPropDef("COMPONENT", "weight", 0, 0, 0);
+  CHECK_STATUS(status);
+  status = defwRealPropDef("NET", "criticality", 0, 0, 0);
+  CHECK_STATUS(status);
+  status = defwEndPropDef();
+  CHECK_STATUS(status);
+
+  status = defwDieArea(0, 0, coreWidth + 2 * CORE_ORIGIN,
+                       coreHeight + 2 * CORE_ORIGIN);
+  CHECK_STATUS(status);
+  status = defwNewLine();
+  CHECK_STATUS(status);
+
+  for (int r = 0; r < numRows; r++) {
+    char name[32];
+    sprintf(name, "ROW_%d", r);
+    status = defwRowStr(name, "core", CORE_ORIGIN,
+                        CORE_ORIGIN + r * ROW_HEIGHT, r % 2 ? "FS" : "N",
+                        coreWidth / SITE_WIDTH, 1, SITE_WIDTH, 0);
+    CHECK_STATUS(status);
+  }
+
+  layers[0] = "M1";
+  layers[1] = "M3";
+  status = defwTracks("X", CORE_ORIGIN + SITE_WIDTH / 2,
+                      coreWidth / SITE_WIDTH, SITE_WIDTH, 2, layers);
+  CHECK_STATUS(status);
+  layers[0] = "M2";
+  layers[1] = "M4";
+  status = defwTracks("Y", CORE_ORIGIN + ROW_HEIGHT / 10,
+                      coreHeight * 5 / ROW_HEIGHT, ROW_HEIGHT / 5, 2, layers);
+  CHECK_STATUS(status);
+  status = defwNewLine();
+  CHECK_STATUS(status);
+
+  status = defwStartVias(4);
+  CHECK_STATUS(status);
+  status = writeVia("VIA12", "M1", "V1", "M2");
+  CHECK_STATUS(status);
+  status = writeVia("VIA23", "M2", "V2", "M3");
+  CHECK_STATUS(status);
+  status = writeVia("VIA34", "M3", "V3", "M4");
+  CHECK_STATUS(status);
+  status = writeVia("VIA14", "M1", "V1", "M4");
+  CHECK_STATUS(status);
+  status = defwEndVias();
+  CHECK_STATUS(status);
+  return defwNewLine();
+}
+
+// A part [from, to) of a section formatted into a writer chunk.
+struct defgenChunk {
+  defwContext* context;
+  int          (*write)(int from, int to);
+  int          from;
+  int          to;
+  int          status;
+  int          started;
+#ifndef WIN32
+  pthread_t    thread;
+#endif
+};
+
+static void* chunkRun(void* arg) {
+  defgenChunk* c = (defgenChunk*) arg;
+  defwContext* previous = defwSetContext(c->context);
+
+  c->status = (*c->write)(c->from, c->to);
+  defwSetContext(previous);
+  return 0;
+}
+
+// Writes the objects [0, num) of the section started last with write,
+// in numChunks chunks formatted by as many threads and appended in
+// order.
+static int writeChunked(int (*write)(int from, int to), int num) {
+  defgenChunk* chunks = (defgenChunk*) calloc(numChunks, sizeof(defgenChunk));
+  int          k, status = 0;
+
+  for (k = 0; k < numChunks; k++) {
+    defgenChunk* c = chunks + k;
+
+    c->context = defwNewChunk();
+    c->write = write;
+    c->from = (int) ((long long) num * k / numChunks);
+    c->to = (int) ((long long) num * (k + 1) / numChunks);
+#ifndef WIN32
+    c->started = pthread_create(&c->thread, 0, chunkRun, c) == 0;
+#endif
+    if (!c->started)
+      chunkRun(c);
+  }
+  for (k = 0; k < numChunks; k++) {
+    defgenChunk* c = chunks + k;
+
+#ifndef WIN32
+    if (c->started)
+      pthread_join(c->thread, 0);
+#endif
+    if (!status)
+      status = c->status;
+    if (!status)
+      status = defwAppendChunk(c->context);
+    defwDeleteContext(c->context);
+  }
+  free(chunks);
+  return status;
+}
+
+// Property weight of each instance, 0 for none.  They are drawn in
+// order from one stream before the chunks are written.
+static int* instWeights;
+
+static int writeComponentRange(int from, int to) {
+  char name[32];
+  int  i, x, y, status;
+
+  for (i = from; i < to; i++) {
+    sprintf(name, "u%d", i);
+    instLocation(i, &x, &y);
+    status = defwComponent(name, instMaster(i).name, 0, NULL, NULL, NULL,
+                           NULL, NULL, 0, NULL, NULL, NULL, NULL, "PLACED",
+                           x, y, (i / perRow) % 2 ? 5 : 0, 0, NULL,
+                           0, 0, 0, 0);
+    CHECK_STATUS(status);
+    if (instWeights[i]) {
+      status = defwIntProperty("weight", instWeights[i]);
+      CHECK_STATUS(status);
+    }
+  }
+  return 0;
+}
+
+static int writeComponents() {
+  int          i, status;
+  defgenRandom rnd(STREAM_PROP, 0);
+
+  instWeights = (int*) malloc(sizeof(int) * numInsts);
+  for (i = 0; i < numInsts; i++)
+    instWeights[i] = rnd.uniform() < props ? 1 + rnd.below(10) : 0;
+
+  status = defwStartComponents(numInsts);
+  CHECK_STATUS(status);
+  if (numChunks > 1)
+    status = writeChunked(writeComponentRange, numInsts);
+  else
+    status = writeComponentRange(0, numInsts);
+  CHECK_STATUS(status);
+  status = defwEndComponents();
+  CHECK_STATUS(status);
+  free(instWeights);
+  return defwNewLine();
+}
+
+// IO pins spread around the die, on the first nets.
+static int writePins() {
+  static const char* sides[] = { "S", "E", "N", "W" };
+  char               name[32], net[32];
+  int                dieW = coreWidth + 2 * CORE_ORIGIN;
+  int                dieH = coreHeight + 2 * CORE_ORIGIN;
+  int                perSide = (numPins + 3) / 4;
+  int                i, status;
+
+  status = defwStartPins(numPins);
+  CHECK_STATUS(status);
+  for (i = 0; i < numPins; i++) {
+    int side = i / perSide;
+    int k = i % perSide + 1;
+    int x, y;
+
+    switch (side) {
+      case 0:  x = dieW * k / (perSide + 1); y = 0; break;
+      case 1:  x = dieW; y = dieH * k / (perSide + 1); break;
+      case 2:  x = dieW * k / (perSide + 1); y = dieH; break;
+      default: x = 0; y = dieH * k / (perSide + 1); break;
+    }
+    sprintf(name, "p%d", i);
+    sprintf(net, "n%d", i);
+    status = defwPinStr(name, net, 0, i % 2 ? "OUTPUT" : "INPUT", "SIGNAL",
+                        "PLACED", x, y, sides[side], "M3", -70, 0, 70, 140);
+    CHECK_STATUS(status);
+  }
+  status = defwEndPins();
+  CHECK_STATUS(status);
+  return defwNewLine();
+}
+
+// VDD and VSS: a followpin on every row boundary, stripes on M4 and
+// vias where a stripe crosses a followpin of its net.
+static int writeSpecialNets() {
+  const char* nets[2] = { "VDD", "VSS" };
+  double      x[2], y[2];
+  int         numStripes = coreWidth / pitch + 1;
+  int         n, r, s, status;
+
+  status = defwStartSpecialNets(2);
+  CHECK_STATUS(status);
+  for (n = 0; n < 2; n++) {
+    status = defwSpecialNet(nets[n]);
+    CHECK_STATUS(status);
+    status = defwSpecialNetConnection("*", nets[n], 0);
+    CHECK_STATUS(status);
+    status = defwSpecialNetUse(n ? "GROUND" : "POWER");
+    CHECK_STATUS(status);
+
+    status = defwSpecialNetPathStart("ROUTED");
+    CHECK_STATUS(status);
+    for (r = n; r <= numRows; r += 2) {
+      if (r > n) {
+        status = defwSpecialNetPathStart("NEW");
+        CHECK_STATUS(status);
+      }
+      status = defwSpecialNetPathLayer("M1");
+      CHECK_STATUS(status);
+      status = defwSpecialNetPathWidth(240);
+      CHECK_STATUS(status);
+      status = defwSpecialNetPathShape("FOLLOWPIN");
+      CHECK_STATUS(status);
+      x[0] = CORE_ORIGIN;
+      y[0] = CORE_ORIGIN + r * ROW_HEIGHT;
+      x[1] = CORE_ORIGIN + coreWidth;
+      y[1] = y[0];
+      status = defwSpecialNetPathPoint(2, x, y);
+      CHECK_STATUS(status);
+    }
+
+    for (s = 0; s < numStripes; s++) {
+      int sx = CORE_ORIGIN + s * pitch + n * pitch / 2;
+      if (sx > CORE_ORIGIN + coreWidth)
+        break;
+      status = defwSpecialNetPathStart("NEW");
+      CHECK_STATUS(status);
+      status = defwSpecialNetPathLayer("M4");
+      CHECK_STATUS(status);
+      status = defwSpecialNetPathWidth(1000);
+      CHECK_STATUS(status);
+      status = defwSpecialNetPathShape("STRIPE");
+      CHECK_STATUS(status);
+      x[0] = sx;
+      y[0] = CORE_ORIGIN;
+      x[1] = sx;
+      y[1] = CORE_ORIGIN + coreHeight;
+      status = defwSpecialNetPathPoint(2, x, y);
+      CHECK_STATUS(status);
+
+      // vias on the followpins of this net, rows n, n + 2, ...
+      if (viaArrays) {
+        status = defwSpecialNetPathStart("NEW");
+        CHECK_STATUS(status);
+        status = defwSpecialNetPathLayer("M4");
+        CHECK_STATUS(status);
+        status = defwSpecialNetPathWidth(1000);
+        CHECK_STATUS(status);
+        status = defwSpecialNetPathShape("STRIPE");
+        CHECK_STATUS(status);
+        x[0] = sx;
+        y[0] = CORE_ORIGIN + n * ROW_HEIGHT;
+        status = defwSpecialNetPathPoint(1, x, y);
+        CHECK_STATUS(status);
+        status = defwSpecialNetPathVia("VIA14");
+        CHECK_STATUS(status);
+        status = defwSpecialNetPathViaData(1, (numRows - n) / 2 + 1, 0,
+                                           2 * ROW_HEIGHT);
+        CHECK_STATUS(status);
+      } else {
+        for (r = n; r <= numRows; r += 2) {
+          status = defwSpecialNetPathStart("NEW");
+          CHECK_STATUS(status);
+          status = defwSpecialNetPathLayer("M4");
+          CHECK_STATUS(status);
+          status = defwSpecialNetPathWidth(1000);
+          CHECK_STATUS(status);
+          x[0] = sx;
+          y[0] = CORE_ORIGIN + r * ROW_HEIGHT;
+          status = defwSpecialNetPathPoint(1, x, y);
+          CHECK_STATUS(status);
+          status = defwSpecialNetPathVia("VIA14");
+          CHECK_STATUS(status);
+        }
+      }
+    }
+    status = defwSpecialNetPathEnd();
+    CHECK_STATUS(status);
+    status = defwSpecialNetEndOneNet();
+    CHECK_STATUS(status);
+  }
+  status = defwEndSpecialNets();
+  CHECK_STATUS(status);
+  return defwNewLine();
+}
+
+static int writeNetRange(int from, int to) {
+  char                  name[32];
+  int*                  sinks = (int*) malloc(sizeof(int) * maxFanout);
+  char**                names = (char**) malloc(sizeof(char*) * maxFanout);
+  defwNetConnectionRec* conns = (defwNetConnectionRec*)
+                                malloc(sizeof(defwNetConnectionRec) * maxFanout);
+  int                   i, j, num, status;
+
+  for (j = 0; j < maxFanout; j++)
+    names[j] = (char*) malloc(32);
+
+  for (i = from; i < to; i++) {
+    // each net has its own random sequence
+    defgenRandom rnd(STREAM_NET, i);
+    int          driver = rnd.below(numInsts);
+
+    num = netSinks(rnd, driver, sinks);
+
+    sprintf(name, "n%d", i);
+    status = defwNet(name);
+    CHECK_STATUS(status);
+
+    sprintf(names[0], "u%d", driver);
+    conns[0].inst = names[0];
+    conns[0].pin = "Z";
+    conns[0].synthesized = 0;
+    for (j = 0; j < num; j++) {
+      sprintf(names[j + 1], "u%d", sinks[j]);
+      conns[j + 1].inst = names[j + 1];
+      conns[j + 1].pin = inputPins[j % instMaster(sinks[j]).numInputs];
+      conns[j + 1].synthesized = 0;
+    }
+    status = defwNetConnectionsBulk(conns, num + 1);
+    CHECK_STATUS(status);
+    if (i < numPins) {
+      sprintf(names[0], "p%d", i);
+      status = defwNetConnection("PIN", names[0], 0);
+      CHECK_STATUS(status);
+    }
+
+    if (rnd.uniform() < routed) {
+      status = writeRouting(driver, sinks, num);
+      CHECK_STATUS(status);
+    }
+    if (rnd.uniform() < props) {
+      status = defwRealProperty("criticality", rnd.below(1000) / 1000.0);
+      CHECK_STATUS(status);
+    }
+    status = defwNetEndOneNet();
+    CHECK_STATUS(status);
+  }
+
+  for (j = 0; j < maxFanout; j++)
+    free(names[j]);
+  free(names);
+  free(conns);
+  free(sinks);
+  return 0;
+}
+
+static int writeNets() {
+  int status;
+
+  status = defwStartNets(numNets);
+  CHECK_STATUS(status);
+  if (numChunks > 1)
+    status = writeChunked(writeNetRange, numNets);
+  else
+    status = writeNetRange(0, numNets);
+  CHECK_STATUS(status);
+  status = defwEndNets();
+  CHECK_STATUS(status);
+  return defwNewLine();
+}
+
+static void usage() {
+  fprintf(stderr, "Usage: defgen [-o <filename>[.gz]] [-seed n] [-insts n]\n"
+          "              [-nets n] [-fanout mean] [-maxfanout n]\n"
+          "              [-routed fraction] [-pitch dbu] [-noviaarray]\n"
+          "              [-pins n] [-props fraction] [-threads n]\n"
+          "              [-gzblock bytes] [-chunks n]\n");
+}
+
+int main(int argc, char** argv) {
+  const char* outfile = 0;
+  FILE*       fout = stdout;
+  defwGZFile  gz = 0;
+  int         status;
+  int         i;
+
+  for (i = 1; i < argc; i++) {
+    const char* opt = argv[i];
+    const char* val = i + 1 < argc ? argv[i + 1] : 0;
+
+    if (strcmp(opt, "-noviaarray") == 0) {
+      viaArrays = 0;
+      continue;
+    }
+    if (strncmp(opt, "-h", 2) == 0) {
+      usage();
+      return 1;
+    }
+    if (!val) {
+      fprintf(stderr, "ERROR: missing value for option '%s'\n", opt);
+      usage();
+      return 2;
+    }
+    i++;
+    if (strcmp(opt, "-o") == 0)
+      outfile = val;
+    else if (strcmp(opt, "-seed") == 0)
+      seed = strtoull(val, NULL, 10);
+    else if (strcmp(opt, "-insts") == 0)
+      numInsts = atoi(val);
+    else if (strcmp(opt, "-nets") == 0)
+      numNets = atoi(val);
+    else if (strcmp(opt, "-fanout") == 0)
+      fanout = atof(val);
+    else if (strcmp(opt, "-maxfanout") == 0)
+      maxFanout = atoi(val);
+    else if (strcmp(opt, "-routed") == 0)
+      routed = atof(val);
+    else if (strcmp(opt, "-pitch") == 0)
+      pitch = atoi(val);
+    else if (strcmp(opt, "-pins") == 0)
+      numPins = atoi(val);
+    else if (strcmp(opt, "-props") == 0)
+      props = atof(val);
+    else if (strcmp(opt, "-threads") == 0)
+      numThreads = atoi(val);
+    else if (strcmp(opt, "-gzblock") == 0)
+      gzipBlock = atoi(val);
+    else if (strcmp(opt, "-chunks") == 0)
+      numChunks = atoi(val);
+    else {
+      fprintf(stderr, "ERROR: Illegal command line option: '%s'\n", opt);
+      usage();
+      return 2;
+    }
+  }
+
+  if (numNets < 0)
+    numNets = numInsts;
+  if (numInsts < 2 || fanout < 2.0 || maxFanout < 2 || pitch < SLOT_WIDTH) {
+    fprintf(stderr, "ERROR: need -insts >= 2, -fanout >= 2, "
+            "-maxfanout >= 2 and -pitch >= %d\n", SLOT_WIDTH);
+    return 2;
+  }
+  if (numPins > numNets)
+    numPins = numNets;
+
+  // a square core
+  perRow = (int) ceil(sqrt((double) numInsts * ROW_HEIGHT / SLOT_WIDTH));
+  numRows = (numInsts + perRow - 1) / perRow;
+  coreWidth = perRow * SLOT_WIDTH;
+  coreHeight = numRows * ROW_HEIGHT;
+
+  if (outfile) {
+    size_t len = strlen(outfile);
+    if (len > 3 && strcmp(outfile + len - 3, ".gz") == 0) {
+      if (numThreads > 1)
+        gz = defwGZipOpenParallel(outfile, -1, numThreads, gzipBlock);
+      else
+        gz = defwGZipOpen(outfile, "wb");
+      fout = (FILE*) gz;
+    } else {
+      fout = fopen(outfile, "w");
+    }
+    if (fout == 0) {
+      fprintf(stderr, "ERROR: could not open output file '%s'\n", outfile);
+      return 2;
+    }
+  }
+
+  status = defwInit(fout, 5, 8, NULL, "/", "[]", "defgen", NULL, NULL, NULL,
+                    DBU);
+  CHECK_STATUS(status);
+  status = defwNewLine();
+  CHECK_STATUS(status);
+
+  status = writeHeader();
+  CHECK_STATUS(status);
+  status = writeComponents();
+  CHECK_STATUS(status);
+  status = writePins();
+  CHECK_STATUS(status);
+  status = writeSpecialNets();
+  CHECK_STATUS(status);
+  status = writeNets();
+  CHECK_STATUS(status);
+
+  status = defwEnd();
+  CHECK_STATUS(status);
+
+  if (gz)
+    status = defwGZipClose(gz);
+  else if (fout != stdout)
+    fclose(fout);
+  return status;
+}
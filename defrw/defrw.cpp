@@ -36,6 +36,7 @@
 #endif /* not WIN32 */
 #include "defrReader.hpp"
 #include "defiAlias.hpp"
+#include "defwWriter.hpp"
 
 char defaultName[64];
 char defaultOut[64];
@@ -83,9 +84,45 @@ int done(defrCallbackType_e c, void* dummy, defiUserData ud) {
   return 0;
 }
 
+// The object callbacks write the END of a section after its last object.
+// Without the component callback (-noComp), or when only the first
+// objects of the sections are read (-sample), the END is written by the
+// end callbacks instead.
+static int noCompCb = 0;
+static int sectionEnds = 0;
+
 int endfunc(defrCallbackType_e c, void* dummy, defiUserData ud) {
+  const char* name = 0;
+
   checkType(c);
   if (ud != userData) dataError();
+  if (!sectionEnds && !(c == defrComponentEndCbkType && noCompCb))
+    return 0;
+
+  switch (c) {
+  case defrAssertionsEndCbkType : name = "ASSERTIONS"; break;
+  case defrComponentEndCbkType : name = "COMPONENTS"; break;
+  case defrConstraintsEndCbkType : name = "CONSTRAINTS"; break;
+  case defrNetEndCbkType : name = "NETS"; break;
+  case defrFPCEndCbkType : name = "FLOORPLANCONSTRAINTS"; break;
+  case defrGroupsEndCbkType : name = "GROUPS"; break;
+  case defrIOTimingsEndCbkType : name = "IOTIMINGS"; break;
+  case defrPartitionsEndCbkType : name = "PARTITIONS"; break;
+  case defrRegionEndCbkType : name = "REGIONS"; break;
+  case defrSNetEndCbkType : name = "SPECIALNETS"; break;
+  case defrScanchainsEndCbkType : name = "SCANCHAINS"; break;
+  case defrPinEndCbkType : name = "PINS"; break;
+  case defrViaEndCbkType : name = "VIAS"; break;
+  case defrPinPropEndCbkType : name = "PINPROPERTIES"; break;
+  case defrBlockageEndCbkType : name = "BLOCKAGES"; break;
+  case defrSlotEndCbkType : name = "SLOTS"; break;
+  case defrFillEndCbkType : name = "FILLS"; break;
+  case defrNonDefaultEndCbkType : name = "NONDEFAULTRULES"; break;
+  case defrStylesEndCbkType : name = "STYLES"; break;
+  default : break;     // no END written for TIMINGDISABLES
+  }
+  if (name)
+    fprintf(fout, "END %s\n", name);
   return 0;
 }
 
@@ -231,7 +268,7 @@ int compf(defrCallbackType_e c, defiComponent* co, defiUserData ud) {
     }
     fprintf(fout, ";\n");
     --numObjs;
-    if (numObjs <= 0)
+    if (numObjs <= 0 && !sectionEnds)
         fprintf(fout, "END COMPONENTS\n");
   return 0;
 }
@@ -583,7 +620,7 @@ int netf(defrCallbackType_e c, defiNet* net, defiUserData ud) {
 
   fprintf (fout, ";\n");
   --numObjs;
-  if (numObjs <= 0)
+  if (numObjs <= 0 && !sectionEnds)
       fprintf(fout, "END NETS\n");
   return 0;
 }
@@ -1443,7 +1480,7 @@ int snetf(defrCallbackType_e c, defiNet* net, defiUserData ud) {
 
   fprintf (fout, ";\n");
   --numObjs;
-  if (numObjs <= 0)
+  if (numObjs <= 0 && !sectionEnds)
       fprintf(fout, "END SPECIALNETS\n");
   return 0;
 }
@@ -1496,7 +1533,7 @@ int ndr(defrCallbackType_e c, defiNonDefault* nd, defiUserData ud) {
     }
   }
   --numObjs;
-  if (numObjs <= 0)
+  if (numObjs <= 0 && !sectionEnds)
     fprintf(fout, "END NONDEFAULTRULES\n");
   return 0;
 }
@@ -1645,7 +1682,7 @@ int constraint(defrCallbackType_e c, defiAssertion* a, defiUserData ud) {
       fprintf(fout, ";\n");
   }
   --numObjs;
-  if (numObjs <= 0) {
+  if (numObjs <= 0 && !sectionEnds) {
       if (c == defrConstraintCbkType)
           fprintf(fout, "END CONSTRAINTS\n");
       else 
@@ -2138,7 +2175,7 @@ int cls(defrCallbackType_e c, void* cl, defiUserData ud) {
          }
          fprintf(fout, ";\n");
          --numObjs;
-         if (numObjs <= 0)
+         if (numObjs <= 0 && !sectionEnds)
              fprintf(fout, "END PINS\n");
          break;
   case defrDefaultCapCbkType :
@@ -2273,7 +2310,7 @@ int cls(defrCallbackType_e c, void* cl, defiUserData ud) {
                 fprintf(fout, "  + PATTERN '%s'\n", via->cutPattern());
          }
          --numObjs;
-         if (numObjs <= 0)
+         if (numObjs <= 0 && !sectionEnds)
              fprintf(fout, "END VIAS\n");
          break;
   case defrRegionCbkType :
@@ -2305,7 +2342,7 @@ int cls(defrCallbackType_e c, void* cl, defiUserData ud) {
          }
          fprintf(fout, ";\n"); 
          --numObjs;
-         if (numObjs <= 0) {
+         if (numObjs <= 0 && !sectionEnds) {
              fprintf(fout, "END REGIONS\n");
          }
          break;
@@ -2371,7 +2408,7 @@ int cls(defrCallbackType_e c, void* cl, defiUserData ud) {
          }
          fprintf(fout, " ;\n");
          --numObjs;
-         if (numObjs <= 0)
+         if (numObjs <= 0 && !sectionEnds)
              fprintf(fout, "END GROUPS\n");
          break;
   case defrScanchainCbkType :
@@ -2438,7 +2475,7 @@ int cls(defrCallbackType_e c, void* cl, defiUserData ud) {
          }
          fprintf(fout, ";\n");
          --numObjs;
-         if (numObjs <= 0)
+         if (numObjs <= 0 && !sectionEnds)
              fprintf(fout, "END SCANCHAINS\n");
          break;
   case defrIOTimingCbkType :
@@ -2480,7 +2517,7 @@ int cls(defrCallbackType_e c, void* cl, defiUserData ud) {
          }
          fprintf(fout, ";\n");
          --numObjs;
-         if (numObjs <= 0)
+         if (numObjs <= 0 && !sectionEnds)
              fprintf(fout, "END IOTIMINGS\n");
          break;
   case defrFPCCbkType :
@@ -2511,7 +2548,7 @@ int cls(defrCallbackType_e c, void* cl, defiUserData ud) {
          }
          fprintf(fout, ";\n");
          --numObjs;
-         if (numObjs <= 0)
+         if (numObjs <= 0 && !sectionEnds)
              fprintf(fout, "END FLOORPLANCONSTRAINTS\n");
          break;
   case defrTimingDisableCbkType :
@@ -2598,7 +2635,7 @@ int cls(defrCallbackType_e c, void* cl, defiUserData ud) {
          }
          fprintf(fout, ";\n");
          --numObjs;
-         if (numObjs <= 0)
+         if (numObjs <= 0 && !sectionEnds)
              fprintf(fout, "END PARTITIONS\n");
          break;
 
@@ -2632,7 +2669,7 @@ int cls(defrCallbackType_e c, void* cl, defiUserData ud) {
             fprintf(fout, ";\n");
          }
          --numObjs;
-         if (numObjs <= 0)
+         if (numObjs <= 0 && !sectionEnds)
              fprintf(fout, "END PINPROPERTIES\n");
          break;
   case defrBlockageCbkType :
@@ -2688,7 +2725,7 @@ int cls(defrCallbackType_e c, void* cl, defiUserData ud) {
          }
          fprintf(fout, ";\n");
          --numObjs;
-         if (numObjs <= 0)
+         if (numObjs <= 0 && !sectionEnds)
              fprintf(fout, "END BLOCKAGES\n");
          break;
   case defrSlotCbkType :
@@ -2710,7 +2747,7 @@ int cls(defrCallbackType_e c, void* cl, defiUserData ud) {
          }
          fprintf(fout, ";\n");
          --numObjs;
-         if (numObjs <= 0)
+         if (numObjs <= 0 && !sectionEnds)
              fprintf(fout, "END SLOTS\n");
          break;
   case defrFillCbkType :
@@ -2760,7 +2797,7 @@ int cls(defrCallbackType_e c, void* cl, defiUserData ud) {
             }
             fprintf(fout, ";\n");
          }
-         if (numObjs <= 0)
+         if (numObjs <= 0 && !sectionEnds)
              fprintf(fout, "END FILLS\n");
          break;
   case defrStylesCbkType :
@@ -2772,7 +2809,7 @@ int cls(defrCallbackType_e c, void* cl, defiUserData ud) {
             fprintf(fout, "%d %d ", points.x[j], points.y[j]);
          fprintf(fout, ";\n");
          --numObjs;
-         if (numObjs <= 0)
+         if (numObjs <= 0 && !sectionEnds)
              fprintf(fout, "END STYLES\n");
          break;
 
@@ -2867,6 +2904,164 @@ void printWarning(const char *str)
     fprintf(stderr, "%s\n", str);
 }
 
+// -splice: the section splice() writes with the writer, the others are
+// copied from the input.
+static int spliceSection = defiSectionUnknown;
+
+// Number of newlines in [start, end) of data.
+static int spliceLines(const char* data, long long start, long long end) {
+  int n = 0;
+
+  for (; start < end; start++)
+    if (data[start] == '\n')
+      n++;
+  return n;
+}
+
+// Copies [start, end) of the input as text outside of a section.
+static int spliceText(int fd, const char* data, long long start,
+                      long long end) {
+  if (start >= end)
+    return 0;
+  return defwCopyRange(fd, start, end - start, spliceLines(data, start, end),
+                       0, defiSectionUnknown);
+}
+
+// Writes section index of the source map with its start and end
+// routines around copies of its statements, as an ECO flow would write
+// a section it edited.  *pos is set to the offset of the input to go on
+// from.
+static int spliceWrite(int fd, const char* data,
+                       const defiSourceMap* map, int index, long long* pos) {
+  const defiSourceRange* r = map->section(index);
+  int                    first = map->firstStatement(index);
+  int                    last = map->firstStatement(index + 1);
+  long long              end = r->end;
+  int                    i, status;
+
+  // the END line is written by the end routine
+  while (end > r->start && strncmp(data + end, "END", 3) != 0)
+    end--;
+  while (end > r->start && data[end - 1] != '\n')
+    end--;
+
+  switch (r->section) {
+    case defiSectionComponents:
+      status = defwStartComponents(last - first);
+      break;
+    case defiSectionPins:
+      status = defwStartPins(last - first);
+      break;
+    case defiSectionSpecialNets:
+      status = defwStartSpecialNets(last - first);
+      break;
+    case defiSectionNets:
+      status = defwStartNets(last - first);
+      break;
+    case defiSectionGroups:
+      status = defwStartGroups(last - first);
+      break;
+    default:
+      fprintf(stderr, "ERROR: -splice can not write %s\n",
+              defiSourceMap::sectionName((defiSection_e) r->section));
+      return 1;
+  }
+  if (status)
+    return status;
+
+  *pos = first < last ? map->statement(first)->start : end;
+  for (i = first; i < last; i++) {
+    const defiSourceRange* s = map->statement(i);
+
+    status = spliceText(fd, data, *pos, s->start);
+    if (status)
+      return status;
+    status = defwCopyRange(fd, s->start, s->end - s->start, s->numLines, 1,
+                           defiSectionUnknown);
+    if (status)
+      return status;
+    *pos = s->end;
+  }
+  status = spliceText(fd, data, *pos, end);
+  if (status)
+    return status;
+
+  switch (r->section) {
+    case defiSectionComponents:
+      status = defwEndComponents();
+      break;
+    case defiSectionPins:
+      status = defwEndPins();
+      break;
+    case defiSectionSpecialNets:
+      status = defwEndSpecialNets();
+      break;
+    case defiSectionNets:
+      status = defwEndNets();
+      break;
+    case defiSectionGroups:
+      status = defwEndGroups();
+      break;
+  }
+
+  // The end routines write an empty line after the section.
+  *pos = r->end;
+  if (data[*pos] == '\n')
+    (*pos)++;
+  return status;
+}
+
+// Writes the file read last to fout through the writer from the source
+// map of the reader: every section but spliceSection is copied from the
+// input with defwCopyRange, and spliceSection is written by
+// spliceWrite.  The output is the input again.
+static int splice(const char* fileName) {
+  const defiSourceMap* map = defrGetSourceMap();
+  FILE*                in;
+  char*                data;
+  long long            size;
+  long long            pos = 0;
+  int                  fd, i;
+  int                  status = 0;
+
+  if (!map || (in = fopen(fileName, "rb")) == 0) {
+    fprintf(stderr, "ERROR: could not splice '%s'\n", fileName);
+    return 1;
+  }
+  fseek(in, 0, SEEK_END);
+  size = ftell(in);
+  fseek(in, 0, SEEK_SET);
+  data = (char*) malloc(size + 1);
+  if (fread(data, 1, size, in) != (size_t) size)
+    size = 0;
+  data[size] = '\0';
+  fd = fileno(in);
+
+  status = defwInitCbk(fout);
+  for (i = 0; i < map->numSections() && !status; i++) {
+    const defiSourceRange* r = map->section(i);
+
+    status = spliceText(fd, data, pos, r->start);
+    if (status)
+      break;
+    if (r->section == spliceSection) {
+      status = spliceWrite(fd, data, map, i, &pos);
+    } else {
+      status = defwCopyRange(fd, r->start, r->end - r->start, r->numLines,
+                             0, r->section);
+      pos = r->end;
+    }
+  }
+  if (!status)
+    status = spliceText(fd, data, pos, size);
+  if (status)
+    defwPrintError(status);
+
+  free(data);
+  fclose(in);
+  return status;
+}
+
 int main(int argc, char** argv) {
   int num = 99;
   char* inFile[6];
@@ -2883,6 +3078,7 @@ int main(int argc, char** argv) {
   int noNetCb = 0;
   int ccr749853 = 0;
   int line_num_print_interval = 50;
+  int sampleLimit = 0;
 
 //  start_mem = (long)sbrk(0);
 
@@ -2924,12 +3120,31 @@ int main(int argc, char** argv) {
         argv++;
         argc--;
         line_num_print_interval = atoi(*argv);
+    } else if (strcmp(*argv, "-sample") == 0) {
+        argv++;
+        argc--;
+        sampleLimit = atoi(*argv);
+    } else if (strcmp(*argv, "-splice") == 0) {
+        argv++;
+        argc--;
+        for (spliceSection = defiSectionUnknown + 1;
+             spliceSection < defiNumSections; spliceSection++)
+          if (strcmp(*argv, defiSourceMap::sectionName(
+                              (defiSection_e) spliceSection)) == 0)
+            break;
+        if (spliceSection == defiNumSections) {
+          fprintf(stderr, "ERROR: unknown section '%s'\n", *argv);
+          return 2;
+        }
+        noCalls = 1;
     } else if (strcmp(*argv, "-test1") == 0) {
       test1 = 1;
     } else if (strcmp(*argv, "-test2") == 0) {
       test2 = 1;
     } else if (strcmp(*argv, "-noNet") == 0) {
       noNetCb = 1;
+    } else if (strcmp(*argv, "-noComp") == 0) {
+      noCompCb = 1;
     } else if (strcmp(*argv, "-ccr749853") == 0) {
       ccr749853 = 1;
     } else if (strcmp(*argv, "-ccr1131444") == 0) {
@@ -2955,6 +3170,9 @@ int main(int argc, char** argv) {
       fprintf(stderr, "\t-i <num_lines> -- sets processing msg interval (default: 50 lines).\n");
       fprintf(stderr, "\t-nc            -- no functional callbacks will be called.\n");
       fprintf(stderr, "\t-o <out_file>  -- write output to the file.\n");
+      fprintf(stderr, "\t-sample <num>  -- read only the first num objects of each section.\n");
+      fprintf(stderr, "\t-splice <section> -- write the input again, copying all sections\n"
+                      "\t                    but this one with defwCopyRange.\n");
       fprintf(stderr, "\t-ignoreRowNames   -- don't output row names.\n");
       fprintf(stderr, "\t-ignoreViaNames   -- don't output via names.\n");
       return 2;
@@ -2978,6 +3196,14 @@ int main(int argc, char** argv) {
 
   defrInitSession(isSessionless ? 0 : 1);
 
+  if (sampleLimit) {
+    defrSetSampleLimit(defiSectionUnknown, sampleLimit);
+    sectionEnds = 1;
+  }
+
+  if (spliceSection != defiSectionUnknown)
+    defrSetBuildSourceMap();
+
   if (noCalls == 0) {
 
     defrSetWarningLogFunction(printWarning);
@@ -3003,7 +3229,8 @@ int main(int argc, char** argv) {
     if (setSNetWireCbk)
       defrSetSNetWireCbk(snetwire);
     defrSetComponentMaskShiftLayerCbk(compMSL);
-    defrSetComponentCbk(compf);
+    if (!noCompCb)
+      defrSetComponentCbk(compf);
     defrSetAddPathToNet();
     defrSetHistoryCbk(hist);
     defrSetConstraintCbk(constraint);
@@ -3136,7 +3363,8 @@ int main(int argc, char** argv) {
     defrSetViaWarnings(3);
   }
 
-  if (! isSessionless) {
+  // The line numbers are written to fout, where -splice writes the DEF.
+  if (! isSessionless && spliceSection == defiSectionUnknown) {
 	  defrSetLongLineNumberFunction(lineNumberCB);
 	  defrSetDeltaNumberLines(line_num_print_interval);
   }
@@ -3222,6 +3450,8 @@ int main(int argc, char** argv) {
 
        if (res)
            fprintf(stderr, "Reader returns bad status.\n", inFile[fileCt]);
+       else if (spliceSection != defiSectionUnknown)
+           res = splice(inFile[fileCt]);
 
        // Testing the aliases API.
        defrAddAlias ("alias1", "aliasValue1", 1);
@@ -0,0 +1,148 @@
+// *****************************************************************************
+// *****************************************************************************
+// Copyright 2013-2014, Cadence Design Systems
+// 
+// This  file  is  part  of  the  Cadence  LEF/DEF  Open   Source
+// Distribution,  Product Version 5.8. 
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+//    implied. See the License for the specific language governing
+//    permissions and limitations under the License.
+// 
+// For updates, support, or to become part of the LEF/DEF Community,
+// check www.openeda.org for details.
+// 
+//  $Author$
+//  $Revision$
+//  $Date$
+//  $State:  $
+// *****************************************************************************
+// *****************************************************************************
+
+// defstat prints the sizes of the sections of DEF files, the routed and
+// unrouted nets, the wires per layer and the via usage, computed with
+// defrScanStats() instead of a full parse.  With -validate it parses the
+// files with defrValidate() instead and only reports their errors and
+// warnings, for checking files before they are read.  Files ending in
+// .gz are read through defzlib.
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#include "defrReader.hpp"
+#include "defzlib.hpp"
+
+static int topVias = 0;
+static int validate = 0;
+
+static bool moreUsed(const std::pair<long long, int>& a,
+                     const std::pair<long long, int>& b) {
+  return a.first > b.first || (a.first == b.first && a.second < b.second);
+}
+
+// The topVias most used vias, instead of all of them by name.
+static void printTopVias(const defiStats& stats) {
+  std::vector<std::pair<long long, int> > vias;
+  int i;
+
+  for (i = 0; i < stats.numVias(); i++)
+    vias.push_back(std::make_pair(stats.viaCount(i), i));
+  std::sort(vias.begin(), vias.end(), moreUsed);
+  for (i = 0; i < (int) vias.size() && i < topVias; i++)
+    printf("via %-18s %lld\n", stats.via(vias[i].second), vias[i].first);
+  if ((int) vias.size() > topVias)
+    printf("(%d more vias)\n", (int) vias.size() - topVias);
+}
+
+static int scanFile(const char* fileName) {
+  defiStats   stats;
+  size_t      len = strlen(fileName);
+  FILE*       f;
+  defGZFile   gz = 0;
+  double      start;
+  double      seconds;
+  int         status;
+  int         numErrors = 0;
+  int         numWarnings = 0;
+
+  if (len > 3 && strcmp(fileName + len - 3, ".gz") == 0) {
+    gz = defGZipOpen(fileName, "r");
+    f = (FILE*) gz;
+  } else {
+    f = fopen(fileName, "r");
+  }
+  if (f == 0) {
+    fprintf(stderr, "ERROR: could not open input file '%s'\n", fileName);
+    return 2;
+  }
+
+  start = defiProfile::clock();
+  if (validate)
+    status = defrValidate(f, fileName, 1, &numErrors, &numWarnings);
+  else
+    status = defrScanStats(f, &stats);
+  seconds = defiProfile::clock() - start;
+  if (gz)
+    defGZipClose(gz);
+  else
+    fclose(f);
+
+  if (validate) {
+    printf("file %s errors %d warnings %d parse %.3f s\n", fileName,
+           numErrors, numWarnings, seconds);
+    return (numErrors > 0 || status) ? 1 : 0;
+  }
+  printf("file %s\n", fileName);
+  stats.print(stdout, !topVias);
+  if (topVias)
+    printTopVias(stats);
+  printf("scan %.3f s", seconds);
+  if (seconds > 0)
+    printf(" %.1f MB/s", stats.bytes() / seconds / 1e6);
+  printf("\n");
+  if (status)
+    fprintf(stderr, "WARNING: '%s' ends inside a section\n", fileName);
+  return status;
+}
+
+static void usage() {
+  fprintf(stderr, "Usage: defstat [-top n | -validate] <filename>[.gz] ...\n");
+}
+
+int main(int argc, char** argv) {
+  int status = 0;
+  int numFiles = 0;
+  int i;
+
+  defrInit();
+  for (i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-top") == 0 && i + 1 < argc) {
+      topVias = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "-validate") == 0) {
+      validate = 1;
+    } else if (argv[i][0] == '-') {
+      fprintf(stderr, "ERROR: Illegal command line option: '%s'\n", argv[i]);
+      usage();
+      return 2;
+    } else {
+      status |= scanFile(argv[i]);
+      numFiles++;
+    }
+  }
+  if (!numFiles) {
+    usage();
+    return 2;
+  }
+  defrClear();
+  return status;
+}
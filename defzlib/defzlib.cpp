@@ -36,12 +36,223 @@
 #include "zlib.h"
 #include "defzlib.hpp"
 #include "defrReader.hpp"
+#include "defwWriter.hpp"
+#ifndef WIN32
+#include <pthread.h>
+#endif
 
 /*
  * Private functions:
  */
 size_t defGZip_read(FILE* file, char* buf, size_t len) {
-  return (gzread((gzFile)file, buf, len));
+  double traceStart;
+  int    nb;
+
+  if (!defiTraceOn)
+    return (gzread((gzFile)file, buf, len));
+  traceStart = defiProfile::clock();
+  nb = gzread((gzFile)file, buf, len);
+  defiTraceSpan("gzip", "inflate", traceStart, "bytes", nb);
+  return (nb);
+}
+
+/* Compressed bytes consumed, for the progress function. */
+long long defGZip_position(FILE* file) {
+  return (gzoffset((gzFile)file));
+}
+
+/*
+ * Writer side.  A defwGZipStream is either a gzFile written by zlib, or
+ * a ring of blocks compressed by worker threads into separate gzip
+ * members that are written to the file in order.
+ */
+enum {
+  DEFW_GZ_IDLE,          /* being filled by the writer */
+  DEFW_GZ_QUEUED,        /* waiting for its worker */
+  DEFW_GZ_DONE           /* compressed, waiting to be written */
+};
+
+struct defwGZipStream;
+
+struct defwGZipBlock {
+  defwGZipStream* stream;
+  char*           in;
+  size_t          inLen;
+  unsigned char*  out;
+  size_t          outLen;
+  size_t          outAlloc;
+  int             state;
+#ifndef WIN32
+  pthread_t       thread;
+#endif
+};
+
+struct defwGZipStream {
+  gzFile          gz;
+  FILE*           file;
+  int             level;
+  size_t          blockSize;
+  int             numBlocks;   /* blocks in the ring */
+  int             numAlloc;    /* blocks allocated */
+  int             numThreads;  /* worker threads started */
+  int             current;     /* block being filled */
+  int             numMembers;  /* members written */
+  int             error;
+  int             threaded;
+  int             quit;
+  defwGZipBlock*  blocks;
+#ifndef WIN32
+  int             hasLock;     /* lock and cond are initialized */
+  pthread_mutex_t lock;
+  pthread_cond_t  cond;
+#endif
+};
+
+static void defwGZip_compress(defwGZipBlock* b) {
+  z_stream zs;
+  size_t   bound;
+  double   traceStart = defiTraceOn ? defiProfile::clock() : 0;
+
+  memset(&zs, 0, sizeof(zs));
+  b->outLen = 0;
+  /* 15 + 16: gzip header and trailer */
+  if (deflateInit2(&zs, b->stream->level, Z_DEFLATED, 15 + 16, 8,
+                   Z_DEFAULT_STRATEGY) != Z_OK)
+    return;
+  bound = deflateBound(&zs, (uLong)b->inLen) + 64;
+  if (bound > b->outAlloc) {
+    free(b->out);
+    b->out = (unsigned char*)malloc(bound);
+    b->outAlloc = b->out ? bound : 0;
+  }
+  if (b->out) {
+    zs.next_in = (Bytef*)b->in;
+    zs.avail_in = (uInt)b->inLen;
+    zs.next_out = b->out;
+    zs.avail_out = (uInt)b->outAlloc;
+    if (deflate(&zs, Z_FINISH) == Z_STREAM_END)
+      b->outLen = b->outAlloc - zs.avail_out;
+  }
+  deflateEnd(&zs);
+  if (defiTraceOn)
+    defiTraceSpan("gzip", "compress", traceStart, "bytes", (long long)b->inLen);
+}
+
+#ifndef WIN32
+static void* defwGZip_worker(void* arg) {
+  defwGZipBlock*  b = (defwGZipBlock*)arg;
+  defwGZipStream* s = b->stream;
+
+  pthread_mutex_lock(&s->lock);
+  for (;;) {
+    while (b->state != DEFW_GZ_QUEUED && !s->quit)
+      pthread_cond_wait(&s->cond, &s->lock);
+    if (b->state != DEFW_GZ_QUEUED)
+      break;
+    pthread_mutex_unlock(&s->lock);
+    defwGZip_compress(b);
+    pthread_mutex_lock(&s->lock);
+    b->state = DEFW_GZ_DONE;
+    pthread_cond_broadcast(&s->cond);
+  }
+  pthread_mutex_unlock(&s->lock);
+  return 0;
+}
+#endif
+
+static void defwGZip_submit(defwGZipStream* s, defwGZipBlock* b) {
+#ifndef WIN32
+  if (s->threaded) {
+    pthread_mutex_lock(&s->lock);
+    b->state = DEFW_GZ_QUEUED;
+    pthread_cond_broadcast(&s->cond);
+    pthread_mutex_unlock(&s->lock);
+    return;
+  }
+#endif
+  defwGZip_compress(b);
+  b->state = DEFW_GZ_DONE;
+}
+
+/* Waits for a submitted block and writes its member. */
+static void defwGZip_retire(defwGZipStream* s, defwGZipBlock* b) {
+  if (b->state == DEFW_GZ_IDLE)
+    return;
+#ifndef WIN32
+  if (s->threaded) {
+    double traceStart = defiTraceOn ? defiProfile::clock() : 0;
+
+    pthread_mutex_lock(&s->lock);
+    while (b->state != DEFW_GZ_DONE)
+      pthread_cond_wait(&s->cond, &s->lock);
+    pthread_mutex_unlock(&s->lock);
+    if (defiTraceOn)
+      defiTraceSpan("gzip", "wait", traceStart);
+  }
+#endif
+  if (!b->outLen || fwrite(b->out, 1, b->outLen, s->file) != b->outLen)
+    s->error = 1;
+  s->numMembers++;
+  b->inLen = 0;
+  b->state = DEFW_GZ_IDLE;
+}
+
+size_t defwGZip_write(FILE* file, const char* data, size_t len) {
+  defwGZipStream* s = (defwGZipStream*)file;
+  size_t          done = 0;
+
+  if (s->gz) {
+    while (done < len) {
+      unsigned n = (len - done > INT_MAX) ? INT_MAX : (unsigned)(len - done);
+      int      w = gzwrite(s->gz, data + done, n);
+      if (w <= 0)
+        break;
+      done += w;
+    }
+    return done;
+  }
+
+  while (done < len) {
+    defwGZipBlock* b = s->blocks + s->current;
+    size_t         n = s->blockSize - b->inLen;
+
+    if (n > len - done)
+      n = len - done;
+    memcpy(b->in + b->inLen, data + done, n);
+    b->inLen += n;
+    done += n;
+    if (b->inLen == s->blockSize) {
+      defwGZip_submit(s, b);
+      s->current = (s->current + 1) % s->numBlocks;
+      defwGZip_retire(s, s->blocks + s->current);
+    }
+  }
+  return done;
+}
+
+static void defwGZip_free(defwGZipStream* s) {
+  int i;
+
+#ifndef WIN32
+  if (s->numThreads) {
+    pthread_mutex_lock(&s->lock);
+    s->quit = 1;
+    pthread_cond_broadcast(&s->cond);
+    pthread_mutex_unlock(&s->lock);
+    for (i = 0; i < s->numThreads; i++)
+      pthread_join(s->blocks[i].thread, 0);
+  }
+  if (s->hasLock) {
+    pthread_mutex_destroy(&s->lock);
+    pthread_cond_destroy(&s->cond);
+  }
+#endif
+  for (i = 0; i < s->numAlloc; i++) {
+    free(s->blocks[i].in);
+    free(s->blocks[i].out);
+  }
+  free(s->blocks);
+  free(s);
 }
 
 /*
@@ -55,9 +266,14 @@ defGZipOpen(const char *gzipPath, const char* mode) {
 
   defGZFile fptr  = gzopen(gzipPath, mode);
   if (fptr) {
+    struct stat st;
+
     /* successfully open the gzip file */
     /* set the read function to read from a compressed file */
     defrSetReadFunction(defGZip_read);
+    /* progress is reported in bytes of the compressed file */
+    defrSetInputPositionFunction(defGZip_position);
+    defrSetInputSize(stat(gzipPath, &st) == 0 ? (long long)st.st_size : -1);
     return (defGZFile)fptr;
   } else
     return NULL;
@@ -65,9 +281,125 @@ defGZipOpen(const char *gzipPath, const char* mode) {
 
 int defGZipClose(defGZFile filePtr) {
   defrUnsetReadFunction();
+  defrUnsetInputPositionFunction();
+  defrSetInputSize(-1);
   return (gzclose((gzFile)filePtr));
 }
 
 int defrReadGZip(defGZFile file, const char* gzipFile, defiUserData uData) {
   return defrRead((FILE*)file, gzipFile, uData, 1);
 }
+
+defwGZFile
+defwGZipOpen(const char *gzipPath, const char* mode) {
+  defwGZipStream* s;
+
+  if (!gzipPath)
+    return NULL;
+
+  s = (defwGZipStream*)calloc(1, sizeof(defwGZipStream));
+  if (!s)
+    return NULL;
+  s->gz = gzopen(gzipPath, mode ? mode : "wb");
+  if (!s->gz) {
+    free(s);
+    return NULL;
+  }
+  /* set the write function to write to a compressed file */
+  defwSetWriteFunction(defwGZip_write);
+  return (defwGZFile)s;
+}
+
+defwGZFile
+defwGZipOpenParallel(const char *gzipPath, int level, int numThreads,
+                     size_t blockSize) {
+  defwGZipStream* s;
+  int             i;
+
+  if (!gzipPath)
+    return NULL;
+  if (numThreads < 1)
+    numThreads = 1;
+  if (blockSize < 65536)
+    blockSize = 65536;
+  if (blockSize > INT_MAX)
+    blockSize = INT_MAX;
+
+  s = (defwGZipStream*)calloc(1, sizeof(defwGZipStream));
+  if (!s)
+    return NULL;
+  s->level = level;
+  s->blockSize = blockSize;
+  s->numBlocks = numThreads;
+  s->blocks = (defwGZipBlock*)calloc(numThreads, sizeof(defwGZipBlock));
+  if (!s->blocks) {
+    free(s);
+    return NULL;
+  }
+  s->numAlloc = numThreads;
+  for (i = 0; i < numThreads; i++) {
+    s->blocks[i].stream = s;
+    s->blocks[i].in = (char*)malloc(blockSize);
+    if (!s->blocks[i].in) {
+      defwGZip_free(s);
+      return NULL;
+    }
+  }
+  s->file = fopen(gzipPath, "wb");
+  if (!s->file) {
+    defwGZip_free(s);
+    return NULL;
+  }
+#ifndef WIN32
+  if (numThreads > 1) {
+    pthread_mutex_init(&s->lock, 0);
+    pthread_cond_init(&s->cond, 0);
+    s->hasLock = 1;
+    s->threaded = 1;
+    for (i = 0; i < numThreads; i++) {
+      if (pthread_create(&s->blocks[i].thread, 0, defwGZip_worker,
+                         s->blocks + i)) {
+        /* Use only the blocks that have a thread, or compress the one
+         * block in the writer thread.  All numAlloc blocks are freed. */
+        s->numBlocks = i ? i : 1;
+        s->threaded = i > 0;
+        break;
+      }
+      s->numThreads++;
+    }
+  }
+#endif
+  /* set the write function to write to a compressed file */
+  defwSetWriteFunction(defwGZip_write);
+  return (defwGZFile)s;
+}
+
+int defwGZipClose(defwGZFile filePtr) {
+  defwGZipStream* s = (defwGZipStream*)filePtr;
+  int             status;
+  int             i;
+
+  if (!s)
+    return -1;
+  defwFlush();
+  defwUnsetWriteFunction();
+
+  if (s->gz) {
+    status = gzclose(s->gz);
+    free(s);
+    return status;
+  }
+
+  /* The block being filled is the newest, the one after it the oldest.
+   * An empty output still gets one (empty) member. */
+  if (s->blocks[s->current].inLen || !s->numMembers)
+    defwGZip_submit(s, s->blocks + s->current);
+  for (i = 1; i <= s->numBlocks; i++)
+    defwGZip_retire(s, s->blocks + (s->current + i) % s->numBlocks);
+
+  status = s->error;
+  if (fclose(s->file))
+    status = 1;
+  defwGZip_free(s);
+  return status;
+}
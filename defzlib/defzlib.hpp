@@ -30,6 +30,8 @@
 #ifndef LEFDEFZIP_H
 #define LEFDEFZIP_H
 
+#include <stddef.h>
+
 typedef void* defGZFile;
 
 /* 
@@ -53,4 +55,37 @@ extern int defGZipClose(defGZFile filePtr);
  */
 extern int defrReadGZip(defGZFile file, const char* gzipFile, void* uData);
 
+typedef void* defwGZFile;
+
+/*
+ * Name: defwGZipOpen
+ * Description: Open a gzip file for the writer and make it the output
+ *              sink of the current writer context.  Pass the returned
+ *              pointer as the FILE* of defwInit or defwInitCbk.  The mode
+ *              is the gzopen mode, e.g. "wb" or "wb9".
+ * Returns: A file pointer
+ */
+extern defwGZFile defwGZipOpen(const char* gzipFile, const char* mode);
+
+/*
+ * Name: defwGZipOpenParallel
+ * Description: Same as defwGZipOpen, but the output is cut in blocks of
+ *              blockSize bytes that numThreads threads compress as
+ *              independent gzip members, written in order.  The file is
+ *              a normal multi member gzip file.  level is the zlib
+ *              compression level, -1 for the default.
+ * Returns: A file pointer
+ */
+extern defwGZFile defwGZipOpenParallel(const char* gzipFile, int level,
+                                       int numThreads, size_t blockSize);
+
+/*
+ * Name: defwGZipClose
+ * Description: Flush the writer, finish and close a gzip file opened by
+ *              defwGZipOpen or defwGZipOpenParallel.  Call it after
+ *              defwEnd.
+ * Returns: 0 if no errors
+ */
+extern int defwGZipClose(defwGZFile filePtr);
+
 #endif
@@ -0,0 +1,121 @@
+// *****************************************************************************
+// *****************************************************************************
+// Copyright 2013-2014, Cadence Design Systems
+// 
+// This  file  is  part  of  the  Cadence  LEF/DEF  Open   Source
+// Distribution,  Product Version 5.8. 
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+//    implied. See the License for the specific language governing
+//    permissions and limitations under the License.
+// 
+// For updates, support, or to become part of the LEF/DEF Community,
+// check www.openeda.org for details.
+// 
+//  $Author$
+//  $Revision$
+//  $Date$
+//  $State:  $
+// *****************************************************************************
+// *****************************************************************************
+
+#ifndef defiAlloc_h
+#define defiAlloc_h
+
+#include <stdio.h>
+#include <stddef.h>
+#include "defiKRDefs.hpp"
+
+BEGIN_LEFDEF_PARSER_NAMESPACE
+
+// Types of the memory the reader allocates, by the part of the reader
+// allocating it.
+typedef enum {
+  defiAllocParser = 0,     // lexer, grammar and reader state
+  defiAllocAlias,          // &alias entries
+  defiAllocAssertion,
+  defiAllocBlockage,
+  defiAllocComponent,
+  defiAllocFill,
+  defiAllocFPC,
+  defiAllocGroup,
+  defiAllocIOTiming,
+  defiAllocMisc,           // geometries, styles and points
+  defiAllocNet,            // nets, wires, subnets, shields, rects, polygons
+  defiAllocNonDefault,
+  defiAllocPartition,
+  defiAllocPath,
+  defiAllocPin,            // pins, pin antenna data and pin caps
+  defiAllocPinProp,
+  defiAllocProp,           // properties and property definitions
+  defiAllocRegion,
+  defiAllocRowTrack,       // rows, tracks and gcell grids
+  defiAllocScanchain,
+  defiAllocSite,
+  defiAllocSlot,
+  defiAllocTimingDisable,
+  defiAllocVia,
+  defiNumAllocTypes
+} defiAllocType_e;
+
+// Allocation accounting, kept while defrSetAllocAccounting() is on.
+// Every defMalloc() block is recorded with its size and type until it
+// is freed; blocks allocated before accounting was turned on are not
+// counted.  The counters of type defiNumAllocTypes are the totals.
+// The blocks are kept in a hash table on their address, which costs
+// 24 to 48 bytes per live block in one array and nothing in the
+// blocks themselves, as defFree() also frees blocks allocated before
+// accounting was on.
+class defiAllocBlocks;
+
+class defiAllocStats {
+public:
+  defiAllocStats();
+  ~defiAllocStats();
+
+  void clear();
+
+  long long current(int type = defiNumAllocTypes) const;  // bytes held
+  long long peak(int type = defiNumAllocTypes) const;     // most held
+  long long count(int type = defiNumAllocTypes) const;    // blocks held
+  long long allocs(int type = defiNumAllocTypes) const;   // allocations
+  long long total(int type = defiNumAllocTypes) const;    // bytes allocated
+
+  static const char* typeName(int type);
+
+  void print(FILE* f) const;
+
+  // Used by the parser.
+  void allocated(const void* p, size_t size, int type);
+  void freed(const void* p);
+  void resized(const void* old, const void* p, size_t size, int type);
+  void aliasSet(size_t oldSize, size_t newSize);
+
+protected:
+  void add(int type, long long size, int blocks);
+
+  defiAllocBlocks* blocks_;       // the live blocks
+  long long current_[defiNumAllocTypes + 1];
+  long long peak_[defiNumAllocTypes + 1];
+  long long count_[defiNumAllocTypes + 1];
+  long long allocs_[defiNumAllocTypes + 1];
+  long long total_[defiNumAllocTypes + 1];
+
+private:
+  defiAllocStats(const defiAllocStats&);
+  defiAllocStats& operator=(const defiAllocStats&);
+};
+
+END_LEFDEF_PARSER_NAMESPACE
+
+USE_LEFDEF_PARSER_NAMESPACE
+
+#endif